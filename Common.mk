@@ -101,8 +101,13 @@ SIMPLEGLOB_H = $(BUILD_INC_DIR)/SimpleGlob.h
 
 SRC_DIR = src
 BUILD_BASE_DIR = builds/$(TARGET_PLATFORM)/$(LUAVM)/$(GRADE)
-BUILD_BIN_DIR = $(BUILD_BASE_DIR)/bin
-BUILD_OBJ_DIR = $(BUILD_BASE_DIR)/obj
+ifdef NULL_GL
+  BUILD_BIN_DIR = $(BUILD_BASE_DIR)/bin-nullgl
+  BUILD_OBJ_DIR = $(BUILD_BASE_DIR)/obj-nullgl
+else
+  BUILD_BIN_DIR = $(BUILD_BASE_DIR)/bin
+  BUILD_OBJ_DIR = $(BUILD_BASE_DIR)/obj
+endif
 BUILD_LIB_DIR = $(BUILD_BASE_DIR)/lib
 BUILD_INC_DIR = $(BUILD_BASE_DIR)/include
 
@@ -133,6 +138,7 @@ ifdef STRICT
   XCFLAGS += -Wall -Werror
 endif
 NO_STRICT_ALIAS_OPT = -fno-strict-aliasing
+PRECISE_FP_OPT = -fno-fast-math
 XLDFLAGS = -ldl -lm -lrt -pthread
 LUA_CFLAGS = -DLUA_COMPAT_ALL
 LUAJIT_FLAGS =
@@ -326,6 +332,7 @@ else ifeq ($(TARGET_PLATFORM),html)
   endif
 else ifeq ($(TARGET_PLATFORM),msvc32)
   NO_STRICT_ALIAS_OPT = 
+  PRECISE_FP_OPT = 
   VC_CL = cl.exe
   VC_CL_PATH = $(shell which $(VC_CL))
   VC_CL_DIR = $(shell dirname "$(VC_CL_PATH)")
@@ -356,6 +363,7 @@ else ifeq ($(TARGET_PLATFORM),msvc32)
   ANGLE_WIN_PREBUILT_DIR = $(THIRD_PARTY_DIR)/angle-win-prebuilt/32
 else ifeq ($(TARGET_PLATFORM),msvc64)
   NO_STRICT_ALIAS_OPT = 
+  PRECISE_FP_OPT = 
   VC_CL = cl.exe
   VC_CL_PATH = $(shell which $(VC_CL))
   VC_CL_DIR = $(shell dirname "$(VC_CL_PATH)")
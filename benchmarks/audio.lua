@@ -0,0 +1,43 @@
+-- Reports how many samples per second each kind of audio node can
+-- render, for each set of audio kernels supported by this CPU.
+
+local seconds = 600 -- of audio rendered per test
+local samples = 44100 * seconds
+
+local channels = 2
+local buffer_samples = 44100
+local view = am.buffer(buffer_samples * channels * 4):view("float")
+for i = 1, buffer_samples * channels do
+    view[i] = math.sin(i * 0.05) * 0.5
+end
+local audio_buffer = am.audio_buffer(view.buffer, channels, 44100)
+
+local
+function track(speed)
+    return am.track(audio_buffer, true, speed or 1)
+end
+
+local tests = {
+    {"track", function() return track() end},
+    {"track (resampled)", function() return track(1.3) end},
+    {"gain", function() return track():gain(0.5) end},
+    {"lowpass_filter", function() return track():lowpass_filter(1000, 1) end},
+    {"highpass_filter", function() return track():highpass_filter(1000, 1) end},
+    {"mix (16 tracks)", function()
+        local mix = am.audio_node()
+        for i = 1, 16 do
+            mix:add(track())
+        end
+        return mix
+    end},
+}
+
+for _, kernels in ipairs(am._audio_kernels()) do
+    am._set_audio_kernels(kernels)
+    print(kernels)
+    for _, test in ipairs(tests) do
+        local name, create = test[1], test[2]
+        local t = am._render_audio_offline(create(), samples)
+        print(string.format("  %-20s %8.1f Msamples/s", name, samples / t / 1000000))
+    end
+end
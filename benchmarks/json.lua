@@ -0,0 +1,92 @@
+-- Parses a generated level file (about 30MB of pretty printed JSON)
+-- with each of the json parsing functions, in MB per second.
+
+math.randomseed(1)
+local entities = {}
+for i = 1, 40000 do
+    entities[i] = {
+        id = i,
+        name = "entity_" .. i,
+        position = {math.random() * 1000, math.random() * 1000, math.random() * 100},
+        rotation = {math.random(), math.random(), math.random(), math.random()},
+        tags = {"solid", i % 3 == 0 and "enemy" or "prop", "note: \"quoted\"\n"},
+        health = math.random(1, 100),
+        active = i % 2 == 0,
+        props = {color = {r = 0.5, g = 0.25, b = 1}, sound = "sfx/hit_" .. (i % 10) .. ".ogg"},
+    }
+end
+-- indent the output like an editor would
+local compact = am.to_json({version = 3, entities = entities})
+local indented = {}
+local depth = 0
+local in_string = false
+local i = 1
+local n = #compact
+while i <= n do
+    local c = compact:sub(i, i)
+    if in_string then
+        if c == "\\" then
+            table.insert(indented, compact:sub(i, i + 1))
+            i = i + 1
+        else
+            if c == '"' then in_string = false end
+            table.insert(indented, c)
+        end
+    elseif c == '"' then
+        in_string = true
+        table.insert(indented, c)
+    elseif c == "{" or c == "[" then
+        depth = depth + 1
+        table.insert(indented, c .. "\n" .. string.rep("    ", depth))
+    elseif c == "}" or c == "]" then
+        depth = depth - 1
+        table.insert(indented, "\n" .. string.rep("    ", depth) .. c)
+    elseif c == "," then
+        table.insert(indented, ",\n" .. string.rep("    ", depth))
+    elseif c == ":" then
+        table.insert(indented, ": ")
+    else
+        table.insert(indented, c)
+    end
+    i = i + 1
+end
+local str = table.concat(indented)
+local buf = am.buffer(#str)
+local bytes = buf:view("ubyte")
+for j = 1, #str, 4096 do
+    bytes:set({str:byte(j, j + 4095)}, j)
+end
+local mb = #str / (1024 * 1024)
+
+local function time(f)
+    collectgarbage()
+    collectgarbage()
+    local t0 = am.current_time()
+    local result = f()
+    return am.current_time() - t0, result
+end
+
+local benchmarks = {
+    {"parse_json (string)", function() return am.parse_json(str) end},
+    {"parse_json (buffer)", function() return am.parse_json(buf) end},
+    {"parse_json_lazy", function() return am.parse_json_lazy(buf) end},
+    {"lazy + 100 lookups", function()
+        local doc = am.parse_json_lazy(buf)
+        local sum = 0
+        for i = 1, 100 do
+            sum = sum + doc.entities[i * 400].health
+        end
+        return doc
+    end},
+    {"parse_json_events", function()
+        local values = 0
+        am.parse_json_events(buf, {value = function(v) values = values + 1 end})
+        return values
+    end},
+}
+
+print(string.format("%.1f MB", mb))
+for _, bm in ipairs(benchmarks) do
+    local t = time(bm[2])
+    print(string.format("%-22s %8.1f MB/s", bm[1], mb / t))
+end
@@ -0,0 +1,96 @@
+-- Measures the throughput of the mathv functions on large views, in
+-- elements per second, with each set of vectorized kernels the CPU
+-- supports and with the scalar loops. The last column uses the fastest
+-- kernels on all the mathv threads, the others use a single thread.
+
+local n = 1000000
+local min_time = 0.25
+
+local function random_view(type, comps, lo, hi)
+    local view = am.buffer(n * comps * (type == "double" and 8 or 4)):view(
+        comps == 1 and type or (type == "double" and "dvec" or "vec")..comps)
+    local flat = view.buffer:view(type)
+    for i = 1, n * comps do
+        flat[i] = lo + math.random() * (hi - lo)
+    end
+    return view
+end
+
+local x = {float = random_view("float", 1, -100, 100), double = random_view("double", 1, -100, 100)}
+local y = {float = random_view("float", 1, -100, 100), double = random_view("double", 1, -100, 100)}
+local t = {float = random_view("float", 1, 0, 1), double = random_view("double", 1, 0, 1)}
+local p = {float = random_view("float", 1, 0.01, 10), double = random_view("double", 1, 0.01, 10)}
+local v2 = {float = random_view("float", 2, -10, 10), double = random_view("double", 2, -10, 10)}
+local v3 = {float = random_view("float", 3, -10, 10), double = random_view("double", 3, -10, 10)}
+local w3 = {float = random_view("float", 3, -10, 10), double = random_view("double", 3, -10, 10)}
+local v4 = {float = random_view("float", 4, -10, 10), double = random_view("double", 4, -10, 10)}
+
+-- results are written into existing views, so allocating the output
+-- isn't included in the times
+local out1 = {float = random_view("float", 1, 0, 0), double = random_view("double", 1, 0, 0)}
+local out3 = {float = random_view("float", 3, 0, 0), double = random_view("double", 3, 0, 0)}
+local out4 = {float = random_view("float", 4, 0, 0), double = random_view("double", 4, 0, 0)}
+local bools = am.buffer(n):view("ubyte")
+
+local benchmarks = {
+    {"add",          function(ty) out1[ty]:add(x[ty], y[ty]) end},
+    {"add scalar",   function(ty) out1[ty]:add(x[ty], 2) end},
+    {"mul",          function(ty) out1[ty]:vec_mul(x[ty], y[ty]) end},
+    {"div",          function(ty) out1[ty]:div(x[ty], y[ty]) end},
+    {"mod",          function(ty) out1[ty]:mod(x[ty], y[ty]) end},
+    {"pow",          function(ty) out1[ty]:pow(p[ty], t[ty]) end},
+    {"floor",        function(ty) out1[ty]:floor(x[ty]) end},
+    {"clamp",        function(ty) out1[ty]:clamp(x[ty], -50, 50) end},
+    {"mix",          function(ty) out1[ty]:mix(x[ty], y[ty], t[ty]) end},
+    {"sin",          function(ty) out1[ty]:sin(x[ty]) end},
+    {"cos",          function(ty) out1[ty]:cos(x[ty]) end},
+    {"log",          function(ty) out1[ty]:log(p[ty]) end},
+    {"lt",           function(ty) bools:lt(x[ty], y[ty]) end},
+    {"dot vec3",     function(ty) out1[ty]:dot(v3[ty], w3[ty]) end},
+    {"length vec2",  function(ty) out1[ty]:length(v2[ty]) end},
+    {"normalize3",   function(ty) out3[ty]:normalize(v3[ty]) end},
+    {"normalize4",   function(ty) out4[ty]:normalize(v4[ty]) end},
+    {"cross",        function(ty) out3[ty]:cross(v3[ty], w3[ty]) end},
+}
+
+local function elements_per_sec(f, ty)
+    f(ty) -- warm up
+    local runs = 0
+    local t0 = am.current_time()
+    local elapsed
+    repeat
+        f(ty)
+        runs = runs + 1
+        elapsed = am.current_time() - t0
+    until elapsed >= min_time
+    return runs * n / elapsed
+end
+
+local kernels = mathv._supported_simd()
+local threads = mathv._threads()
+local header = string.format("%-14s %-7s", "function", "type")
+for _, k in ipairs(kernels) do
+    header = header..string.format(" %12s", k)
+end
+header = header..string.format(" %12s", threads.." threads")
+print(header.."   (million elements per second)")
+for _, b in ipairs(benchmarks) do
+    local name, f = b[1], b[2]
+    for _, ty in ipairs{"float", "double"} do
+        local line = string.format("%-14s %-7s", name, ty)
+        for _, k in ipairs(kernels) do
+            -- the vectorized kernels are only used for floats
+            if ty == "float" or k == "scalar" then
+                mathv._set_simd(k)
+                mathv._set_threads(1)
+                line = line..string.format(" %12.1f", elements_per_sec(f, ty) / 1e6)
+            else
+                line = line..string.format(" %12s", "")
+            end
+        end
+        mathv._set_simd(kernels[1])
+        mathv._set_threads(threads)
+        line = line..string.format(" %12.1f", elements_per_sec(f, ty) / 1e6)
+        print(line)
+    end
+end
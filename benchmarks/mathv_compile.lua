@@ -0,0 +1,60 @@
+-- Compares chains of mathv calls with the same expressions compiled
+-- with mathv.compile, in elements per second. Both write into existing
+-- views, but the chained calls allocate a view for each intermediate
+-- result.
+
+local n = 1000000
+local min_time = 0.25
+
+local function random_view(type, lo, hi)
+    local comps = ({float = 1, vec3 = 3, vec4 = 4, mat4 = 16})[type]
+    local buf = am.buffer(n * comps * 4)
+    local flat = buf:view("float")
+    for i = 1, n * comps do
+        flat[i] = lo + math.random() * (hi - lo)
+    end
+    return buf:view(type)
+end
+
+local a = random_view("vec3", -10, 10)
+local b = random_view("vec3", -10, 10)
+local s = random_view("float", 0, 1)
+local t = random_view("float", 0, 1)
+local m = random_view("mat4", -1, 1)
+local out3 = random_view("vec3", 0, 0)
+local out4 = random_view("vec4", 0, 0)
+
+local blend = mathv.compile("vec3 a, float s, vec3 b, float t", "a * s + b * t")
+local wave = mathv.compile("vec3 a, float t", "a + normalize(a) * sin(length(a) * 4 + t) * 0.1")
+local transform = mathv.compile("mat4 m, vec3 a", "m * vec4(a, 1)")
+
+local benchmarks = {
+    {"blend",
+        function() out3:add(a * s, b * t) end,
+        function() blend(out3, a, s, b, t) end},
+    {"wave",
+        function() out3:add(a, mathv.normalize(a) * mathv.sin(mathv.length(a) * 4 + 0.5) * 0.1) end,
+        function() wave(out3, a, 0.5) end},
+    {"transform",
+        function() out4:mat_mul(m, mathv.vec4(a, 1)) end,
+        function() transform(out4, m, a) end},
+}
+
+local function elements_per_sec(f)
+    f() -- warm up
+    local runs = 0
+    local t0 = am.current_time()
+    local elapsed
+    repeat
+        f()
+        runs = runs + 1
+        elapsed = am.current_time() - t0
+    until elapsed >= min_time
+    return runs * n / elapsed
+end
+
+print(string.format("%-12s %12s %12s   (million elements per second)", "expression", "chained", "compiled"))
+for _, bm in ipairs(benchmarks) do
+    print(string.format("%-12s %12.1f %12.1f", bm[1],
+        elements_per_sec(bm[2]) / 1e6, elements_per_sec(bm[3]) / 1e6))
+end
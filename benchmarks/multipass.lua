@@ -0,0 +1,52 @@
+-- Renders a scene with four passes (as in a deferred lighting setup)
+-- and reports the average frame time, first traversing the scene once
+-- per pass and then once for all passes (am.set_single_traversal).
+-- Build with NULL_GL=1 to run it without a GPU or display.
+
+local num_objects = 2000
+local num_frames = 200
+
+local win = am.window{width = 640, height = 480, title = "multipass benchmark"}
+
+local function object()
+    local x = math.random() * 640 - 320
+    local y = math.random() * 480 - 240
+    local rect = am.rect(-4, -4, 4, 4, vec4(math.random(), math.random(), math.random(), 1))
+    -- geometry pass, then one of two light passes, then a shared overlay pass
+    return am.translate(x, y) ^ am.rotate(math.random() * math.pi) ^ am.scale(1) ^ am.group{
+        am.pass(1) ^ rect,
+        am.pass(math.random(2, 3)) ^ rect,
+        am.pass(4) ^ rect,
+    }
+end
+
+win.scene = am.group()
+for i = 1, num_objects do
+    win.scene:append(object())
+end
+
+local modes = {false, true}
+local mode = 1
+local frame = 0
+local t0
+win.scene:action(function()
+    frame = frame + 1
+    if frame == 1 then
+        am.set_single_traversal(modes[mode])
+        return
+    elseif frame == 2 then
+        t0 = am.current_time()
+        return
+    end
+    if frame > num_frames + 2 then
+        local t = am.current_time() - t0
+        print(string.format("%-18s %0.3fms per frame",
+            modes[mode] and "single traversal" or "traversal per pass",
+            t / num_frames * 1000))
+        frame = 0
+        mode = mode + 1
+        if mode > #modes then
+            win:close()
+        end
+    end
+end)
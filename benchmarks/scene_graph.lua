@@ -0,0 +1,45 @@
+-- Renders a scene with many nodes for a fixed number of frames and
+-- reports the average frame time. Build with NULL_GL=1 to run it
+-- without a GPU or display and also get the graphics call counts.
+
+local num_sprites = 2000
+local num_frames = 300
+
+local win = am.window{width = 640, height = 480, title = "scene graph benchmark"}
+win.scene = am.group()
+for i = 1, num_sprites do
+    local x = math.random() * 640 - 320
+    local y = math.random() * 480 - 240
+    win.scene:append(am.translate(x, y) ^ am.rotate(math.random() * math.pi)
+        ^ am.rect(-4, -4, 4, 4, vec4(math.random(), math.random(), math.random(), 1)))
+end
+
+local frame = 0
+local t0
+win.scene:action(function()
+    frame = frame + 1
+    if frame == 1 then
+        t0 = am.current_time()
+        if am.reset_null_gl_stats then
+            am.reset_null_gl_stats()
+        end
+        return
+    end
+    for _, node in win.scene:child_pairs() do
+        node.position2d = node.position2d + vec2(0.1)
+    end
+    if frame > num_frames then
+        local t = am.current_time() - t0
+        print(string.format("%d frames, %d nodes: %0.3fms per frame",
+            num_frames, num_sprites, t / num_frames * 1000))
+        if am.null_gl_stats then
+            local stats = am.null_gl_stats()
+            for _, field in ipairs{"draw_calls", "vertices", "state_changes", "program_binds",
+                "buffer_upload_bytes", "texture_upload_bytes"}
+            do
+                print(string.format("%-22s %0.1f per frame", field, stats[field] / stats.frames))
+            end
+        end
+        win:close()
+    end
+end)
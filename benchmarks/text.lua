@@ -0,0 +1,41 @@
+-- A HUD of text labels whose text changes every frame, reporting the
+-- average frame time. Also times creating new labels.
+-- Build with NULL_GL=1 to run it without a GPU or display.
+
+local num_labels = 500
+local num_frames = 200
+
+local win = am.window{width = 640, height = 480, title = "text benchmark"}
+
+local labels = {}
+local hud = am.group()
+for i = 1, num_labels do
+    local x = (i % 20) * 32 - 320
+    local y = math.floor(i / 20) * 16 - 240
+    labels[i] = am.text("Score: 0", "left")
+    hud:append(am.translate(x, y) ^ labels[i])
+end
+win.scene = hud
+
+local t = am.current_time()
+for i = 1, num_labels * 10 do
+    am.text("Label "..i)
+end
+print(string.format("am.text:    %0.2fus per label", (am.current_time() - t) / (num_labels * 10) * 1e6))
+
+local frame = 0
+local t0
+win.scene:action(function()
+    frame = frame + 1
+    if frame == 1 then
+        t0 = am.current_time()
+    end
+    for i = 1, num_labels do
+        labels[i].text = "Score: "..((frame * 7 + i) % 1000)
+    end
+    if frame > num_frames then
+        local dt = am.current_time() - t0
+        print(string.format("set_text:   %0.3fms per frame (%d labels)", dt / num_frames * 1000, num_labels))
+        win:close()
+    end
+end)
@@ -0,0 +1,78 @@
+-- Draws many static meshes, each with its own position, normal and
+-- color buffers, and reports the average frame time along with how
+-- many of the draws had their attribute arrays bound from a cached
+-- vertex array object.
+-- Build with NULL_GL=1 to run it without a GPU or display (the GL call
+-- counts are only reported then).
+
+local num_meshes = 2000
+local num_frames = 200
+
+local win = am.window{width = 640, height = 480, title = "vertex arrays benchmark"}
+
+local prog = am.program([[
+    precision mediump float;
+    attribute vec3 vert;
+    attribute vec3 normal;
+    attribute vec4 color;
+    uniform mat4 MV;
+    uniform mat4 P;
+    varying vec4 v_color;
+    void main() {
+        v_color = color * (0.5 + 0.5 * abs(normal.z));
+        gl_Position = P * MV * vec4(vert, 1.0);
+    }
+]], [[
+    precision mediump float;
+    varying vec4 v_color;
+    void main() {
+        gl_FragColor = v_color;
+    }
+]])
+
+local function mesh()
+    local verts = am.vec3_array{vec3(-4, -4, 0), vec3(4, -4, 0), vec3(0, 4, 0)}
+    local normals = am.vec3_array{vec3(0, 0, 1), vec3(0, 0, 1), vec3(0, 0, 1)}
+    local c = vec4(math.random(), math.random(), math.random(), 1)
+    local colors = am.vec4_array{c, c, c}
+    local x = math.random() * 640 - 320
+    local y = math.random() * 480 - 240
+    return am.translate(x, y)
+        ^ am.bind{vert = verts, normal = normals, color = colors}
+        ^ am.draw"triangles"
+end
+
+local meshes = am.group()
+for i = 1, num_meshes do
+    meshes:append(mesh())
+end
+win.scene = am.use_program(prog) ^ meshes
+
+local frame = 0
+local t0
+local hits, misses, calls = 0, 0, 0
+win.scene:action(function()
+    frame = frame + 1
+    if frame == 1 then
+        return
+    elseif frame == 2 then
+        t0 = am.current_time()
+        return
+    end
+    local stats = am.perf_stats()
+    hits = hits + stats.frame_vertex_array_hits
+    misses = misses + stats.frame_vertex_array_misses
+    if am.null_gl_stats then
+        calls = calls + am.null_gl_stats("frame").calls
+    end
+    if frame > num_frames + 2 then
+        local t = am.current_time() - t0
+        print(string.format("%0.3fms per frame", t / num_frames * 1000))
+        print(string.format("vao hits per frame:   %0.1f", hits / num_frames))
+        print(string.format("vao misses per frame: %0.1f", misses / num_frames))
+        if am.null_gl_stats then
+            print(string.format("gl calls per mesh:    %0.2f", calls / num_frames / num_meshes))
+        end
+        win:close()
+    end
+end)
@@ -0,0 +1,4 @@
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG 1
+#define STBI_ONLY_JPEG 1
+#include "stb_image.h"
@@ -24,9 +24,51 @@ end
 
 local do_action = am.step_action
 
+local profiler_running = am._profiler_running
+local profile_begin = am._profile_begin
+local profile_end = am._profile_end
+
+-- The name of an action's profiler scope: its id if that's a string,
+-- otherwise where its function was defined.
+local
+function profile_name(action)
+    local name = action.profile_name
+    if not name then
+        local id = action.id
+        if type(id) == "string" then
+            name = id
+        elseif type(action.func) == "function" then
+            local info = debug.getinfo(action.func, "S")
+            name = "action "..info.short_src..":"..info.linedefined
+        else
+            name = "action (coroutine)"
+        end
+        action.profile_name = name
+    end
+    return name
+end
+
+-- Runs the action in profiled_action under xpcall, so that if it raises
+-- an error its profiler scope is closed before the error is re-raised.
+-- The traceback is built where the error happened and passed on the
+-- same way as errors in coroutine actions.
+local profiled_action
+
+local
+function run_profiled_action()
+    return do_action(profiled_action.func, profiled_action.node)
+end
+
+local
+function profiled_action_error(msg)
+    profile_end()
+    return "__coroutine__"..am._traceback(msg, nil, 3)
+end
+
 function am._execute_actions(actions, from, to)
     local t = am.frame_time
     local priority = 1
+    local profiling = profiler_running()
     repeat
         local next_priority = 10000000
         for i = from, to do
@@ -37,7 +79,20 @@ function am._execute_actions(actions, from, to)
                     actions[i] = false
                     if action.seq ~= seq then
                         action.seq = seq
-                        if do_action(action.func, action.node) then
+                        local done
+                        if profiling then
+                            profile_begin(profile_name(action))
+                            profiled_action = action
+                            local ok, res = xpcall(run_profiled_action, profiled_action_error)
+                            if not ok then
+                                error(res, 0)
+                            end
+                            profile_end()
+                            done = res
+                        else
+                            done = do_action(action.func, action.node)
+                        end
+                        if done then
                             -- remove action
                             local node_actions = action.node._actions
                             for j = 1, #node_actions do
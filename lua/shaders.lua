@@ -115,6 +115,26 @@ local premult_texturecolor_f = [[
     }
 ]]
 
+-- Draws text from a signed distance field font (see the pack
+-- command's -sdf option). sdf_unit_range is the font's distance range
+-- divided by the texture size, so the edge can be antialiased over
+-- about one screen pixel whatever the text is scaled to.
+local sdf_texturecolor_f = [[
+    #extension GL_OES_standard_derivatives : enable
+    precision mediump float;
+    uniform sampler2D tex;
+    uniform vec4 color;
+    uniform vec2 sdf_unit_range;
+    varying vec2 v_uv;
+    void main() {
+        vec2 screen_tex_size = vec2(1.0) / fwidth(v_uv);
+        float screen_px_range = max(0.5 * dot(sdf_unit_range, screen_tex_size), 1.0);
+        float dist = texture2D(tex, v_uv).a - 0.5;
+        float alpha = clamp(screen_px_range * dist + 0.5, 0.0, 1.0);
+        gl_FragColor = vec4(color.rgb, color.a * alpha);
+    }
+]]
+
 local sources = {
     color = {color_v, color_f},
     color2d = {color2d_v, color_f},
@@ -125,6 +145,7 @@ local sources = {
     texturecolor = {texture_v, texturecolor_f},
     texturecolor2d = {texture2d_v, texturecolor_f},
     premult_texturecolor2d = {texture2d_v, premult_texturecolor_f},
+    sdf_texturecolor2d = {texture2d_v, sdf_texturecolor_f},
 }
 
 am.shaders = {}
@@ -6,13 +6,30 @@ function make_buffer(num_verts)
     return buffer, verts, uvs
 end
 
+-- Index buffers for drawing quads are shared between nodes. There's
+-- one for each power of 2 number of quads, so a node can draw fewer
+-- quads than its index buffer has room for.
+local quad_indices_cache = {}
+
+local
+function quad_capacity(num_quads)
+    local capacity = 1
+    while capacity < num_quads do
+        capacity = capacity * 2
+    end
+    return capacity
+end
+
 local
-function make_indices(num_verts)
-    local num_tris = num_verts / 4
-    local num_elems = num_tris * 6
+function quad_indices(capacity)
+    local view = quad_indices_cache[capacity]
+    if view then
+        return view
+    end
+    local num_elems = capacity * 6
     local arr_type
     local stride
-    if num_elems < 2^16 then
+    if capacity * 4 <= 2^16 then
         arr_type = "ushort_elem"
         stride = 2
     else
@@ -20,11 +37,11 @@ function make_indices(num_verts)
         stride = 4
     end
     local buffer = am.buffer(num_elems * stride)
-    local view = buffer:view(arr_type, 0, stride)
+    view = buffer:view(arr_type, 0, stride)
     local indices = {}
     local i = 1
     local k = 0
-    for j = 0, num_tris - 1 do
+    for j = 0, capacity - 1 do
         indices[i]     = 1 + k
         indices[i + 1] = 2 + k
         indices[i + 2] = 3 + k
@@ -35,107 +52,31 @@ function make_indices(num_verts)
         k = k + 4
     end
     view:set(indices)
+    quad_indices_cache[capacity] = view
     return view
 end
 
-local newline = string.byte("\n")
-local space = string.byte(" ")
-local asterix = string.byte("*")
-local dash = string.byte("-")
-local underscore = string.byte("_")
+-- Layout is done natively from a copy of the font's characters. The
+-- copy is remade whenever the font's chars table or line height is
+-- replaced, but edits made inside an existing chars table are not seen.
+local native_fonts = setmetatable({}, {__mode = "k"})
 
 local
-function set_text_verts(font, str, verts_view, uvs_view, halign, valign)
-    local x = 0
-    local y = 0
-    local verts = {}
-    local uvs = {}
-    local v = 1
-    local u = 1
-    local chars = font.chars
-
-    -- compute row_widths and height
-    local row_widths = {0}
-    local max_width = 0
-    local h = font.line_height
-    local row = 1
-    for p, c in utf8.codes(str) do
-        if c == newline then
-            h = h + font.line_height
-            row = row + 1
-            row_widths[row] = 0
-        else
-            local char_data = chars[c] or chars[0] or chars[space]
-            local w = row_widths[row] + char_data.advance
-            row_widths[row] = w
-            if w > max_width then
-                max_width = w
-            end
-        end
-    end
-    
-    row = 1
-    if halign == "center" then
-        x = -math.floor(row_widths[row] / 2)
-    elseif halign == "right" then
-        x = -row_widths[row]
-    else
-        x = 0
+function native_font(font)
+    local entry = native_fonts[font]
+    if not entry or entry.chars ~= font.chars or entry.line_height ~= font.line_height then
+        entry = {
+            nfont = am._text_font(font.chars, font.line_height),
+            chars = font.chars,
+            line_height = font.line_height,
+        }
+        native_fonts[font] = entry
     end
-    if valign == "center" then
-        y = math.floor(h / 2) - font.line_height
-    elseif valign == "bottom" then
-        y = h - font.line_height
-    else
-        y = -font.line_height
-    end
-    for p, c in utf8.codes(str) do
-        local char_data, x1, y1, x2, y2, advance
-        if c == newline then
-            y = y - font.line_height
-            x1, y1, x2, y2 = 0, 0, 0, 0
-            char_data = chars[space]
-            advance = 0
-            row = row + 1
-            if halign == "center" then
-                x = -math.floor(row_widths[row] / 2)
-            elseif halign == "right" then
-                x = -row_widths[row]
-            else
-                x = 0
-            end
-        else
-            char_data = chars[c] or chars[0] or chars[space]
-            x1, y1, x2, y2 = char_data.x1, char_data.y1, char_data.x2, char_data.y2
-            advance = char_data.advance
-        end
-        verts[v]     = x + x1
-        verts[v + 1] = y + y2
-        verts[v + 2] = x + x1
-        verts[v + 3] = y + y1
-        verts[v + 4] = x + x2
-        verts[v + 5] = y + y1
-        verts[v + 6] = x + x2
-        verts[v + 7] = y + y2
-        v = v + 8
-        local s1, t1, s2, t2 = char_data.s1, char_data.t1, char_data.s2, char_data.t2
-        uvs[u]     = s1
-        uvs[u + 1] = t2
-        uvs[u + 2] = s1
-        uvs[u + 3] = t1
-        uvs[u + 4] = s2
-        uvs[u + 5] = t1
-        uvs[u + 6] = s2
-        uvs[u + 7] = t2
-        u = u + 8
-        x = x + advance
-    end
-    verts_view:set(verts)
-    uvs_view:set(uvs)
-
-    return max_width, h
+    return entry.nfont
 end
 
+local newline = string.byte("\n")
+
 local
 function set_sprite_verts(img, verts_view, uvs_view, halign, valign)
     local x1, y1, x2, y2 = img.x1, img.y1, img.x2, img.y2
@@ -192,38 +133,64 @@ function am.text(font, str, color, halign, valign)
         str = " "
     end
     local len = utf8.len(str)
-    local num_verts = len * 4
-    local buffer, verts, uvs = make_buffer(num_verts)
-    local indices = make_indices(num_verts)
-    local w, h = set_text_verts(font, str, verts, uvs, halign, valign)
-    local node =
-        am.blend(font.is_premult and "premult" or "alpha")
-        ^am.use_program(font.is_premult and am.shaders.premult_texturecolor2d or am.shaders.texturecolor2d)
-        ^am.bind{
-            vert = verts,
-            uv = uvs,
-            tex = font.texture,
-            color = color,
-        }
-        ^am.draw("triangles", indices)
+    if not len then
+        error("invalid UTF-8 string", 2)
+    end
+    local capacity = quad_capacity(len)
+    local buffer, verts, uvs = make_buffer(capacity * 4)
+    local indices = quad_indices(capacity)
+    local w, h = am._layout_text(native_font(font), str, halign, valign, verts, uvs)
+    local node
+    if font.sdf then
+        -- distance field fonts only use the texture's alpha channel, so
+        -- premultiplication doesn't matter
+        local tex = font.texture
+        node =
+            am.blend"alpha"
+            ^am.use_program(am.shaders.sdf_texturecolor2d)
+            ^am.bind{
+                vert = verts,
+                uv = uvs,
+                tex = tex,
+                color = color,
+                sdf_unit_range = vec2(font.distance_range / tex.width, font.distance_range / tex.height),
+            }
+            ^am.draw("triangles", indices, 1, len * 6)
+    else
+        node =
+            am.blend(font.is_premult and "premult" or "alpha")
+            ^am.use_program(font.is_premult and am.shaders.premult_texturecolor2d or am.shaders.texturecolor2d)
+            ^am.bind{
+                vert = verts,
+                uv = uvs,
+                tex = font.texture,
+                color = color,
+            }
+            ^am.draw("triangles", indices, 1, len * 6)
+    end
     function node:get_text()
         return str
     end
     function node:set_text(str1)
         str1 = type(str1) == "string" and str1 or tostring(str1)
+        if str1 == str then
+            return
+        end
         local len1 = utf8.len(str1)
-        if len1 > len then
-            local num_verts = len1 * 4 
-            buffer, verts, uvs = make_buffer(num_verts)
-            indices = make_indices(num_verts)
+        if not len1 then
+            error("invalid UTF-8 string", 2)
+        end
+        if len1 > capacity then
+            capacity = quad_capacity(len1)
+            buffer, verts, uvs = make_buffer(capacity * 4)
+            indices = quad_indices(capacity)
             self"bind".vert = verts
             self"bind".uv = uvs
             self"draw".elements = indices
-            len = len1
         end
         str = str1
-        w, h = set_text_verts(font, str, verts, uvs, halign, valign)
-        self"draw".count = utf8.len(str) * 6
+        w, h = am._layout_text(native_font(font), str, halign, valign, verts, uvs)
+        self"draw".count = len1 * 6
     end
     function node:get_color()
         return color
@@ -393,9 +360,8 @@ function am.sprite(image0, color, halign, valign)
     valign = valign or "center"
     color = color or vec4(1)
     local image = convert_sprite_source(image0)
-    local num_verts = 4
-    local buffer, verts, uvs = make_buffer(num_verts)
-    local indices = make_indices(num_verts)
+    local buffer, verts, uvs = make_buffer(4)
+    local indices = quad_indices(1)
     set_sprite_verts(image, verts, uvs, halign, valign)
     local node =
         am.blend(image.is_premult and "premult" or "alpha")
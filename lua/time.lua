@@ -36,6 +36,12 @@ function am.perf_stats()
     stats.avg_fps = count / total_time
     stats.frame_draw_calls = am._frame_draw_calls()
     stats.frame_use_program_calls = am._frame_use_program_calls()
+    stats.frame_upload_bytes = am._frame_upload_bytes()
+    stats.frame_vbo_stalls = am._frame_vbo_stalls()
+    stats.frame_uniform_uploads = am._frame_uniform_uploads()
+    stats.frame_uniform_skips = am._frame_uniform_skips()
+    stats.frame_vertex_array_hits = am._frame_vertex_array_hits()
+    stats.frame_vertex_array_misses = am._frame_vertex_array_misses()
     return stats
 end
 
@@ -2,15 +2,17 @@ local debug = _G.debug
 
 local remove_c_stack_slots = true
 
-function am._traceback(msg, thread)
+-- level is passed on to debug.traceback (the default, 2, starts the
+-- traceback at the function that called this one).
+function am._traceback(msg, thread, level)
     local match = msg:match("^.*__coroutine__(.*)$")
     if match then
         return match
     end
     if thread then
-        msg = debug.traceback(thread, msg, 2)
+        msg = debug.traceback(thread, msg, level or 2)
     else
-        msg = debug.traceback(msg, 2)
+        msg = debug.traceback(msg, level or 2)
     end
     if type(msg) == "string" and remove_c_stack_slots then
         msg = msg:gsub("\n\t%[C%]:[^\n]*", ""):gsub("\nstack traceback:$", "")
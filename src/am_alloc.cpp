@@ -37,7 +37,9 @@
 // macro to get pool number from size
 #define GET_POOL(sz) ((sz - 1) >> CELL_SZ)
 
-#ifdef AM_PRINT_ALLOC_STATS
+// Stats are always kept, since they're cheap to update. They can be
+// logged when the allocator is destroyed by defining AM_PRINT_ALLOC_STATS
+// and are available from Lua via am.allocator_stats.
 struct pool_stats {
     uint64_t nallocs;
     uint64_t nfrees;
@@ -45,6 +47,16 @@ struct pool_stats {
     uint64_t hwm_sz;
     uint64_t allocsz;
     uint64_t freesz;
+    // counts at the start of the current frame
+    uint64_t frame_start_nallocs;
+    uint64_t frame_start_nfrees;
+    uint64_t frame_start_allocsz;
+    uint64_t frame_start_freesz;
+    // counts for the last complete frame
+    uint64_t frame_nallocs;
+    uint64_t frame_nfrees;
+    uint64_t frame_allocsz;
+    uint64_t frame_freesz;
 };
 
 static void update_stats_alloc(pool_stats *stats, size_t sz) {
@@ -68,7 +80,17 @@ static void update_stats_free(pool_stats *stats, size_t sz) {
     //am_debug("FREE %d (alloced = %d, freed = %d)", (int)sz, (int)stats->allocsz, (int)stats->freesz);
     assert(stats->allocsz >= stats->freesz);
 }
-#endif
+
+static void update_stats_frame(pool_stats *stats) {
+    stats->frame_nallocs = stats->nallocs - stats->frame_start_nallocs;
+    stats->frame_nfrees = stats->nfrees - stats->frame_start_nfrees;
+    stats->frame_allocsz = stats->allocsz - stats->frame_start_allocsz;
+    stats->frame_freesz = stats->freesz - stats->frame_start_freesz;
+    stats->frame_start_nallocs = stats->nallocs;
+    stats->frame_start_nfrees = stats->nfrees;
+    stats->frame_start_allocsz = stats->allocsz;
+    stats->frame_start_freesz = stats->freesz;
+}
 
 struct am_pool {
     void **freelist;
@@ -76,15 +98,11 @@ struct am_pool {
     int num_blocks;
     size_t cellsize;
     size_t blocksize;
-#ifdef AM_PRINT_ALLOC_STATS
     pool_stats stats;
-#endif
 };
 
 struct am_allocator {
-#ifdef AM_PRINT_ALLOC_STATS
     pool_stats heap_stats;
-#endif
 #ifdef AM_USE_DLMALLOC
     mspace ms;
 #endif
@@ -136,10 +154,14 @@ am_allocator *am_new_allocator() {
 
 void *am_alloc(void *ud, void *ptr, size_t osize, size_t nsize) {
     am_allocator *allocator = (am_allocator*)ud;
+    if (ptr != NULL) {
+        update_stats_free(&allocator->heap_stats, osize);
+    }
     if (nsize == 0) {
         am_free(allocator, ptr);
         return NULL;
     }
+    update_stats_alloc(&allocator->heap_stats, nsize);
     return am_realloc(allocator, ptr, nsize);
 }
 
@@ -149,9 +171,7 @@ static void free_pool_cell(am_pool *pool, void *ptr, size_t sz) {
     void **cell = (void**)ptr;
     *cell = (void*)pool->freelist;
     pool->freelist = cell;
-#ifdef AM_PRINT_ALLOC_STATS
     update_stats_free(&pool->stats, sz);
-#endif
 }
 
 static void do_free(am_allocator *allocator, void *ptr, size_t sz) {
@@ -160,9 +180,7 @@ static void do_free(am_allocator *allocator, void *ptr, size_t sz) {
         free_pool_cell(&allocator->pools[pool], ptr, sz);
     } else {
         am_free(allocator, ptr);
-#ifdef AM_PRINT_ALLOC_STATS
         update_stats_free(&allocator->heap_stats, sz);
-#endif
     }
 }
 
@@ -178,9 +196,7 @@ static void init_block(void *block, size_t cellsize, size_t blocksize) {
 }
 
 static void *alloc_pool_cell(am_allocator *allocator, am_pool *pool, size_t sz) {
-#ifdef AM_PRINT_ALLOC_STATS
     update_stats_alloc(&pool->stats, sz);
-#endif
     if (pool->freelist != NULL) {
         void *ptr = (void*)pool->freelist;
         pool->freelist = (void**)(*(pool->freelist));
@@ -212,9 +228,7 @@ void *am_alloc(void *ud, void *ptr, size_t osize, size_t nsize) {
             if (pool < NUM_POOLS) {
                 return alloc_pool_cell(allocator, &allocator->pools[pool], nsize);
             } else {
-#ifdef AM_PRINT_ALLOC_STATS
                 update_stats_alloc(&allocator->heap_stats, nsize);
-#endif
                 return am_malloc(allocator, nsize);
             }
         } else {
@@ -222,19 +236,15 @@ void *am_alloc(void *ud, void *ptr, size_t osize, size_t nsize) {
             int opool = GET_POOL(osize);
             int npool = GET_POOL(nsize);
             if (opool >= NUM_POOLS && npool >= NUM_POOLS) {
-#ifdef AM_PRINT_ALLOC_STATS
                 update_stats_free(&allocator->heap_stats, osize);
                 update_stats_alloc(&allocator->heap_stats, nsize);
-#endif
                 return am_realloc(allocator, ptr, nsize);
             } else {
                 void *newcell;
                 if (npool < NUM_POOLS) {
                     newcell = alloc_pool_cell(allocator, &allocator->pools[npool], nsize);
                 } else {
-#ifdef AM_PRINT_ALLOC_STATS
                     update_stats_alloc(&allocator->heap_stats, nsize);
-#endif
                     newcell = am_malloc(allocator, nsize);
                 }
                 memcpy(newcell, ptr, am_min(osize, nsize));
@@ -309,3 +319,88 @@ void am_destroy_allocator(am_allocator *allocator) {
 #endif
     delete allocator;
 }
+
+static am_allocator *get_allocator(lua_State *L) {
+    void *ud;
+    lua_Alloc f = lua_getallocf(L, &ud);
+    // luajit uses its own allocator on 64 bit systems
+    if (f != &am_alloc) return NULL;
+    return (am_allocator*)ud;
+}
+
+void am_allocator_end_frame(lua_State *L) {
+    am_allocator *allocator = get_allocator(L);
+    if (allocator == NULL) return;
+    for (int p = 0; p < NUM_POOLS; p++) {
+        update_stats_frame(&allocator->pools[p].stats);
+    }
+    update_stats_frame(&allocator->heap_stats);
+}
+
+static void push_pool_stats(lua_State *L, pool_stats *stats, bool frame) {
+    lua_newtable(L);
+    lua_pushnumber(L, (double)(frame ? stats->frame_nallocs : stats->nallocs));
+    lua_setfield(L, -2, "allocs");
+    lua_pushnumber(L, (double)(frame ? stats->frame_nfrees : stats->nfrees));
+    lua_setfield(L, -2, "frees");
+    lua_pushnumber(L, (double)(frame ? stats->frame_allocsz : stats->allocsz));
+    lua_setfield(L, -2, "alloc_bytes");
+    lua_pushnumber(L, (double)(frame ? stats->frame_freesz : stats->freesz));
+    lua_setfield(L, -2, "free_bytes");
+    lua_pushnumber(L, (double)(stats->nallocs - stats->nfrees));
+    lua_setfield(L, -2, "live");
+    lua_pushnumber(L, (double)(stats->allocsz - stats->freesz));
+    lua_setfield(L, -2, "bytes");
+    lua_pushnumber(L, (double)stats->hwm_cells);
+    lua_setfield(L, -2, "peak_live");
+    lua_pushnumber(L, (double)stats->hwm_sz);
+    lua_setfield(L, -2, "peak_bytes");
+}
+
+static int allocator_stats(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    bool frame = false;
+    if (nargs > 0 && !lua_isnil(L, 1)) {
+        const char *mode = luaL_checkstring(L, 1);
+        if (strcmp(mode, "frame") == 0) {
+            frame = true;
+        } else if (strcmp(mode, "total") != 0) {
+            return luaL_error(L, "invalid mode: '%s' (expecting 'total' or 'frame')", mode);
+        }
+    }
+    am_allocator *allocator = get_allocator(L);
+    if (allocator == NULL) {
+        lua_pushnil(L);
+        return 1;
+    }
+    lua_newtable(L);
+    lua_newtable(L);
+    for (int p = 0; p < NUM_POOLS; p++) {
+        am_pool *pool = &allocator->pools[p];
+        push_pool_stats(L, &pool->stats, frame);
+        lua_pushinteger(L, (int)pool->cellsize);
+        lua_setfield(L, -2, "cell_size");
+        lua_pushinteger(L, pool->num_blocks);
+        lua_setfield(L, -2, "blocks");
+        double reserved = (double)pool->num_blocks * (double)pool->blocksize;
+        lua_pushnumber(L, reserved);
+        lua_setfield(L, -2, "reserved_bytes");
+        // fraction of the reserved cells that are in use
+        double used = (double)(pool->stats.nallocs - pool->stats.nfrees) * (double)pool->cellsize;
+        lua_pushnumber(L, reserved > 0.0 ? used / reserved : 0.0);
+        lua_setfield(L, -2, "utilization");
+        lua_rawseti(L, -2, p + 1);
+    }
+    lua_setfield(L, -2, "pools");
+    push_pool_stats(L, &allocator->heap_stats, frame);
+    lua_setfield(L, -2, "large");
+    return 1;
+}
+
+void am_open_allocator_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"allocator_stats", allocator_stats},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+}
@@ -3,3 +3,9 @@ struct am_allocator;
 am_allocator *am_new_allocator();
 void *am_alloc(void *allocator, void *ptr, size_t osize, size_t nsize);
 void am_destroy_allocator(am_allocator *allocator);
+
+// Records the allocation counts for the frame just finished, for
+// am.allocator_stats("frame").
+void am_allocator_end_frame(lua_State *L);
+
+void am_open_allocator_module(lua_State *L);
@@ -26,47 +26,61 @@
 #define clear_pending_pause(node)   node->flags &= ~AM_AUDIO_NODE_FLAG_PENDING_PAUSE
 
 static am_audio_context audio_context;
+static am_audio_context offline_context; // used by am._render_audio_offline
+
+// set by am.set_audio_threads, applied at the next sync
+static int requested_audio_threads = 1;
 
 // Audio Bus
 
-// all buffers in the pool have the same size
-// current_pool_bufsize is the size of each buffer in the
-// pool, in bytes.
-static std::vector<void*> buffer_pool;
-static int current_pool_bufsize = 0;
-static unsigned int bufpool_top = 0;
+// all buffers in a pool have the same size.
+// bufsize is the size of each buffer in the
+// pool, in bytes. Each thread that renders audio
+// has its own pool.
+struct am_audio_buffer_pool {
+    std::vector<void*> buffers;
+    int bufsize;
+    unsigned int top;
+
+    am_audio_buffer_pool() {
+        bufsize = 0;
+        top = 0;
+    }
+};
+
+static am_audio_buffer_pool default_buffer_pool;
 
 static double audio_time_accum = 0.0;
 
-static void clear_buffer_pool() {
-    for (unsigned int i = 0; i < buffer_pool.size(); i++) {
-        free(buffer_pool[i]);
+static void clear_buffer_pool(am_audio_buffer_pool *pool) {
+    for (unsigned int i = 0; i < pool->buffers.size(); i++) {
+        free(pool->buffers[i]);
     }
-    buffer_pool.clear();
-    bufpool_top = 0;
-    current_pool_bufsize = 0;
+    pool->buffers.clear();
+    pool->top = 0;
+    pool->bufsize = 0;
 }
 
-static void* push_buffer(int size) {
-    if (size != current_pool_bufsize) {
+static void* push_buffer(am_audio_buffer_pool *pool, int size) {
+    if (size != pool->bufsize) {
         // size of audio buffer has changed, clear pool
-        clear_buffer_pool();
-        current_pool_bufsize = size;
+        clear_buffer_pool(pool);
+        pool->bufsize = size;
     }
-    am_always_assert(bufpool_top <= buffer_pool.size());
-    if (bufpool_top == buffer_pool.size()) {
-        buffer_pool.push_back(malloc(size));
+    am_always_assert(pool->top <= pool->buffers.size());
+    if (pool->top == pool->buffers.size()) {
+        pool->buffers.push_back(malloc(size));
     }
-    void *buf = buffer_pool[bufpool_top++];
+    void *buf = pool->buffers[pool->top++];
     memset(buf, 0, size);
     return buf;
 }
 
-static void pop_buffer(void *buf) {
-    bufpool_top--;
-    assert(bufpool_top >= 0);
-    assert(buffer_pool.size() > bufpool_top);
-    assert(buffer_pool[bufpool_top] == buf);
+static void pop_buffer(am_audio_buffer_pool *pool, void *buf) {
+    pool->top--;
+    assert(pool->top >= 0);
+    assert(pool->buffers.size() > pool->top);
+    assert(pool->buffers[pool->top] == buf);
 }
 
 static void setup_channels(am_audio_bus *bus) {
@@ -80,20 +94,23 @@ am_audio_bus::am_audio_bus(int nchannels, int nsamples, float* buf) {
     num_samples = nsamples;
     buffer = buf;
     owns_buffer = false;
+    pool = NULL;
     setup_channels(this);
 }
 
 am_audio_bus::am_audio_bus(am_audio_bus *bus) {
     num_channels = bus->num_channels;
     num_samples = bus->num_samples;
-    buffer = (float*)push_buffer(num_channels * num_samples * sizeof(float));
+    pool = bus->pool;
+    buffer = (float*)push_buffer(pool == NULL ? &default_buffer_pool : pool,
+        num_channels * num_samples * sizeof(float));
     owns_buffer = true;
     setup_channels(this);
 }
 
 am_audio_bus::~am_audio_bus() {
     if (owns_buffer) {
-        pop_buffer(buffer);
+        pop_buffer(pool == NULL ? &default_buffer_pool : pool, buffer);
     }
 }
 
@@ -110,6 +127,8 @@ am_audio_node::am_audio_node() {
     live_children.owner = this;
     last_sync = 0;
     last_render = 0;
+    last_update = 0;
+    render_group = 0;
     flags = 0;
     recursion_limit = 0;
 }
@@ -117,6 +136,9 @@ am_audio_node::am_audio_node() {
 void am_audio_node::sync_params() {
 }
 
+void am_audio_node::update_params() {
+}
+
 void am_audio_node::post_render(am_audio_context *context, int num_samples) {
 }
 
@@ -135,11 +157,7 @@ bool am_audio_node::finished() {
 static void mix_bus(am_audio_bus * AM_RESTRICT dest, am_audio_bus * AM_RESTRICT src) {
     for (int c = 0; c < am_min(dest->num_channels, src->num_channels); c++) {
         int n = am_min(dest->num_samples, src->num_samples);
-        float * AM_RESTRICT dest_data = dest->channel_data[c];
-        float * AM_RESTRICT src_data = src->channel_data[c];
-        for (int s = 0; s < n; s++) {
-            dest_data[s] += src_data[s];
-        }
+        am_audio_kern->mix(dest->channel_data[c], src->channel_data[c], n);
     }
 }
 
@@ -171,40 +189,43 @@ static void apply_fadeout(am_audio_bus *bus) {
     }
 }
 
+static void render_child(am_audio_context *context, am_audio_bus *bus, am_audio_node_child *child) {
+    int pause_state = live_pause_state(child->child);
+    am_audio_node_child_state child_state = child->state;
+    if (child_state == AM_AUDIO_NODE_CHILD_STATE_OLD
+        && pause_state == LIVE_PAUSE_STATE_UNPAUSED)
+    {
+        child->child->render_audio(context, bus);
+    } else if (child_state == AM_AUDIO_NODE_CHILD_STATE_DONE
+        || pause_state == LIVE_PAUSE_STATE_PAUSED
+        // also ignore if paused and added at same time...
+        || (pause_state == LIVE_PAUSE_STATE_BEGIN && child->state == AM_AUDIO_NODE_CHILD_STATE_NEW)
+        // ...or if unpaused and removed at same time
+        || (pause_state == LIVE_PAUSE_STATE_END && child->state == AM_AUDIO_NODE_CHILD_STATE_REMOVED))
+    {
+        // ignore
+    } else {
+        // a fadein or fadeout is required, because
+        // the child was recently added/removed or
+        // paused/unpaused.
+        am_audio_bus tmp(bus);
+        child->child->render_audio(context, &tmp);
+        if (child_state == AM_AUDIO_NODE_CHILD_STATE_NEW || pause_state == LIVE_PAUSE_STATE_END) {
+            apply_fadein(&tmp);
+        } else if (child_state == AM_AUDIO_NODE_CHILD_STATE_REMOVED || pause_state == LIVE_PAUSE_STATE_BEGIN) {
+            apply_fadeout(&tmp);
+        } else {
+            assert(false);
+        }
+        mix_bus(bus, &tmp);
+    }
+}
+
 void am_audio_node::render_children(am_audio_context *context, am_audio_bus *bus) {
     if (recursion_limit < 0) return;
     recursion_limit--;
     for (int i = 0; i < live_children.size; i++) {
-        am_audio_node_child *child = &live_children.arr[i];
-        int pause_state = live_pause_state(child->child);
-        am_audio_node_child_state child_state = child->state;
-        if (child_state == AM_AUDIO_NODE_CHILD_STATE_OLD
-            && pause_state == LIVE_PAUSE_STATE_UNPAUSED)
-        {
-            child->child->render_audio(context, bus);
-        } else if (child_state == AM_AUDIO_NODE_CHILD_STATE_DONE
-            || pause_state == LIVE_PAUSE_STATE_PAUSED
-            // also ignore if paused and added at same time...
-            || (pause_state == LIVE_PAUSE_STATE_BEGIN && child->state == AM_AUDIO_NODE_CHILD_STATE_NEW)
-            // ...or if unpaused and removed at same time
-            || (pause_state == LIVE_PAUSE_STATE_END && child->state == AM_AUDIO_NODE_CHILD_STATE_REMOVED))
-        {
-            // ignore
-        } else {
-            // a fadein or fadeout is required, because
-            // the child was recently added/removed or
-            // paused/unpaused.
-            am_audio_bus tmp(bus);
-            child->child->render_audio(context, &tmp);
-            if (child_state == AM_AUDIO_NODE_CHILD_STATE_NEW || pause_state == LIVE_PAUSE_STATE_END) {
-                apply_fadein(&tmp);
-            } else if (child_state == AM_AUDIO_NODE_CHILD_STATE_REMOVED || pause_state == LIVE_PAUSE_STATE_BEGIN) {
-                apply_fadeout(&tmp);
-            } else {
-                assert(false);
-            }
-            mix_bus(bus, &tmp);
-        }
+        render_child(context, bus, &live_children.arr[i]);
     }
     recursion_limit++;
 }
@@ -216,6 +237,10 @@ am_gain_node::am_gain_node() : gain(0) {
 }
 
 void am_gain_node::sync_params() {
+    gain.sync();
+}
+
+void am_gain_node::update_params() {
     gain.update_target();
 }
 
@@ -228,10 +253,9 @@ void am_gain_node::render_audio(am_audio_context *context, am_audio_bus *bus) {
     render_children(context, &tmp);
     int num_channels = bus->num_channels;
     int num_samples = bus->num_samples;
-    for (int s = 0; s < num_samples; s++) {
-        for (int c = 0; c < num_channels; c++) {
-            bus->channel_data[c][s] += tmp.channel_data[c][s] * gain.interpolate_linear(s);
-        }
+    for (int c = 0; c < num_channels; c++) {
+        am_audio_kern->mix_gain(bus->channel_data[c], tmp.channel_data[c], num_samples,
+            0, gain.current_value, gain.target_value, am_conf_audio_interpolate_samples);
     }
 }
 
@@ -256,37 +280,8 @@ void am_biquad_filter_node::render_audio(am_audio_context *context, am_audio_bus
     int num_channels = bus->num_channels;
     int num_samples = bus->num_samples;
     for (int c = 0; c < num_channels; c++) {
-        float *source = &tmp.channel_data[c][0];
-        float *dest = &bus->channel_data[c][0];
-        int n = num_samples;
-
-        double x1 = current_state[c].x1;
-        double x2 = current_state[c].x2;
-        double y1 = current_state[c].y1;
-        double y2 = current_state[c].y2;
-
-        double b0 = coeffs.b0;
-        double b1 = coeffs.b1;
-        double b2 = coeffs.b2;
-        double a1 = coeffs.a1;
-        double a2 = coeffs.a2;
-
-        while (n--) {
-            float x = *source++;
-            float y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2;
-
-            *dest++ += y;
-
-            x2 = x1;
-            x1 = x;
-            y2 = y1;
-            y1 = y;
-        }
-
-        next_state[c].x1 = x1;
-        next_state[c].x2 = x2;
-        next_state[c].y1 = y1;
-        next_state[c].y2 = y2;
+        am_audio_kern->mix_biquad(bus->channel_data[c], tmp.channel_data[c], num_samples,
+            &coeffs, &current_state[c], &next_state[c]);
     }
 }
 
@@ -377,6 +372,11 @@ am_lowpass_filter_node::am_lowpass_filter_node() : cutoff(0), resonance(0) {
 }
 
 void am_lowpass_filter_node::sync_params() {
+    cutoff.sync();
+    resonance.sync();
+}
+
+void am_lowpass_filter_node::update_params() {
     cutoff.update_target();
     resonance.update_target();
     if (cutoff.current_value != cutoff.target_value
@@ -392,6 +392,11 @@ am_highpass_filter_node::am_highpass_filter_node() : cutoff(0), resonance(0) {
 }
 
 void am_highpass_filter_node::sync_params() {
+    cutoff.sync();
+    resonance.sync();
+}
+
+void am_highpass_filter_node::update_params() {
     cutoff.update_target();
     resonance.update_target();
     if (cutoff.current_value != cutoff.target_value
@@ -420,8 +425,8 @@ am_audio_track_node::am_audio_track_node()
 }
 
 void am_audio_track_node::sync_params() {
-    playback_speed.update_target();
-    gain.update_target();
+    playback_speed.sync();
+    gain.sync();
     if (needs_reset) {
         current_position = reset_position;
         next_position = reset_position;
@@ -450,6 +455,9 @@ void am_audio_track_node::render_audio(am_audio_context *context, am_audio_bus *
     int buf_num_samples = audio_buffer->buffer->size / (buf_num_channels * sizeof(float));
     int bus_num_samples = tmp.num_samples;
     int bus_num_channels = tmp.num_channels;
+    float gain_from = gain.current_value;
+    float gain_to = gain.target_value;
+    int ramp = am_conf_audio_interpolate_samples;
     if (!track_resample_required(this)) {
         // optimise common case where no resampling is required
         for (int c = 0; c < bus_num_channels; c++) {
@@ -458,8 +466,13 @@ void am_audio_track_node::render_audio(am_audio_context *context, am_audio_bus *
             if (c < buf_num_channels) {
                 int buf_pos = (int)floor(current_position);
                 assert(buf_pos < buf_num_samples);
-                for (int bus_pos = 0; bus_pos < bus_num_samples; bus_pos++) {
-                    bus_data[bus_pos] += buf_data[buf_pos++] * gain.interpolate_linear(bus_pos);
+                int bus_pos = 0;
+                while (bus_pos < bus_num_samples) {
+                    int n = am_min(bus_num_samples - bus_pos, buf_num_samples - buf_pos);
+                    am_audio_kern->mix_gain(bus_data + bus_pos, buf_data + buf_pos, n,
+                        bus_pos, gain_from, gain_to, ramp);
+                    bus_pos += n;
+                    buf_pos += n;
                     if (buf_pos >= buf_num_samples) {
                         if (loop) {
                             buf_pos = 0;
@@ -481,12 +494,29 @@ void am_audio_track_node::render_audio(am_audio_context *context, am_audio_bus *
         }
     } else {
         // resample
+        bool speed_changing = playback_speed.current_value != playback_speed.target_value;
+        double step = (double)(playback_speed.target_value * sample_rate_ratio);
         for (int c = 0; c < bus_num_channels; c++) {
             float *bus_data = tmp.channel_data[c];
             float *buf_data = ((float*)audio_buffer->buffer->data) + c * buf_num_samples;
             if (c < buf_num_channels) {
                 double pos = current_position;
-                for (int write_index = 0; write_index < bus_num_samples; write_index++) {
+                int write_index = 0;
+                while (write_index < bus_num_samples) {
+                    if (step > 0.0 && (!speed_changing || write_index >= ramp)) {
+                        // the step is constant from here on, so hand the kernel as many samples
+                        // as it can do before reaching the end of the buffer (leaving a sample
+                        // of slack for rounding differences).
+                        double max_span = ((double)(buf_num_samples - 1) - pos) / step - 1.0;
+                        int span = max_span < 0.0 ? 0 :
+                            (int)am_min(max_span, (double)(bus_num_samples - write_index));
+                        if (span > 0) {
+                            pos = am_audio_kern->mix_resample(bus_data + write_index, buf_data, span,
+                                pos, step, write_index, gain_from, gain_to, ramp);
+                            write_index += span;
+                            continue;
+                        }
+                    }
                     int read_index1 = (int)floor(pos);
                     int read_index2 = read_index1 + 1;
                     if (read_index2 >= buf_num_samples) {
@@ -511,6 +541,7 @@ void am_audio_track_node::render_audio(am_audio_context *context, am_audio_bus *
                             break;
                         }
                     }
+                    write_index++;
                 }
                 next_position = pos;
             } else {
@@ -529,10 +560,151 @@ void am_audio_track_node::post_render(am_audio_context *context, int num_samples
     current_position = next_position;
 }
 
+void am_audio_track_node::update_params() {
+    playback_speed.update_target();
+    gain.update_target();
+}
+
 bool am_audio_track_node::finished() {
     return done_client;
 }
 
+// Stream decoder thread. Streams with a ring are decoded ahead on this
+// thread, so the audio thread only has to copy samples out of the ring.
+// The audio thread mustn't block, so it requests a refill by setting
+// stream_refill_requested, which the decoder thread polls every
+// AM_STREAM_POLL_MS. stream_wakeup is only signalled to stop the thread.
+
+#define AM_STREAM_POLL_MS 5
+
+static am_thread *stream_thread = NULL;
+static am_mutex *stream_mutex = NULL; // protects decoding_streams
+static am_semaphore *stream_wakeup = NULL;
+static std::vector<am_audio_stream_node*> decoding_streams;
+static volatile uint32_t stream_refill_requested = 0;
+static volatile uint32_t stream_thread_quit = 0;
+
+static void fill_stream_ring(am_audio_stream_node *node) {
+    am_audio_stream_ring *ring = node->ring;
+    if (ring->eof) return;
+    stb_vorbis *f = (stb_vorbis*)node->handle;
+    uint32_t w = ring->write;
+    bool rewound = false;
+    while (true) {
+        uint32_t space = ring->capacity - (w - am_atomic_load(&ring->read));
+        if (space == 0) break;
+        uint32_t offset = w & (ring->capacity - 1);
+        int n = (int)am_min(space, ring->capacity - offset);
+        float *channel_data[AM_MAX_CHANNELS];
+        for (int c = 0; c < ring->num_channels; c++) {
+            channel_data[c] = ring->data + c * ring->capacity + offset;
+        }
+        int m = stb_vorbis_get_samples_float(f, ring->num_channels, channel_data, n);
+        if (m == 0) {
+            if (!node->loop) {
+                am_atomic_store(&ring->eof, 1);
+                break;
+            } else if (rewound) {
+                // nothing to play
+                break;
+            }
+            stb_vorbis_seek_start(f);
+            rewound = true;
+        } else {
+            rewound = false;
+            w += m;
+            am_atomic_store(&ring->write, w);
+        }
+    }
+}
+
+static void stream_thread_main(void *data) {
+    while (true) {
+        am_wait_semaphore_timeout(stream_wakeup, AM_STREAM_POLL_MS);
+        if (am_atomic_load(&stream_thread_quit)) break;
+        if (!am_atomic_load(&stream_refill_requested)) continue;
+        // clear the request before filling, so a request made while
+        // filling is picked up on the next poll
+        am_atomic_store(&stream_refill_requested, 0);
+        am_lock_mutex(stream_mutex);
+        for (unsigned int i = 0; i < decoding_streams.size(); i++) {
+            fill_stream_ring(decoding_streams[i]);
+        }
+        am_unlock_mutex(stream_mutex);
+    }
+}
+
+static bool start_stream_thread() {
+    if (stream_thread != NULL) return true;
+    if (stream_mutex == NULL) {
+        stream_mutex = am_create_mutex();
+        stream_wakeup = am_create_semaphore();
+    }
+    am_atomic_store(&stream_thread_quit, 0);
+    am_atomic_store(&stream_refill_requested, 0);
+    stream_thread = am_create_thread(stream_thread_main, NULL);
+    return stream_thread != NULL;
+}
+
+static void stop_stream_thread() {
+    if (stream_thread != NULL) {
+        am_atomic_store(&stream_thread_quit, 1);
+        am_signal_semaphore(stream_wakeup);
+        am_join_thread(stream_thread);
+        stream_thread = NULL;
+    }
+    // Streams still in the list are freed when their nodes are collected,
+    // which happens after this when the lua state is closed.
+    decoding_streams.clear();
+    if (stream_mutex != NULL) {
+        am_destroy_mutex(stream_mutex);
+        stream_mutex = NULL;
+        am_destroy_semaphore(stream_wakeup);
+        stream_wakeup = NULL;
+    }
+}
+
+// Allocates the node's ring, fills it and hands the node to the decoder thread.
+// Returns false if there's no decoder thread, in which case the node
+// will decode on the audio thread.
+static bool start_decoding_stream(am_audio_stream_node *node, double prefetch) {
+    if (!start_stream_thread()) return false;
+    uint32_t frames = (uint32_t)(prefetch * (double)node->sample_rate);
+    uint32_t capacity = 1024;
+    while (capacity < frames && capacity < (1 << 24)) {
+        capacity *= 2;
+    }
+    am_audio_stream_ring *ring = new am_audio_stream_ring();
+    ring->num_channels = am_min(node->num_channels, AM_MAX_CHANNELS);
+    ring->capacity = capacity;
+    ring->data = (float*)malloc(ring->num_channels * capacity * sizeof(float));
+    ring->read = 0;
+    ring->write = 0;
+    ring->eof = 0;
+    node->ring = ring;
+    // fill the ring here so playback can start straight away
+    fill_stream_ring(node);
+    am_lock_mutex(stream_mutex);
+    decoding_streams.push_back(node);
+    am_unlock_mutex(stream_mutex);
+    return true;
+}
+
+static void stop_decoding_stream(am_audio_stream_node *node) {
+    if (node->ring == NULL) return;
+    // once this returns the decoder thread won't touch the node again.
+    // stream_mutex is NULL if the decoder thread has already been stopped.
+    if (stream_mutex != NULL) {
+        am_lock_mutex(stream_mutex);
+        decoding_streams.erase(std::remove(decoding_streams.begin(), decoding_streams.end(), node),
+            decoding_streams.end());
+        am_unlock_mutex(stream_mutex);
+    }
+    free(node->ring->data);
+    delete node->ring;
+    node->ring = NULL;
+}
+
 // Audio stream node
 
 am_audio_stream_node::am_audio_stream_node()
@@ -541,6 +713,8 @@ am_audio_stream_node::am_audio_stream_node()
     buffer = NULL;
     buffer_ref = LUA_NOREF;
     handle = NULL;
+    ring = NULL;
+    underruns = 0;
     num_channels = 2;
     sample_rate = 44100;
     sample_rate_ratio = 1.0f;
@@ -552,12 +726,48 @@ am_audio_stream_node::am_audio_stream_node()
 }
 
 void am_audio_stream_node::sync_params() {
-    playback_speed.update_target();
+    playback_speed.sync();
     done_client = done_server;
 }
 
+void am_audio_stream_node::update_params() {
+    playback_speed.update_target();
+}
+
+static void render_stream_ring(am_audio_stream_node *node, am_audio_bus *bus) {
+    am_audio_stream_ring *ring = node->ring;
+    // eof is set after the last samples are written, so check it first
+    bool eof = am_atomic_load(&ring->eof) != 0;
+    uint32_t r = ring->read;
+    uint32_t available = am_atomic_load(&ring->write) - r;
+    int n = (int)am_min(available, (uint32_t)bus->num_samples);
+    uint32_t offset = r & (ring->capacity - 1);
+    int n1 = (int)am_min((uint32_t)n, ring->capacity - offset);
+    for (int c = 0; c < bus->num_channels; c++) {
+        // duplicate the last channel if the stream has fewer channels than the bus
+        float *channel = ring->data + am_min(c, ring->num_channels - 1) * ring->capacity;
+        am_audio_kern->mix(bus->channel_data[c], channel + offset, n1);
+        am_audio_kern->mix(bus->channel_data[c] + n1, channel, n - n1);
+    }
+    am_atomic_store(&ring->read, r + n);
+    if (n < bus->num_samples) {
+        if (eof) {
+            node->done_server = true;
+        } else {
+            node->underruns++;
+        }
+    }
+    if (!eof && available - n <= ring->capacity / 2) {
+        am_atomic_store(&stream_refill_requested, 1);
+    }
+}
+
 void am_audio_stream_node::render_audio(am_audio_context *context, am_audio_bus *bus) {
     if (done_server) return;
+    if (ring != NULL) {
+        render_stream_ring(this, bus);
+        return;
+    }
     int bus_num_samples = bus->num_samples;
     int bus_num_channels = bus->num_channels;
     stb_vorbis *f = (stb_vorbis*)handle;
@@ -611,6 +821,11 @@ am_oscillator_node::am_oscillator_node()
 }
 
 void am_oscillator_node::sync_params() {
+    phase.sync();
+    freq.sync();
+}
+
+void am_oscillator_node::update_params() {
     phase.update_target();
     freq.update_target();
 }
@@ -675,9 +890,13 @@ void am_spectrum_node::sync_params() {
         *farr = decibels;
         farr = (float*)(((uint8_t*)farr) + arr->stride);
     }
+    smoothing.sync();
+    done = false;
+}
+
+void am_spectrum_node::update_params() {
     smoothing.update_target();
     smoothing.update_current();
-    done = false;
 }
 
 void am_spectrum_node::post_render(am_audio_context *context, int num_samples) {
@@ -968,7 +1187,7 @@ static void get_gain(lua_State *L, void *obj) {
 
 static void set_gain(lua_State *L, void *obj) {
     am_gain_node *node = (am_gain_node*)obj;
-    node->gain.pending_value = luaL_checknumber(L, 3);
+    node->gain.set(luaL_checknumber(L, 3));
 }
 
 static am_property gain_property = {get_gain, set_gain};
@@ -1003,7 +1222,7 @@ static void get_lowpass_cutoff(lua_State *L, void *obj) {
 
 static void set_lowpass_cutoff(lua_State *L, void *obj) {
     am_lowpass_filter_node *node = (am_lowpass_filter_node*)obj;
-    node->cutoff.pending_value = am_clamp(luaL_checknumber(L, 3), 1.0, 22050.0);
+    node->cutoff.set(am_clamp(luaL_checknumber(L, 3), 1.0, 22050.0));
 }
 
 static void get_lowpass_resonance(lua_State *L, void *obj) {
@@ -1013,7 +1232,7 @@ static void get_lowpass_resonance(lua_State *L, void *obj) {
 
 static void set_lowpass_resonance(lua_State *L, void *obj) {
     am_lowpass_filter_node *node = (am_lowpass_filter_node*)obj;
-    node->resonance.pending_value = am_clamp(luaL_checknumber(L, 3), 0.0, 1000.0);
+    node->resonance.set(am_clamp(luaL_checknumber(L, 3), 0.0, 1000.0));
 }
 
 static am_property lowpass_cutoff_property = {get_lowpass_cutoff, set_lowpass_cutoff};
@@ -1050,7 +1269,7 @@ static void get_highpass_cutoff(lua_State *L, void *obj) {
 
 static void set_highpass_cutoff(lua_State *L, void *obj) {
     am_highpass_filter_node *node = (am_highpass_filter_node*)obj;
-    node->cutoff.pending_value = am_clamp(luaL_checknumber(L, 3), 1.0, 22050.0);
+    node->cutoff.set(am_clamp(luaL_checknumber(L, 3), 1.0, 22050.0));
 }
 
 static void get_highpass_resonance(lua_State *L, void *obj) {
@@ -1060,7 +1279,7 @@ static void get_highpass_resonance(lua_State *L, void *obj) {
 
 static void set_highpass_resonance(lua_State *L, void *obj) {
     am_highpass_filter_node *node = (am_highpass_filter_node*)obj;
-    node->resonance.pending_value = am_clamp(luaL_checknumber(L, 3), 0.0, 1000.0);
+    node->resonance.set(am_clamp(luaL_checknumber(L, 3), 0.0, 1000.0));
 }
 
 static am_property highpass_cutoff_property = {get_highpass_cutoff, set_highpass_cutoff};
@@ -1119,7 +1338,7 @@ static void get_track_playback_speed(lua_State *L, void *obj) {
 
 static void set_track_playback_speed(lua_State *L, void *obj) {
     am_audio_track_node *node = (am_audio_track_node*)obj;
-    node->playback_speed.pending_value = luaL_checknumber(L, 3);
+    node->playback_speed.set(luaL_checknumber(L, 3));
 }
 
 static am_property track_playback_speed_property = {get_track_playback_speed, set_track_playback_speed};
@@ -1131,7 +1350,7 @@ static void get_track_volume(lua_State *L, void *obj) {
 
 static void set_track_volume(lua_State *L, void *obj) {
     am_audio_track_node *node = (am_audio_track_node*)obj;
-    node->gain.pending_value = luaL_checknumber(L, 3);
+    node->gain.set(luaL_checknumber(L, 3));
 }
 
 static am_property track_volume_property = {get_track_volume, set_track_volume};
@@ -1155,6 +1374,10 @@ static void register_audio_track_node_mt(lua_State *L) {
 
 static int create_audio_stream_node(lua_State *L) {
     int nargs = am_check_nargs(L, 1);
+    double prefetch = AM_DEFAULT_STREAM_PREFETCH;
+    if (nargs > 3) {
+        prefetch = luaL_checknumber(L, 4);
+    }
     am_audio_stream_node *node = am_new_userdata(L, am_audio_stream_node);
     node->buffer = am_check_buffer(L, 1);
     node->buffer_ref = node->ref(L, 1);
@@ -1178,11 +1401,15 @@ static int create_audio_stream_node(lua_State *L) {
     }
     node->num_channels = info.channels;
     node->sample_rate_ratio = (float)node->sample_rate / (float)am_conf_audio_sample_rate;
+    if (prefetch > 0.0) {
+        start_decoding_stream(node, prefetch);
+    }
     return 1;
 }
 
 static int audio_stream_gc(lua_State *L) {
     am_audio_stream_node *node = (am_audio_stream_node*)lua_touserdata(L, 1);
+    stop_decoding_stream(node);
     if (node->handle != NULL) {
         stb_vorbis_close((stb_vorbis*)node->handle);
         node->handle = NULL;
@@ -1197,11 +1424,18 @@ static void get_stream_playback_speed(lua_State *L, void *obj) {
 
 static void set_stream_playback_speed(lua_State *L, void *obj) {
     am_audio_stream_node *node = (am_audio_stream_node*)obj;
-    node->playback_speed.pending_value = luaL_checknumber(L, 3);
+    node->playback_speed.set(luaL_checknumber(L, 3));
 }
 
 static am_property stream_playback_speed_property = {get_stream_playback_speed, set_stream_playback_speed};
 
+static void get_stream_underruns(lua_State *L, void *obj) {
+    am_audio_stream_node *node = (am_audio_stream_node*)obj;
+    lua_pushinteger(L, node->underruns);
+}
+
+static am_property stream_underruns_property = {get_stream_underruns, NULL};
+
 static void register_audio_stream_node_mt(lua_State *L) {
     lua_newtable(L);
     lua_pushcclosure(L, am_audio_node_index, 0);
@@ -1211,6 +1445,7 @@ static void register_audio_stream_node_mt(lua_State *L) {
     lua_setfield(L, -2, "__gc");
 
     am_register_property(L, "playback_speed", &stream_playback_speed_property);
+    am_register_property(L, "underruns", &stream_underruns_property);
 
     am_register_metatable(L, "audio_stream", MT_am_audio_stream_node, MT_am_audio_node);
 }
@@ -1234,7 +1469,7 @@ static void get_phase(lua_State *L, void *obj) {
 
 static void set_phase(lua_State *L, void *obj) {
     am_oscillator_node *node = (am_oscillator_node*)obj;
-    node->phase.pending_value = luaL_checknumber(L, 3);
+    node->phase.set(luaL_checknumber(L, 3));
 }
 
 static am_property phase_property = {get_phase, set_phase};
@@ -1246,7 +1481,7 @@ static void get_freq(lua_State *L, void *obj) {
 
 static void set_freq(lua_State *L, void *obj) {
     am_oscillator_node *node = (am_oscillator_node*)obj;
-    node->freq.pending_value = luaL_checknumber(L, 3);
+    node->freq.set(luaL_checknumber(L, 3));
 }
 
 static am_property freq_property = {get_freq, set_freq};
@@ -1319,7 +1554,7 @@ static void get_smoothing(lua_State *L, void *obj) {
 
 static void set_smoothing(lua_State *L, void *obj) {
     am_spectrum_node *node = (am_spectrum_node*)obj;
-    node->smoothing.pending_value = am_clamp(luaL_checknumber(L, 3), 0.0, 1.0);
+    node->smoothing.set(am_clamp(luaL_checknumber(L, 3), 0.0, 1.0));
 }
 
 static am_property smoothing_property = {get_smoothing, set_smoothing};
@@ -1363,6 +1598,17 @@ static int get_root_audio_node(lua_State *L) {
     return 1;
 }
 
+static int set_audio_threads(lua_State *L) {
+    am_check_nargs(L, 1);
+    int n = luaL_checkinteger(L, 1);
+    if (n < 1) {
+        return luaL_error(L, "number of audio threads must be at least 1");
+    }
+    // the thread pool is resized during the next sync
+    requested_audio_threads = am_min(n, am_min(AM_MAX_AUDIO_THREADS, am_cpu_count()));
+    return 0;
+}
+
 static void get_finished(lua_State *L, void *obj) {
     am_audio_node *node = (am_audio_node*)obj;
     lua_pushboolean(L, node->finished());
@@ -1578,9 +1824,247 @@ static int load_audio(lua_State *L) {
 
 //-------------------------------------------------------------------------
 
+// Parallel rendering. When more than one audio thread is enabled, the
+// root's live children are partitioned into groups that share no nodes.
+// Each group is rendered into its own bus by whichever thread claims it
+// first and the group buses are then mixed in order on the audio thread.
+// Offline rendering has its own group state and workers, so it never
+// holds up the audio thread.
+
+struct audio_render_group {
+    std::vector<int> children; // indices into the root's live children
+    std::vector<float> data;
+};
+
+struct audio_group_renderer;
+
+struct audio_worker {
+    am_thread *thread;
+    am_semaphore *start;
+    am_audio_buffer_pool pool;
+    audio_group_renderer *renderer;
+    bool quit;
+};
+
+struct audio_group_renderer {
+    am_audio_context *context;
+    std::vector<audio_worker*> workers;
+    am_semaphore *workers_done;
+    std::vector<int> group_parent; // union-find over the root's live children
+    std::vector<int> group_index;
+    std::vector<audio_render_group> groups;
+    int num_groups;
+    bool groups_ok;
+    volatile uint32_t next_group;
+    int channels;
+    int samples;
+
+    audio_group_renderer(am_audio_context *context) : context(context) {
+        workers_done = NULL;
+        num_groups = 0;
+        groups_ok = true;
+        next_group = 0;
+        channels = 0;
+        samples = 0;
+    }
+};
+
+static audio_group_renderer live_renderer(&audio_context);
+static audio_group_renderer offline_renderer(&offline_context);
+
+static int find_group(audio_group_renderer *r, int g) {
+    while (r->group_parent[g] != g) {
+        r->group_parent[g] = r->group_parent[r->group_parent[g]];
+        g = r->group_parent[g];
+    }
+    return g;
+}
+
+static void merge_groups(audio_group_renderer *r, int g1, int g2) {
+    g1 = find_group(r, g1);
+    g2 = find_group(r, g2);
+    // the smallest index is always the representative, so
+    // groups are mixed in the order their children were added
+    if (g1 < g2) {
+        r->group_parent[g2] = g1;
+    } else if (g2 < g1) {
+        r->group_parent[g1] = g2;
+    }
+}
+
+// Applies parameter updates queued since the last render and records
+// which of the root's children each node is reachable from.
+static void update_params(audio_group_renderer *r, am_audio_node *node, int group) {
+    am_audio_context *context = r->context;
+    if (node->last_update > context->render_id) {
+        // already visited
+        if (group >= 0) {
+            if (node->render_group < 0) {
+                // the root is reachable from one of its children
+                r->groups_ok = false;
+            } else {
+                merge_groups(r, node->render_group, group);
+            }
+        }
+        return;
+    }
+    node->last_update = context->render_id + 1;
+    node->render_group = group;
+    node->update_params();
+    for (int i = 0; i < node->live_children.size; i++) {
+        update_params(r, node->live_children.arr[i].child, group < 0 ? i : group);
+    }
+}
+
+static void update_root_params(audio_group_renderer *r) {
+    am_audio_node *root = r->context->root;
+    int n = root->live_children.size;
+    r->group_parent.resize(n);
+    for (int i = 0; i < n; i++) {
+        r->group_parent[i] = i;
+    }
+    r->groups_ok = true;
+    update_params(r, root, -1);
+}
+
+static void build_render_groups(audio_group_renderer *r) {
+    am_audio_node *root = r->context->root;
+    int n = root->live_children.size;
+    r->group_index.resize(n);
+    r->num_groups = 0;
+    for (int i = 0; i < n; i++) {
+        int g = find_group(r, i);
+        if (g == i) {
+            r->group_index[i] = r->num_groups++;
+            if ((int)r->groups.size() < r->num_groups) {
+                r->groups.resize(r->num_groups);
+            }
+            r->groups[r->group_index[i]].children.clear();
+        }
+        r->groups[r->group_index[g]].children.push_back(i);
+    }
+}
+
+static void render_group(audio_group_renderer *r, audio_render_group *group, am_audio_buffer_pool *pool) {
+    am_audio_node *root = r->context->root;
+    am_audio_bus bus(r->channels, r->samples, &group->data[0]);
+    bus.pool = pool;
+    memset(bus.buffer, 0, r->channels * r->samples * sizeof(float));
+    for (unsigned int i = 0; i < group->children.size(); i++) {
+        render_child(r->context, &bus, &root->live_children.arr[group->children[i]]);
+    }
+}
+
+static void render_claimed_groups(audio_group_renderer *r, am_audio_buffer_pool *pool) {
+    while (true) {
+        int g = (int)am_atomic_add(&r->next_group, 1) - 1;
+        if (g >= r->num_groups) break;
+        render_group(r, &r->groups[g], pool);
+    }
+}
+
+static void audio_worker_main(void *data) {
+    audio_worker *worker = (audio_worker*)data;
+    while (true) {
+        am_wait_semaphore(worker->start);
+        if (worker->quit) break;
+        render_claimed_groups(worker->renderer, &worker->pool);
+        am_signal_semaphore(worker->renderer->workers_done);
+    }
+}
+
+static void stop_audio_workers(audio_group_renderer *r) {
+    for (unsigned int i = 0; i < r->workers.size(); i++) {
+        audio_worker *worker = r->workers[i];
+        worker->quit = true;
+        am_signal_semaphore(worker->start);
+        am_join_thread(worker->thread);
+        am_destroy_semaphore(worker->start);
+        clear_buffer_pool(&worker->pool);
+        delete worker;
+    }
+    r->workers.clear();
+}
+
+static void destroy_group_renderer(audio_group_renderer *r) {
+    stop_audio_workers(r);
+    if (r->workers_done != NULL) {
+        am_destroy_semaphore(r->workers_done);
+        r->workers_done = NULL;
+    }
+}
+
+// Must be called when the renderer's workers aren't busy. For the live
+// renderer that means while the audio thread is locked out.
+static void update_audio_workers(audio_group_renderer *r) {
+    int num_workers = requested_audio_threads - 1;
+    if (num_workers == (int)r->workers.size()) return;
+    stop_audio_workers(r);
+    if (num_workers > 0 && r->workers_done == NULL) {
+        r->workers_done = am_create_semaphore();
+    }
+    for (int i = 0; i < num_workers; i++) {
+        audio_worker *worker = new audio_worker();
+        worker->start = am_create_semaphore();
+        worker->renderer = r;
+        worker->quit = false;
+        worker->thread = am_create_thread(audio_worker_main, worker);
+        if (worker->thread == NULL) {
+            // threads not supported
+            am_destroy_semaphore(worker->start);
+            delete worker;
+            break;
+        }
+        r->workers.push_back(worker);
+    }
+    // don't keep retrying if threads couldn't be created
+    requested_audio_threads = (int)r->workers.size() + 1;
+}
+
+static void render_root(audio_group_renderer *r, am_audio_bus *bus) {
+    am_audio_context *context = r->context;
+    am_audio_node *root = context->root;
+    int num_workers = (int)r->workers.size();
+    if (num_workers == 0 || !r->groups_ok || root->recursion_limit < 0) {
+        root->render_audio(context, bus);
+        return;
+    }
+    build_render_groups(r);
+    if (r->num_groups < 2) {
+        root->render_audio(context, bus);
+        return;
+    }
+    // the root is always a plain audio node, so rendering the groups
+    // is equivalent to calling its render_children.
+    r->channels = bus->num_channels;
+    r->samples = bus->num_samples;
+    for (int g = 0; g < r->num_groups; g++) {
+        r->groups[g].data.resize(r->channels * r->samples);
+    }
+    am_atomic_store(&r->next_group, 0);
+    int num_woken = am_min(num_workers, r->num_groups - 1);
+    for (int w = 0; w < num_woken; w++) {
+        am_signal_semaphore(r->workers[w]->start);
+    }
+    render_claimed_groups(r, bus->pool == NULL ? &default_buffer_pool : bus->pool);
+    for (int w = 0; w < num_woken; w++) {
+        am_wait_semaphore(r->workers_done);
+    }
+    for (int g = 0; g < r->num_groups; g++) {
+        am_audio_bus group_bus(r->channels, r->samples, &r->groups[g].data[0]);
+        mix_bus(bus, &group_bus);
+    }
+}
+
+//-------------------------------------------------------------------------
+
 void am_destroy_audio() {
+    destroy_group_renderer(&live_renderer);
+    destroy_group_renderer(&offline_renderer);
+    stop_stream_thread();
+    requested_audio_threads = 1;
     audio_context.root = NULL;
-    clear_buffer_pool();
+    clear_buffer_pool(&default_buffer_pool);
 }
 
 static void update_live_pause_state(am_audio_node *node) {
@@ -1612,18 +2096,21 @@ void am_fill_audio_bus(am_audio_bus *bus) {
     if (am_record_perf_timings) {
         t0 = am_get_current_time();
     }
+    am_profile_begin(AM_PROFILE_AUDIO_THREAD, "audio");
+    update_root_params(&live_renderer);
     if (!am_conf_audio_mute) {
 #if AM_STEAMWORKS
         // mute audio if steam overlay shown
         if (!am_steam_overlay_enabled) {
 #endif
-            audio_context.root->render_audio(&audio_context, bus);
+            render_root(&live_renderer, bus);
 #if AM_STEAMWORKS
         }
 #endif
     }
     audio_context.render_id++;
     do_post_render(&audio_context, bus->num_samples, audio_context.root);
+    am_profile_end(AM_PROFILE_AUDIO_THREAD);
     if (am_record_perf_timings) {
         audio_time_accum += am_get_current_time() - t0;
     }
@@ -1711,8 +2198,102 @@ static void sync_audio_graph(lua_State *L, am_audio_context *context, am_audio_n
     audio_time_accum = 0.0;
 }
 
+//-------------------------------------------------------------------------
+// Offline rendering, used by the audio benchmarks.
+
+static am_audio_buffer_pool offline_buffer_pool;
+
+static void update_offline_params(am_audio_context *context, am_audio_node *node) {
+    if (node->last_update > context->render_id) return;
+    node->last_update = context->render_id + 1;
+    node->update_params();
+    for (int i = 0; i < node->live_children.size; i++) {
+        update_offline_params(context, node->live_children.arr[i].child);
+    }
+}
+
+// Renders the given node, which should not be connected to the root
+// audio node, for the given number of samples per channel and returns
+// the time taken. A plain audio node is rendered the same way as the
+// root, so its children are split across the audio threads. If a float view is given the output is written to it,
+// one block at a time with each block's channels one after the other.
+// Otherwise the output is discarded.
+static int render_audio_offline(lua_State *L) {
+    int nargs = am_check_nargs(L, 2);
+    am_audio_node *node = am_get_userdata(L, am_audio_node, 1);
+    int total_samples = luaL_checkinteger(L, 2);
+    int num_channels = am_conf_audio_channels;
+    int num_samples = am_conf_audio_buffer_size;
+    am_buffer_view *out = NULL;
+    if (nargs > 2) {
+        out = am_get_userdata(L, am_buffer_view, 3);
+        if (out->type != AM_VIEW_TYPE_F32 || out->components != 1) {
+            return luaL_error(L, "expecting a float view");
+        }
+        int num_blocks = (total_samples + num_samples - 1) / num_samples;
+        if (out->size < num_blocks * num_samples * num_channels) {
+            return luaL_error(L, "view too small (need %d floats)", num_blocks * num_samples * num_channels);
+        }
+        am_check_buffer_data(L, out->buffer);
+    }
+    offline_context.sample_rate = am_conf_audio_sample_rate;
+    offline_context.root = node;
+    std::vector<float> data(num_channels * num_samples);
+    am_audio_bus bus(num_channels, num_samples, &data[0]);
+    bus.pool = &offline_buffer_pool;
+    bool grouped = am_get_type(L, 1) == MT_am_audio_node;
+    if (grouped) {
+        update_audio_workers(&offline_renderer);
+    }
+    double t0 = am_get_current_time();
+    for (int rendered = 0; rendered < total_samples; rendered += num_samples) {
+        offline_context.sync_id++;
+        sync_audio_graph(L, &offline_context, node);
+        memset(&data[0], 0, data.size() * sizeof(float));
+        if (grouped) {
+            update_root_params(&offline_renderer);
+            render_root(&offline_renderer, &bus);
+        } else {
+            update_offline_params(&offline_context, node);
+            node->render_audio(&offline_context, &bus);
+        }
+        offline_context.render_id++;
+        do_post_render(&offline_context, num_samples, node);
+        if (out != NULL) {
+            int index = (rendered / num_samples) * (int)data.size();
+            for (int i = 0; i < (int)data.size(); i++) {
+                *(float*)(out->buffer->data + out->offset + (index + i) * out->stride) = data[i];
+            }
+        }
+    }
+    if (out != NULL && out->size > 0) {
+        out->mark_dirty(0, out->size);
+    }
+    lua_pushnumber(L, am_get_current_time() - t0);
+    offline_context.root = NULL;
+    return 1;
+}
+
+static int audio_kernels(lua_State *L) {
+    const char *names[4];
+    int n = am_supported_audio_kernels(names, 4);
+    lua_createtable(L, n, 0);
+    for (int i = 0; i < n; i++) {
+        lua_pushstring(L, names[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+    return 1;
+}
+
+static int set_audio_kernels(lua_State *L) {
+    am_check_nargs(L, 1);
+    lua_pushboolean(L, am_set_audio_kernels(luaL_checkstring(L, 1)));
+    return 1;
+}
+
 void am_sync_audio_graph(lua_State *L) {
     if (audio_context.root == NULL) return;
+    update_audio_workers(&live_renderer);
     audio_context.sync_id++;
     sync_audio_graph(L, &audio_context, audio_context.root);
 }
@@ -1784,6 +2365,10 @@ void am_open_audio_module(lua_State *L) {
         {"stream", create_audio_stream_node},
         {"load_audio", load_audio},
         {"root_audio_node", get_root_audio_node},
+        {"set_audio_threads", set_audio_threads},
+        {"_render_audio_offline", render_audio_offline},
+        {"_audio_kernels", audio_kernels},
+        {"_set_audio_kernels", set_audio_kernels},
         {NULL, NULL}
     };
     am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
@@ -1798,6 +2383,8 @@ void am_open_audio_module(lua_State *L) {
     register_capture_node_mt(L);
     register_spectrum_node_mt(L);
 
+    am_init_audio_kernels();
+
     audio_context.sample_rate = am_conf_audio_sample_rate;
     audio_context.sync_id = 0;
     audio_context.render_id = 0;
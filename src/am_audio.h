@@ -2,8 +2,12 @@
 #define AM_MIN_FFT_SIZE 64
 #define AM_MAX_FFT_SIZE 2048
 #define AM_MAX_FFT_BINS (AM_MAX_FFT_SIZE / 2 + 1)
+#define AM_AUDIO_PARAM_RING_SIZE 8 // must be a power of 2
+#define AM_MAX_AUDIO_THREADS 16
+#define AM_DEFAULT_STREAM_PREFETCH 0.5 // seconds
 
 struct am_audio_node;
+struct am_audio_buffer_pool;
 
 struct am_audio_context {
     int sample_rate;
@@ -20,6 +24,7 @@ struct am_audio_bus {
     float *channel_data[AM_MAX_CHANNELS]; // these point ...
     float *buffer;                        // ... into this
     bool owns_buffer;
+    am_audio_buffer_pool *pool; // where temporary buses are allocated (NULL for the default pool)
 
     am_audio_bus(int num_channels, int num_samples, float *buffer);
     am_audio_bus(am_audio_bus *bus);
@@ -44,20 +49,59 @@ struct am_audio_node_child {
     }
 };
 
+// Parameter values are set on the main thread and passed to the audio
+// thread through a single producer/single consumer ring, so that new
+// values don't have to wait for the next am_sync_audio_graph.
+// If the ring fills up (because the audio thread is stalled), the
+// latest value is instead picked up during the next sync.
 template<typename T>
 struct am_audio_param {
-    T pending_value;
-    T target_value;
-    T current_value;
+    T pending_value; // main thread
+    T target_value;  // audio thread
+    T current_value; // audio thread
+    T ring[AM_AUDIO_PARAM_RING_SIZE];
+    volatile uint32_t ring_read;
+    volatile uint32_t ring_write;
+    bool ring_overflow;
 
     am_audio_param(T val) {
         pending_value = val;
         target_value = val;
         current_value = val;
+        ring_read = 0;
+        ring_write = 0;
+        ring_overflow = false;
     }
 
+    // Called on the main thread.
+    void set(T val) {
+        pending_value = val;
+        uint32_t w = ring_write;
+        if (ring_overflow || w - am_atomic_load(&ring_read) >= AM_AUDIO_PARAM_RING_SIZE) {
+            ring_overflow = true;
+            return;
+        }
+        ring[w & (AM_AUDIO_PARAM_RING_SIZE - 1)] = val;
+        am_atomic_store(&ring_write, w + 1);
+    }
+
+    // Called on the main thread while the audio thread is locked out.
+    void sync() {
+        if (ring_overflow) {
+            target_value = pending_value;
+            ring_read = ring_write;
+            ring_overflow = false;
+        }
+    }
+
+    // Called on the audio thread before rendering. Only the
+    // most recent value in the ring matters.
     void update_target() {
-        target_value = pending_value;
+        uint32_t r = ring_read;
+        uint32_t w = am_atomic_load(&ring_write);
+        if (r == w) return;
+        target_value = ring[(w - 1) & (AM_AUDIO_PARAM_RING_SIZE - 1)];
+        am_atomic_store(&ring_read, w);
     }
 
     void update_current() {
@@ -91,6 +135,8 @@ struct am_audio_node : am_nonatomic_userdata {
     am_lua_array<am_audio_node_child> live_children;
     int last_sync;
     int last_render;
+    int last_update;
+    int render_group; // index of the root child whose subtree this node was first found in
     uint32_t flags;
     int recursion_limit;
 
@@ -100,6 +146,7 @@ struct am_audio_node : am_nonatomic_userdata {
     void render_children(am_audio_context *context, am_audio_bus *bus);
 
     virtual void sync_params();
+    virtual void update_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
@@ -110,6 +157,7 @@ struct am_gain_node : am_audio_node {
 
     am_gain_node();
     virtual void sync_params();
+    virtual void update_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
 };
@@ -150,6 +198,7 @@ struct am_lowpass_filter_node : am_biquad_filter_node {
     
     am_lowpass_filter_node();
     virtual void sync_params();
+    virtual void update_params();
 };
 
 struct am_highpass_filter_node : am_biquad_filter_node {
@@ -158,6 +207,7 @@ struct am_highpass_filter_node : am_biquad_filter_node {
     
     am_highpass_filter_node();
     virtual void sync_params();
+    virtual void update_params();
 };
 
 struct am_audio_track_node : am_audio_node {
@@ -177,15 +227,29 @@ struct am_audio_track_node : am_audio_node {
 
     am_audio_track_node();
     virtual void sync_params();
+    virtual void update_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
 };
 
+// Decoded audio waiting to be played by a stream node. Filled ahead of
+// time by the stream decoder thread and drained by the audio thread.
+struct am_audio_stream_ring {
+    float *data; // capacity samples for each channel, one channel after the other
+    int num_channels;
+    uint32_t capacity; // power of 2
+    volatile uint32_t read;
+    volatile uint32_t write;
+    volatile uint32_t eof;
+};
+
 struct am_audio_stream_node : am_audio_node {
     am_buffer *buffer;
     int buffer_ref;
     void *handle;
+    am_audio_stream_ring *ring; // NULL if decoding on the audio thread
+    int underruns;
     int num_channels;
     int sample_rate;
     float sample_rate_ratio;
@@ -199,6 +263,7 @@ struct am_audio_stream_node : am_audio_node {
 
     am_audio_stream_node();
     virtual void sync_params();
+    virtual void update_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
@@ -219,6 +284,7 @@ struct am_oscillator_node : am_audio_node {
 
     am_oscillator_node();
     virtual void sync_params();
+    virtual void update_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
     virtual bool finished();
@@ -236,6 +302,7 @@ struct am_spectrum_node : am_audio_node {
     
     am_spectrum_node();
     virtual void sync_params();
+    virtual void update_params();
     virtual void render_audio(am_audio_context *context, am_audio_bus *bus);
     virtual void post_render(am_audio_context *context, int num_samples);
 };
@@ -0,0 +1,543 @@
+#include "amulet.h"
+
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(AM_HTML)
+#define AM_AUDIO_SSE2
+#include <emmintrin.h>
+// AVX2 kernels are compiled regardless of the target flags and
+// only used if the CPU supports them.
+#define AM_AUDIO_AVX2
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define AM_TARGET_AVX2
+#else
+#define AM_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define AM_AUDIO_NEON
+#include <arm_neon.h>
+#endif
+
+am_audio_kernels *am_audio_kern = NULL;
+
+//-------------------------------------------------------------------------
+// Scalar kernels. These match the original per-sample loops exactly.
+
+static inline float ramp_gain(int s, float g0, float g1, int ramp) {
+    if (s < ramp) {
+        return g0 + ((float)s / (float)ramp) * (g1 - g0);
+    } else {
+        return g1;
+    }
+}
+
+static void mix_scalar(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n) {
+    for (int i = 0; i < n; i++) {
+        dest[i] += src[i];
+    }
+}
+
+static void mix_gain_scalar(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    int start, float g0, float g1, int ramp)
+{
+    for (int i = 0; i < n; i++) {
+        dest[i] += src[i] * ramp_gain(start + i, g0, g1, ramp);
+    }
+}
+
+static double mix_resample_scalar(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    double pos, double step, int start, float g0, float g1, int ramp)
+{
+    for (int i = 0; i < n; i++) {
+        int read_index = (int)floor(pos);
+        double interpolation_factor = pos - (double)read_index;
+        float sample1 = src[read_index];
+        float sample2 = src[read_index + 1];
+        float interpolated_sample = (1.0 - interpolation_factor) * sample1 + interpolation_factor * sample2;
+        dest[i] += interpolated_sample * ramp_gain(start + i, g0, g1, ramp);
+        pos += step;
+    }
+    return pos;
+}
+
+static void biquad_scalar(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    const am_biquad_filter_coeffs *coeffs, double *x1, double *x2, double *y1, double *y2)
+{
+    double b0 = coeffs->b0;
+    double b1 = coeffs->b1;
+    double b2 = coeffs->b2;
+    double a1 = coeffs->a1;
+    double a2 = coeffs->a2;
+    double px1 = *x1;
+    double px2 = *x2;
+    double py1 = *y1;
+    double py2 = *y2;
+    while (n--) {
+        float x = *src++;
+        float y = b0*x + b1*px1 + b2*px2 - a1*py1 - a2*py2;
+
+        *dest++ += y;
+
+        px2 = px1;
+        px1 = x;
+        py2 = py1;
+        py1 = y;
+    }
+    *x1 = px1;
+    *x2 = px2;
+    *y1 = py1;
+    *y2 = py2;
+}
+
+static void mix_biquad_scalar(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    const am_biquad_filter_coeffs *coeffs, const am_biquad_filter_state *in_state,
+    am_biquad_filter_state *out_state)
+{
+    double x1 = in_state->x1;
+    double x2 = in_state->x2;
+    double y1 = in_state->y1;
+    double y2 = in_state->y2;
+    biquad_scalar(dest, src, n, coeffs, &x1, &x2, &y1, &y2);
+    out_state->x1 = x1;
+    out_state->x2 = x2;
+    out_state->y1 = y1;
+    out_state->y2 = y2;
+}
+
+static am_audio_kernels scalar_kernels = {
+    "scalar",
+    mix_scalar,
+    mix_gain_scalar,
+    mix_resample_scalar,
+    mix_biquad_scalar,
+};
+
+//-------------------------------------------------------------------------
+// Block biquad. The recurrence means each output depends on the previous
+// one, which prevents vectorization. Instead we work out how much each of
+// the inputs to a block of B samples (x[-2], x[-1], x[0..B-1], y[-2], y[-1])
+// contributes to each of the block's outputs. A block is then a sum of
+// B+4 vectors, scaled by those inputs. Like the scalar loop, the
+// coefficients, the arithmetic and the filter state are all double
+// precision, so low cutoffs and high resonances don't lose precision.
+
+#define AM_MAX_BIQUAD_BLOCK 8
+
+static void biquad_block_matrix(const am_biquad_filter_coeffs *coeffs, int block, double *cols) {
+    int num_inputs = block + 4;
+    for (int v = 0; v < num_inputs; v++) {
+        // x and y are offset by 2, so x[0] is x[-2]
+        double x[AM_MAX_BIQUAD_BLOCK + 2];
+        double y[AM_MAX_BIQUAD_BLOCK + 2];
+        memset(x, 0, sizeof(x));
+        memset(y, 0, sizeof(y));
+        if (v < block + 2) {
+            x[v] = 1.0;
+        } else {
+            y[v - block - 2] = 1.0;
+        }
+        for (int k = 0; k < block; k++) {
+            y[k + 2] = coeffs->b0 * x[k + 2] + coeffs->b1 * x[k + 1] + coeffs->b2 * x[k]
+                - coeffs->a1 * y[k + 1] - coeffs->a2 * y[k];
+            cols[v * block + k] = y[k + 2];
+        }
+    }
+}
+
+static void finish_biquad(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    const am_biquad_filter_coeffs *coeffs, double x1, double x2, double y1, double y2,
+    am_biquad_filter_state *out_state)
+{
+    biquad_scalar(dest, src, n, coeffs, &x1, &x2, &y1, &y2);
+    out_state->x1 = x1;
+    out_state->x2 = x2;
+    out_state->y1 = y1;
+    out_state->y2 = y2;
+}
+
+//-------------------------------------------------------------------------
+// SSE2 kernels
+
+#ifdef AM_AUDIO_SSE2
+
+static void mix_sse2(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128 d0 = _mm_add_ps(_mm_loadu_ps(dest + i), _mm_loadu_ps(src + i));
+        __m128 d1 = _mm_add_ps(_mm_loadu_ps(dest + i + 4), _mm_loadu_ps(src + i + 4));
+        _mm_storeu_ps(dest + i, d0);
+        _mm_storeu_ps(dest + i + 4, d1);
+    }
+    for (; i < n; i++) {
+        dest[i] += src[i];
+    }
+}
+
+static void mix_gain_sse2(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    int start, float g0, float g1, int ramp)
+{
+    int i = 0;
+    int ramp_end = am_clamp(ramp - start, 0, n);
+    __m128 vg0 = _mm_set1_ps(g0);
+    __m128 vdiff = _mm_set1_ps(g1 - g0);
+    __m128 vramp = _mm_set1_ps((float)ramp);
+    __m128 vs = _mm_add_ps(_mm_set1_ps((float)start), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+    __m128 vfour = _mm_set1_ps(4.0f);
+    for (; i + 4 <= ramp_end; i += 4) {
+        __m128 g = _mm_add_ps(vg0, _mm_mul_ps(_mm_div_ps(vs, vramp), vdiff));
+        _mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), _mm_mul_ps(_mm_loadu_ps(src + i), g)));
+        vs = _mm_add_ps(vs, vfour);
+    }
+    for (; i < ramp_end; i++) {
+        dest[i] += src[i] * ramp_gain(start + i, g0, g1, ramp);
+    }
+    __m128 vg1 = _mm_set1_ps(g1);
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), _mm_mul_ps(_mm_loadu_ps(src + i), vg1)));
+    }
+    for (; i < n; i++) {
+        dest[i] += src[i] * g1;
+    }
+}
+
+static double mix_resample_sse2(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    double pos, double step, int start, float g0, float g1, int ramp)
+{
+    int i = 0;
+    __m128d vpos = _mm_set1_pd(pos);
+    __m128d vstep = _mm_set1_pd(step);
+    __m128 vg0 = _mm_set1_ps(g0);
+    __m128 vg1 = _mm_set1_ps(g1);
+    __m128 vdiff = _mm_set1_ps(g1 - g0);
+    __m128 vramp = _mm_set1_ps((float)ramp);
+    int idx[4];
+    for (; i + 4 <= n; i += 4) {
+        __m128d p0 = _mm_add_pd(vpos, _mm_mul_pd(_mm_setr_pd((double)i, (double)(i + 1)), vstep));
+        __m128d p1 = _mm_add_pd(vpos, _mm_mul_pd(_mm_setr_pd((double)(i + 2), (double)(i + 3)), vstep));
+        // positions are never negative, so truncation is the same as floor
+        __m128i i0 = _mm_cvttpd_epi32(p0);
+        __m128i i1 = _mm_cvttpd_epi32(p1);
+        __m128 f0 = _mm_cvtpd_ps(_mm_sub_pd(p0, _mm_cvtepi32_pd(i0)));
+        __m128 f1 = _mm_cvtpd_ps(_mm_sub_pd(p1, _mm_cvtepi32_pd(i1)));
+        __m128 frac = _mm_movelh_ps(f0, f1);
+        _mm_storeu_si128((__m128i*)idx, _mm_unpacklo_epi64(i0, i1));
+        __m128 s1 = _mm_setr_ps(src[idx[0]], src[idx[1]], src[idx[2]], src[idx[3]]);
+        __m128 s2 = _mm_setr_ps(src[idx[0] + 1], src[idx[1] + 1], src[idx[2] + 1], src[idx[3] + 1]);
+        __m128 val = _mm_add_ps(s1, _mm_mul_ps(frac, _mm_sub_ps(s2, s1)));
+
+        __m128 vs = _mm_add_ps(_mm_set1_ps((float)(start + i)), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+        __m128 in_ramp = _mm_cmplt_ps(vs, vramp);
+        __m128 g = _mm_add_ps(vg0, _mm_mul_ps(_mm_div_ps(vs, vramp), vdiff));
+        g = _mm_or_ps(_mm_and_ps(in_ramp, g), _mm_andnot_ps(in_ramp, vg1));
+
+        _mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), _mm_mul_ps(val, g)));
+    }
+    pos += (double)i * step;
+    return mix_resample_scalar(dest + i, src, n - i, pos, step, start + i, g0, g1, ramp);
+}
+
+static void mix_biquad_sse2(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    const am_biquad_filter_coeffs *coeffs, const am_biquad_filter_state *in_state,
+    am_biquad_filter_state *out_state)
+{
+    double cols[8 * 4];
+    biquad_block_matrix(coeffs, 4, cols);
+    // outputs 0 and 1 of each column are in lo, 2 and 3 in hi
+    __m128d lo[8];
+    __m128d hi[8];
+    for (int v = 0; v < 8; v++) {
+        lo[v] = _mm_loadu_pd(cols + v * 4);
+        hi[v] = _mm_loadu_pd(cols + v * 4 + 2);
+    }
+    __m128d x2 = _mm_set1_pd(in_state->x2);
+    __m128d x1 = _mm_set1_pd(in_state->x1);
+    __m128d y2 = _mm_set1_pd(in_state->y2);
+    __m128d y1 = _mm_set1_pd(in_state->y1);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128d xs0 = _mm_set1_pd((double)src[i]);
+        __m128d xs1 = _mm_set1_pd((double)src[i + 1]);
+        __m128d xs2 = _mm_set1_pd((double)src[i + 2]);
+        __m128d xs3 = _mm_set1_pd((double)src[i + 3]);
+        __m128d ylo = _mm_add_pd(
+            _mm_add_pd(
+                _mm_add_pd(_mm_mul_pd(lo[0], x2), _mm_mul_pd(lo[1], x1)),
+                _mm_add_pd(_mm_mul_pd(lo[2], xs0), _mm_mul_pd(lo[3], xs1))),
+            _mm_add_pd(
+                _mm_add_pd(_mm_mul_pd(lo[4], xs2), _mm_mul_pd(lo[5], xs3)),
+                _mm_add_pd(_mm_mul_pd(lo[6], y2), _mm_mul_pd(lo[7], y1))));
+        __m128d yhi = _mm_add_pd(
+            _mm_add_pd(
+                _mm_add_pd(_mm_mul_pd(hi[0], x2), _mm_mul_pd(hi[1], x1)),
+                _mm_add_pd(_mm_mul_pd(hi[2], xs0), _mm_mul_pd(hi[3], xs1))),
+            _mm_add_pd(
+                _mm_add_pd(_mm_mul_pd(hi[4], xs2), _mm_mul_pd(hi[5], xs3)),
+                _mm_add_pd(_mm_mul_pd(hi[6], y2), _mm_mul_pd(hi[7], y1))));
+        __m128 y = _mm_movelh_ps(_mm_cvtpd_ps(ylo), _mm_cvtpd_ps(yhi));
+        _mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), y));
+        x2 = xs2;
+        x1 = xs3;
+        y2 = _mm_unpacklo_pd(yhi, yhi);
+        y1 = _mm_unpackhi_pd(yhi, yhi);
+    }
+    finish_biquad(dest + i, src + i, n - i, coeffs,
+        _mm_cvtsd_f64(x1), _mm_cvtsd_f64(x2), _mm_cvtsd_f64(y1), _mm_cvtsd_f64(y2), out_state);
+}
+
+static am_audio_kernels sse2_kernels = {
+    "sse2",
+    mix_sse2,
+    mix_gain_sse2,
+    mix_resample_sse2,
+    mix_biquad_sse2,
+};
+
+#endif
+
+//-------------------------------------------------------------------------
+// AVX2 kernels
+
+#ifdef AM_AUDIO_AVX2
+
+AM_TARGET_AVX2
+static void mix_avx2(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n) {
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256 d0 = _mm256_add_ps(_mm256_loadu_ps(dest + i), _mm256_loadu_ps(src + i));
+        __m256 d1 = _mm256_add_ps(_mm256_loadu_ps(dest + i + 8), _mm256_loadu_ps(src + i + 8));
+        _mm256_storeu_ps(dest + i, d0);
+        _mm256_storeu_ps(dest + i + 8, d1);
+    }
+    for (; i < n; i++) {
+        dest[i] += src[i];
+    }
+}
+
+AM_TARGET_AVX2
+static void mix_gain_avx2(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    int start, float g0, float g1, int ramp)
+{
+    int i = 0;
+    int ramp_end = am_clamp(ramp - start, 0, n);
+    __m256 vg0 = _mm256_set1_ps(g0);
+    __m256 vdiff = _mm256_set1_ps(g1 - g0);
+    __m256 vramp = _mm256_set1_ps((float)ramp);
+    __m256 vs = _mm256_add_ps(_mm256_set1_ps((float)start),
+        _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f));
+    __m256 veight = _mm256_set1_ps(8.0f);
+    for (; i + 8 <= ramp_end; i += 8) {
+        __m256 g = _mm256_add_ps(vg0, _mm256_mul_ps(_mm256_div_ps(vs, vramp), vdiff));
+        _mm256_storeu_ps(dest + i, _mm256_add_ps(_mm256_loadu_ps(dest + i), _mm256_mul_ps(_mm256_loadu_ps(src + i), g)));
+        vs = _mm256_add_ps(vs, veight);
+    }
+    for (; i < ramp_end; i++) {
+        dest[i] += src[i] * ramp_gain(start + i, g0, g1, ramp);
+    }
+    __m256 vg1 = _mm256_set1_ps(g1);
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(dest + i, _mm256_add_ps(_mm256_loadu_ps(dest + i), _mm256_mul_ps(_mm256_loadu_ps(src + i), vg1)));
+    }
+    for (; i < n; i++) {
+        dest[i] += src[i] * g1;
+    }
+}
+
+AM_TARGET_AVX2
+static double mix_resample_avx2(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    double pos, double step, int start, float g0, float g1, int ramp)
+{
+    int i = 0;
+    __m256d vpos = _mm256_set1_pd(pos);
+    __m256d vstep = _mm256_set1_pd(step);
+    __m256d vlane0 = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+    __m256d vlane1 = _mm256_setr_pd(4.0, 5.0, 6.0, 7.0);
+    __m256 vlanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    __m256 vg0 = _mm256_set1_ps(g0);
+    __m256 vg1 = _mm256_set1_ps(g1);
+    __m256 vdiff = _mm256_set1_ps(g1 - g0);
+    __m256 vramp = _mm256_set1_ps((float)ramp);
+    for (; i + 8 <= n; i += 8) {
+        __m256d vi = _mm256_set1_pd((double)i);
+        __m256d p0 = _mm256_add_pd(vpos, _mm256_mul_pd(_mm256_add_pd(vi, vlane0), vstep));
+        __m256d p1 = _mm256_add_pd(vpos, _mm256_mul_pd(_mm256_add_pd(vi, vlane1), vstep));
+        // positions are never negative, so truncation is the same as floor
+        __m128i i0 = _mm256_cvttpd_epi32(p0);
+        __m128i i1 = _mm256_cvttpd_epi32(p1);
+        __m128 f0 = _mm256_cvtpd_ps(_mm256_sub_pd(p0, _mm256_cvtepi32_pd(i0)));
+        __m128 f1 = _mm256_cvtpd_ps(_mm256_sub_pd(p1, _mm256_cvtepi32_pd(i1)));
+        __m256i idx = _mm256_inserti128_si256(_mm256_castsi128_si256(i0), i1, 1);
+        __m256 frac = _mm256_insertf128_ps(_mm256_castps128_ps256(f0), f1, 1);
+        __m256 s1 = _mm256_i32gather_ps(src, idx, 4);
+        __m256 s2 = _mm256_i32gather_ps(src + 1, idx, 4);
+        __m256 val = _mm256_add_ps(s1, _mm256_mul_ps(frac, _mm256_sub_ps(s2, s1)));
+
+        __m256 vs = _mm256_add_ps(_mm256_set1_ps((float)(start + i)), vlanes);
+        __m256 in_ramp = _mm256_cmp_ps(vs, vramp, _CMP_LT_OQ);
+        __m256 g = _mm256_add_ps(vg0, _mm256_mul_ps(_mm256_div_ps(vs, vramp), vdiff));
+        g = _mm256_blendv_ps(vg1, g, in_ramp);
+
+        _mm256_storeu_ps(dest + i, _mm256_add_ps(_mm256_loadu_ps(dest + i), _mm256_mul_ps(val, g)));
+    }
+    pos += (double)i * step;
+    return mix_resample_scalar(dest + i, src, n - i, pos, step, start + i, g0, g1, ramp);
+}
+
+AM_TARGET_AVX2
+static void mix_biquad_avx2(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    const am_biquad_filter_coeffs *coeffs, const am_biquad_filter_state *in_state,
+    am_biquad_filter_state *out_state)
+{
+    double cols[12 * 8];
+    biquad_block_matrix(coeffs, 8, cols);
+    // outputs 0 to 3 of each column are in lo, 4 to 7 in hi
+    __m256d lo[12];
+    __m256d hi[12];
+    for (int v = 0; v < 12; v++) {
+        lo[v] = _mm256_loadu_pd(cols + v * 8);
+        hi[v] = _mm256_loadu_pd(cols + v * 8 + 4);
+    }
+    __m256d in[12];
+    in[0] = _mm256_set1_pd(in_state->x2);
+    in[1] = _mm256_set1_pd(in_state->x1);
+    in[10] = _mm256_set1_pd(in_state->y2);
+    in[11] = _mm256_set1_pd(in_state->y1);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        for (int k = 0; k < 8; k++) {
+            in[k + 2] = _mm256_set1_pd((double)src[i + k]);
+        }
+        __m256d ylo = _mm256_mul_pd(lo[0], in[0]);
+        __m256d yhi = _mm256_mul_pd(hi[0], in[0]);
+        for (int v = 1; v < 12; v++) {
+            ylo = _mm256_add_pd(ylo, _mm256_mul_pd(lo[v], in[v]));
+            yhi = _mm256_add_pd(yhi, _mm256_mul_pd(hi[v], in[v]));
+        }
+        __m256 y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(ylo)), _mm256_cvtpd_ps(yhi), 1);
+        _mm256_storeu_ps(dest + i, _mm256_add_ps(_mm256_loadu_ps(dest + i), y));
+        in[0] = in[8];
+        in[1] = in[9];
+        in[10] = _mm256_permute4x64_pd(yhi, 0xAA);
+        in[11] = _mm256_permute4x64_pd(yhi, 0xFF);
+    }
+    finish_biquad(dest + i, src + i, n - i, coeffs,
+        _mm_cvtsd_f64(_mm256_castpd256_pd128(in[1])), _mm_cvtsd_f64(_mm256_castpd256_pd128(in[0])), _mm_cvtsd_f64(_mm256_castpd256_pd128(in[11])), _mm_cvtsd_f64(_mm256_castpd256_pd128(in[10])), out_state);
+}
+
+static am_audio_kernels avx2_kernels = {
+    "avx2",
+    mix_avx2,
+    mix_gain_avx2,
+    mix_resample_avx2,
+    mix_biquad_avx2,
+};
+
+static bool cpu_supports_avx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    // check the OS saves the ymm registers
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+//-------------------------------------------------------------------------
+// NEON kernels. 32 bit ARM has no vector division or double precision
+// vector arithmetic, so the gain ramp, resampling and biquad stay scalar.
+
+#ifdef AM_AUDIO_NEON
+
+static void mix_neon(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        float32x4_t d0 = vaddq_f32(vld1q_f32(dest + i), vld1q_f32(src + i));
+        float32x4_t d1 = vaddq_f32(vld1q_f32(dest + i + 4), vld1q_f32(src + i + 4));
+        vst1q_f32(dest + i, d0);
+        vst1q_f32(dest + i + 4, d1);
+    }
+    for (; i < n; i++) {
+        dest[i] += src[i];
+    }
+}
+
+static void mix_gain_neon(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+    int start, float g0, float g1, int ramp)
+{
+    int i = am_clamp(ramp - start, 0, n);
+    mix_gain_scalar(dest, src, i, start, g0, g1, ramp);
+    float32x4_t vg1 = vdupq_n_f32(g1);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(dest + i, vmlaq_f32(vld1q_f32(dest + i), vld1q_f32(src + i), vg1));
+    }
+    for (; i < n; i++) {
+        dest[i] += src[i] * g1;
+    }
+}
+
+static am_audio_kernels neon_kernels = {
+    "neon",
+    mix_neon,
+    mix_gain_neon,
+    mix_resample_scalar,
+    mix_biquad_scalar,
+};
+
+#endif
+
+//-------------------------------------------------------------------------
+
+static int supported_kernels(am_audio_kernels **kernels) {
+    int n = 0;
+#ifdef AM_AUDIO_AVX2
+    if (cpu_supports_avx2()) {
+        kernels[n++] = &avx2_kernels;
+    }
+#endif
+#ifdef AM_AUDIO_SSE2
+    kernels[n++] = &sse2_kernels;
+#endif
+#ifdef AM_AUDIO_NEON
+    kernels[n++] = &neon_kernels;
+#endif
+    kernels[n++] = &scalar_kernels;
+    return n;
+}
+
+void am_init_audio_kernels() {
+    am_audio_kernels *kernels[4];
+    supported_kernels(kernels);
+    am_audio_kern = kernels[0];
+}
+
+bool am_set_audio_kernels(const char *name) {
+    am_audio_kernels *kernels[4];
+    int n = supported_kernels(kernels);
+    for (int i = 0; i < n; i++) {
+        if (strcmp(kernels[i]->name, name) == 0) {
+            am_audio_kern = kernels[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+int am_supported_audio_kernels(const char **names, int max) {
+    am_audio_kernels *kernels[4];
+    int n = am_min(supported_kernels(kernels), max);
+    for (int i = 0; i < n; i++) {
+        names[i] = kernels[i]->name;
+    }
+    return n;
+}
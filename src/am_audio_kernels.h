@@ -0,0 +1,34 @@
+// The inner loops of the audio renderer. There is an implementation
+// of each kernel for every instruction set we support and the fastest
+// one the CPU can run is selected in am_init_audio_kernels.
+//
+// All kernels accumulate into dest. Where a gain is applied, the gain
+// for sample s is g0 + (s / ramp) * (g1 - g0) for s < ramp and g1
+// after that (the same as am_audio_param::interpolate_linear), where
+// s is the sample's index plus start.
+struct am_audio_kernels {
+    const char *name;
+
+    void (*mix)(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n);
+
+    void (*mix_gain)(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+        int start, float g0, float g1, int ramp);
+
+    // Linearly interpolates src at positions pos, pos + step, pos + 2*step, ...
+    // The caller must ensure every position is less than src_len - 1.
+    // Returns the position after the last sample.
+    double (*mix_resample)(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+        double pos, double step, int start, float g0, float g1, int ramp);
+
+    void (*mix_biquad)(float * AM_RESTRICT dest, const float * AM_RESTRICT src, int n,
+        const am_biquad_filter_coeffs *coeffs, const am_biquad_filter_state *in_state,
+        am_biquad_filter_state *out_state);
+};
+
+extern am_audio_kernels *am_audio_kern;
+
+void am_init_audio_kernels();
+// Returns false if the named kernels aren't supported on this CPU.
+bool am_set_audio_kernels(const char *name);
+// Returns the names of the supported kernels, fastest first.
+int am_supported_audio_kernels(const char **names, int max);
@@ -42,6 +42,9 @@ double am_get_current_time();
 
 // returned pointer and errmsg should be freed with free()
 void *am_read_resource(const char *filename, int *len, char** errmsg);
+// Returns the package am_read_resource would read filename from, or
+// NULL if it would be read from somewhere else.
+am_package *am_get_resource_package(const char *filename);
 
 int am_next_video_capture_frame();
 void am_copy_video_frame_to_texture();
@@ -433,6 +433,11 @@ void *am_read_resource(const char *filename, int *len, char** errmsg) {
     return buf;
 }
 
+am_package *am_get_resource_package(const char *filename) {
+    // resources are read from the apk's assets
+    return NULL;
+}
+
 int am_next_video_capture_frame() {
     return 0;
 }
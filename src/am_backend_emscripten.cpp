@@ -640,6 +640,10 @@ void *am_read_resource(const char *filename, int *len, char **errmsg) {
     }
 }
 
+am_package *am_get_resource_package(const char *filename) {
+    return package;
+}
+
 static int video_frame = 0;
 int am_next_video_capture_frame() {
     return video_frame++;
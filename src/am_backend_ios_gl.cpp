@@ -1062,6 +1062,10 @@ void *am_read_resource(const char *filename, int *len, char** errmsg) {
     return am_read_package_resource(package, filename, len, errmsg);
 }
 
+am_package *am_get_resource_package(const char *filename) {
+    return package;
+}
+
 void am_copy_video_frame_to_texture() {
 }
 
@@ -71,7 +71,7 @@ extern int am_metal_window_pwidth;
 extern int am_metal_window_pheight;
 extern int am_metal_window_swidth;
 extern int am_metal_window_sheight;
-#else
+#elif !defined(AM_USE_NULL_GL)
 static SDL_GLContext gl_context;
 static bool gl_context_initialized = false;
 #endif
@@ -117,6 +117,9 @@ am_native_window *am_create_native_window(
         am_log0("%s", "sorry, only one window is supported");
         return NULL;
     }
+#elif defined(AM_USE_NULL_GL)
+    // no gl context, windows are created by sdl's dummy video driver
+    Uint32 flags = 0;
 #else
     // using gl
     if (main_window != NULL) {
@@ -187,7 +190,7 @@ am_native_window *am_create_native_window(
     am_metal_window_depth_buffer = depth_buffer;
     am_metal_window_stencil_buffer = stencil_buffer;
     am_metal_window_msaa_samples = msaa_samples;
-#else
+#elif !defined(AM_USE_NULL_GL)
     if (!gl_context_initialized) {
         gl_context = SDL_GL_CreateContext(win);
 #ifdef AM_NEED_GL_FUNC_PTRS
@@ -351,7 +354,7 @@ void am_destroy_native_window(am_native_window* window) {
 }
 
 void am_native_window_bind_framebuffer(am_native_window* window) {
-#if !defined(AM_USE_METAL)
+#if !defined(AM_USE_METAL) && !defined(AM_USE_NULL_GL)
     SDL_GL_MakeCurrent((SDL_Window*)window, gl_context);
 #endif
     am_bind_framebuffer(0);
@@ -359,7 +362,7 @@ void am_native_window_bind_framebuffer(am_native_window* window) {
 
 void am_native_window_swap_buffers(am_native_window* window) {
     am_gl_end_frame(true);
-#if !defined(AM_USE_METAL)
+#if !defined(AM_USE_METAL) && !defined(AM_USE_NULL_GL)
     SDL_GL_SwapWindow((SDL_Window*)window);
 #endif
 }
@@ -455,6 +458,11 @@ void *am_read_resource(const char *filename, int *len, char **errmsg) {
     }
 }
 
+am_package *am_get_resource_package(const char *filename) {
+    bool force_filesystem = filename[0] == '@';
+    return force_filesystem ? NULL : package;
+}
+
 #if !(defined (AM_OSX) && !defined(AM_USE_METAL))// see am_videocapture_osx.cpp for OSX (opengl) definition
 int am_next_video_capture_frame() {
     return 0;
@@ -536,7 +544,9 @@ static int launch_url(lua_State *L) {
 
 int main( int argc, char *argv[] )
 {
+#if !defined(AM_USE_METAL) && !defined(AM_USE_NULL_GL)
     int vsync;
+#endif
     double t0;
     double t_debt;
     double frame_time = 0.0;
@@ -611,10 +621,12 @@ restart:
     t0 = am_get_current_time();
     frame_time = t0;
     t_debt = 0.0;
+#if !defined(AM_USE_METAL) && !defined(AM_USE_NULL_GL)
     vsync = -2;
+#endif
 
     while (windows.size() > 0 && !restart_triggered) {
-#if !defined(AM_USE_METAL)
+#if !defined(AM_USE_METAL) && !defined(AM_USE_NULL_GL)
         if (vsync != (am_conf_vsync ? 1 : 0)) {
             vsync = (am_conf_vsync ? 1 : 0);
             SDL_GL_SetSwapInterval(vsync);
@@ -880,6 +892,10 @@ static void add_extra_controller_mappings() {
 
 static void init_sdl() {
     add_extra_controller_mappings();
+#if defined(AM_USE_NULL_GL)
+    // run without a display
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+#endif
     SDL_Init(SDL_INIT_TIMER | SDL_INIT_AUDIO | SDL_INIT_VIDEO | SDL_INIT_JOYSTICK | SDL_INIT_HAPTIC | SDL_INIT_GAMECONTROLLER);
     init_audio();
     init_controllers();
@@ -912,6 +928,9 @@ static void audio_callback(void *ud, Uint8 *stream, int len) {
     if (len != (int)sizeof(float) * am_conf_audio_buffer_size * am_conf_audio_channels) {
         // This will cause the buffer pool to be reset. See push_buffer in am_audio.cpp.
         am_conf_audio_buffer_size = len / ((int)sizeof(float) * am_conf_audio_channels);
+        // audio_buffer was allocated for the old size
+        free(audio_buffer);
+        audio_buffer = (float*)malloc(len);
     }
     int num_channels = am_conf_audio_channels;
     int num_samples = am_conf_audio_buffer_size;
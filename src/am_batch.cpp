@@ -0,0 +1,481 @@
+#include "amulet.h"
+
+am_batch_state::am_batch_state() {
+    depth = 0;
+    run = 0;
+    position_name = -1;
+}
+
+static bool is_attribute_param(am_program_param *param) {
+    return param->type >= AM_PROGRAM_PARAM_ATTRIBUTE_1F;
+}
+
+static int attribute_param_components(am_program_param *param) {
+    return param->type - AM_PROGRAM_PARAM_ATTRIBUTE_1F + 1;
+}
+
+// Number of doubles used by a uniform value of the given type,
+// or -1 for samplers and arrays.
+static int uniform_value_size(am_program_param_client_type type) {
+    switch (type) {
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_1F: return 1;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_2F: return 2;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_3F: return 3;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_4F: return 4;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_MAT2: return 4;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_MAT3: return 9;
+        case AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4: return 16;
+        default: return -1;
+    }
+}
+
+// Mirrors the checks in am_program_param::bind, so that any draw
+// that would produce a warning is left to the normal draw path.
+static bool param_value_bindable(am_program_param *param, am_program_param_value *value) {
+    switch (param->type) {
+        case AM_PROGRAM_PARAM_UNIFORM_1F:
+            return value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_1F;
+        case AM_PROGRAM_PARAM_UNIFORM_2F:
+            return value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_2F;
+        case AM_PROGRAM_PARAM_UNIFORM_3F:
+            return value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_3F;
+        case AM_PROGRAM_PARAM_UNIFORM_4F:
+            return value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_4F;
+        case AM_PROGRAM_PARAM_UNIFORM_MAT2:
+            return value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT2;
+        case AM_PROGRAM_PARAM_UNIFORM_MAT3:
+            return value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT3;
+        case AM_PROGRAM_PARAM_UNIFORM_MAT4:
+            return value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4;
+        case AM_PROGRAM_PARAM_UNIFORM_SAMPLER2D:
+            return value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D;
+        case AM_PROGRAM_PARAM_ATTRIBUTE_1F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_2F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_3F:
+        case AM_PROGRAM_PARAM_ATTRIBUTE_4F: {
+            if (value->type != AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY) return false;
+            am_buffer_view *view = value->value.arr;
+            return view->can_be_gl_attrib()
+                && view->buffer->data != NULL
+                && view->buffer->arraybuf != NULL;
+        }
+    }
+    return false;
+}
+
+// The modelview matrix can only be baked into the position attribute
+// if the components the shader doesn't read would keep their default
+// values after transformation.
+static bool can_bake_modelview(am_render_state *rstate, am_program *prog) {
+    am_batch_state *batch = rstate->batch;
+    if (batch->position_name < 0) return false;
+    int components = 0;
+    bool has_modelview = false;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param *param = &prog->params[i];
+        if (param->name == batch->position_name && is_attribute_param(param)) {
+            components = attribute_param_components(param);
+        } else if (param->name == rstate->modelview_param_index
+            && param->type == AM_PROGRAM_PARAM_UNIFORM_MAT4)
+        {
+            has_modelview = true;
+        }
+    }
+    if (!has_modelview || components < 2) return false;
+    am_program_param_value *mv = &rstate->param_name_map[rstate->modelview_param_index].value;
+    if (mv->type != AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) return false;
+    glm::dmat4 m = *((glm::dmat4*)&mv->value.m4[0]);
+    if (components < 4) {
+        if (m[0][3] != 0.0 || m[1][3] != 0.0 || m[2][3] != 0.0 || m[3][3] != 1.0) return false;
+    }
+    if (components < 3) {
+        if (m[0][2] != 0.0 || m[1][2] != 0.0 || m[3][2] != 0.0) return false;
+    }
+    return true;
+}
+
+bool am_batch_capture_draw(am_render_state *rstate, am_draw_mode mode,
+    int first, int count, am_buffer_view *indices_view, am_element_index_type type)
+{
+    am_batch_state *batch = rstate->batch;
+    am_program *prog = rstate->active_program;
+    // Only list primitives can be concatenated.
+    if (mode != AM_DRAWMODE_POINTS &&
+        mode != AM_DRAWMODE_LINES &&
+        mode != AM_DRAWMODE_TRIANGLES)
+    {
+        return false;
+    }
+    if (mode == AM_DRAWMODE_POINTS && !prog->sets_point_size) return false;
+    if (rstate->instance_count > 0) return false;
+
+    int max_size = INT_MAX;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param *param = &prog->params[i];
+        am_program_param_value *value = &rstate->param_name_map[param->name].value;
+        if (!param_value_bindable(param, value)) return false;
+        if (is_attribute_param(param) && value->value.arr->size < max_size) {
+            max_size = value->value.arr->size;
+        }
+    }
+    if (max_size == INT_MAX) return false;
+
+    int num_verts;
+    if (indices_view == NULL) {
+        if (count > max_size - first) count = max_size - first;
+        if (count <= 0) return true;
+        num_verts = count;
+    } else {
+        if (indices_view->buffer->elembuf == NULL) return false;
+        indices_view->buffer->update_if_dirty();
+        indices_view->update_max_elem_if_required();
+        if (indices_view->size > 0 && (int)indices_view->max_elem >= max_size) return false;
+        if (count > indices_view->size - first) count = indices_view->size - first;
+        if (count <= 0) return true;
+        num_verts = (int)indices_view->max_elem + 1;
+    }
+    if (num_verts > AM_MAX_BATCHED_DRAW_VERTICES) return false;
+
+    am_batch_draw draw;
+    am_init_captured_draw(rstate, &draw, mode, first, count, indices_view, type, &batch->values);
+    // draws in later passes were already deferred
+    draw.passes = rstate->current_pass;
+    draw.num_verts = num_verts;
+    draw.bake_modelview = can_bake_modelview(rstate, prog);
+    batch->draws.push_back(draw);
+    return true;
+}
+
+// memcmp may report states as different because of padding,
+// but never reports different states as the same, which is all
+// we need here.
+#define SAME_STATE(a, b, field) (memcmp(&(a)->field, &(b)->field, sizeof((a)->field)) == 0)
+
+static bool can_merge(am_render_state *rstate, am_batch_draw *a, am_batch_draw *b) {
+    if (a->program != b->program) return false;
+    if (a->mode != b->mode) return false;
+    if (a->bake_modelview != b->bake_modelview) return false;
+    if (!SAME_STATE(a, b, viewport_state)) return false;
+    if (!SAME_STATE(a, b, scissor_test_state)) return false;
+    if (!SAME_STATE(a, b, color_mask_state)) return false;
+    if (!SAME_STATE(a, b, depth_test_state)) return false;
+    if (!SAME_STATE(a, b, stencil_test_state)) return false;
+    if (!SAME_STATE(a, b, cull_face_state)) return false;
+    if (!SAME_STATE(a, b, blend_state)) return false;
+    am_batch_state *batch = rstate->batch;
+    am_program *prog = a->program;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param *param = &prog->params[i];
+        if (is_attribute_param(param)) continue;
+        if (a->bake_modelview && param->name == rstate->modelview_param_index) continue;
+        am_program_param_value *va = &batch->values[a->values_offset + i];
+        am_program_param_value *vb = &batch->values[b->values_offset + i];
+        if (va->type == AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D) {
+            if (va->value.sampler2d.texture != vb->value.sampler2d.texture) return false;
+        } else {
+            int n = uniform_value_size(va->type);
+            if (memcmp(&va->value.m4[0], &vb->value.m4[0], n * sizeof(double)) != 0) return false;
+        }
+    }
+    return true;
+}
+
+void am_init_captured_draw(am_render_state *rstate, am_batch_draw *draw,
+    am_draw_mode mode, int first, int count, am_buffer_view *indices_view,
+    am_element_index_type type, std::vector<am_program_param_value> *values)
+{
+    am_program *prog = rstate->active_program;
+    draw->program = prog;
+    draw->mode = mode;
+    draw->first = first;
+    draw->count = count;
+    draw->num_verts = 0;
+    draw->indices_view = indices_view;
+    draw->type = type;
+    draw->values_offset = values->size();
+    draw->bake_modelview = false;
+    draw->instance_count = rstate->instance_count;
+    draw->num_instance_params = rstate->num_instance_params;
+    draw->instance_param_names = rstate->instance_param_names;
+    draw->passes = rstate->pass & rstate->pass_mask;
+    draw->viewport_state = rstate->active_viewport_state;
+    draw->scissor_test_state = rstate->active_scissor_test_state;
+    draw->color_mask_state = rstate->active_color_mask_state;
+    draw->depth_test_state = rstate->active_depth_test_state;
+    draw->stencil_test_state = rstate->active_stencil_test_state;
+    draw->cull_face_state = rstate->active_cull_face_state;
+    draw->blend_state = rstate->active_blend_state;
+    for (int i = 0; i < prog->num_params; i++) {
+        values->push_back(rstate->param_name_map[prog->params[i].name].value);
+    }
+}
+
+void am_apply_captured_draw_state(am_render_state *rstate, am_batch_draw *draw,
+    am_program_param_value *values)
+{
+    am_program *prog = draw->program;
+    rstate->active_viewport_state = draw->viewport_state;
+    rstate->active_scissor_test_state = draw->scissor_test_state;
+    rstate->active_color_mask_state = draw->color_mask_state;
+    rstate->active_depth_test_state = draw->depth_test_state;
+    rstate->active_stencil_test_state = draw->stencil_test_state;
+    rstate->active_cull_face_state = draw->cull_face_state;
+    rstate->active_blend_state = draw->blend_state;
+    rstate->active_program = prog;
+    for (int i = 0; i < prog->num_params; i++) {
+        rstate->param_name_map[prog->params[i].name].value = values[i];
+    }
+}
+
+void am_replay_captured_draw(am_render_state *rstate, am_batch_draw *draw,
+    am_program_param_value *values)
+{
+    am_apply_captured_draw_state(rstate, draw, values);
+    // The draw already passed the pass check when it was captured.
+    uint32_t old_pass = rstate->pass;
+    uint32_t old_pass_mask = rstate->pass_mask;
+    rstate->pass = draw->passes & old_pass;
+    rstate->pass_mask = rstate->pass;
+    rstate->instance_count = draw->instance_count;
+    rstate->num_instance_params = draw->num_instance_params;
+    rstate->instance_param_names = draw->instance_param_names;
+    if (draw->indices_view == NULL) {
+        rstate->draw_arrays(draw->mode, draw->first, draw->count);
+    } else {
+        rstate->draw_elements(draw->mode, draw->first, draw->count, draw->indices_view, draw->type);
+    }
+    if (draw->instance_count > 0) {
+        rstate->reset_instance_attrs();
+    }
+    rstate->pass = old_pass;
+    rstate->pass_mask = old_pass_mask;
+}
+
+static void replay_draw(am_render_state *rstate, am_batch_draw *draw) {
+    am_batch_state *batch = rstate->batch;
+    int old_depth = batch->depth;
+    batch->depth = 0;
+    am_replay_captured_draw(rstate, draw, &batch->values[draw->values_offset]);
+    batch->depth = old_depth;
+}
+
+static void draw_merged(am_render_state *rstate, int start, int end, int total_verts) {
+    am_batch_state *batch = rstate->batch;
+    am_batch_draw *draw0 = &batch->draws[start];
+    am_program *prog = draw0->program;
+
+    int stride = 0; // in floats
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param *param = &prog->params[i];
+        if (is_attribute_param(param)) stride += attribute_param_components(param);
+    }
+    bool indexed = false;
+    for (int d = start; d < end; d++) {
+        if (batch->draws[d].indices_view != NULL) indexed = true;
+    }
+
+    batch->verts.resize(total_verts * stride);
+    batch->indices.clear();
+    int base = 0;
+    for (int d = start; d < end; d++) {
+        am_batch_draw *draw = &batch->draws[d];
+        am_program_param_value *values = &batch->values[draw->values_offset];
+        int first_vert = draw->indices_view == NULL ? draw->first : 0;
+        glm::dmat4 mv(1.0);
+        if (draw->bake_modelview) {
+            for (int i = 0; i < prog->num_params; i++) {
+                if (prog->params[i].name == rstate->modelview_param_index) {
+                    mv = *((glm::dmat4*)&values[i].value.m4[0]);
+                }
+            }
+        }
+        int attr_offset = 0;
+        for (int i = 0; i < prog->num_params; i++) {
+            am_program_param *param = &prog->params[i];
+            if (!is_attribute_param(param)) continue;
+            int n = attribute_param_components(param);
+            am_buffer_view *view = values[i].value.arr;
+            am_view_type_info *info = &am_view_type_infos[view->type];
+            int view_components = view->components < n ? view->components : n;
+            bool bake = draw->bake_modelview && param->name == batch->position_name;
+            uint8_t *src = view->buffer->data + view->offset + first_vert * view->stride;
+            float *dst = &batch->verts[base * stride + attr_offset];
+            for (int v = 0; v < draw->num_verts; v++) {
+                glm::dvec4 c(0.0, 0.0, 0.0, 1.0);
+                for (int j = 0; j < view_components; j++) {
+                    c[j] = info->num_reader(src + j * info->size);
+                }
+                if (bake) c = mv * c;
+                for (int j = 0; j < n; j++) {
+                    dst[j] = (float)c[j];
+                }
+                src += view->stride;
+                dst += stride;
+            }
+            attr_offset += n;
+        }
+        if (indexed) {
+            if (draw->indices_view != NULL) {
+                am_buffer_view *iview = draw->indices_view;
+                uint8_t *src = iview->buffer->data + iview->offset + draw->first * iview->stride;
+                for (int k = 0; k < draw->count; k++) {
+                    uint32_t idx = draw->type == AM_ELEMENT_TYPE_USHORT ? *((uint16_t*)src) : *((uint32_t*)src);
+                    batch->indices.push_back((uint16_t)(base + idx));
+                    src += iview->stride;
+                }
+            } else {
+                for (int k = 0; k < draw->num_verts; k++) {
+                    batch->indices.push_back((uint16_t)(base + k));
+                }
+            }
+        }
+        base += draw->num_verts;
+    }
+
+    am_apply_captured_draw_state(rstate, draw0, &batch->values[draw0->values_offset]);
+    if (draw0->bake_modelview) {
+        rstate->param_name_map[rstate->modelview_param_index].value.set_mat4(glm::dmat4(1.0));
+    }
+    rstate->active_viewport_state.bind(rstate, false);
+    rstate->active_scissor_test_state.bind(rstate, false);
+    rstate->active_color_mask_state.bind(rstate, false);
+    rstate->active_depth_test_state.bind(rstate, false);
+    rstate->active_stencil_test_state.bind(rstate, false);
+    rstate->active_cull_face_state.bind(rstate, false);
+    rstate->active_blend_state.bind(rstate, false);
+    rstate->bind_active_program();
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param *param = &prog->params[i];
+        if (!is_attribute_param(param)) param->bind(rstate);
+    }
+
+    // merged vertices are in the stream ring, so use the default vao
+    rstate->bind_vertex_array(0);
+    int vert_offset = am_stream_upload(AM_ARRAY_BUFFER, &batch->verts[0],
+        batch->verts.size() * sizeof(float), NULL);
+    int attr_offset = 0;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param *param = &prog->params[i];
+        if (!is_attribute_param(param)) continue;
+        int n = attribute_param_components(param);
+        am_set_attribute_pointer(param->location, n, AM_ATTRIBUTE_CLIENT_TYPE_FLOAT,
+            false, stride * sizeof(float), vert_offset + attr_offset * sizeof(float));
+        attr_offset += n;
+    }
+    rstate->enable_vaas(prog->num_vaas);
+
+    // validate once for the whole merged draw
+    if (!rstate->validate_active_program(draw0->mode)) return;
+    if (indexed) {
+        int index_offset = am_stream_upload(AM_ELEMENT_ARRAY_BUFFER, &batch->indices[0],
+            batch->indices.size() * sizeof(uint16_t), NULL);
+        am_draw_elements(draw0->mode, batch->indices.size(), AM_ELEMENT_TYPE_USHORT, index_offset);
+    } else {
+        am_draw_arrays(draw0->mode, 0, total_verts);
+    }
+}
+
+void am_batch_flush(am_render_state *rstate) {
+    am_batch_state *batch = rstate->batch;
+    int num_draws = batch->draws.size();
+    if (num_draws == 0) return;
+
+    am_viewport_state       old_viewport_state = rstate->active_viewport_state;
+    am_scissor_test_state   old_scissor_test_state = rstate->active_scissor_test_state;
+    am_color_mask_state     old_color_mask_state = rstate->active_color_mask_state;
+    am_depth_test_state     old_depth_test_state = rstate->active_depth_test_state;
+    am_stencil_test_state   old_stencil_test_state = rstate->active_stencil_test_state;
+    am_cull_face_state      old_cull_face_state = rstate->active_cull_face_state;
+    am_blend_state          old_blend_state = rstate->active_blend_state;
+    am_program              *old_program = rstate->active_program;
+    std::vector<am_program_param_value> old_values;
+
+    int start = 0;
+    while (start < num_draws) {
+        am_batch_draw *draw0 = &batch->draws[start];
+        int total_verts = draw0->num_verts;
+        int end = start + 1;
+        // indices are 16 bit, so a merged draw can reference at most 2^16 vertices
+        while (end < num_draws
+            && total_verts + batch->draws[end].num_verts <= 65536
+            && can_merge(rstate, draw0, &batch->draws[end]))
+        {
+            total_verts += batch->draws[end].num_verts;
+            end++;
+        }
+
+        am_program *prog = draw0->program;
+        old_values.clear();
+        for (int i = 0; i < prog->num_params; i++) {
+            old_values.push_back(rstate->param_name_map[prog->params[i].name].value);
+        }
+        if (end - start == 1) {
+            replay_draw(rstate, draw0);
+        } else {
+            draw_merged(rstate, start, end, total_verts);
+        }
+        for (int i = 0; i < prog->num_params; i++) {
+            rstate->param_name_map[prog->params[i].name].value = old_values[i];
+        }
+        start = end;
+    }
+
+    rstate->active_viewport_state = old_viewport_state;
+    rstate->active_scissor_test_state = old_scissor_test_state;
+    rstate->active_color_mask_state = old_color_mask_state;
+    rstate->active_depth_test_state = old_depth_test_state;
+    rstate->active_stencil_test_state = old_stencil_test_state;
+    rstate->active_cull_face_state = old_cull_face_state;
+    rstate->active_blend_state = old_blend_state;
+    rstate->active_program = old_program;
+
+    batch->draws.clear();
+    batch->values.clear();
+}
+
+void am_batch_node::render(am_render_state *rstate) {
+    if (rstate->batch == NULL) {
+        rstate->batch = new am_batch_state();
+    }
+    am_batch_state *batch = rstate->batch;
+    if (batch->depth == 0) {
+        batch->position_name = position_name;
+        batch->run++;
+    }
+    batch->depth++;
+    render_children(rstate);
+    batch->depth--;
+    if (batch->depth == 0) {
+        am_batch_flush(rstate);
+    }
+}
+
+static int create_batch_node(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    am_batch_node *node = am_new_userdata(L, am_batch_node);
+    node->tags.push_back(L, AM_TAG_BATCH);
+    node->position_name = -1;
+    if (nargs > 0 && !lua_isnil(L, 1)) {
+        node->position_name = am_lookup_param_name(L, 1);
+    }
+    return 1;
+}
+
+static void register_batch_node_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_scene_node_index, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, am_scene_node_newindex, 0);
+    lua_setfield(L, -2, "__newindex");
+
+    am_register_metatable(L, "batch", MT_am_batch_node, MT_am_scene_node);
+}
+
+void am_open_batch_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"batch", create_batch_node},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_batch_node_mt(L);
+}
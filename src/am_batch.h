@@ -0,0 +1,80 @@
+// Draws with more vertices than this are not merged, since the
+// cost of copying them would outweigh the saved draw call.
+#define AM_MAX_BATCHED_DRAW_VERTICES 1024
+
+// A draw captured inside a batch or retained node, along with the
+// render state and parameter values that were active when it was issued.
+struct am_batch_draw {
+    am_program              *program;
+    am_draw_mode            mode;
+    int                     first;
+    int                     count;
+    int                     num_verts;
+    am_buffer_view          *indices_view; // NULL for draw_arrays
+    am_element_index_type   type;
+    int                     values_offset; // index of first param value in the owner's values
+    bool                    bake_modelview;
+    int                     instance_count;
+    int                     num_instance_params;
+    int                     *instance_param_names;
+    uint32_t                passes; // passes the draw is in
+
+    am_viewport_state       viewport_state;
+    am_scissor_test_state   scissor_test_state;
+    am_color_mask_state     color_mask_state;
+    am_depth_test_state     depth_test_state;
+    am_stencil_test_state   stencil_test_state;
+    am_cull_face_state      cull_face_state;
+    am_blend_state          blend_state;
+};
+
+struct am_batch_state {
+    int                                 depth;
+    uint32_t                            run; // incremented when an outermost batch node is rendered
+    am_param_name_id                    position_name; // -1 if modelview should not be baked
+    std::vector<am_batch_draw>          draws;
+    std::vector<am_program_param_value> values;
+    std::vector<float>                  verts;
+    std::vector<uint16_t>               indices;
+
+    am_batch_state();
+};
+
+// Draws in passes after the current one, captured while traversing
+// the scene once for all passes (see am_render_state::single_traversal).
+struct am_deferred_passes {
+    std::vector<am_batch_draw>          draws;
+    std::vector<am_program_param_value> values;
+    // For each draw, the batch run it was captured in (0 if it wasn't
+    // inside a batch node) and that batch's position attribute, so
+    // the draws can be merged again when they're replayed.
+    std::vector<uint32_t>               batch_runs;
+    std::vector<am_param_name_id>       batch_position_names;
+    std::vector<int>                    pass_draws[32]; // indexes into draws
+    uint32_t                            pending; // passes with draws
+};
+
+struct am_batch_node : am_scene_node {
+    am_param_name_id position_name;
+    virtual void render(am_render_state *rstate);
+};
+
+// Returns false if the draw can't be batched, in which case the
+// caller should flush pending draws and then draw immediately.
+bool am_batch_capture_draw(am_render_state *rstate, am_draw_mode mode,
+    int first, int count, am_buffer_view *indices_view, am_element_index_type type);
+void am_batch_flush(am_render_state *rstate);
+
+// Snapshots the active render state and the values of the active
+// program's parameters (appended to values) into draw.
+void am_init_captured_draw(am_render_state *rstate, am_batch_draw *draw,
+    am_draw_mode mode, int first, int count, am_buffer_view *indices_view,
+    am_element_index_type type, std::vector<am_program_param_value> *values);
+// Makes the captured state active. The caller is responsible for
+// restoring the previous state afterwards.
+void am_apply_captured_draw_state(am_render_state *rstate, am_batch_draw *draw,
+    am_program_param_value *values);
+void am_replay_captured_draw(am_render_state *rstate, am_batch_draw *draw,
+    am_program_param_value *values);
+
+void am_open_batch_module(lua_State *L);
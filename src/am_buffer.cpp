@@ -104,6 +104,7 @@ am_buffer::am_buffer() {
     alloc_method = AM_BUF_ALLOC_LUA;
     origin = "anonymous buffer";
     usage = AM_BUFFER_USAGE_STATIC_DRAW;
+    package = NULL;
 }
 
 am_buffer *am_push_new_buffer_and_init(lua_State *L, int size) {
@@ -157,6 +158,16 @@ am_buffer *am_push_new_buffer_with_data(lua_State *L, int size, void* data) {
     return buf;
 }
 
+am_buffer *am_push_new_buffer_with_package_data(lua_State *L, int size, void* data, am_package *pkg) {
+    am_buffer *buf = new(lua_newuserdata(L, sizeof(am_buffer))) am_buffer();
+    am_set_metatable(L, buf, MT_am_buffer_gc);
+    buf->data = (uint8_t*)data;
+    buf->size = size;
+    buf->alloc_method = AM_BUF_ALLOC_PACKAGE;
+    buf->package = pkg;
+    return buf;
+}
+
 void am_buffer::free_data() {
     if (data == NULL) return;
     switch (alloc_method) {
@@ -168,8 +179,36 @@ void am_buffer::free_data() {
             break;
         case AM_BUF_ALLOC_POOL_SCRATCH:
             break;
+        case AM_BUF_ALLOC_PACKAGE:
+            am_unmap_package_resource(package, data, size);
+            package = NULL;
+            break;
+    }
+    data = NULL;
+}
+
+uint8_t *am_buffer::take_data(am_package **pkg) {
+    *pkg = NULL;
+    if (data == NULL) return NULL;
+    uint8_t *taken;
+    switch (alloc_method) {
+        case AM_BUF_ALLOC_MALLOC:
+            taken = data;
+            total_buffer_malloc_bytes -= size;
+            break;
+        case AM_BUF_ALLOC_PACKAGE:
+            taken = data;
+            *pkg = package;
+            package = NULL;
+            break;
+        default:
+            // the data belongs to the lua state or the buffer pool
+            taken = (uint8_t*)malloc(size);
+            memcpy(taken, data, size);
+            break;
     }
     data = NULL;
+    return taken;
 }
 
 static int free_buffer(lua_State *L) {
@@ -242,6 +281,17 @@ static int load_buffer(lua_State *L) {
     const char *filename = luaL_checkstring(L, 1);
     int len;
     char *errmsg;
+    am_package *pkg = am_get_resource_package(filename);
+    if (pkg != NULL) {
+        // stored package entries can be used without copying
+        void *data = am_map_package_resource(pkg, filename, &len);
+        if (data != NULL) {
+            am_buffer *buf = am_push_new_buffer_with_package_data(L, len, data, pkg);
+            buf->origin = filename;
+            buf->ref(L, 1);
+            return 1;
+        }
+    }
     void *data = am_read_resource(filename, &len, &errmsg);
     if (data == NULL) {
         free(errmsg);
@@ -259,13 +309,13 @@ static int load_string(lua_State *L) {
     const char *filename = luaL_checkstring(L, 1);
     int len;
     char *errmsg;
-    void *data = am_read_resource(filename, &len, &errmsg);
+    const void *data = am_acquire_resource(filename, &len, &errmsg);
     if (data == NULL) {
         free(errmsg);
         lua_pushnil(L);
     } else {
         lua_pushlstring(L, (const char*)data, len);
-        free(data);
+        am_release_resource(filename, data);
     }
     return 1;
 }
@@ -275,13 +325,13 @@ static int load_script(lua_State *L) {
     const char *filename = luaL_checkstring(L, 1);
     int len;
     char *errmsg;
-    void *data = am_read_resource(filename, &len, &errmsg);
+    const void *data = am_acquire_resource(filename, &len, &errmsg);
     if (data == NULL) {
         free(errmsg);
         lua_pushnil(L);
     } else {
         luaL_loadbuffer(L, (const char*)data, len, filename);
-        free(data);
+        am_release_resource(filename, data);
     }
     return 1;
 }
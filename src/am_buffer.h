@@ -2,6 +2,7 @@ enum am_buffer_alloc_method {
     AM_BUF_ALLOC_MALLOC, // system malloc
     AM_BUF_ALLOC_POOL_SCRATCH,
     AM_BUF_ALLOC_LUA,
+    AM_BUF_ALLOC_PACKAGE, // am_map_package_resource
 };
 
 struct am_texture2d;
@@ -19,10 +20,16 @@ struct am_buffer : am_nonatomic_userdata {
     am_buffer_alloc_method  alloc_method;
     const char              *origin;
     am_buffer_usage         usage;
+    am_package              *package; // set if alloc_method is AM_BUF_ALLOC_PACKAGE
 
     am_buffer();
 
     void free_data();
+    // Takes ownership of the data, leaving the buffer in the same state
+    // as a freed buffer. The returned data should be freed with free(),
+    // unless *pkg is set, in which case it was mapped from that package
+    // and should be unmapped with am_unmap_package_resource.
+    uint8_t *take_data(am_package **pkg);
     void create_arraybuf(lua_State *L);
     void create_elembuf(lua_State *L);
     void update_if_dirty();
@@ -57,6 +64,9 @@ struct am_buffer_data_allocator : am_nonatomic_userdata {
 // use these instead of am_new_userdata to create a buffer
 am_buffer *am_push_new_buffer_and_init(lua_State *L, int size);
 am_buffer *am_push_new_buffer_with_data(lua_State *L, int size, void* data);
+// the new buffer will own data, which must have been mapped with
+// am_map_package_resource.
+am_buffer *am_push_new_buffer_with_package_data(lua_State *L, int size, void* data, am_package *pkg);
 
 // use this instead of am_get_userdata for buffers (does some extra checking)
 am_buffer* am_check_buffer(lua_State *L, int idx);
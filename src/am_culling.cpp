@@ -1,5 +1,18 @@
 #include "amulet.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AM_CULL_SSE
+#include <emmintrin.h>
+#endif
+
+static bool same_names(int *names1, int num_names1, am_param_name_id *names2, int num_names2) {
+    if (num_names1 != num_names2) return false;
+    for (int i = 0; i < num_names1; i++) {
+        if (names1[i] != names2[i]) return false;
+    }
+    return true;
+}
+
 // Cull face
 
 void am_cull_face_node::render(am_render_state *rstate) {
@@ -71,6 +84,14 @@ void am_cull_sphere_node::render(am_render_state *rstate) {
     }
 }
 
+bool am_cull_sphere_node::cull_bounds(int *bvh_names, int num_bvh_names, am_cull_bounds *bounds) {
+    if (!same_names(bvh_names, num_bvh_names, names, num_names)) return false;
+    bounds->center = center;
+    bounds->extent = glm::dvec3(0.0);
+    bounds->radius = radius;
+    return true;
+}
+
 static int create_cull_sphere_node(lua_State *L) {
     if (lua_gettop(L) >= 1 && lua_type(L, 1) != LUA_TSTRING) {
         lua_pushstring(L, am_conf_default_modelview_matrix_name);
@@ -163,6 +184,14 @@ void am_cull_box_node::render(am_render_state *rstate) {
     }
 }
 
+bool am_cull_box_node::cull_bounds(int *bvh_names, int num_bvh_names, am_cull_bounds *bounds) {
+    if (!same_names(bvh_names, num_bvh_names, names, num_names)) return false;
+    bounds->center = (min + max) * 0.5;
+    bounds->extent = glm::abs(max - min) * 0.5;
+    bounds->radius = 0.0;
+    return true;
+}
+
 static int create_cull_box_node(lua_State *L) {
     if (lua_gettop(L) >= 1 && lua_type(L, 1) != LUA_TSTRING) {
         lua_pushstring(L, am_conf_default_modelview_matrix_name);
@@ -234,6 +263,337 @@ static void register_cull_box_node_mt(lua_State *L) {
     am_register_metatable(L, "cull_box", MT_am_cull_box_node, MT_am_scene_node);
 }
 
+// Cull BVH
+
+am_bvh::am_bvh() {
+    node_version = 0;
+    built = false;
+    num_refits = 0;
+}
+
+// Frustum planes in structure-of-arrays form, padded to 8 planes
+// so they can be tested 4 at a time. The padding planes contain
+// everything.
+struct frustum_planes {
+    float nx[8];
+    float ny[8];
+    float nz[8];
+    float d[8];
+    float ax[8]; // absolute values of the normals
+    float ay[8];
+    float az[8];
+};
+
+#define ALL_PLANES 0x3F
+
+static void extract_frustum_planes(glm::dmat4 &matrix, frustum_planes *f) {
+    for (int i = 0; i < 8; i++) {
+        glm::dvec4 plane;
+        if (i < 6) {
+            // left, right, bottom, top, near, far
+            glm::dvec4 row = glm::row(matrix, i / 2);
+            plane = glm::row(matrix, 3) + ((i & 1) ? -row : row);
+            double l = glm::length(glm::dvec3(plane.x, plane.y, plane.z));
+            if (l > 0.0) plane /= l;
+        } else {
+            plane = glm::dvec4(0.0, 0.0, 0.0, 1.0);
+        }
+        f->nx[i] = (float)plane.x;
+        f->ny[i] = (float)plane.y;
+        f->nz[i] = (float)plane.z;
+        f->d[i] = (float)plane.w;
+        f->ax[i] = fabsf(f->nx[i]);
+        f->ay[i] = fabsf(f->ny[i]);
+        f->az[i] = fabsf(f->nz[i]);
+    }
+}
+
+// Tests a box (plus a radius, for spheres) against the planes in mask.
+// Returns -1 if the bounds are outside one of the planes, otherwise
+// the planes the bounds still intersect (0 if fully inside).
+static int classify_bounds(frustum_planes *f, const float *c, const float *e, float radius, int mask) {
+    int outside = 0;
+    int inside = 0;
+#ifdef AM_CULL_SSE
+    __m128 cx = _mm_set1_ps(c[0]);
+    __m128 cy = _mm_set1_ps(c[1]);
+    __m128 cz = _mm_set1_ps(c[2]);
+    __m128 ex = _mm_set1_ps(e[0]);
+    __m128 ey = _mm_set1_ps(e[1]);
+    __m128 ez = _mm_set1_ps(e[2]);
+    __m128 rad = _mm_set1_ps(radius);
+    __m128 zero = _mm_setzero_ps();
+    for (int k = 0; k < 8; k += 4) {
+        __m128 s = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f->nx + k), cx), _mm_mul_ps(_mm_loadu_ps(f->ny + k), cy)),
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f->nz + k), cz), _mm_loadu_ps(f->d + k)));
+        __m128 r = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f->ax + k), ex), _mm_mul_ps(_mm_loadu_ps(f->ay + k), ey)),
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(f->az + k), ez), rad));
+        outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(s, r), zero)) << k;
+        inside |= _mm_movemask_ps(_mm_cmpge_ps(_mm_sub_ps(s, r), zero)) << k;
+    }
+#else
+    for (int k = 0; k < 8; k++) {
+        float s = f->nx[k] * c[0] + f->ny[k] * c[1] + f->nz[k] * c[2] + f->d[k];
+        float r = f->ax[k] * e[0] + f->ay[k] * e[1] + f->az[k] * e[2] + radius;
+        outside |= (s + r < 0.0f) << k;
+        inside |= (s - r >= 0.0f) << k;
+    }
+#endif
+    if (outside & mask) return -1;
+    return mask & ~inside;
+}
+
+static void set_node_bounds(am_bvh_node *node, float *min, float *max) {
+    for (int j = 0; j < 3; j++) {
+        node->center[j] = (min[j] + max[j]) * 0.5f;
+        node->extent[j] = (max[j] - min[j]) * 0.5f;
+    }
+}
+
+static void compute_node_bounds(am_bvh *bvh, int n) {
+    am_bvh_node *node = &bvh->nodes[n];
+    float min[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+    float max[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    if (node->left < 0) {
+        for (int i = node->first; i < node->first + node->count; i++) {
+            am_bvh_item *item = &bvh->items[i];
+            for (int j = 0; j < 3; j++) {
+                float e = item->extent[j] + item->radius;
+                min[j] = fminf(min[j], item->center[j] - e);
+                max[j] = fmaxf(max[j], item->center[j] + e);
+            }
+        }
+    } else {
+        am_bvh_node *children[2] = {&bvh->nodes[node->left], &bvh->nodes[node->right]};
+        for (int k = 0; k < 2; k++) {
+            for (int j = 0; j < 3; j++) {
+                min[j] = fminf(min[j], children[k]->center[j] - children[k]->extent[j]);
+                max[j] = fmaxf(max[j], children[k]->center[j] + children[k]->extent[j]);
+            }
+        }
+    }
+    set_node_bounds(node, min, max);
+}
+
+struct item_center_less {
+    int axis;
+    bool operator()(const am_bvh_item &a, const am_bvh_item &b) const {
+        return a.center[axis] < b.center[axis];
+    }
+};
+
+static int build_bvh_range(am_bvh *bvh, int first, int count, int parent) {
+    int n = bvh->nodes.size();
+    bvh->nodes.push_back(am_bvh_node());
+    bvh->nodes[n].parent = parent;
+    if (count <= AM_CULL_BVH_LEAF_SIZE) {
+        bvh->nodes[n].left = -1;
+        bvh->nodes[n].right = -1;
+        bvh->nodes[n].first = first;
+        bvh->nodes[n].count = count;
+        for (int i = first; i < first + count; i++) {
+            bvh->items[i].leaf = n;
+        }
+    } else {
+        // split at the median centre along the longest axis
+        float min[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+        float max[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+        for (int i = first; i < first + count; i++) {
+            for (int j = 0; j < 3; j++) {
+                min[j] = fminf(min[j], bvh->items[i].center[j]);
+                max[j] = fmaxf(max[j], bvh->items[i].center[j]);
+            }
+        }
+        item_center_less less;
+        less.axis = 0;
+        for (int j = 1; j < 3; j++) {
+            if (max[j] - min[j] > max[less.axis] - min[less.axis]) less.axis = j;
+        }
+        int mid = first + count / 2;
+        std::nth_element(bvh->items.begin() + first, bvh->items.begin() + mid,
+            bvh->items.begin() + first + count, less);
+        int left = build_bvh_range(bvh, first, mid - first, n);
+        int right = build_bvh_range(bvh, mid, first + count - mid, n);
+        bvh->nodes[n].left = left;
+        bvh->nodes[n].right = right;
+        bvh->nodes[n].first = 0;
+        bvh->nodes[n].count = 0;
+    }
+    compute_node_bounds(bvh, n);
+    return n;
+}
+
+static void set_item_bounds(am_bvh_item *item, am_cull_bounds *bounds) {
+    for (int j = 0; j < 3; j++) {
+        item->center[j] = (float)bounds->center[j];
+        item->extent[j] = (float)bounds->extent[j];
+    }
+    item->radius = (float)bounds->radius;
+}
+
+static void build_bvh(am_cull_bvh_node *node) {
+    am_bvh *bvh = node->bvh;
+    int num_children = node->children.size;
+    bvh->items.clear();
+    bvh->nodes.clear();
+    bvh->child_items.assign(num_children, -1);
+    bvh->visible.assign(num_children, 0);
+    for (int i = 0; i < num_children; i++) {
+        am_scene_node *child = node->children.arr[i].child;
+        am_cull_bounds bounds;
+        if (child->cull_bounds(node->names, node->num_names, &bounds)) {
+            am_bvh_item item;
+            item.child = i;
+            item.leaf = -1;
+            item.version = child->version;
+            set_item_bounds(&item, &bounds);
+            bvh->items.push_back(item);
+        }
+    }
+    if (bvh->items.size() > 0) {
+        build_bvh_range(bvh, 0, bvh->items.size(), -1);
+    }
+    for (unsigned int i = 0; i < bvh->items.size(); i++) {
+        bvh->child_items[bvh->items[i].child] = i;
+    }
+    bvh->node_version = node->version;
+    bvh->num_refits = 0;
+    bvh->built = true;
+}
+
+// Updates the bounds of children that changed since the last frame
+// and the bounds of the nodes above them. The hierarchy is rebuilt
+// once it has been refitted as many times as it has items, since by
+// then it may no longer be a good fit.
+static void refit_bvh(am_cull_bvh_node *node) {
+    am_bvh *bvh = node->bvh;
+    for (unsigned int i = 0; i < bvh->items.size(); i++) {
+        am_bvh_item *item = &bvh->items[i];
+        am_scene_node *child = node->children.arr[item->child].child;
+        if (child->version == item->version) continue;
+        am_cull_bounds bounds;
+        if (!child->cull_bounds(node->names, node->num_names, &bounds)) {
+            build_bvh(node);
+            return;
+        }
+        item->version = child->version;
+        set_item_bounds(item, &bounds);
+        for (int n = item->leaf; n >= 0; n = bvh->nodes[n].parent) {
+            compute_node_bounds(bvh, n);
+        }
+        bvh->num_refits++;
+    }
+    if (bvh->num_refits > (int)bvh->items.size()) {
+        build_bvh(node);
+    }
+}
+
+static void cull_bvh_subtree(am_bvh *bvh, frustum_planes *f, int n, int mask) {
+    am_bvh_node *node = &bvh->nodes[n];
+    if (mask != 0) {
+        // one test culls (or accepts) the whole subtree
+        mask = classify_bounds(f, node->center, node->extent, 0.0f, mask);
+        if (mask < 0) return;
+    }
+    if (node->left < 0) {
+        for (int i = node->first; i < node->first + node->count; i++) {
+            am_bvh_item *item = &bvh->items[i];
+            if (mask == 0 || classify_bounds(f, item->center, item->extent, item->radius, mask) >= 0) {
+                bvh->visible[item->child] = 1;
+            }
+        }
+    } else {
+        cull_bvh_subtree(bvh, f, node->left, mask);
+        cull_bvh_subtree(bvh, f, node->right, mask);
+    }
+}
+
+void am_cull_bvh_node::render(am_render_state *rstate) {
+    glm::dmat4 matrix = glm::dmat4(1.0);
+    for (int i = 0; i < num_names; i++) {
+        am_program_param_name_slot *slot = &rstate->param_name_map[names[i]];
+        am_program_param_value *param = &slot->value;
+        if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
+            glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
+            matrix = matrix * *m;
+        } else {
+            am_log1("WARNING: matrix '%s' is not a mat4 in cull_bvh node (node will be culled)", slot->name);
+            return;
+        }
+    }
+    if (recursion_limit < 0) return;
+
+    if (!bvh->built || bvh->node_version != version) {
+        build_bvh(this);
+    } else {
+        refit_bvh(this);
+    }
+    frustum_planes planes;
+    extract_frustum_planes(matrix, &planes);
+    if (bvh->visible.size() > 0) {
+        memset(&bvh->visible[0], 0, bvh->visible.size());
+    }
+    if (bvh->nodes.size() > 0) {
+        cull_bvh_subtree(bvh, &planes, 0, ALL_PLANES);
+    }
+
+    // Render in child order. Visible children have already been tested,
+    // so their own test is skipped.
+    recursion_limit--;
+    for (int i = 0; i < children.size; i++) {
+        am_scene_node *child = children.arr[i].child;
+        if (rstate->recording != NULL) {
+            am_retained_record_node(rstate, child);
+        }
+        if (am_node_hidden(child)) continue;
+        if (bvh->child_items[i] < 0) {
+            child->render(rstate);
+        } else if (bvh->visible[i]) {
+            child->render_children(rstate);
+        }
+    }
+    recursion_limit++;
+}
+
+static int create_cull_bvh_node(lua_State *L) {
+    if (lua_gettop(L) == 0) {
+        lua_pushstring(L, am_conf_default_projection_matrix_name);
+        lua_pushstring(L, am_conf_default_modelview_matrix_name);
+    }
+    int nargs = am_check_nargs(L, 1);
+    am_cull_bvh_node *node = am_new_userdata(L, am_cull_bvh_node);
+    node->tags.push_back(L, AM_TAG_CULL_BVH);
+    node->num_names = 0;
+    for (int i = 1; i <= nargs; i++) {
+        if (lua_type(L, i) != LUA_TSTRING) return luaL_error(L, "expecting a string in position %d", i);
+        if (node->num_names >= AM_MAX_CULL_BVH_NAMES) return luaL_error(L, "too many matrices (max %d)", AM_MAX_CULL_BVH_NAMES);
+        node->names[node->num_names] = am_lookup_param_name(L, i);
+        node->num_names++;
+    }
+    node->bvh = new am_bvh();
+    return 1;
+}
+
+static int cull_bvh_node_gc(lua_State *L) {
+    am_cull_bvh_node *node = (am_cull_bvh_node*)lua_touserdata(L, 1);
+    delete node->bvh;
+    return 0;
+}
+
+static void register_cull_bvh_node_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_scene_node_index, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, am_scene_node_newindex, 0);
+    lua_setfield(L, -2, "__newindex");
+    lua_pushcclosure(L, cull_bvh_node_gc, 0);
+    lua_setfield(L, -2, "__gc");
+
+    am_register_metatable(L, "cull_bvh", MT_am_cull_bvh_node, MT_am_scene_node);
+}
+
 // Module init
 
 void am_open_culling_module(lua_State *L) {
@@ -241,6 +601,7 @@ void am_open_culling_module(lua_State *L) {
         {"cull_face", create_cull_face_node},
         {"cull_sphere", create_cull_sphere_node},
         {"cull_box", create_cull_box_node},
+        {"cull_bvh", create_cull_bvh_node},
         {NULL, NULL}
     };
     am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
@@ -256,4 +617,5 @@ void am_open_culling_module(lua_State *L) {
     register_cull_face_node_mt(L);
     register_cull_sphere_node_mt(L);
     register_cull_box_node_mt(L);
+    register_cull_bvh_node_mt(L);
 }
@@ -1,5 +1,7 @@
 #define AM_MAX_CULL_SPHERE_NAMES 8
 #define AM_MAX_CULL_BOX_NAMES 8
+#define AM_MAX_CULL_BVH_NAMES 8
+#define AM_CULL_BVH_LEAF_SIZE 4
 
 enum am_cull_face_mode {
     AM_CULL_FACE_MODE_FRONT,
@@ -18,6 +20,7 @@ struct am_cull_sphere_node : am_scene_node {
     glm::dvec3 center;
     float radius;
     virtual void render(am_render_state *rstate);
+    virtual bool cull_bounds(int *names, int num_names, am_cull_bounds *bounds);
 };
 
 struct am_cull_box_node : am_scene_node {
@@ -26,6 +29,51 @@ struct am_cull_box_node : am_scene_node {
     glm::dvec3 min;
     glm::dvec3 max;
     virtual void render(am_render_state *rstate);
+    virtual bool cull_bounds(int *names, int num_names, am_cull_bounds *bounds);
+};
+
+struct am_cull_bounds {
+    glm::dvec3 center;
+    glm::dvec3 extent; // half the size of the box (zero for spheres)
+    double radius;     // zero for boxes
+};
+
+struct am_bvh_node {
+    float center[3];
+    float extent[3];
+    int parent;
+    int left;  // -1 for leaf nodes
+    int right;
+    int first; // range of items in a leaf node
+    int count;
+};
+
+struct am_bvh_item {
+    int child;        // index in am_cull_bvh_node::children
+    int leaf;         // index of the containing leaf node
+    uint32_t version; // child version when the bounds were read
+    float center[3];
+    float extent[3];
+    float radius;
+};
+
+struct am_bvh {
+    uint32_t                    node_version; // version of the cull_bvh node the hierarchy was built for
+    bool                        built;
+    int                         num_refits;
+    std::vector<am_bvh_node>    nodes; // root is nodes[0]
+    std::vector<am_bvh_item>    items;
+    std::vector<int>            child_items; // item index of each child, or -1 if the child has no bounds
+    std::vector<char>           visible; // per child
+
+    am_bvh();
+};
+
+struct am_cull_bvh_node : am_scene_node {
+    am_param_name_id names[AM_MAX_CULL_BVH_NAMES];
+    int num_names;
+    am_bvh *bvh;
+    virtual void render(am_render_state *rstate);
 };
 
 void am_open_culling_module(lua_State *L);
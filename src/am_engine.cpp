@@ -37,6 +37,7 @@ am_engine *am_init_engine(bool worker, int argc, char** argv) {
     am_init_traceback_func(L);
     am_open_userdata_module(L);
     am_open_logging_module(L);
+    am_open_allocator_module(L);
     am_open_math_module(L);
     am_open_time_module(L);
     am_open_buffer_module(L);
@@ -48,6 +49,7 @@ am_engine *am_init_engine(bool worker, int argc, char** argv) {
     am_open_browser_module(L);
     am_open_rand_module(L);
     am_open_glob_module(L);
+    am_open_package_module(L);
     am_open_i18n_module(L);
     am_open_net_module(L);
     if (!worker) {
@@ -66,6 +68,9 @@ am_engine *am_init_engine(bool worker, int argc, char** argv) {
         am_open_blending_module(L);
         am_open_transforms_module(L);
         am_open_renderer_module(L);
+        am_open_batch_module(L);
+        am_open_retained_module(L);
+        am_open_text_module(L);
         am_open_audio_module(L);
         am_open_sfxr_module(L);
 #if defined(AM_BACKEND_IOS)
@@ -77,8 +82,13 @@ am_engine *am_init_engine(bool worker, int argc, char** argv) {
 #endif
 #if defined(AM_STEAMWORKS)
         am_open_steamworks_module(L);
+#endif
+#if defined(AM_USE_NULL_GL)
+        am_open_null_gl_module(L);
 #endif
         am_open_native_module(L);
+        am_open_jobs_module(L);
+        am_open_profiler_module(L);
     }
     am_set_version(L);
     am_set_dirs(L);
@@ -94,10 +104,15 @@ am_engine *am_init_engine(bool worker, int argc, char** argv) {
 
 void am_destroy_engine(am_engine *eng) {
     if (!eng->worker) {
+        // Stop the job workers first, since they may still be running
+        // and each has its own engine.
+        am_destroy_jobs();
+        am_destroy_mathv_threads();
         // Audio must be destroyed before closing the lua state, because
         // closing the lua state will destroy the root audio node.
         am_log_gl("// destroy audio");
         am_destroy_audio();
+        am_destroy_profiler();
 #if defined(AM_STEAMWORKS)
         am_steam_teardown();
 #endif
@@ -106,6 +121,10 @@ void am_destroy_engine(am_engine *eng) {
         am_log_gl("// close lua");
         lua_close(eng->L);
         eng->L = NULL;
+        if (!eng->worker) {
+            am_log_gl("// delete stream rings");
+            am_delete_stream_rings();
+        }
         am_log_gl("// destroy allocator");
         if (eng->allocator != NULL) {
             am_destroy_allocator(eng->allocator);
@@ -270,13 +289,13 @@ static bool run_embedded_scripts(lua_State *L, bool worker) {
         run_embedded_script(L, "lua/traceback.lua") &&
         run_embedded_script(L, "lua/setup.lua") &&
         run_embedded_script(L, "lua/type.lua") &&
-        run_embedded_script(L, "lua/extra.lua");
+        run_embedded_script(L, "lua/extra.lua") &&
+        run_embedded_script(L, "lua/buffer.lua");
     if (!ok) return false;
     if (!worker) {
         return
         run_embedded_script(L, "lua/save.lua") &&
         run_embedded_script(L, "lua/time.lua") &&
-        run_embedded_script(L, "lua/buffer.lua") &&
         run_embedded_script(L, "lua/shaders.lua") &&
         run_embedded_script(L, "lua/shapes.lua") &&
         run_embedded_script(L, "lua/text.lua") &&
@@ -4,13 +4,16 @@
 
 #include "amulet.h"
 
-#ifndef AM_USE_METAL
+#if !defined(AM_USE_METAL) && !defined(AM_USE_NULL_GL)
 
 #if defined(AM_BACKEND_SDL)
     #define GL_GLEXT_PROTOTYPES
     #include <SDL_opengl.h>
+    #include <SDL_video.h>
 #elif defined(AM_BACKEND_EMSCRIPTEN)
+    #define GL_GLEXT_PROTOTYPES
     #include <GLES2/gl2.h>
+    #include <GLES2/gl2ext.h>
 #elif defined(AM_BACKEND_IOS)
     #include <OpenGLES/ES2/gl.h>
     #include <OpenGLES/ES2/glext.h>
@@ -90,9 +93,36 @@ int am_max_vertex_texture_image_units = 0;
 int am_max_vertex_uniform_vectors = 0;
 int am_frame_draw_calls = 0;
 int am_frame_use_program_calls = 0;
+bool am_instancing_supported = false;
+bool am_vertex_arrays_supported = false;
 
 static bool gl_initialized = false;
 
+// Instancing isn't part of OpenGL ES 2 or WebGL 1, so the entry points
+// are looked up at runtime on platforms where we load GL ourselves.
+#if defined(AM_BACKEND_SDL)
+typedef void (APIENTRY *vertex_attrib_divisor_func)(GLuint index, GLuint divisor);
+typedef void (APIENTRY *draw_arrays_instanced_func)(GLenum mode, GLint first, GLsizei count, GLsizei primcount);
+typedef void (APIENTRY *draw_elements_instanced_func)(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount);
+static vertex_attrib_divisor_func vertex_attrib_divisor_ptr = NULL;
+static draw_arrays_instanced_func draw_arrays_instanced_ptr = NULL;
+static draw_elements_instanced_func draw_elements_instanced_ptr = NULL;
+#endif
+
+// Likewise for vertex array objects, which are core in desktop GL 3
+// and an extension (OES_vertex_array_object) in ES 2 and WebGL 1.
+#if defined(AM_BACKEND_SDL)
+typedef void (APIENTRY *gen_vertex_arrays_func)(GLsizei n, GLuint *arrays);
+typedef void (APIENTRY *delete_vertex_arrays_func)(GLsizei n, const GLuint *arrays);
+typedef void (APIENTRY *bind_vertex_array_func)(GLuint array);
+static gen_vertex_arrays_func gen_vertex_arrays_ptr = NULL;
+static delete_vertex_arrays_func delete_vertex_arrays_ptr = NULL;
+static bind_vertex_array_func bind_vertex_array_ptr = NULL;
+#endif
+
+static void init_instancing();
+static void init_vertex_arrays();
+
 static void check_glerror(const char *file, int line, const char *func);
 
 static void reset_gl() {
@@ -151,6 +181,7 @@ static void log_gl_prog_header() {
     fprintf(gl_log_file, "%s\n", "    std::map<GLuint, GLuint> shader;");
     fprintf(gl_log_file, "%s\n", "    std::map<GLuint, GLuint> fbuf;");
     fprintf(gl_log_file, "%s\n", "    std::map<GLuint, GLuint> rbuf;");
+    fprintf(gl_log_file, "%s\n", "    std::map<GLuint, GLuint> vao;");
     fprintf(gl_log_file, "%s\n", "    ptr[0] = NULL;");
     fprintf(gl_log_file, "%s\n", "    prog[0] = 0;");
     fprintf(gl_log_file, "%s\n", "    tex[0] = 0;");
@@ -158,6 +189,7 @@ static void log_gl_prog_header() {
     fprintf(gl_log_file, "%s\n", "    shader[0] = 0;");
     fprintf(gl_log_file, "%s\n", "    fbuf[0] = 0;");
     fprintf(gl_log_file, "%s\n", "    rbuf[0] = 0;");
+    fprintf(gl_log_file, "%s\n", "    vao[0] = 0;");
     fprintf(gl_log_file, "%s\n", "    SDL_Init(SDL_INIT_VIDEO);");
     fprintf(gl_log_file, "%s\n", "    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);");
     fprintf(gl_log_file, "%s\n", "    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 1);");
@@ -274,6 +306,8 @@ void am_init_gl() {
     }
     log_gl_prog_header();
     reset_gl();
+    init_instancing();
+    init_vertex_arrays();
 }
 
 void am_close_gllog() {
@@ -298,6 +332,93 @@ bool am_gl_is_initialized() {
     return gl_initialized;
 }
 
+static bool has_extension(const char *name) {
+    const char *exts = (const char*)GLFUNC(glGetString)(GL_EXTENSIONS);
+    check_for_errors
+    if (exts == NULL) return false;
+    int len = strlen(name);
+    const char *p = exts;
+    while ((p = strstr(p, name)) != NULL) {
+        if ((p == exts || p[-1] == ' ') && (p[len] == ' ' || p[len] == '\0')) {
+            return true;
+        }
+        p += len;
+    }
+    return false;
+}
+
+static void init_instancing() {
+#if defined(AM_BACKEND_SDL)
+    const char *suffix = NULL;
+    if (am_conf_d3dangle) {
+        if (has_extension("GL_ANGLE_instanced_arrays")) suffix = "ANGLE";
+    } else {
+        int major = 0;
+        const char *version = (const char*)GLFUNC(glGetString)(GL_VERSION);
+        if (version != NULL) major = atoi(version);
+        if (major >= 4 || (version != NULL && strncmp(version, "3.3", 3) == 0)) {
+            suffix = "";
+        } else if (has_extension("GL_ARB_instanced_arrays") && has_extension("GL_ARB_draw_instanced")) {
+            suffix = "ARB";
+        }
+    }
+    if (suffix != NULL) {
+        char name[64];
+        snprintf(name, sizeof(name), "glVertexAttribDivisor%s", suffix);
+        vertex_attrib_divisor_ptr = (vertex_attrib_divisor_func)SDL_GL_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glDrawArraysInstanced%s", suffix);
+        draw_arrays_instanced_ptr = (draw_arrays_instanced_func)SDL_GL_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glDrawElementsInstanced%s", suffix);
+        draw_elements_instanced_ptr = (draw_elements_instanced_func)SDL_GL_GetProcAddress(name);
+    }
+    am_instancing_supported = vertex_attrib_divisor_ptr != NULL
+        && draw_arrays_instanced_ptr != NULL
+        && draw_elements_instanced_ptr != NULL;
+#elif defined(AM_BACKEND_EMSCRIPTEN)
+    am_instancing_supported = has_extension("GL_ANGLE_instanced_arrays")
+        || has_extension("ANGLE_instanced_arrays");
+#elif defined(AM_BACKEND_IOS)
+    am_instancing_supported = has_extension("GL_EXT_instanced_arrays");
+#else
+    am_instancing_supported = false;
+#endif
+}
+
+static void init_vertex_arrays() {
+#if defined(AM_BACKEND_SDL)
+    const char *suffix = NULL;
+    if (am_conf_d3dangle) {
+        if (has_extension("GL_OES_vertex_array_object")) suffix = "OES";
+    } else {
+        int major = 0;
+        const char *version = (const char*)GLFUNC(glGetString)(GL_VERSION);
+        if (version != NULL) major = atoi(version);
+        if (major >= 3 || has_extension("GL_ARB_vertex_array_object")) {
+            suffix = "";
+        }
+    }
+    if (suffix != NULL) {
+        char name[64];
+        snprintf(name, sizeof(name), "glGenVertexArrays%s", suffix);
+        gen_vertex_arrays_ptr = (gen_vertex_arrays_func)SDL_GL_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glDeleteVertexArrays%s", suffix);
+        delete_vertex_arrays_ptr = (delete_vertex_arrays_func)SDL_GL_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glBindVertexArray%s", suffix);
+        bind_vertex_array_ptr = (bind_vertex_array_func)SDL_GL_GetProcAddress(name);
+    }
+    am_vertex_arrays_supported = gen_vertex_arrays_ptr != NULL
+        && delete_vertex_arrays_ptr != NULL
+        && bind_vertex_array_ptr != NULL;
+#elif defined(AM_BACKEND_EMSCRIPTEN)
+    am_vertex_arrays_supported = has_extension("GL_OES_vertex_array_object")
+        || has_extension("OES_vertex_array_object");
+#elif defined(AM_BACKEND_IOS)
+    am_vertex_arrays_supported = has_extension("GL_OES_vertex_array_object");
+#else
+    am_vertex_arrays_supported = false;
+#endif
+}
+
 static GLenum to_gl_blend_equation(am_blend_equation eq);
 static GLenum to_gl_blend_sfactor(am_blend_sfactor f);
 static GLenum to_gl_blend_dfactor(am_blend_dfactor f);
@@ -579,7 +700,7 @@ void am_set_buffer_data(am_buffer_target target, int size, void *data, am_buffer
     check_initialized();
     GLenum gl_target = to_gl_buffer_target(target);
     GLenum gl_usage = to_gl_buffer_usage(usage);
-    log_gl_ptr(data, size);
+    if (data != NULL) log_gl_ptr(data, size);
     log_gl("glBufferData(%s, %d, ptr[%p], %s);", gl_buffer_target_str(gl_target), size, data, gl_usage_str(gl_usage));
     GLFUNC(glBufferData)(gl_target, size, data, gl_usage);
     check_for_errors
@@ -1136,6 +1257,73 @@ void am_set_attribute_pointer(am_gluint location, int size, am_attribute_client_
     check_for_errors
 }
 
+void am_set_attribute_divisor(am_gluint location, int divisor) {
+    check_initialized();
+    if (!am_instancing_supported) {
+        am_log0("INTERNAL ERROR: %s", "instancing not supported");
+        return;
+    }
+    log_gl("glVertexAttribDivisor(%u, %d);", location, divisor);
+#if defined(AM_BACKEND_SDL)
+    vertex_attrib_divisor_ptr(location, divisor);
+#elif defined(AM_BACKEND_EMSCRIPTEN)
+    glVertexAttribDivisorANGLE(location, divisor);
+#elif defined(AM_BACKEND_IOS)
+    glVertexAttribDivisorEXT(location, divisor);
+#endif
+    check_for_errors
+}
+
+// Vertex Array Objects
+
+am_vertex_array_id am_create_vertex_array() {
+    check_initialized(0);
+    if (!am_vertex_arrays_supported) {
+        am_log0("INTERNAL ERROR: %s", "vertex arrays not supported");
+        return 0;
+    }
+    GLuint vao = 0;
+#if defined(AM_BACKEND_SDL)
+    gen_vertex_arrays_ptr(1, &vao);
+#elif defined(AM_BACKEND_EMSCRIPTEN) || defined(AM_BACKEND_IOS)
+    glGenVertexArraysOES(1, &vao);
+#endif
+    log_gl("glGenVertexArrays(1, &vao[%u]);", vao);
+    check_for_errors
+    return vao;
+}
+
+void am_delete_vertex_array(am_vertex_array_id vao) {
+    check_initialized();
+    if (!am_vertex_arrays_supported) {
+        am_log0("INTERNAL ERROR: %s", "vertex arrays not supported");
+        return;
+    }
+    log_gl("glDeleteVertexArrays(1, &vao[%u]);", vao);
+    GLuint id = vao;
+#if defined(AM_BACKEND_SDL)
+    delete_vertex_arrays_ptr(1, &id);
+#elif defined(AM_BACKEND_EMSCRIPTEN) || defined(AM_BACKEND_IOS)
+    glDeleteVertexArraysOES(1, &id);
+#endif
+    check_for_errors
+}
+
+void am_bind_vertex_array(am_vertex_array_id vao) {
+    check_initialized();
+    if (!am_vertex_arrays_supported) {
+        am_log0("INTERNAL ERROR: %s", "vertex arrays not supported");
+        return;
+    }
+    log_gl("glBindVertexArray(vao[%u]);", vao);
+#if defined(AM_BACKEND_SDL)
+    bind_vertex_array_ptr(vao);
+#elif defined(AM_BACKEND_EMSCRIPTEN) || defined(AM_BACKEND_IOS)
+    glBindVertexArrayOES(vao);
+#endif
+    check_for_errors
+}
+
 // Texture Objects
 
 void am_set_active_texture_unit(int texture_unit) {
@@ -1419,6 +1607,47 @@ void am_draw_elements(am_draw_mode mode, int count, am_element_index_type type,
     am_frame_draw_calls++;
 }
 
+void am_draw_arrays_instanced(am_draw_mode mode, int first, int count, int instances) {
+    check_initialized();
+    if (!am_instancing_supported) {
+        am_log0("INTERNAL ERROR: %s", "instancing not supported");
+        return;
+    }
+    GLenum gl_mode = to_gl_draw_mode(mode);
+    log_gl("glDrawArraysInstanced(%s, %d, %d, %d);",
+        gl_draw_mode_str(gl_mode), first, count, instances);
+#if defined(AM_BACKEND_SDL)
+    draw_arrays_instanced_ptr(gl_mode, first, count, instances);
+#elif defined(AM_BACKEND_EMSCRIPTEN)
+    glDrawArraysInstancedANGLE(gl_mode, first, count, instances);
+#elif defined(AM_BACKEND_IOS)
+    glDrawArraysInstancedEXT(gl_mode, first, count, instances);
+#endif
+    check_for_errors
+    am_frame_draw_calls++;
+}
+
+void am_draw_elements_instanced(am_draw_mode mode, int count, am_element_index_type type, int offset, int instances) {
+    check_initialized();
+    if (!am_instancing_supported) {
+        am_log0("INTERNAL ERROR: %s", "instancing not supported");
+        return;
+    }
+    GLenum gl_mode = to_gl_draw_mode(mode);
+    GLenum gl_type = to_gl_element_index_type(type);
+    log_gl("glDrawElementsInstanced(%s, %d, %s, %d, %d);",
+        gl_draw_mode_str(gl_mode), count, gl_type_str(gl_type), offset, instances);
+#if defined(AM_BACKEND_SDL)
+    draw_elements_instanced_ptr(gl_mode, count, gl_type, (void*)((uintptr_t)offset), instances);
+#elif defined(AM_BACKEND_EMSCRIPTEN)
+    glDrawElementsInstancedANGLE(gl_mode, count, gl_type, (void*)((uintptr_t)offset), instances);
+#elif defined(AM_BACKEND_IOS)
+    glDrawElementsInstancedEXT(gl_mode, count, gl_type, (void*)((uintptr_t)offset), instances);
+#endif
+    check_for_errors
+    am_frame_draw_calls++;
+}
+
 void am_gl_end_framebuffer_render() {
 }
 
@@ -2173,4 +2402,4 @@ bool am_gl_requires_combined_depthstencil() {
     return false;
 }
 
-#endif  // AM_USE_METAL
+#endif  // !AM_USE_METAL && !AM_USE_NULL_GL
@@ -19,6 +19,8 @@ extern int am_max_varying_vectors;
 extern int am_max_vertex_attribs;
 extern int am_max_vertex_texture_image_units;
 extern int am_max_vertex_uniform_vectors;
+extern bool am_instancing_supported;
+extern bool am_vertex_arrays_supported;
 extern int am_frame_draw_calls;
 extern int am_frame_use_program_calls;
 
@@ -285,6 +287,17 @@ void am_set_attribute3f(am_gluint location, const float *value);
 void am_set_attribute4f(am_gluint location, const float *value);
 
 void am_set_attribute_pointer(am_gluint location, int size, am_attribute_client_type type, bool normalized, int stride, int offset);
+// only valid if am_instancing_supported is true
+void am_set_attribute_divisor(am_gluint location, int divisor);
+
+// Vertex Array Objects (only valid if am_vertex_arrays_supported is true)
+
+typedef am_gluint am_vertex_array_id;
+
+am_vertex_array_id am_create_vertex_array();
+void am_delete_vertex_array(am_vertex_array_id vao);
+// 0 binds the default vertex array
+void am_bind_vertex_array(am_vertex_array_id vao);
 
 // Texture Objects
 
@@ -430,6 +443,9 @@ enum am_element_index_type {
 
 void am_draw_arrays(am_draw_mode mode, int first, int count);
 void am_draw_elements(am_draw_mode mode, int count, am_element_index_type type, int offset);
+// only valid if am_instancing_supported is true
+void am_draw_arrays_instanced(am_draw_mode mode, int first, int count, int instances);
+void am_draw_elements_instanced(am_draw_mode mode, int count, am_element_index_type type, int offset, int instances);
 
 // Other
 
@@ -441,3 +457,8 @@ void am_close_gllog();
 void am_reset_gl_frame_stats();
 
 bool am_gl_requires_combined_depthstencil();
+
+#if defined(AM_USE_NULL_GL)
+// Registers am.null_gl_stats and am.reset_null_gl_stats (see am_gl_null.cpp).
+void am_open_null_gl_module(lua_State *L);
+#endif
@@ -0,0 +1,1107 @@
+// A GL backend that doesn't talk to a GPU. It's selected by building with
+// NULL_GL=1 and is intended for running the renderer on machines without
+// a display, e.g. for benchmarks on a build server.
+//
+// Every call succeeds and objects get fresh ids, but nothing is drawn:
+// read back pixels are the color the framebuffer was last cleared to and
+// shaders are not validated.
+// Instead the calls are counted (see am.null_gl_stats).
+//
+// Active attributes and uniforms are found by scanning the shader sources
+// for their declarations. Variables that are declared but never referenced
+// are left out, roughly matching what a GLSL compiler would report.
+
+#include "amulet.h"
+
+#ifdef AM_USE_NULL_GL
+
+int am_max_combined_texture_image_units = 0;
+int am_max_cube_map_texture_size = 0;
+int am_max_fragment_uniform_vectors = 0;
+int am_max_renderbuffer_size = 0;
+int am_max_texture_image_units = 0;
+int am_max_texture_size = 0;
+int am_max_varying_vectors = 0;
+int am_max_vertex_attribs = 0;
+int am_max_vertex_texture_image_units = 0;
+int am_max_vertex_uniform_vectors = 0;
+int am_frame_draw_calls = 0;
+int am_frame_use_program_calls = 0;
+bool am_instancing_supported = false;
+bool am_vertex_arrays_supported = true;
+
+static bool gl_initialized = false;
+
+struct null_gl_counters {
+    uint64_t calls;
+    uint64_t draw_calls;
+    uint64_t vertices;
+    uint64_t state_changes;
+    uint64_t program_binds;
+    uint64_t uniform_uploads;
+    uint64_t buffer_upload_bytes;
+    uint64_t texture_upload_bytes;
+    uint64_t frames;
+};
+
+static null_gl_counters total_stats;
+static null_gl_counters frame_start_stats;
+static null_gl_counters last_frame_stats;
+
+#define record_call {total_stats.calls++;}
+#define record_state_change {total_stats.calls++; total_stats.state_changes++;}
+#define record_uniform_upload {total_stats.calls++; total_stats.uniform_uploads++;}
+
+#define check_initialized(...) {if (!gl_initialized) {am_log1("%s:%d: attempt to call %s without a valid gl context", __FILE__, __LINE__, __func__); return __VA_ARGS__;}}
+
+struct null_gl_var {
+    char *name;
+    int type; // am_attribute_var_type or am_uniform_var_type
+    int size;
+};
+
+struct null_gl_object {
+    bool is_program;
+    am_shader_type shader_type;
+    char *src; // shader source with comments removed
+    std::vector<am_shader_id> shaders;
+    std::vector<null_gl_var> attributes;
+    std::vector<null_gl_var> uniforms;
+};
+
+// Shaders and programs share a namespace, as in GL. Index 0 is unused.
+static std::vector<null_gl_object*> objects;
+
+static am_gluint next_buffer_id = 1;
+static am_gluint next_texture_id = 1;
+static am_gluint next_renderbuffer_id = 1;
+static am_gluint next_framebuffer_id = 1;
+static am_gluint next_vertex_array_id = 1;
+
+// Each framebuffer's contents is just the color it was last cleared to.
+// Framebuffer 0 is the default one.
+static am_gluint bound_framebuffer = 0;
+static uint8_t clear_color[4] = {0, 0, 0, 0};
+static bool color_mask[4] = {true, true, true, true};
+static std::vector<uint32_t> framebuffer_colors;
+
+static void free_vars(std::vector<null_gl_var> *vars) {
+    for (unsigned int i = 0; i < vars->size(); i++) {
+        free((*vars)[i].name);
+    }
+    vars->clear();
+}
+
+static void free_object(am_gluint id) {
+    if (id == 0 || id >= objects.size() || objects[id] == NULL) return;
+    null_gl_object *obj = objects[id];
+    if (obj->src != NULL) free(obj->src);
+    free_vars(&obj->attributes);
+    free_vars(&obj->uniforms);
+    delete obj;
+    objects[id] = NULL;
+}
+
+static null_gl_object *get_object(am_gluint id) {
+    if (id == 0 || id >= objects.size()) return NULL;
+    return objects[id];
+}
+
+static am_gluint new_object(bool is_program, am_shader_type type) {
+    if (objects.size() == 0) objects.push_back(NULL);
+    null_gl_object *obj = new null_gl_object();
+    obj->is_program = is_program;
+    obj->shader_type = type;
+    obj->src = NULL;
+    objects.push_back(obj);
+    return (am_gluint)(objects.size() - 1);
+}
+
+// Initialization
+
+void am_init_gl() {
+    if (gl_initialized) {
+        am_log0("INTERNAL ERROR: %s", "gl already initialized");
+        return;
+    }
+    gl_initialized = true;
+
+    // typical values for a desktop GPU
+    am_max_combined_texture_image_units = 32;
+    am_max_cube_map_texture_size = 8192;
+    am_max_fragment_uniform_vectors = 1024;
+    am_max_renderbuffer_size = 8192;
+    am_max_texture_image_units = 16;
+    am_max_texture_size = 8192;
+    am_max_varying_vectors = 16;
+    am_max_vertex_attribs = 16;
+    am_max_vertex_texture_image_units = 16;
+    am_max_vertex_uniform_vectors = 1024;
+    am_instancing_supported = true;
+}
+
+void am_destroy_gl() {
+    if (!gl_initialized) return;
+    gl_initialized = false;
+    for (unsigned int i = 0; i < objects.size(); i++) {
+        free_object(i);
+    }
+    objects.clear();
+    framebuffer_colors.clear();
+    bound_framebuffer = 0;
+}
+
+bool am_gl_is_initialized() {
+    return gl_initialized;
+}
+
+// Per-Fragment Operations
+
+void am_set_blend_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_blend_color(float r, float g, float b, float a) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_blend_equation(am_blend_equation rgb, am_blend_equation alpha) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_blend_func(am_blend_sfactor src_rgb, am_blend_dfactor dst_rgb, am_blend_sfactor src_alpha, am_blend_dfactor dst_alpha) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_depth_test_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_depth_func(am_depth_func func) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_stencil_test_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_stencil_func(am_glint ref, am_gluint mask, am_stencil_func func_front, am_stencil_func func_back) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_stencil_op(am_stencil_face_side face, am_stencil_op fail, am_stencil_op zfail, am_stencil_op zpass) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_sample_alpha_to_coverage_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_sample_coverage_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_sample_coverage(float value, bool invert) {
+    check_initialized();
+    record_state_change
+}
+
+// Whole Framebuffer Operations
+
+void am_clear_framebuffer(bool clear_color_buf, bool clear_depth_buf, bool clear_stencil_buf) {
+    check_initialized();
+    record_call
+    if (!clear_color_buf) return;
+    if (framebuffer_colors.size() <= bound_framebuffer) {
+        framebuffer_colors.resize(bound_framebuffer + 1, 0);
+    }
+    uint8_t *color = (uint8_t*)&framebuffer_colors[bound_framebuffer];
+    for (int i = 0; i < 4; i++) {
+        if (color_mask[i]) color[i] = clear_color[i];
+    }
+}
+
+void am_set_framebuffer_clear_color(float r, float g, float b, float a) {
+    check_initialized();
+    record_state_change
+    float c[4] = {r, g, b, a};
+    for (int i = 0; i < 4; i++) {
+        float v = am_clamp(c[i], 0.0f, 1.0f);
+        clear_color[i] = (uint8_t)(v * 255.0f + 0.5f);
+    }
+}
+
+void am_set_framebuffer_clear_depth(float depth) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_framebuffer_clear_stencil_val(am_glint val) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_framebuffer_color_mask(bool r, bool g, bool b, bool a) {
+    check_initialized();
+    record_state_change
+    color_mask[0] = r;
+    color_mask[1] = g;
+    color_mask[2] = b;
+    color_mask[3] = a;
+}
+
+void am_set_framebuffer_depth_mask(bool flag) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_framebuffer_stencil_mask(am_gluint mask) {
+    check_initialized();
+    record_state_change
+}
+
+// Buffer Objects
+
+am_buffer_id am_create_buffer_object() {
+    check_initialized(0);
+    record_call
+    return next_buffer_id++;
+}
+
+void am_bind_buffer(am_buffer_target target, am_buffer_id buffer) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_buffer_data(am_buffer_target target, int size, void *data, am_buffer_usage usage) {
+    check_initialized();
+    record_call
+    if (data != NULL) total_stats.buffer_upload_bytes += size;
+}
+
+void am_set_buffer_sub_data(am_buffer_target target, int offset, int size, void *data) {
+    check_initialized();
+    record_call
+    total_stats.buffer_upload_bytes += size;
+}
+
+void am_delete_buffer(am_buffer_id buffer) {
+    check_initialized();
+    record_call
+}
+
+// View and Clip
+
+void am_set_depth_range(float near, float far) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_scissor_test_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_scissor(int x, int y, int w, int h) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_viewport(int x, int y, int w, int h) {
+    check_initialized();
+    record_state_change
+}
+
+// Rasterization
+
+void am_set_front_face_winding(am_face_winding mode) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_cull_face_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_cull_face_side(am_cull_face_side face) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_line_width(float w) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_polygon_offset_fill_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_polygon_offset(float factor, float units) {
+    check_initialized();
+    record_state_change
+}
+
+// Dithering
+
+void am_set_dither_enabled(bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+// Programs and Shaders
+
+static bool is_ident_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// Returns a copy of src with comments replaced by spaces.
+static char *strip_comments(const char *src) {
+    int len = strlen(src);
+    char *out = (char*)malloc(len + 1);
+    int i = 0;
+    while (i < len) {
+        if (src[i] == '/' && src[i+1] == '/') {
+            while (i < len && src[i] != '\n') out[i++] = ' ';
+        } else if (src[i] == '/' && src[i+1] == '*') {
+            out[i++] = ' ';
+            out[i++] = ' ';
+            while (i < len && !(src[i] == '*' && src[i+1] == '/')) {
+                out[i] = src[i] == '\n' ? '\n' : ' ';
+                i++;
+            }
+            if (i < len) {
+                out[i++] = ' ';
+                out[i++] = ' ';
+            }
+        } else {
+            out[i] = src[i];
+            i++;
+        }
+    }
+    out[len] = '\0';
+    return out;
+}
+
+// Reads the next token, skipping white space and preprocessor lines.
+// Tokens are identifiers, numbers or single punctuation characters.
+// Returns false at the end of the source.
+static bool next_token(const char **ptr, const char **tok, int *len) {
+    const char *p = *ptr;
+    for (;;) {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+        if (*p != '#') break;
+        while (*p != '\0' && *p != '\n') p++;
+    }
+    if (*p == '\0') {
+        *ptr = p;
+        return false;
+    }
+    *tok = p;
+    if (is_ident_char(*p)) {
+        while (is_ident_char(*p)) p++;
+    } else {
+        p++;
+    }
+    *len = (int)(p - *tok);
+    *ptr = p;
+    return true;
+}
+
+static bool token_is(const char *tok, int len, const char *str) {
+    return (int)strlen(str) == len && strncmp(tok, str, len) == 0;
+}
+
+static int count_identifier(const char *src, const char *name) {
+    const char *p = src;
+    const char *tok;
+    int len;
+    int n = 0;
+    while (next_token(&p, &tok, &len)) {
+        if (token_is(tok, len, name)) n++;
+    }
+    return n;
+}
+
+static am_attribute_var_type attribute_var_type(const char *tok, int len) {
+    if (token_is(tok, len, "float")) return AM_ATTRIBUTE_VAR_TYPE_FLOAT;
+    if (token_is(tok, len, "vec2")) return AM_ATTRIBUTE_VAR_TYPE_FLOAT_VEC2;
+    if (token_is(tok, len, "vec3")) return AM_ATTRIBUTE_VAR_TYPE_FLOAT_VEC3;
+    if (token_is(tok, len, "vec4")) return AM_ATTRIBUTE_VAR_TYPE_FLOAT_VEC4;
+    if (token_is(tok, len, "mat2")) return AM_ATTRIBUTE_VAR_TYPE_FLOAT_MAT2;
+    if (token_is(tok, len, "mat3")) return AM_ATTRIBUTE_VAR_TYPE_FLOAT_MAT3;
+    if (token_is(tok, len, "mat4")) return AM_ATTRIBUTE_VAR_TYPE_FLOAT_MAT4;
+    return AM_ATTRIBUTE_VAR_TYPE_UNKNOWN;
+}
+
+static am_uniform_var_type uniform_var_type(const char *tok, int len) {
+    if (token_is(tok, len, "float")) return AM_UNIFORM_VAR_TYPE_FLOAT;
+    if (token_is(tok, len, "vec2")) return AM_UNIFORM_VAR_TYPE_FLOAT_VEC2;
+    if (token_is(tok, len, "vec3")) return AM_UNIFORM_VAR_TYPE_FLOAT_VEC3;
+    if (token_is(tok, len, "vec4")) return AM_UNIFORM_VAR_TYPE_FLOAT_VEC4;
+    if (token_is(tok, len, "int")) return AM_UNIFORM_VAR_TYPE_INT;
+    if (token_is(tok, len, "ivec2")) return AM_UNIFORM_VAR_TYPE_INT_VEC2;
+    if (token_is(tok, len, "ivec3")) return AM_UNIFORM_VAR_TYPE_INT_VEC3;
+    if (token_is(tok, len, "ivec4")) return AM_UNIFORM_VAR_TYPE_INT_VEC4;
+    if (token_is(tok, len, "bool")) return AM_UNIFORM_VAR_TYPE_BOOL;
+    if (token_is(tok, len, "bvec2")) return AM_UNIFORM_VAR_TYPE_BOOL_VEC2;
+    if (token_is(tok, len, "bvec3")) return AM_UNIFORM_VAR_TYPE_BOOL_VEC3;
+    if (token_is(tok, len, "bvec4")) return AM_UNIFORM_VAR_TYPE_BOOL_VEC4;
+    if (token_is(tok, len, "mat2")) return AM_UNIFORM_VAR_TYPE_FLOAT_MAT2;
+    if (token_is(tok, len, "mat3")) return AM_UNIFORM_VAR_TYPE_FLOAT_MAT3;
+    if (token_is(tok, len, "mat4")) return AM_UNIFORM_VAR_TYPE_FLOAT_MAT4;
+    if (token_is(tok, len, "sampler2D")) return AM_UNIFORM_VAR_TYPE_SAMPLER_2D;
+    if (token_is(tok, len, "samplerCube")) return AM_UNIFORM_VAR_TYPE_SAMPLER_CUBE;
+    return AM_UNIFORM_VAR_TYPE_UNKNOWN;
+}
+
+static bool has_var(std::vector<null_gl_var> *vars, const char *tok, int len) {
+    for (unsigned int i = 0; i < vars->size(); i++) {
+        if (token_is(tok, len, (*vars)[i].name)) return true;
+    }
+    return false;
+}
+
+// Appends the attributes or uniforms (depending on qualifier) declared
+// in src to vars, e.g. "uniform highp vec4 a, b[2];".
+static void parse_declarations(const char *src, const char *qualifier, std::vector<null_gl_var> *vars) {
+    bool is_uniform = strcmp(qualifier, "uniform") == 0;
+    const char *p = src;
+    const char *tok;
+    int len;
+    bool stmt_start = true;
+    while (next_token(&p, &tok, &len)) {
+        bool is_decl = stmt_start && token_is(tok, len, qualifier);
+        stmt_start = len == 1 && (*tok == ';' || *tok == '{' || *tok == '}');
+        if (!is_decl) continue;
+        if (!next_token(&p, &tok, &len)) return;
+        if (token_is(tok, len, "lowp") || token_is(tok, len, "mediump") || token_is(tok, len, "highp")) {
+            if (!next_token(&p, &tok, &len)) return;
+        }
+        int type = is_uniform ? (int)uniform_var_type(tok, len) : (int)attribute_var_type(tok, len);
+        while (next_token(&p, &tok, &len)) {
+            if (*tok == ';') {
+                stmt_start = true;
+                break;
+            }
+            if (*tok == ',' || !is_ident_char(*tok)) continue;
+            null_gl_var var;
+            var.name = (char*)malloc(len + 1);
+            memcpy(var.name, tok, len);
+            var.name[len] = '\0';
+            var.type = type;
+            var.size = 1;
+            const char *q = p;
+            if (next_token(&q, &tok, &len) && *tok == '[') {
+                if (next_token(&q, &tok, &len)) {
+                    var.size = am_max(1, atoi(tok));
+                }
+                p = q;
+            }
+            if (has_var(vars, var.name, strlen(var.name))) {
+                free(var.name);
+            } else {
+                vars->push_back(var);
+            }
+        }
+    }
+}
+
+// Removes the variables that are only mentioned in their declarations.
+static void remove_inactive_vars(std::vector<null_gl_var> *vars, std::vector<null_gl_object*> *shaders) {
+    std::vector<null_gl_var> active;
+    for (unsigned int i = 0; i < vars->size(); i++) {
+        null_gl_var *var = &(*vars)[i];
+        int refs = 0;
+        int decls = 0;
+        for (unsigned int s = 0; s < shaders->size(); s++) {
+            int n = count_identifier((*shaders)[s]->src, var->name);
+            if (n > 0) decls++;
+            refs += n;
+        }
+        if (refs > decls) {
+            active.push_back(*var);
+        } else {
+            free(var->name);
+        }
+    }
+    *vars = active;
+}
+
+am_program_id am_create_program() {
+    check_initialized(0);
+    record_call
+    return new_object(true, AM_VERTEX_SHADER);
+}
+
+am_shader_id am_create_shader(am_shader_type type) {
+    check_initialized(0);
+    record_call
+    return new_object(false, type);
+}
+
+bool am_compile_shader(am_shader_id shader, am_shader_type type, const char *src, char **msg, int *line_no, char **line_str) {
+    check_initialized(false);
+    record_call
+    *msg = NULL;
+    *line_str = NULL;
+    *line_no = -1;
+    null_gl_object *obj = get_object(shader);
+    if (obj == NULL || obj->is_program) {
+        const char *err = "invalid shader";
+        *msg = (char*)malloc(strlen(err) + 1);
+        strcpy(*msg, err);
+        return false;
+    }
+    if (obj->src != NULL) free(obj->src);
+    obj->src = strip_comments(src);
+    return true;
+}
+
+void am_attach_shader(am_program_id program, am_shader_id shader) {
+    check_initialized();
+    record_call
+    null_gl_object *obj = get_object(program);
+    if (obj == NULL || !obj->is_program) return;
+    obj->shaders.push_back(shader);
+}
+
+bool am_link_program(am_program_id program) {
+    check_initialized(false);
+    record_call
+    null_gl_object *prog = get_object(program);
+    if (prog == NULL || !prog->is_program) return false;
+    free_vars(&prog->attributes);
+    free_vars(&prog->uniforms);
+    std::vector<null_gl_object*> shaders;
+    for (unsigned int i = 0; i < prog->shaders.size(); i++) {
+        null_gl_object *shader = get_object(prog->shaders[i]);
+        if (shader == NULL || shader->src == NULL) return false;
+        shaders.push_back(shader);
+    }
+    for (unsigned int i = 0; i < shaders.size(); i++) {
+        if (shaders[i]->shader_type == AM_VERTEX_SHADER) {
+            parse_declarations(shaders[i]->src, "attribute", &prog->attributes);
+        }
+        parse_declarations(shaders[i]->src, "uniform", &prog->uniforms);
+    }
+    remove_inactive_vars(&prog->attributes, &shaders);
+    remove_inactive_vars(&prog->uniforms, &shaders);
+    return true;
+}
+
+char *am_get_program_info_log(am_program_id program) {
+    check_initialized(NULL);
+    record_call
+    char *log = (char*)malloc(1);
+    log[0] = '\0';
+    return log;
+}
+
+int am_get_program_active_attributes(am_program_id program) {
+    check_initialized(0);
+    record_call
+    null_gl_object *prog = get_object(program);
+    if (prog == NULL || !prog->is_program) return 0;
+    return prog->attributes.size();
+}
+
+int am_get_program_active_uniforms(am_program_id program) {
+    check_initialized(0);
+    record_call
+    null_gl_object *prog = get_object(program);
+    if (prog == NULL || !prog->is_program) return 0;
+    return prog->uniforms.size();
+}
+
+bool am_validate_program(am_program_id program) {
+    check_initialized(false);
+    record_call
+    return true;
+}
+
+void am_use_program(am_program_id program) {
+    check_initialized();
+    record_state_change
+    total_stats.program_binds++;
+    am_frame_use_program_calls++;
+}
+
+void am_detach_shader(am_program_id program, am_shader_id shader) {
+    check_initialized();
+    record_call
+    null_gl_object *obj = get_object(program);
+    if (obj == NULL || !obj->is_program) return;
+    for (unsigned int i = 0; i < obj->shaders.size(); i++) {
+        if (obj->shaders[i] == shader) {
+            obj->shaders.erase(obj->shaders.begin() + i);
+            return;
+        }
+    }
+}
+
+void am_delete_shader(am_shader_id shader) {
+    check_initialized();
+    record_call
+    free_object(shader);
+}
+
+void am_delete_program(am_program_id program) {
+    check_initialized();
+    record_call
+    free_object(program);
+}
+
+// Uniforms and Attributes
+
+int am_attribute_client_type_size(am_attribute_client_type t) {
+    switch (t) {
+        case AM_ATTRIBUTE_CLIENT_TYPE_BYTE: return 1;
+        case AM_ATTRIBUTE_CLIENT_TYPE_SHORT: return 2;
+        case AM_ATTRIBUTE_CLIENT_TYPE_UBYTE: return 1;
+        case AM_ATTRIBUTE_CLIENT_TYPE_USHORT: return 2;
+        case AM_ATTRIBUTE_CLIENT_TYPE_FLOAT: return 4;
+    }
+    return 0;
+}
+
+void am_set_attribute_array_enabled(am_gluint location, bool enabled) {
+    check_initialized();
+    record_state_change
+}
+
+static void get_active_var(std::vector<null_gl_var> *vars, am_gluint index,
+    char **name, int *type, int *size, am_gluint *loc)
+{
+    const char *var_name = index < vars->size() ? (*vars)[index].name : "";
+    *name = (char*)malloc(strlen(var_name) + 1);
+    strcpy(*name, var_name);
+    *type = index < vars->size() ? (*vars)[index].type : -1;
+    *size = index < vars->size() ? (*vars)[index].size : 0;
+    *loc = index;
+}
+
+void am_get_active_attribute(am_program_id program, am_gluint index,
+    char **name, am_attribute_var_type *type, int *size, am_gluint *loc)
+{
+    check_initialized();
+    record_call
+    null_gl_object *prog = get_object(program);
+    std::vector<null_gl_var> none;
+    int t;
+    get_active_var(prog != NULL ? &prog->attributes : &none, index, name, &t, size, loc);
+    *type = t < 0 ? AM_ATTRIBUTE_VAR_TYPE_UNKNOWN : (am_attribute_var_type)t;
+}
+
+void am_get_active_uniform(am_program_id program, am_gluint index,
+    char **name, am_uniform_var_type *type, int *size, am_gluint *loc)
+{
+    check_initialized();
+    record_call
+    null_gl_object *prog = get_object(program);
+    std::vector<null_gl_var> none;
+    int t;
+    get_active_var(prog != NULL ? &prog->uniforms : &none, index, name, &t, size, loc);
+    *type = t < 0 ? AM_UNIFORM_VAR_TYPE_UNKNOWN : (am_uniform_var_type)t;
+}
+
+void am_set_uniform1f(am_gluint location, float value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform2f(am_gluint location, const float *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform3f(am_gluint location, const float *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform4f(am_gluint location, const float *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform1i(am_gluint location, am_glint value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform2i(am_gluint location, const am_glint *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform3i(am_gluint location, const am_glint *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform4i(am_gluint location, const am_glint *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform_mat2(am_gluint location, const float *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform_mat3(am_gluint location, const float *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_uniform_mat4(am_gluint location, const float *value) {
+    check_initialized();
+    record_uniform_upload
+}
+
+void am_set_attribute1f(am_gluint location, const float value) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_attribute2f(am_gluint location, const float *value) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_attribute3f(am_gluint location, const float *value) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_attribute4f(am_gluint location, const float *value) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_attribute_pointer(am_gluint location, int size, am_attribute_client_type type, bool normalized, int stride, int offset) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_attribute_divisor(am_gluint location, int divisor) {
+    check_initialized();
+    record_state_change
+}
+
+// Vertex Array Objects
+
+am_vertex_array_id am_create_vertex_array() {
+    check_initialized(0);
+    record_call
+    return next_vertex_array_id++;
+}
+
+void am_delete_vertex_array(am_vertex_array_id vao) {
+    check_initialized();
+    record_call
+}
+
+void am_bind_vertex_array(am_vertex_array_id vao) {
+    check_initialized();
+    record_state_change
+}
+
+// Texture Objects
+
+void am_set_active_texture_unit(int texture_unit) {
+    check_initialized();
+    record_state_change
+}
+
+am_texture_id am_create_texture() {
+    check_initialized(0);
+    record_call
+    return next_texture_id++;
+}
+
+void am_delete_texture(am_texture_id texture) {
+    check_initialized();
+    record_call
+}
+
+void am_bind_texture(am_texture_bind_target target, am_texture_id texture) {
+    check_initialized();
+    record_state_change
+}
+
+void am_copy_texture_image_2d(am_texture_copy_target target, int level, am_texture_format format, int x, int y, int w, int h) {
+    check_initialized();
+    record_call
+}
+
+void am_copy_texture_sub_image_2d(am_texture_copy_target target, int level, int xoffset, int yoffset, int x, int y, int w, int h) {
+    check_initialized();
+    record_call
+}
+
+void am_generate_mipmap(am_texture_bind_target target) {
+    check_initialized();
+    record_call
+}
+
+int am_compute_pixel_size(am_texture_format format, am_texture_type type) {
+    switch (type) {
+        case AM_TEXTURE_TYPE_UBYTE:
+            switch (format) {
+                case AM_TEXTURE_FORMAT_ALPHA:
+                case AM_TEXTURE_FORMAT_LUMINANCE:
+                    return 1;
+                case AM_TEXTURE_FORMAT_LUMINANCE_ALPHA:
+                    return 2;
+                case AM_TEXTURE_FORMAT_RGB:
+                    return 3;
+                case AM_TEXTURE_FORMAT_RGBA:
+                    return 4;
+            }
+        case AM_TEXTURE_TYPE_USHORT_5_6_5:
+        case AM_TEXTURE_TYPE_USHORT_4_4_4_4:
+        case AM_TEXTURE_TYPE_USHORT_5_5_5_1:
+            return 2;
+    }
+    assert(false);
+    return 0;
+}
+
+void am_set_texture_image_2d(am_texture_copy_target target, int level, am_texture_format format, int w, int h, am_texture_type type, void *data) {
+    check_initialized();
+    record_call
+    if (data != NULL) {
+        total_stats.texture_upload_bytes += (uint64_t)w * h * am_compute_pixel_size(format, type);
+    }
+}
+
+void am_set_texture_sub_image_2d(am_texture_copy_target target, int level, int xoffset, int yoffset, int w, int h, am_texture_format format, am_texture_type type, void *data) {
+    check_initialized();
+    record_call
+    total_stats.texture_upload_bytes += (uint64_t)w * h * am_compute_pixel_size(format, type);
+}
+
+void am_set_texture_min_filter(am_texture_bind_target target, am_texture_min_filter filter) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_texture_mag_filter(am_texture_bind_target target, am_texture_mag_filter filter) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_texture_wrap(am_texture_bind_target target, am_texture_wrap s_wrap, am_texture_wrap t_wrap) {
+    check_initialized();
+    record_state_change
+}
+
+// Renderbuffer Objects
+
+am_renderbuffer_id am_create_renderbuffer() {
+    check_initialized(0);
+    record_call
+    return next_renderbuffer_id++;
+}
+
+void am_delete_renderbuffer(am_renderbuffer_id rb) {
+    check_initialized();
+    record_call
+}
+
+void am_bind_renderbuffer(am_renderbuffer_id rb) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_renderbuffer_storage(am_renderbuffer_format format, int w, int h) {
+    check_initialized();
+    record_call
+}
+
+// Read Back Pixels
+
+void am_read_pixels(int x, int y, int w, int h, void *data) {
+    check_initialized();
+    record_call
+    uint32_t color = bound_framebuffer < framebuffer_colors.size() ?
+        framebuffer_colors[bound_framebuffer] : 0;
+    uint8_t *pixels = (uint8_t*)data;
+    for (int i = 0; i < w * h; i++) {
+        memcpy(pixels + i * 4, &color, 4);
+    }
+}
+
+// Framebuffer Objects
+
+am_framebuffer_id am_create_framebuffer() {
+    check_initialized(0);
+    record_call
+    return next_framebuffer_id++;
+}
+
+void am_delete_framebuffer(am_framebuffer_id fb) {
+    check_initialized();
+    record_call
+    if (fb < framebuffer_colors.size()) {
+        framebuffer_colors[fb] = 0;
+    }
+}
+
+void am_bind_framebuffer(am_framebuffer_id fb) {
+    check_initialized();
+    record_state_change
+    bound_framebuffer = fb;
+}
+
+am_framebuffer_status am_check_framebuffer_status() {
+    check_initialized(AM_FRAMEBUFFER_STATUS_UNKNOWN);
+    record_call
+    return AM_FRAMEBUFFER_STATUS_COMPLETE;
+}
+
+void am_set_framebuffer_renderbuffer(am_framebuffer_attachment attachment, am_renderbuffer_id rb) {
+    check_initialized();
+    record_state_change
+}
+
+void am_set_framebuffer_texture2d(am_framebuffer_attachment attachment, am_texture_copy_target target, am_texture_id texture) {
+    check_initialized();
+    record_state_change
+}
+
+// Writing to the Draw Buffer
+
+void am_draw_arrays(am_draw_mode mode, int first, int count) {
+    check_initialized();
+    record_call
+    total_stats.draw_calls++;
+    total_stats.vertices += count;
+    am_frame_draw_calls++;
+}
+
+void am_draw_elements(am_draw_mode mode, int count, am_element_index_type type, int offset) {
+    check_initialized();
+    record_call
+    total_stats.draw_calls++;
+    total_stats.vertices += count;
+    am_frame_draw_calls++;
+}
+
+void am_draw_arrays_instanced(am_draw_mode mode, int first, int count, int instances) {
+    check_initialized();
+    record_call
+    total_stats.draw_calls++;
+    total_stats.vertices += (uint64_t)count * instances;
+    am_frame_draw_calls++;
+}
+
+void am_draw_elements_instanced(am_draw_mode mode, int count, am_element_index_type type, int offset, int instances) {
+    check_initialized();
+    record_call
+    total_stats.draw_calls++;
+    total_stats.vertices += (uint64_t)count * instances;
+    am_frame_draw_calls++;
+}
+
+// Other
+
+void am_gl_end_framebuffer_render() {
+}
+
+void am_gl_end_frame(bool present) {
+}
+
+void am_log_gl(const char *msg) {
+}
+
+void am_close_gllog() {
+}
+
+void am_reset_gl_frame_stats() {
+    am_frame_draw_calls = 0;
+    am_frame_use_program_calls = 0;
+    last_frame_stats.calls = total_stats.calls - frame_start_stats.calls;
+    last_frame_stats.draw_calls = total_stats.draw_calls - frame_start_stats.draw_calls;
+    last_frame_stats.vertices = total_stats.vertices - frame_start_stats.vertices;
+    last_frame_stats.state_changes = total_stats.state_changes - frame_start_stats.state_changes;
+    last_frame_stats.program_binds = total_stats.program_binds - frame_start_stats.program_binds;
+    last_frame_stats.uniform_uploads = total_stats.uniform_uploads - frame_start_stats.uniform_uploads;
+    last_frame_stats.buffer_upload_bytes = total_stats.buffer_upload_bytes - frame_start_stats.buffer_upload_bytes;
+    last_frame_stats.texture_upload_bytes = total_stats.texture_upload_bytes - frame_start_stats.texture_upload_bytes;
+    last_frame_stats.frames = 1;
+    total_stats.frames++;
+    frame_start_stats = total_stats;
+}
+
+bool am_gl_requires_combined_depthstencil() {
+    return false;
+}
+
+// Lua interface
+
+static int null_gl_stats(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    null_gl_counters *stats = &total_stats;
+    if (nargs > 0 && !lua_isnil(L, 1)) {
+        const char *mode = luaL_checkstring(L, 1);
+        if (strcmp(mode, "frame") == 0) {
+            stats = &last_frame_stats;
+        } else if (strcmp(mode, "total") != 0) {
+            return luaL_error(L, "invalid mode: '%s' (expecting 'total' or 'frame')", mode);
+        }
+    }
+    lua_newtable(L);
+    lua_pushnumber(L, (double)stats->calls);
+    lua_setfield(L, -2, "calls");
+    lua_pushnumber(L, (double)stats->draw_calls);
+    lua_setfield(L, -2, "draw_calls");
+    lua_pushnumber(L, (double)stats->vertices);
+    lua_setfield(L, -2, "vertices");
+    lua_pushnumber(L, (double)stats->state_changes);
+    lua_setfield(L, -2, "state_changes");
+    lua_pushnumber(L, (double)stats->program_binds);
+    lua_setfield(L, -2, "program_binds");
+    lua_pushnumber(L, (double)stats->uniform_uploads);
+    lua_setfield(L, -2, "uniform_uploads");
+    lua_pushnumber(L, (double)stats->buffer_upload_bytes);
+    lua_setfield(L, -2, "buffer_upload_bytes");
+    lua_pushnumber(L, (double)stats->texture_upload_bytes);
+    lua_setfield(L, -2, "texture_upload_bytes");
+    lua_pushnumber(L, (double)stats->frames);
+    lua_setfield(L, -2, "frames");
+    return 1;
+}
+
+static int reset_null_gl_stats(lua_State *L) {
+    memset(&total_stats, 0, sizeof(null_gl_counters));
+    memset(&frame_start_stats, 0, sizeof(null_gl_counters));
+    memset(&last_frame_stats, 0, sizeof(null_gl_counters));
+    return 0;
+}
+
+void am_open_null_gl_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"null_gl_stats", null_gl_stats},
+        {"reset_null_gl_stats", reset_null_gl_stats},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+}
+
+#endif // AM_USE_NULL_GL
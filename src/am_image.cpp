@@ -60,7 +60,7 @@ static int create_image_buffer(lua_State *L) {
 
 bool am_load_image(const char *filename, uint8_t **img_data, int *width, int *height, char **errmsg) {
     int len;
-    void *data = am_read_resource(filename, &len, errmsg);
+    const void *data = am_acquire_resource(filename, &len, errmsg);
     if (data == NULL) {
         return false;
     }
@@ -68,7 +68,7 @@ bool am_load_image(const char *filename, uint8_t **img_data, int *width, int *he
     stbi_set_flip_vertically_on_load(1);
     *img_data =
         (uint8_t*)stbi_load_from_memory((stbi_uc const *)data, len, width, height, &components, 4);
-    free(data);
+    am_release_resource(filename, data);
     if (img_data == NULL) {
         *errmsg = am_format("%s", stbi_failure_reason());
     }
@@ -0,0 +1,719 @@
+#include "amulet.h"
+
+// Jobs run Lua functions on a pool of worker threads. Each worker thread
+// has its own worker engine (see am_init_engine), so values can't be
+// shared between the main state and the workers. Instead arguments are
+// written to a message when a job is started and read back in the worker,
+// and the results are passed back the same way. Buffer data is moved
+// rather than copied, leaving the sending buffer in the same state as a
+// freed buffer.
+//
+// Where threads aren't available jobs run to completion in a worker engine
+// on the main thread when they're started.
+
+enum job_value_tag {
+    TAG_NIL,
+    TAG_TRUE,
+    TAG_FALSE,
+    TAG_NUMBER,
+    TAG_STRING,
+    TAG_TABLE,
+    TAG_TABLE_END,
+    TAG_BUFFER,
+    TAG_VIEW,
+    TAG_VEC2,
+    TAG_VEC3,
+    TAG_VEC4,
+    TAG_MAT2,
+    TAG_MAT3,
+    TAG_MAT4,
+    TAG_QUAT,
+};
+
+#define MAX_TABLE_DEPTH 64
+
+enum job_state {
+    JOB_PENDING,
+    JOB_SUCCESS,
+    JOB_ERROR,
+};
+
+struct job_buffer {
+    am_buffer *source; // only valid while the message is being written
+    uint8_t *data;
+    int size;
+    am_package *pkg;
+    am_buffer_usage usage;
+};
+
+struct job_message {
+    uint8_t *bytes;
+    int len;
+    int capacity;
+    int num_values;
+    std::vector<job_buffer> buffers;
+};
+
+struct am_job {
+    am_job *next;
+    char *name;
+    job_message args;
+    job_message results;
+    char *error;
+    am_semaphore *done;
+    volatile uint32_t state;
+    volatile uint32_t refs;
+};
+
+struct job_pool {
+    am_mutex *mutex;
+    am_semaphore *pending;
+    am_job *head;
+    am_job *tail;
+    std::vector<am_thread*> threads;
+};
+
+static job_pool *pool = NULL;
+static bool pool_initialized = false;
+
+// used when threads aren't available
+static am_engine *inline_engine = NULL;
+
+struct am_job_future : am_nonatomic_userdata {
+    am_job *job;
+    int results_ref;
+    int num_results;
+};
+
+// Messages
+
+static void init_message(job_message *msg) {
+    msg->bytes = NULL;
+    msg->len = 0;
+    msg->capacity = 0;
+    msg->num_values = 0;
+}
+
+static void free_message(job_message *msg) {
+    for (unsigned int i = 0; i < msg->buffers.size(); i++) {
+        job_buffer *b = &msg->buffers[i];
+        if (b->data == NULL) continue;
+        if (b->pkg != NULL) {
+            am_unmap_package_resource(b->pkg, b->data, b->size);
+        } else {
+            free(b->data);
+        }
+    }
+    msg->buffers.clear();
+    if (msg->bytes != NULL) free(msg->bytes);
+    init_message(msg);
+}
+
+static void write_bytes(job_message *msg, const void *data, int len) {
+    if (msg->len + len > msg->capacity) {
+        int capacity = am_max(msg->capacity * 2, 256);
+        while (capacity < msg->len + len) capacity *= 2;
+        msg->bytes = (uint8_t*)realloc(msg->bytes, capacity);
+        msg->capacity = capacity;
+    }
+    memcpy(msg->bytes + msg->len, data, len);
+    msg->len += len;
+}
+
+static void write_tag(job_message *msg, job_value_tag tag) {
+    uint8_t t = (uint8_t)tag;
+    write_bytes(msg, &t, 1);
+}
+
+static void write_int(job_message *msg, int n) {
+    int32_t i = n;
+    write_bytes(msg, &i, sizeof(int32_t));
+}
+
+static void write_doubles(job_message *msg, const double *d, int n) {
+    write_bytes(msg, d, n * sizeof(double));
+}
+
+// Returns the index of the buffer in the message, adding it if this is
+// the first time it's been seen.
+static int add_buffer(job_message *msg, am_buffer *buf) {
+    for (unsigned int i = 0; i < msg->buffers.size(); i++) {
+        if (msg->buffers[i].source == buf) return i;
+    }
+    job_buffer b;
+    b.source = buf;
+    b.data = NULL;
+    b.size = buf->size;
+    b.pkg = NULL;
+    b.usage = buf->usage;
+    msg->buffers.push_back(b);
+    return msg->buffers.size() - 1;
+}
+
+static void write_value(lua_State *L, job_message *msg, int idx, int depth) {
+    idx = am_absindex(L, idx);
+    switch (lua_type(L, idx)) {
+        case LUA_TNIL:
+            write_tag(msg, TAG_NIL);
+            return;
+        case LUA_TBOOLEAN:
+            write_tag(msg, lua_toboolean(L, idx) ? TAG_TRUE : TAG_FALSE);
+            return;
+        case LUA_TNUMBER: {
+            double n = lua_tonumber(L, idx);
+            write_tag(msg, TAG_NUMBER);
+            write_doubles(msg, &n, 1);
+            return;
+        }
+        case LUA_TSTRING: {
+            size_t len;
+            const char *str = lua_tolstring(L, idx, &len);
+            write_tag(msg, TAG_STRING);
+            write_int(msg, (int)len);
+            write_bytes(msg, str, (int)len);
+            return;
+        }
+        case LUA_TTABLE: {
+            if (depth >= MAX_TABLE_DEPTH) {
+                luaL_error(L, "tables passed to or from jobs may not be nested more than %d deep (or contain cycles)", MAX_TABLE_DEPTH);
+                return;
+            }
+            luaL_checkstack(L, 3, "table too deep");
+            write_tag(msg, TAG_TABLE);
+            lua_pushnil(L);
+            while (lua_next(L, idx) != 0) {
+                write_value(L, msg, -2, depth + 1);
+                write_value(L, msg, -1, depth + 1);
+                lua_pop(L, 1); // value
+            }
+            write_tag(msg, TAG_TABLE_END);
+            return;
+        }
+        case LUA_TUSERDATA: {
+            int type = am_get_type(L, idx);
+            switch (type) {
+                case MT_am_buffer:
+                case MT_am_buffer_gc: {
+                    am_buffer *buf = am_check_buffer(L, idx);
+                    write_tag(msg, TAG_BUFFER);
+                    write_int(msg, add_buffer(msg, buf));
+                    return;
+                }
+                case MT_am_buffer_view: {
+                    am_buffer_view *view = am_check_buffer_view(L, idx);
+                    write_tag(msg, TAG_VIEW);
+                    write_int(msg, add_buffer(msg, view->buffer));
+                    write_int(msg, (int)view->type);
+                    write_int(msg, view->components);
+                    write_int(msg, view->offset);
+                    write_int(msg, view->stride);
+                    write_int(msg, view->size);
+                    return;
+                }
+                case MT_am_vec2:
+                    write_tag(msg, TAG_VEC2);
+                    write_doubles(msg, glm::value_ptr(am_get_userdata(L, am_vec2, idx)->v), 2);
+                    return;
+                case MT_am_vec3:
+                    write_tag(msg, TAG_VEC3);
+                    write_doubles(msg, glm::value_ptr(am_get_userdata(L, am_vec3, idx)->v), 3);
+                    return;
+                case MT_am_vec4:
+                    write_tag(msg, TAG_VEC4);
+                    write_doubles(msg, glm::value_ptr(am_get_userdata(L, am_vec4, idx)->v), 4);
+                    return;
+                case MT_am_mat2:
+                    write_tag(msg, TAG_MAT2);
+                    write_doubles(msg, glm::value_ptr(am_get_userdata(L, am_mat2, idx)->m), 4);
+                    return;
+                case MT_am_mat3:
+                    write_tag(msg, TAG_MAT3);
+                    write_doubles(msg, glm::value_ptr(am_get_userdata(L, am_mat3, idx)->m), 9);
+                    return;
+                case MT_am_mat4:
+                    write_tag(msg, TAG_MAT4);
+                    write_doubles(msg, glm::value_ptr(am_get_userdata(L, am_mat4, idx)->m), 16);
+                    return;
+                case MT_am_quat:
+                    write_tag(msg, TAG_QUAT);
+                    write_doubles(msg, glm::value_ptr(am_get_userdata(L, am_quat, idx)->q), 4);
+                    return;
+            }
+            luaL_error(L, "a %s can't be passed to or from a job", am_get_typename(L, type));
+            return;
+        }
+    }
+    luaL_error(L, "a %s can't be passed to or from a job", lua_typename(L, lua_type(L, idx)));
+}
+
+// Writes the values at stack positions first to last to msg. The data of
+// any buffers is only taken once all the values have been written, so the
+// buffers are left alone if this raises an error.
+static void write_message(lua_State *L, job_message *msg, int first, int last) {
+    for (int i = first; i <= last; i++) {
+        write_value(L, msg, i, 0);
+    }
+    msg->num_values = last - first + 1;
+    for (unsigned int i = 0; i < msg->buffers.size(); i++) {
+        job_buffer *b = &msg->buffers[i];
+        b->data = b->source->take_data(&b->pkg);
+        b->source = NULL;
+    }
+}
+
+static job_value_tag read_tag(const uint8_t **p) {
+    job_value_tag tag = (job_value_tag)**p;
+    (*p)++;
+    return tag;
+}
+
+static int read_int(const uint8_t **p) {
+    int32_t i;
+    memcpy(&i, *p, sizeof(int32_t));
+    *p += sizeof(int32_t);
+    return i;
+}
+
+static void read_doubles(const uint8_t **p, double *d, int n) {
+    memcpy(d, *p, n * sizeof(double));
+    *p += n * sizeof(double);
+}
+
+static void read_value(lua_State *L, const uint8_t **p, int buffers_idx) {
+    luaL_checkstack(L, 4, "table too deep");
+    switch (read_tag(p)) {
+        case TAG_NIL:
+            lua_pushnil(L);
+            return;
+        case TAG_TRUE:
+            lua_pushboolean(L, 1);
+            return;
+        case TAG_FALSE:
+            lua_pushboolean(L, 0);
+            return;
+        case TAG_NUMBER: {
+            double n;
+            read_doubles(p, &n, 1);
+            lua_pushnumber(L, n);
+            return;
+        }
+        case TAG_STRING: {
+            int len = read_int(p);
+            lua_pushlstring(L, (const char*)*p, len);
+            *p += len;
+            return;
+        }
+        case TAG_TABLE:
+            lua_newtable(L);
+            while (**p != TAG_TABLE_END) {
+                read_value(L, p, buffers_idx);
+                read_value(L, p, buffers_idx);
+                lua_rawset(L, -3);
+            }
+            (*p)++;
+            return;
+        case TAG_BUFFER:
+            lua_rawgeti(L, buffers_idx, read_int(p) + 1);
+            return;
+        case TAG_VIEW: {
+            lua_rawgeti(L, buffers_idx, read_int(p) + 1);
+            am_buffer *buf = (am_buffer*)lua_touserdata(L, -1);
+            am_buffer_view_type type = (am_buffer_view_type)read_int(p);
+            int components = read_int(p);
+            am_buffer_view *view = am_new_buffer_view(L, type, components);
+            view->buffer = buf;
+            view->buffer_ref = view->ref(L, -2);
+            view->offset = read_int(p);
+            view->stride = read_int(p);
+            view->size = read_int(p);
+            lua_remove(L, -2); // buffer
+            return;
+        }
+        case TAG_VEC2:
+            read_doubles(p, glm::value_ptr(am_new_userdata(L, am_vec2)->v), 2);
+            return;
+        case TAG_VEC3:
+            read_doubles(p, glm::value_ptr(am_new_userdata(L, am_vec3)->v), 3);
+            return;
+        case TAG_VEC4:
+            read_doubles(p, glm::value_ptr(am_new_userdata(L, am_vec4)->v), 4);
+            return;
+        case TAG_MAT2:
+            read_doubles(p, glm::value_ptr(am_new_userdata(L, am_mat2)->m), 4);
+            return;
+        case TAG_MAT3:
+            read_doubles(p, glm::value_ptr(am_new_userdata(L, am_mat3)->m), 9);
+            return;
+        case TAG_MAT4:
+            read_doubles(p, glm::value_ptr(am_new_userdata(L, am_mat4)->m), 16);
+            return;
+        case TAG_QUAT:
+            read_doubles(p, glm::value_ptr(am_new_userdata(L, am_quat)->q), 4);
+            return;
+        case TAG_TABLE_END:
+            break;
+    }
+    am_abort("INTERNAL ERROR: corrupt job message");
+}
+
+// Pushes the values in msg and returns the number of values pushed.
+// The buffers in the message then belong to L.
+static int read_message(lua_State *L, job_message *msg) {
+    luaL_checkstack(L, msg->num_values + 2, "too many job values");
+    lua_createtable(L, msg->buffers.size(), 0);
+    int buffers_idx = lua_gettop(L);
+    for (unsigned int i = 0; i < msg->buffers.size(); i++) {
+        job_buffer *b = &msg->buffers[i];
+        am_buffer *buf;
+        if (b->pkg != NULL) {
+            buf = am_push_new_buffer_with_package_data(L, b->size, b->data, b->pkg);
+        } else if (b->data != NULL) {
+            buf = am_push_new_buffer_with_data(L, b->size, b->data);
+        } else {
+            buf = am_push_new_buffer_and_init(L, 0);
+        }
+        buf->usage = b->usage;
+        buf->mark_dirty(0, buf->size);
+        b->data = NULL;
+        lua_rawseti(L, buffers_idx, i + 1);
+    }
+    const uint8_t *p = msg->bytes;
+    for (int i = 0; i < msg->num_values; i++) {
+        read_value(L, &p, buffers_idx);
+    }
+    lua_remove(L, buffers_idx);
+    int n = msg->num_values;
+    free_message(msg);
+    return n;
+}
+
+// Jobs
+
+static am_job *new_job(const char *name) {
+    am_job *job = new am_job();
+    job->next = NULL;
+    job->name = (char*)malloc(strlen(name) + 1);
+    strcpy(job->name, name);
+    init_message(&job->args);
+    init_message(&job->results);
+    job->error = NULL;
+    job->done = am_create_semaphore();
+    job->state = JOB_PENDING;
+    job->refs = 1;
+    return job;
+}
+
+static void release_job(am_job *job) {
+    if (am_atomic_add(&job->refs, (uint32_t)-1) == 0) {
+        free(job->name);
+        free_message(&job->args);
+        free_message(&job->results);
+        if (job->error != NULL) free(job->error);
+        am_destroy_semaphore(job->done);
+        delete job;
+    }
+}
+
+static void finish_job(am_job *job, const char *error) {
+    if (error != NULL) {
+        job->error = (char*)malloc(strlen(error) + 1);
+        strcpy(job->error, error);
+        free_message(&job->results);
+    }
+    am_atomic_store(&job->state, error == NULL ? JOB_SUCCESS : JOB_ERROR);
+    am_signal_semaphore(job->done);
+}
+
+// Pushes the function a job name refers to. Names of the form
+// "a.b.f" refer to the field f of the global table a.b or, if there's
+// no such table, of the module returned by require("a.b").
+static void push_job_function(lua_State *L, const char *name) {
+    const char *dot = strrchr(name, '.');
+    if (dot == NULL) {
+        lua_getglobal(L, name);
+    } else {
+#if defined(AM_LUA52) || defined(AM_LUA53)
+        lua_rawgeti(L, LUA_REGISTRYINDEX, LUA_RIDX_GLOBALS);
+#else
+        lua_pushvalue(L, LUA_GLOBALSINDEX);
+#endif
+        const char *start = name;
+        while (start < dot && lua_istable(L, -1)) {
+            const char *end = start;
+            while (end < dot && *end != '.') end++;
+            lua_pushlstring(L, start, end - start);
+            lua_gettable(L, -2);
+            lua_remove(L, -2);
+            start = end + 1;
+        }
+        if (!lua_istable(L, -1)) {
+            lua_pop(L, 1);
+            lua_getglobal(L, "require");
+            lua_pushlstring(L, name, dot - name);
+            lua_call(L, 1, 1);
+        }
+        if (lua_istable(L, -1)) {
+            lua_getfield(L, -1, dot + 1);
+            lua_remove(L, -2);
+        }
+    }
+    if (!lua_isfunction(L, -1)) {
+        luaL_error(L, "job function '%s' not found", name);
+    }
+}
+
+static int run_job_in_engine(lua_State *L) {
+    am_job *job = (am_job*)lua_touserdata(L, 1);
+    lua_settop(L, 0);
+    push_job_function(L, job->name);
+    int nargs = read_message(L, &job->args);
+    lua_call(L, nargs, LUA_MULTRET);
+    write_message(L, &job->results, 1, lua_gettop(L));
+    return 0;
+}
+
+static void execute_job(am_engine *eng, am_job *job) {
+    if (eng == NULL) {
+        finish_job(job, "unable to create worker engine");
+        return;
+    }
+    lua_State *L = eng->L;
+    lua_rawgeti(L, LUA_REGISTRYINDEX, AM_TRACEBACK_FUNC);
+    lua_pushcclosure(L, run_job_in_engine, 0);
+    lua_pushlightuserdata(L, job);
+    int status = lua_pcall(L, 1, 0, -3);
+    if (status != 0) {
+        const char *msg = lua_tostring(L, -1);
+        finish_job(job, msg != NULL ? msg : "unknown error");
+        lua_pop(L, 1); // error
+    } else {
+        finish_job(job, NULL);
+    }
+    lua_pop(L, 1); // traceback func
+}
+
+// Worker pool
+
+static am_job *next_job() {
+    am_wait_semaphore(pool->pending);
+    am_lock_mutex(pool->mutex);
+    am_job *job = pool->head;
+    if (job != NULL) {
+        pool->head = job->next;
+        if (pool->head == NULL) pool->tail = NULL;
+        job->next = NULL;
+    }
+    am_unlock_mutex(pool->mutex);
+    return job;
+}
+
+static void worker_main(void *data) {
+    am_engine *eng = am_init_engine(true, 0, NULL);
+    am_job *job;
+    // a NULL job means the pool is being shut down
+    while ((job = next_job()) != NULL) {
+        if (am_atomic_load(&job->refs) == 1) {
+            // the future was garbage collected, so no one wants the result
+            finish_job(job, "cancelled");
+        } else {
+            execute_job(eng, job);
+        }
+        release_job(job);
+    }
+    if (eng != NULL) am_destroy_engine(eng);
+}
+
+static void init_pool() {
+    pool_initialized = true;
+    job_pool *p = new job_pool();
+    p->mutex = am_create_mutex();
+    p->pending = am_create_semaphore();
+    p->head = NULL;
+    p->tail = NULL;
+    pool = p;
+    int num_workers = am_max(1, am_cpu_count() - 1);
+    for (int i = 0; i < num_workers; i++) {
+        am_thread *thread = am_create_thread(worker_main, NULL);
+        if (thread == NULL) break;
+        p->threads.push_back(thread);
+    }
+    if (p->threads.size() == 0) {
+        am_destroy_semaphore(p->pending);
+        am_destroy_mutex(p->mutex);
+        delete p;
+        pool = NULL;
+    }
+}
+
+static void submit_job(am_job *job) {
+    if (!pool_initialized) init_pool();
+    if (pool == NULL) {
+        if (inline_engine == NULL) {
+            inline_engine = am_init_engine(true, 0, NULL);
+        }
+        execute_job(inline_engine, job);
+        return;
+    }
+    am_atomic_add(&job->refs, 1);
+    am_lock_mutex(pool->mutex);
+    if (pool->tail == NULL) {
+        pool->head = job;
+    } else {
+        pool->tail->next = job;
+    }
+    pool->tail = job;
+    am_unlock_mutex(pool->mutex);
+    am_signal_semaphore(pool->pending);
+}
+
+void am_destroy_jobs() {
+    if (pool != NULL) {
+        // cancel queued jobs and wait for running ones to finish
+        am_lock_mutex(pool->mutex);
+        am_job *job = pool->head;
+        pool->head = NULL;
+        pool->tail = NULL;
+        am_unlock_mutex(pool->mutex);
+        while (job != NULL) {
+            am_job *next = job->next;
+            finish_job(job, "cancelled");
+            release_job(job);
+            job = next;
+        }
+        for (unsigned int i = 0; i < pool->threads.size(); i++) {
+            am_signal_semaphore(pool->pending);
+        }
+        for (unsigned int i = 0; i < pool->threads.size(); i++) {
+            am_join_thread(pool->threads[i]);
+        }
+        am_destroy_semaphore(pool->pending);
+        am_destroy_mutex(pool->mutex);
+        delete pool;
+        pool = NULL;
+    }
+    if (inline_engine != NULL) {
+        am_destroy_engine(inline_engine);
+        inline_engine = NULL;
+    }
+    pool_initialized = false;
+}
+
+// Lua interface
+
+static int run_job(lua_State *L) {
+    int nargs = am_check_nargs(L, 1);
+    const char *name = luaL_checkstring(L, 1);
+    am_job_future *future = am_new_userdata(L, am_job_future);
+    future->job = new_job(name);
+    future->results_ref = LUA_NOREF;
+    future->num_results = 0;
+    // if this fails the job is freed when the future is collected
+    write_message(L, &future->job->args, 2, nargs);
+    submit_job(future->job);
+    return 1;
+}
+
+static int future_gc(lua_State *L) {
+    am_job_future *future = am_get_userdata(L, am_job_future, 1);
+    if (future->job != NULL) {
+        release_job(future->job);
+        future->job = NULL;
+    }
+    return 0;
+}
+
+static int push_results(lua_State *L, am_job_future *future) {
+    am_job *job = future->job;
+    switch (am_atomic_load(&job->state)) {
+        case JOB_PENDING:
+            return luaL_error(L, "job '%s' hasn't finished yet", job->name);
+        case JOB_ERROR:
+            return luaL_error(L, "job '%s' failed: %s", job->name, job->error);
+    }
+    if (future->results_ref == LUA_NOREF) {
+        // the results can only be read once, since buffers are moved
+        // into this state, so keep them in case they're asked for again.
+        int n = read_message(L, &job->results);
+        lua_createtable(L, n, 0);
+        lua_insert(L, -n - 1);
+        for (int i = n; i >= 1; i--) {
+            lua_rawseti(L, -i - 1, i);
+        }
+        future->results_ref = future->ref(L, -1);
+        future->num_results = n;
+        lua_pop(L, 1); // results table
+    }
+    luaL_checkstack(L, future->num_results, "too many job results");
+    future->pushref(L, future->results_ref);
+    for (int i = 1; i <= future->num_results; i++) {
+        lua_rawgeti(L, -i, i);
+    }
+    lua_remove(L, -future->num_results - 1); // results table
+    return future->num_results;
+}
+
+static int future_result(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_job_future *future = am_get_userdata(L, am_job_future, 1);
+    return push_results(L, future);
+}
+
+static int future_wait(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_job_future *future = am_get_userdata(L, am_job_future, 1);
+    am_job *job = future->job;
+    if (am_atomic_load(&job->state) == JOB_PENDING) {
+        am_wait_semaphore(job->done);
+    }
+    return push_results(L, future);
+}
+
+static void get_status(lua_State *L, void *obj) {
+    am_job_future *future = (am_job_future*)obj;
+    switch (am_atomic_load(&future->job->state)) {
+        case JOB_PENDING: lua_pushstring(L, "pending"); break;
+        case JOB_SUCCESS: lua_pushstring(L, "success"); break;
+        default: lua_pushstring(L, "error"); break;
+    }
+}
+
+static void get_error(lua_State *L, void *obj) {
+    am_job_future *future = (am_job_future*)obj;
+    if (am_atomic_load(&future->job->state) == JOB_ERROR) {
+        lua_pushstring(L, future->job->error);
+    } else {
+        lua_pushnil(L);
+    }
+}
+
+static am_property future_status_property = {get_status, NULL};
+static am_property future_error_property = {get_error, NULL};
+
+static void register_future_mt(lua_State *L) {
+    lua_newtable(L);
+    am_set_default_index_func(L);
+    am_set_default_newindex_func(L);
+
+    lua_pushcclosure(L, future_gc, 0);
+    lua_setfield(L, -2, "__gc");
+
+    lua_pushcclosure(L, future_result, 0);
+    lua_setfield(L, -2, "result");
+    lua_pushcclosure(L, future_wait, 0);
+    lua_setfield(L, -2, "wait");
+
+    am_register_property(L, "status", &future_status_property);
+    am_register_property(L, "error", &future_error_property);
+
+    am_register_metatable(L, "job", MT_am_job_future, 0);
+}
+
+void am_open_jobs_module(lua_State *L) {
+    lua_getglobal(L, AMULET_LUA_MODULE_NAME);
+    lua_newtable(L);
+    lua_pushcclosure(L, run_job, 0);
+    lua_setfield(L, -2, "run");
+    lua_setfield(L, -2, "jobs");
+    lua_pop(L, 1); // am table
+    register_future_mt(L);
+}
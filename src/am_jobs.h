@@ -0,0 +1,2 @@
+void am_open_jobs_module(lua_State *L);
+void am_destroy_jobs();
@@ -1,80 +1,503 @@
 #include "amulet.h"
 
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(AM_HTML)
+#define AM_JSON_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 /*------------------------ parsing ----------------------------*/
 
+/*
+ * One parser is shared by am.parse_json, am.parse_json_lazy and
+ * am.parse_json_events. It is parameterised by a handler type that
+ * receives the structure of the document as it is scanned:
+ *
+ *   table_builder builds Lua tables on the stack (am.parse_json),
+ *   tape_builder  records the position of every value so it can be
+ *                 materialized later (am.parse_json_lazy),
+ *   event_caller  calls Lua callbacks (am.parse_json_events).
+ *
+ * Handler methods return false to stop parsing, either after setting an
+ * error with parse_error or after setting state->stopped.
+ *
+ * The input is a pointer and a length rather than a NUL terminated
+ * string, so buffers can be parsed in place.
+ */
+
+// Objects and arrays may be nested this deep. The parser recurses once
+// per level.
+#define MAX_DEPTH 512
+
+// Escaped strings up to this length are unescaped on the C stack.
+#define SHORT_STRING_SIZE 256
+
 struct parse_state {
     const char *start;
     const char *ptr;
+    const char *end;
+    const char *err_pos;
+    const char *err_msg;
+    int depth;
+    bool stopped; // a handler asked to stop without an error
 };
 
-static void eat_whitespace(parse_state *state);
-static int parse_value(lua_State *L, parse_state *state);
-static int parse_string(lua_State *L, parse_state *state);
-static int parse_object(lua_State *L, parse_state *state);
-static int parse_array(lua_State *L, parse_state *state);
-static int parse_boolean(lua_State *L, parse_state *state);
-static int parse_null(lua_State *L, parse_state *state);
-static int parse_number(lua_State *L, parse_state *state);
-static int parse_word(lua_State *L, parse_state *state, const char *word, const char *err_msg);
-static int push_parse_error(lua_State *L, parse_state *state, const char *msg);
+static void init_parse_state(parse_state *state, const char *data, size_t len) {
+    state->start = data;
+    state->ptr = data;
+    state->end = data + len;
+    state->err_pos = NULL;
+    state->err_msg = NULL;
+    state->depth = 0;
+    state->stopped = false;
+}
+
+static bool parse_error(parse_state *state, const char *pos, const char *msg) {
+    state->err_pos = pos;
+    state->err_msg = msg;
+    return false;
+}
+
+static void push_parse_error(lua_State *L, parse_state *state) {
+    int line = 1;
+    const char *line_start = state->start;
+    const char *ptr = state->start;
+    while (ptr < state->err_pos) {
+        const char *nl = (const char*)memchr(ptr, '\n', state->err_pos - ptr);
+        if (nl == NULL) break;
+        line++;
+        ptr = nl + 1;
+        line_start = ptr;
+    }
+    int column = (int)(state->err_pos - line_start) + 1;
+    lua_pushfstring(L, "%d:%d: %s", line, column, state->err_msg);
+}
+
+static inline bool is_whitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static inline bool is_punct(char c) {
+    return c == ':' || c == '{' || c == '}' || c == '[' || c == ']' || c == ',';
+}
+
+static inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+static inline int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+#ifdef AM_JSON_SSE2
+static inline int lowest_set_bit(unsigned int mask) {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward(&i, mask);
+    return (int)i;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+// Whitespace and string contents make up most of a typical document, so
+// these two scans look at 16 bytes at a time where SSE2 is available.
+
+static inline const char *skip_whitespace(const char *ptr, const char *end) {
+    if (ptr < end && !is_whitespace(*ptr)) return ptr;
+#ifdef AM_JSON_SSE2
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i nl = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    while (end - ptr >= 16) {
+        __m128i c = _mm_loadu_si128((const __m128i*)ptr);
+        __m128i ws = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(c, space), _mm_cmpeq_epi8(c, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(c, nl), _mm_cmpeq_epi8(c, cr)));
+        unsigned int mask = ~(unsigned int)_mm_movemask_epi8(ws) & 0xFFFF;
+        if (mask != 0) return ptr + lowest_set_bit(mask);
+        ptr += 16;
+    }
+#endif
+    while (ptr < end && is_whitespace(*ptr)) ptr++;
+    return ptr;
+}
+
+// Returns a pointer to the first '"' or '\' at or after ptr, or end.
+static inline const char *find_quote_or_backslash(const char *ptr, const char *end) {
+#ifdef AM_JSON_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    while (end - ptr >= 16) {
+        __m128i c = _mm_loadu_si128((const __m128i*)ptr);
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(c, quote), _mm_cmpeq_epi8(c, backslash)));
+        if (mask != 0) return ptr + lowest_set_bit(mask);
+        ptr += 16;
+    }
+#endif
+    while (ptr < end && *ptr != '"' && *ptr != '\\') ptr++;
+    return ptr;
+}
 
 /*
- * Expects a string as its only argument.
- * Returns either the parsed value or nil and an error message.
+ * Checks the string starting at state->ptr (which must be a '"') and
+ * leaves state->ptr after the closing quote. *str and *len are set to the
+ * raw contents between the quotes and *escaped to whether they contain
+ * any escape sequences (in which case they need to go through
+ * unescape_string).
  */
-int am_parse_json(lua_State *L) {
-    am_check_nargs(L, 1);
-    const char *input = lua_tostring(L, 1);
-    if (input == NULL) {
-        return luaL_error(L, "Argument 1 must be a string");
+static bool scan_string(parse_state *state, const char **str, size_t *len, bool *escaped) {
+    assert(*state->ptr == '"');
+    const char *start = state->ptr + 1;
+    const char *end = state->end;
+    const char *ptr = start;
+    *escaped = false;
+    while (true) {
+        ptr = find_quote_or_backslash(ptr, end);
+        if (ptr == end) return parse_error(state, state->ptr, "unterminated string");
+        if (*ptr == '"') break;
+        *escaped = true;
+        if (end - ptr < 2) return parse_error(state, state->ptr, "unterminated string");
+        switch (ptr[1]) {
+            case 'n': case 'r': case 't': case 'b': case 'f':
+            case '\\': case '/': case '"': case '\'':
+                ptr += 2;
+                break;
+            case 'u':
+                if (end - ptr < 6 || hex_value(ptr[2]) < 0 || hex_value(ptr[3]) < 0
+                    || hex_value(ptr[4]) < 0 || hex_value(ptr[5]) < 0)
+                {
+                    return parse_error(state, ptr + 1, "invalid unicode escape sequence");
+                }
+                ptr += 6;
+                break;
+            default:
+                return parse_error(state, ptr + 1, "unrecognised escape sequence");
+        }
     }
-    int top = lua_gettop(L);
-    parse_state state;
-    state.start = input;
-    state.ptr = input;
-
-    int ok = parse_value(L, &state);
-    if (ok) {
-        eat_whitespace(&state);
-        if (*state.ptr == 0) {
-            return 1; // parsed value will be at top + 1.
+    *str = start;
+    *len = ptr - start;
+    state->ptr = ptr + 1;
+    return true;
+}
+
+static unsigned int read_hex4(const char *ptr) {
+    return (hex_value(ptr[0]) << 12) | (hex_value(ptr[1]) << 8)
+        | (hex_value(ptr[2]) << 4) | hex_value(ptr[3]);
+}
+
+/*
+ * Decodes the escape sequence at *src (which has already been checked by
+ * scan_string) into out, advancing *src past it. Returns the number of
+ * bytes written, which is never more than the length of the sequence.
+ * \u escapes are converted to UTF-8, combining surrogate pairs.
+ */
+static int decode_escape(const char **src, const char *end, char *out) {
+    const char *ptr = *src;
+    assert(*ptr == '\\');
+    *src = ptr + 2;
+    switch (ptr[1]) {
+        case 'n': *out = '\n'; return 1;
+        case 'r': *out = '\r'; return 1;
+        case 't': *out = '\t'; return 1;
+        case 'b': *out = '\b'; return 1;
+        case 'f': *out = '\f'; return 1;
+        case 'u': break;
+        default: *out = ptr[1]; return 1;
+    }
+    unsigned int cp = read_hex4(ptr + 2);
+    *src = ptr + 6;
+    if (cp >= 0xD800 && cp <= 0xDBFF && end - *src >= 6 && (*src)[0] == '\\' && (*src)[1] == 'u') {
+        unsigned int lo = read_hex4(*src + 2);
+        if (lo >= 0xDC00 && lo <= 0xDFFF) {
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+            *src += 6;
+        }
+    }
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
+    } else if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    } else if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    } else {
+        out[0] = (char)(0xF0 | (cp >> 18));
+        out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (cp & 0x3F));
+        return 4;
+    }
+}
+
+// Pushes the raw string contents returned by scan_string.
+static void push_string(lua_State *L, const char *str, size_t len, bool escaped) {
+    if (!escaped) {
+        lua_pushlstring(L, str, len);
+        return;
+    }
+    const char *end = str + len;
+    if (len <= SHORT_STRING_SIZE) {
+        char tmp[SHORT_STRING_SIZE];
+        char *out = tmp;
+        while (str < end) {
+            const char *bs = (const char*)memchr(str, '\\', end - str);
+            if (bs == NULL) bs = end;
+            memcpy(out, str, bs - str);
+            out += bs - str;
+            str = bs;
+            if (str < end) out += decode_escape(&str, end, out);
+        }
+        lua_pushlstring(L, tmp, out - tmp);
+    } else {
+        luaL_Buffer b;
+        luaL_buffinit(L, &b);
+        char seq[4];
+        while (str < end) {
+            const char *bs = (const char*)memchr(str, '\\', end - str);
+            if (bs == NULL) bs = end;
+            luaL_addlstring(&b, str, bs - str);
+            str = bs;
+            if (str < end) luaL_addlstring(&b, seq, decode_escape(&str, end, seq));
+        }
+        luaL_pushresult(&b);
+    }
+}
+
+static const double exact_powers_of_10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/*
+ * Parses the number at state->ptr. Numbers with at most 15 significant
+ * digits and a small exponent (which covers almost everything written
+ * by am.to_json) are computed exactly from the digits with a single
+ * multiply or divide. Anything else goes through strtod.
+ */
+static bool parse_number(parse_state *state, double *result) {
+    const char *start = state->ptr;
+    const char *end = state->end;
+    const char *ptr = start;
+    bool negative = false;
+    if (*ptr == '-') {
+        negative = true;
+        ptr++;
+    }
+    if (ptr == end || !is_digit(*ptr)) return parse_error(state, start, "invalid number");
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    if (*ptr == '0') {
+        ptr++;
+    } else {
+        while (ptr < end && is_digit(*ptr)) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (*ptr - '0');
+                digits++;
+            } else {
+                exponent++;
+                digits++;
+            }
+            ptr++;
+        }
+    }
+    if (ptr < end && *ptr == '.') {
+        ptr++;
+        if (ptr == end || !is_digit(*ptr)) return parse_error(state, start, "invalid number");
+        while (ptr < end && is_digit(*ptr)) {
+            if (mantissa == 0 && *ptr == '0') {
+                exponent--;
+            } else if (digits < 19) {
+                mantissa = mantissa * 10 + (*ptr - '0');
+                digits++;
+                exponent--;
+            } else {
+                digits++;
+            }
+            ptr++;
+        }
+    }
+    if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+        ptr++;
+        bool exp_negative = false;
+        if (ptr < end && (*ptr == '+' || *ptr == '-')) {
+            exp_negative = *ptr == '-';
+            ptr++;
+        }
+        if (ptr == end || !is_digit(*ptr)) return parse_error(state, start, "invalid number");
+        int e = 0;
+        while (ptr < end && is_digit(*ptr)) {
+            if (e < 100000) e = e * 10 + (*ptr - '0');
+            ptr++;
+        }
+        exponent += exp_negative ? -e : e;
+    }
+    if (ptr < end && !is_whitespace(*ptr) && !is_punct(*ptr)) {
+        return parse_error(state, start, "invalid number");
+    }
+    state->ptr = ptr;
+    if (digits <= 15 && exponent >= -22 && exponent <= 22) {
+        // both the mantissa and the power of 10 are exact doubles, so
+        // this is correctly rounded.
+        double n = (double)mantissa;
+        if (exponent < 0) {
+            n = n / exact_powers_of_10[-exponent];
         } else {
-            lua_pop(L, 1); // pop value
-            lua_pushnil(L);
-            push_parse_error(L, &state, "unexpected trailing characters");
-            return 2;
+            n = n * exact_powers_of_10[exponent];
         }
+        *result = negative ? -n : n;
+        return true;
+    }
+    // strtod needs a NUL terminated copy.
+    char tmp[64];
+    size_t len = ptr - start;
+    char *buf = len < sizeof(tmp) ? tmp : (char*)malloc(len + 1);
+    memcpy(buf, start, len);
+    buf[len] = 0;
+    *result = strtod(buf, NULL);
+    if (buf != tmp) free(buf);
+    return true;
+}
+
+static void push_number(lua_State *L, double n) {
+    if (n >= INT_MIN && n <= INT_MAX && (double)((int)n) == n) {
+        // in case we're using different representation for
+        // integers in the lua vm
+        lua_pushinteger(L, (int)n);
     } else {
-        // Error message will be on top of stack.
-        // Insert nil before err msg.
-        lua_pushnil(L);
-        lua_insert(L, top + 1);
-        return 2;
+        lua_pushnumber(L, n);
     }
 }
 
-static int is_whitespace(const char c) {
-    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+static bool parse_word(parse_state *state, const char *word, size_t len, const char *err_msg) {
+    const char *ptr = state->ptr;
+    if ((size_t)(state->end - ptr) < len || memcmp(ptr, word, len) != 0) {
+        return parse_error(state, ptr, err_msg);
+    }
+    ptr += len;
+    if (ptr < state->end && !is_whitespace(*ptr) && !is_punct(*ptr)) {
+        return parse_error(state, state->ptr, err_msg);
+    }
+    state->ptr = ptr;
+    return true;
 }
 
-static int is_punct(const char c) {
-    return c == ':' || c == '{' || c == '}' || c == '[' || c == ']' || c == ',';
+template <class H> static bool parse_value(parse_state *state, H *h);
+
+template <class H>
+static bool parse_object(parse_state *state, H *h) {
+    const char *open = state->ptr;
+    assert(*open == '{');
+    if (++state->depth > MAX_DEPTH) return parse_error(state, open, "too deeply nested");
+    if (!h->begin_object(state, open)) return false;
+    const char *end = state->end;
+    state->ptr = skip_whitespace(state->ptr + 1, end);
+    if (state->ptr < end && *state->ptr == '}') {
+        // empty object
+        state->ptr++;
+        state->depth--;
+        return h->end_object(state);
+    }
+    while (true) {
+        if (state->ptr == end) return parse_error(state, open, "unterminated object");
+        if (*state->ptr != '"') return parse_error(state, state->ptr, "string expected");
+        const char *key_pos = state->ptr;
+        const char *key;
+        size_t key_len;
+        bool escaped;
+        if (!scan_string(state, &key, &key_len, &escaped)) return false;
+        if (!h->key(state, key_pos, key, key_len, escaped)) return false;
+        state->ptr = skip_whitespace(state->ptr, end);
+        if (state->ptr == end || *state->ptr != ':') {
+            return parse_error(state, state->ptr, "colon expected");
+        }
+        state->ptr = skip_whitespace(state->ptr + 1, end);
+        if (!parse_value(state, h)) return false;
+        if (!h->member(state)) return false;
+        state->ptr = skip_whitespace(state->ptr, end);
+        if (state->ptr < end && *state->ptr == ',') {
+            state->ptr = skip_whitespace(state->ptr + 1, end);
+        } else {
+            break;
+        }
+    }
+    if (state->ptr == end) return parse_error(state, open, "unterminated object");
+    if (*state->ptr != '}') return parse_error(state, state->ptr, "unexpected character");
+    state->ptr++;
+    state->depth--;
+    return h->end_object(state);
 }
 
-static void eat_whitespace(parse_state *state) {
-    while (is_whitespace(*state->ptr)) state->ptr++;
+template <class H>
+static bool parse_array(parse_state *state, H *h) {
+    const char *open = state->ptr;
+    assert(*open == '[');
+    if (++state->depth > MAX_DEPTH) return parse_error(state, open, "too deeply nested");
+    if (!h->begin_array(state, open)) return false;
+    const char *end = state->end;
+    state->ptr = skip_whitespace(state->ptr + 1, end);
+    if (state->ptr < end && *state->ptr == ']') {
+        // empty array
+        state->ptr++;
+        state->depth--;
+        return h->end_array(state);
+    }
+    int i = 1;
+    while (true) {
+        if (!parse_value(state, h)) return false;
+        if (!h->element(state, i)) return false;
+        i++;
+        state->ptr = skip_whitespace(state->ptr, end);
+        if (state->ptr < end && *state->ptr == ',') {
+            state->ptr = skip_whitespace(state->ptr + 1, end);
+        } else {
+            break;
+        }
+    }
+    if (state->ptr == end) return parse_error(state, open, "unterminated array");
+    if (*state->ptr != ']') return parse_error(state, state->ptr, "unexpected character");
+    state->ptr++;
+    state->depth--;
+    return h->end_array(state);
 }
 
-static int parse_value(lua_State *L, parse_state *state) {
-    eat_whitespace(state);
-    char c = *state->ptr;
-    switch (c) {
-        case '"': return parse_string(L, state);
-        case '{': return parse_object(L, state);
-        case '[': return parse_array(L, state);
+template <class H>
+static bool parse_value(parse_state *state, H *h) {
+    const char *pos = state->ptr;
+    if (pos == state->end) return parse_error(state, pos, "unexpected end of input");
+    switch (*pos) {
+        case '"': {
+            const char *str;
+            size_t len;
+            bool escaped;
+            if (!scan_string(state, &str, &len, &escaped)) return false;
+            return h->string(state, pos, str, len, escaped);
+        }
+        case '{': return parse_object(state, h);
+        case '[': return parse_array(state, h);
         case 't':
-        case 'f': return parse_boolean(L, state);
-        case 'n': return parse_null(L, state);
+            if (!parse_word(state, "true", 4, "expected 'true'")) return false;
+            return h->boolean(state, pos, true);
+        case 'f':
+            if (!parse_word(state, "false", 5, "expected 'false'")) return false;
+            return h->boolean(state, pos, false);
+        case 'n':
+            if (!parse_word(state, "null", 4, "expected 'null'")) return false;
+            return h->null(state, pos);
         case '-':
         case '0':
         case '1':
@@ -85,225 +508,604 @@ static int parse_value(lua_State *L, parse_state *state) {
         case '6':
         case '7':
         case '8':
-        case '9': return parse_number(L, state);
-        default:  return push_parse_error(L, state, "unexpected character");
+        case '9': {
+            double n;
+            if (!parse_number(state, &n)) return false;
+            return h->number(state, pos, n);
+        }
+        default:
+            return parse_error(state, pos, "unexpected character");
     }
 }
 
-static int parse_string(lua_State *L, parse_state *state) {
-    const char *ptr = state->ptr;
-    assert(*ptr == '"');
-    ptr++;
-    if (*ptr == '"') {
-        lua_pushstring(L, "");
-        state->ptr = ptr + 1;
-        return 1;
-    }
-    const char *start = ptr;
-    while (*ptr != 0 && !(*ptr != '\\' && *(ptr + 1) == '"')) ptr++;
-    if (*ptr == 0) return push_parse_error(L, state, "unterminated string");
-    int len = ptr - start + 1;
-    char *tmp = (char*)malloc(len);
-    char *tptr = tmp;
-    ptr = start;
-    while (*ptr != '"') {
-        if (*ptr == '\\') {
-            ptr++;
-            switch (*ptr) {
-                case 'n': *tptr = '\n'; break;
-                case 'r': *tptr = '\r'; break;
-                case 't': *tptr = '\t'; break;
-                case 'b': *tptr = '\b'; break;
-                case 'f': *tptr = '\f'; break;
-                case '\\': *tptr = '\\'; break;
-                case '/': *tptr = '/'; break;
-                case '"': *tptr = '"'; break;
-                case '\'': *tptr = '\''; break;
-                default:
-                    // XXX handle unicode escape sequences
-                    free(tmp);
-                    state->ptr = ptr;
-                    return push_parse_error(L, state, "unrecognised escape sequence");
-            }
-        } else {
-            *tptr = *ptr;
-        }
-        tptr++;
-        ptr++;
+// Parses a complete document, which may only be followed by whitespace.
+template <class H>
+static bool parse_document(parse_state *state, H *h) {
+    state->ptr = skip_whitespace(state->ptr, state->end);
+    if (!parse_value(state, h)) return false;
+    state->ptr = skip_whitespace(state->ptr, state->end);
+    if (state->ptr != state->end) {
+        return parse_error(state, state->ptr, "unexpected trailing characters");
     }
-    state->ptr = ptr + 1;
-    lua_pushlstring(L, tmp, (tptr - tmp));
-    free(tmp);
-    return 1;
+    return true;
 }
 
-static int parse_boolean(lua_State *L, parse_state *state) {
-    const char *ptr = state->ptr;
-    switch (*ptr) {
-        case 't':
-            if (parse_word(L, state, "true", "expected 'true'")) {
-                lua_pushboolean(L, 1);
-                return 1;
-            } else {
-                return 0;
-            }
-        case 'f': 
-            if (parse_word(L, state, "false", "expected 'false'")) {
-                lua_pushboolean(L, 0);
-                return 1;
-            } else {
-                return 0;
-            }
-        default:
-            assert(0);
-            return 0;
+// Accepts either a string or a buffer.
+static const char *check_json_source(lua_State *L, int idx, size_t *len) {
+    int type = am_get_type(L, idx);
+    if (type == MT_am_buffer || type == MT_am_buffer_gc) {
+        am_buffer *buf = am_check_buffer(L, idx);
+        *len = buf->size;
+        return (const char*)buf->data;
+    }
+    const char *str = lua_tolstring(L, idx, len);
+    if (str == NULL) {
+        luaL_error(L, "argument %d must be a string or buffer", idx);
     }
+    return str;
 }
 
-static int parse_null(lua_State *L, parse_state *state) {
-    if (parse_word(L, state, "null", "expected 'null'")) {
+/*------------------------ eager parsing ----------------------------*/
+
+struct table_builder {
+    lua_State *L;
+
+    bool begin_object(parse_state *state, const char *pos) {
+        luaL_checkstack(L, 3, "json too deeply nested");
+        lua_newtable(L);
+        return true;
+    }
+    bool key(parse_state *state, const char *pos, const char *str, size_t len, bool escaped) {
+        push_string(L, str, len, escaped);
+        return true;
+    }
+    bool member(parse_state *state) {
+        lua_rawset(L, -3);
+        return true;
+    }
+    bool end_object(parse_state *state) {
+        return true;
+    }
+    bool begin_array(parse_state *state, const char *pos) {
+        luaL_checkstack(L, 3, "json too deeply nested");
+        lua_newtable(L);
+        return true;
+    }
+    bool element(parse_state *state, int i) {
+        lua_rawseti(L, -2, i);
+        return true;
+    }
+    bool end_array(parse_state *state) {
+        return true;
+    }
+    bool string(parse_state *state, const char *pos, const char *str, size_t len, bool escaped) {
+        push_string(L, str, len, escaped);
+        return true;
+    }
+    bool number(parse_state *state, const char *pos, double n) {
+        push_number(L, n);
+        return true;
+    }
+    bool boolean(parse_state *state, const char *pos, bool b) {
+        lua_pushboolean(L, b ? 1 : 0);
+        return true;
+    }
+    bool null(parse_state *state, const char *pos) {
         lua_pushnil(L);
-        return 1;
+        return true;
+    }
+};
+
+int am_parse_json_data(lua_State *L, const char *data, size_t len) {
+    int top = lua_gettop(L);
+    parse_state state;
+    init_parse_state(&state, data, len);
+    table_builder builder;
+    builder.L = L;
+    if (parse_document(&state, &builder)) {
+        return 1; // parsed value will be at top + 1.
     } else {
-        return 0; // parse_word() pushed the error msg
+        lua_settop(L, top);
+        lua_pushnil(L);
+        push_parse_error(L, &state);
+        return 2;
     }
 }
 
-static int parse_number(lua_State *L, parse_state *state) {
-    char *end;
-    double n = strtod(state->ptr, &end);
-    if (state->ptr == end || (*end != 0 && !is_whitespace(*end) && !is_punct(*end))) {
-        return push_parse_error(L, state, "invalid number");
-    } else {
-        state->ptr = end;
-        if ((double)((int)n) == n) {
-            // in case we're using different representation for
-            // integers in the lua vm
-            lua_pushinteger(L, (int)n);
-        } else {
-            lua_pushnumber(L, n);
+/*
+ * Expects a string or buffer as its only argument.
+ * Returns either the parsed value or nil and an error message.
+ */
+int am_parse_json(lua_State *L) {
+    am_check_nargs(L, 1);
+    size_t len;
+    const char *data = check_json_source(L, 1, &len);
+    return am_parse_json_data(L, data, len);
+}
+
+/*------------------------ lazy parsing ----------------------------*/
+
+/*
+ * am.parse_json_lazy checks the whole document up front but only records
+ * where each value starts (a "tape" of json_nodes in document order,
+ * with object keys getting their own nodes). Objects and arrays are
+ * returned as am_json_value proxies that convert one level at a time
+ * when they are first indexed. The source string or buffer is kept alive
+ * by the document and is not copied.
+ */
+
+struct json_node {
+    uint32_t offset; // of the value (or key) in the source
+    uint32_t next;   // index of the node following this value and its contents
+};
+
+struct tape_builder {
+    const char *start;
+    json_node *nodes;
+    size_t num_nodes;
+    size_t capacity;
+    uint32_t open[MAX_DEPTH + 1];
+    int depth;
+
+    uint32_t add(const char *pos) {
+        if (num_nodes == capacity) {
+            capacity = capacity == 0 ? 1024 : capacity * 2;
+            nodes = (json_node*)realloc(nodes, capacity * sizeof(json_node));
         }
-        return 1;
+        uint32_t n = (uint32_t)num_nodes++;
+        nodes[n].offset = (uint32_t)(pos - start);
+        nodes[n].next = n + 1;
+        return n;
+    }
+    bool begin_container(const char *pos) {
+        open[depth++] = add(pos);
+        return true;
+    }
+    bool end_container() {
+        nodes[open[--depth]].next = (uint32_t)num_nodes;
+        return true;
     }
-}
 
-static int parse_object(lua_State *L, parse_state *state) {
-    assert(*state->ptr == '{');
-    state->ptr++;
-    eat_whitespace(state);
-    lua_newtable(L);
-    if (*state->ptr == '}') {
-        // empty object
-        state->ptr++;
-        return 1;
+    bool begin_object(parse_state *state, const char *pos) { return begin_container(pos); }
+    bool key(parse_state *state, const char *pos, const char *str, size_t len, bool escaped) {
+        add(pos);
+        return true;
+    }
+    bool member(parse_state *state) { return true; }
+    bool end_object(parse_state *state) { return end_container(); }
+    bool begin_array(parse_state *state, const char *pos) { return begin_container(pos); }
+    bool element(parse_state *state, int i) { return true; }
+    bool end_array(parse_state *state) { return end_container(); }
+    bool string(parse_state *state, const char *pos, const char *str, size_t len, bool escaped) {
+        add(pos);
+        return true;
+    }
+    bool number(parse_state *state, const char *pos, double n) {
+        add(pos);
+        return true;
+    }
+    bool boolean(parse_state *state, const char *pos, bool b) {
+        add(pos);
+        return true;
+    }
+    bool null(parse_state *state, const char *pos) {
+        add(pos);
+        return true;
+    }
+};
+
+struct am_json_doc : am_nonatomic_userdata {
+    const char *str;   // the source if it's a string
+    am_buffer *buffer; // the source if it's a buffer
+    size_t size;
+    json_node *nodes;
+    int source_ref;
+};
+
+struct am_json_value : am_nonatomic_userdata {
+    am_json_doc *doc;
+    int doc_ref;
+    uint32_t node;
+    bool is_object;
+    int count;          // elements or members, -1 until first indexed
+    uint32_t *children; // node of each element, or of each member's key
+    int cache_ref;      // table of converted elements or members
+};
+
+static const char *doc_data(lua_State *L, am_json_doc *doc) {
+    if (doc->buffer != NULL) {
+        return (const char*)am_check_buffer_data(L, doc->buffer);
     }
-    while (1) {
-        // key
-        if (!parse_string(L, state)) {
-            lua_remove(L, -2); // remove table
-            return 0;
+    return doc->str;
+}
+
+// Pushes the value at the given node. Objects and arrays are pushed as
+// new proxies. The document must be at doc_idx.
+static void push_node(lua_State *L, am_json_doc *doc, int doc_idx, const char *data, uint32_t node) {
+    parse_state state;
+    init_parse_state(&state, data, doc->size);
+    state.ptr = data + doc->nodes[node].offset;
+    switch (*state.ptr) {
+        case '{':
+        case '[': {
+            am_json_value *val = am_new_userdata(L, am_json_value);
+            val->doc = doc;
+            val->doc_ref = val->ref(L, doc_idx);
+            val->node = node;
+            val->is_object = *state.ptr == '{';
+            val->count = -1;
+            val->children = NULL;
+            val->cache_ref = LUA_NOREF;
+            break;
         }
-        eat_whitespace(state);
-        if (*state->ptr != ':') {
-            lua_pop(L, 2); // pop table and key
-            return push_parse_error(L, state, "colon expected");
+        case '"': {
+            const char *str;
+            size_t len;
+            bool escaped;
+            scan_string(&state, &str, &len, &escaped);
+            push_string(L, str, len, escaped);
+            break;
         }
-        state->ptr++;
-        // value
-        eat_whitespace(state);
-        if (!parse_value(L, state)) {
-            lua_remove(L, -2); // remove key
-            lua_remove(L, -2); // remove table
-            return 0;
+        case 't': lua_pushboolean(L, 1); break;
+        case 'f': lua_pushboolean(L, 0); break;
+        case 'n': lua_pushnil(L); break;
+        default: {
+            double n = 0.0;
+            parse_number(&state, &n);
+            push_number(L, n);
         }
-        lua_rawset(L, -3);
-        eat_whitespace(state);
-        if (*state->ptr == ',') {
-            state->ptr++;
-            eat_whitespace(state);
-        } else {
-            break;
+    }
+}
+
+// Finds the children of the value the first time it's indexed. The
+// members of an object are all converted at this point, because they
+// have to be put in a table to be looked up by key anyway. Elements of
+// arrays are converted as they are accessed.
+static void init_children(lua_State *L, am_json_value *val) {
+    if (val->count >= 0) return;
+    json_node *nodes = val->doc->nodes;
+    uint32_t end = nodes[val->node].next;
+    int count = 0;
+    uint32_t i = val->node + 1;
+    while (i < end) {
+        count++;
+        i = val->is_object ? nodes[i + 1].next : nodes[i].next;
+    }
+    val->children = (uint32_t*)malloc(sizeof(uint32_t) * (count > 0 ? count : 1));
+    int c = 0;
+    i = val->node + 1;
+    while (i < end) {
+        val->children[c++] = i;
+        i = val->is_object ? nodes[i + 1].next : nodes[i].next;
+    }
+    val->count = count;
+
+    lua_createtable(L, 0, val->is_object ? count : 0);
+    if (val->is_object) {
+        int cache_idx = lua_gettop(L);
+        val->pushref(L, val->doc_ref);
+        int doc_idx = lua_gettop(L);
+        const char *data = doc_data(L, val->doc);
+        for (c = 0; c < count; c++) {
+            uint32_t key = val->children[c];
+            push_node(L, val->doc, doc_idx, data, key);
+            push_node(L, val->doc, doc_idx, data, key + 1);
+            lua_rawset(L, cache_idx);
         }
+        lua_pop(L, 1); // doc
     }
-    if (*state->ptr == 0) {
-        lua_pop(L, 1); // pop table.
-        return push_parse_error(L, state, "unterminated object");
+    val->cache_ref = val->ref(L, -1);
+    lua_pop(L, 1); // cache
+}
+
+// Pushes element i (1 based) of an array proxy.
+static void push_element(lua_State *L, am_json_value *val, int i) {
+    val->pushref(L, val->cache_ref);
+    lua_rawgeti(L, -1, i);
+    if (!lua_isnil(L, -1)) {
+        lua_remove(L, -2); // cache
+        return;
     }
-    if (*state->ptr != '}') {
-        lua_pop(L, 1); // pop table
-        return push_parse_error(L, state, "unexpected character");
+    lua_pop(L, 1); // nil
+    val->pushref(L, val->doc_ref);
+    push_node(L, val->doc, lua_gettop(L), doc_data(L, val->doc), val->children[i - 1]);
+    lua_remove(L, -2); // doc
+    if (lua_type(L, -1) == LUA_TUSERDATA) {
+        // keep the same proxy for later lookups
+        lua_pushvalue(L, -1);
+        lua_rawseti(L, -3, i);
     }
-    state->ptr++;
-    return 1;
+    lua_remove(L, -2); // cache
 }
 
-static int parse_array(lua_State *L, parse_state *state) {
-    assert(*state->ptr == '[');
-    state->ptr++;
-    eat_whitespace(state);
-    lua_newtable(L);
-    if (*state->ptr == ']') {
-        // empty array
-        state->ptr++;
+static int json_value_index(lua_State *L) {
+    am_json_value *val = am_get_userdata(L, am_json_value, 1);
+    init_children(L, val);
+    if (val->is_object) {
+        val->pushref(L, val->cache_ref);
+        lua_pushvalue(L, 2);
+        lua_rawget(L, -2);
         return 1;
     }
-    int i = 1;
-    while (1) {
-        if (!parse_value(L, state)) {
-            lua_remove(L, -2); // remove table
-            return 0;
-        }
-        lua_rawseti(L, -2, i);
-        i++;
-        eat_whitespace(state);
-        if (*state->ptr == ',') {
-            state->ptr++;
-            eat_whitespace(state);
+    if (lua_type(L, 2) != LUA_TNUMBER) {
+        lua_pushnil(L);
+        return 1;
+    }
+    double d = lua_tonumber(L, 2);
+    int i = (int)d;
+    if ((double)i != d || i < 1 || i > val->count) {
+        lua_pushnil(L);
+        return 1;
+    }
+    push_element(L, val, i);
+    return 1;
+}
+
+static int json_value_newindex(lua_State *L) {
+    return luaL_error(L, "lazy json values are read only (use am.json_materialize to get a table)");
+}
+
+static int json_value_len(lua_State *L) {
+    am_json_value *val = am_get_userdata(L, am_json_value, 1);
+    init_children(L, val);
+    lua_pushinteger(L, val->count);
+    return 1;
+}
+
+static int json_value_gc(lua_State *L) {
+    am_json_value *val = (am_json_value*)lua_touserdata(L, 1);
+    free(val->children);
+    val->children = NULL;
+    return 0;
+}
+
+static int json_doc_gc(lua_State *L) {
+    am_json_doc *doc = (am_json_doc*)lua_touserdata(L, 1);
+    free(doc->nodes);
+    doc->nodes = NULL;
+    return 0;
+}
+
+// Iterator returned by am.json_pairs for proxies. Upvalue 1 is the proxy
+// and upvalue 2 the position of the last element or member returned.
+// Null values are skipped, as they are absent from parsed tables.
+static int json_value_next(lua_State *L) {
+    am_json_value *val = am_get_userdata(L, am_json_value, lua_upvalueindex(1));
+    int pos = lua_tointeger(L, lua_upvalueindex(2));
+    while (pos < val->count) {
+        pos++;
+        if (val->is_object) {
+            val->pushref(L, val->doc_ref);
+            push_node(L, val->doc, lua_gettop(L), doc_data(L, val->doc), val->children[pos - 1]);
+            lua_remove(L, -2); // doc
+            val->pushref(L, val->cache_ref);
+            lua_pushvalue(L, -2);
+            lua_rawget(L, -2);
+            lua_remove(L, -2); // cache
         } else {
-            break;
+            lua_pushinteger(L, pos);
+            push_element(L, val, pos);
         }
+        if (!lua_isnil(L, -1)) {
+            lua_pushinteger(L, pos);
+            lua_replace(L, lua_upvalueindex(2));
+            return 2;
+        }
+        lua_pop(L, 2);
     }
-    if (*state->ptr == 0) {
-        lua_pop(L, 1); // pop table.
-        return push_parse_error(L, state, "unterminated array");
-    }
-    if (*state->ptr != ']') {
-        lua_pop(L, 1); // pop table
-        return push_parse_error(L, state, "unexpected character");
+    lua_pushinteger(L, pos);
+    lua_replace(L, lua_upvalueindex(2));
+    lua_pushnil(L);
+    return 1;
+}
+
+static int table_next(lua_State *L) {
+    luaL_checktype(L, 1, LUA_TTABLE);
+    lua_settop(L, 2);
+    if (lua_next(L, 1)) {
+        return 2;
     }
-    state->ptr++;
+    lua_pushnil(L);
     return 1;
 }
 
-static int parse_word(lua_State *L, parse_state *state, const char *word, const char *err_msg) {
-    const char *ptr = state->ptr;
-    while (*ptr == *word && *ptr != 0 && *word != 0) {
-        ptr++;
-        word++;
+/*
+ * Like pairs, but also works with lazy json values (in document order).
+ */
+static int json_pairs(lua_State *L) {
+    am_check_nargs(L, 1);
+    if (am_get_type(L, 1) == MT_am_json_value) {
+        am_json_value *val = am_get_userdata(L, am_json_value, 1);
+        init_children(L, val);
+        lua_pushvalue(L, 1);
+        lua_pushinteger(L, 0);
+        lua_pushcclosure(L, json_value_next, 2);
+        return 1;
     }
-    if (*word == 0 && (is_whitespace(*ptr) || is_punct(*ptr) || *ptr == 0)) {
-        state->ptr = ptr;
+    luaL_checktype(L, 1, LUA_TTABLE);
+    lua_pushcclosure(L, table_next, 0);
+    lua_pushvalue(L, 1);
+    lua_pushnil(L);
+    return 3;
+}
+
+/*
+ * Converts a lazy json value (and everything inside it) to tables.
+ * Other values are returned unchanged.
+ */
+static int json_materialize(lua_State *L) {
+    am_check_nargs(L, 1);
+    lua_settop(L, 1);
+    if (am_get_type(L, 1) != MT_am_json_value) {
         return 1;
-    } else {
-        return push_parse_error(L, state, err_msg);
     }
+    am_json_value *val = am_get_userdata(L, am_json_value, 1);
+    const char *data = doc_data(L, val->doc);
+    parse_state state;
+    init_parse_state(&state, data, val->doc->size);
+    state.ptr = data + val->doc->nodes[val->node].offset;
+    table_builder builder;
+    builder.L = L;
+    // the document was checked by parse_json_lazy
+    parse_value(&state, &builder);
+    return 1;
 }
 
-static int push_parse_error(lua_State *L, parse_state *state, const char *msg) {
-    int line = 1;
-    int column = 1;
-    const char *ptr = state->start;
-    while (ptr < state->ptr) {
-        if (*ptr == '\n') {
-            line++;
-            column = 1;
+static int parse_json_lazy(lua_State *L) {
+    am_check_nargs(L, 1);
+    size_t len;
+    const char *data = check_json_source(L, 1, &len);
+    if (len > 0xFFFFFFFFu) {
+        return luaL_error(L, "json too large for lazy parsing");
+    }
+    parse_state state;
+    init_parse_state(&state, data, len);
+    tape_builder tape;
+    tape.start = data;
+    tape.nodes = NULL;
+    tape.num_nodes = 0;
+    tape.capacity = 0;
+    tape.depth = 0;
+    if (!parse_document(&state, &tape)) {
+        free(tape.nodes);
+        lua_pushnil(L);
+        push_parse_error(L, &state);
+        return 2;
+    }
+    am_json_doc *doc = am_new_userdata(L, am_json_doc);
+    int doc_idx = lua_gettop(L);
+    doc->str = lua_isstring(L, 1) ? data : NULL;
+    doc->buffer = doc->str == NULL ? am_get_userdata(L, am_buffer, 1) : NULL;
+    doc->size = len;
+    doc->nodes = (json_node*)realloc(tape.nodes, tape.num_nodes * sizeof(json_node));
+    doc->source_ref = doc->ref(L, 1);
+    push_node(L, doc, doc_idx, data, 0);
+    return 1;
+}
+
+/*------------------------ event parsing ----------------------------*/
+
+enum json_event {
+    EVENT_BEGIN_OBJECT,
+    EVENT_END_OBJECT,
+    EVENT_BEGIN_ARRAY,
+    EVENT_END_ARRAY,
+    EVENT_KEY,
+    EVENT_VALUE,
+    NUM_EVENTS,
+};
+
+static const char *event_names[NUM_EVENTS] = {
+    "begin_object",
+    "end_object",
+    "begin_array",
+    "end_array",
+    "key",
+    "value",
+};
+
+struct event_caller {
+    lua_State *L;
+    int callback[NUM_EVENTS]; // stack index of each callback, or 0
+    am_buffer *buffer;        // the source if it's a buffer
+    uint8_t *data;
+
+    // Calls the callback below the top nargs values. A callback can
+    // return false to stop parsing.
+    bool call(parse_state *state, int nargs) {
+        lua_call(L, nargs, 1);
+        bool stop = lua_type(L, -1) == LUA_TBOOLEAN && !lua_toboolean(L, -1);
+        lua_pop(L, 1);
+        if (buffer != NULL && buffer->data != data) {
+            luaL_error(L, "buffer freed while parsing json");
+        }
+        if (stop) {
+            state->stopped = true;
+            return false;
+        }
+        return true;
+    }
+    bool event(parse_state *state, json_event e) {
+        if (callback[e] == 0) return true;
+        lua_pushvalue(L, callback[e]);
+        return call(state, 0);
+    }
+
+    bool begin_object(parse_state *state, const char *pos) { return event(state, EVENT_BEGIN_OBJECT); }
+    bool key(parse_state *state, const char *pos, const char *str, size_t len, bool escaped) {
+        if (callback[EVENT_KEY] == 0) return true;
+        lua_pushvalue(L, callback[EVENT_KEY]);
+        push_string(L, str, len, escaped);
+        return call(state, 1);
+    }
+    bool member(parse_state *state) { return true; }
+    bool end_object(parse_state *state) { return event(state, EVENT_END_OBJECT); }
+    bool begin_array(parse_state *state, const char *pos) { return event(state, EVENT_BEGIN_ARRAY); }
+    bool element(parse_state *state, int i) { return true; }
+    bool end_array(parse_state *state) { return event(state, EVENT_END_ARRAY); }
+    bool string(parse_state *state, const char *pos, const char *str, size_t len, bool escaped) {
+        if (callback[EVENT_VALUE] == 0) return true;
+        lua_pushvalue(L, callback[EVENT_VALUE]);
+        push_string(L, str, len, escaped);
+        return call(state, 1);
+    }
+    bool number(parse_state *state, const char *pos, double n) {
+        if (callback[EVENT_VALUE] == 0) return true;
+        lua_pushvalue(L, callback[EVENT_VALUE]);
+        push_number(L, n);
+        return call(state, 1);
+    }
+    bool boolean(parse_state *state, const char *pos, bool b) {
+        if (callback[EVENT_VALUE] == 0) return true;
+        lua_pushvalue(L, callback[EVENT_VALUE]);
+        lua_pushboolean(L, b ? 1 : 0);
+        return call(state, 1);
+    }
+    bool null(parse_state *state, const char *pos) {
+        if (callback[EVENT_VALUE] == 0) return true;
+        lua_pushvalue(L, callback[EVENT_VALUE]);
+        lua_pushnil(L);
+        return call(state, 1);
+    }
+};
+
+/*
+ * Expects a string or buffer and a table of callbacks.
+ * Returns true if the whole document was parsed, false if a callback
+ * stopped parsing, or nil and an error message.
+ */
+static int parse_json_events(lua_State *L) {
+    am_check_nargs(L, 2);
+    size_t len;
+    const char *data = check_json_source(L, 1, &len);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    lua_settop(L, 2);
+    event_caller caller;
+    caller.L = L;
+    caller.buffer = lua_isstring(L, 1) ? NULL : am_get_userdata(L, am_buffer, 1);
+    caller.data = (uint8_t*)data;
+    for (int i = 0; i < NUM_EVENTS; i++) {
+        lua_getfield(L, 2, event_names[i]);
+        if (lua_isfunction(L, -1)) {
+            caller.callback[i] = lua_gettop(L);
         } else {
-            column++;
+            lua_pop(L, 1);
+            caller.callback[i] = 0;
         }
-        ptr++;
     }
-    lua_pushfstring(L, "%d:%d: %s", line, column, msg);
-    return 0;
+    parse_state state;
+    init_parse_state(&state, data, len);
+    if (parse_document(&state, &caller)) {
+        lua_pushboolean(L, 1);
+        return 1;
+    } else if (state.stopped) {
+        lua_pushboolean(L, 0);
+        return 1;
+    } else {
+        lua_pushnil(L);
+        push_parse_error(L, &state);
+        return 2;
+    }
 }
 
 /*------------------------ serialization ----------------------------*/
@@ -462,11 +1264,39 @@ static void append_value(lua_State *L, write_state *state) {
     lua_pop(L, 1); // pop value
 }
 
+static void register_json_doc_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, json_doc_gc, 0);
+    lua_setfield(L, -2, "__gc");
+    am_register_metatable(L, "json_doc", MT_am_json_doc, 0);
+}
+
+static void register_json_value_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, json_value_index, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, json_value_newindex, 0);
+    lua_setfield(L, -2, "__newindex");
+    lua_pushcclosure(L, json_value_len, 0);
+    lua_setfield(L, -2, "__len");
+    lua_pushcclosure(L, json_pairs, 0);
+    lua_setfield(L, -2, "__pairs");
+    lua_pushcclosure(L, json_value_gc, 0);
+    lua_setfield(L, -2, "__gc");
+    am_register_metatable(L, "json_value", MT_am_json_value, 0);
+}
+
 void am_open_json_module(lua_State *L) {
     luaL_Reg funcs[] = {
         {"parse_json", am_parse_json},
+        {"parse_json_lazy", parse_json_lazy},
+        {"parse_json_events", parse_json_events},
+        {"json_pairs", json_pairs},
+        {"json_materialize", json_materialize},
         {"to_json", to_json},
         {NULL, NULL}
     };
     am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_json_doc_mt(L);
+    register_json_value_mt(L);
 }
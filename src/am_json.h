@@ -1,2 +1,5 @@
 int am_parse_json(lua_State *L);
+// Parses len bytes of JSON at data and pushes the resulting value, or
+// nil and an error message. Returns the number of values pushed.
+int am_parse_json_data(lua_State *L, const char *data, size_t len);
 void am_open_json_module(lua_State *L);
@@ -3,6 +3,312 @@
 #include "amulet.h"
 #include "am_mathv_helper.inc"
 
+static void add_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->add_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = ADD_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = ADD_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = ADD_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = ADD_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = ADD_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = ADD_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = ADD_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void add_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = ADD_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int add_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.add");        uint8_t arg_singleton_scratch[2][16*8];
@@ -23,6 +329,7 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.add", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -32,33 +339,9 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = ADD_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(add_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -67,33 +350,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = ADD_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(add_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -102,33 +360,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = ADD_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(add_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -137,33 +370,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = ADD_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(add_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -172,33 +380,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = ADD_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(add_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -207,33 +390,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = ADD_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(add_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -242,33 +400,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = ADD_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(add_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -277,33 +410,8 @@ static int add_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.add", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ADD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = ADD_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(add_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.add");
@@ -321,6 +429,312 @@ static int am_mathv_add_into(lua_State *L) {
     return add_impl(L, view);
 }
 
+static void sub_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->sub_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = SUB_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = SUB_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = SUB_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = SUB_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = SUB_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = SUB_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = SUB_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void sub_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = SUB_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int sub_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.sub");        uint8_t arg_singleton_scratch[2][16*8];
@@ -341,6 +755,7 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.sub", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -350,33 +765,9 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = SUB_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(sub_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -385,33 +776,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = SUB_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(sub_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -420,33 +786,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = SUB_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(sub_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -455,33 +796,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = SUB_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(sub_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -490,33 +806,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = SUB_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(sub_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -525,33 +816,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = SUB_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(sub_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -560,33 +826,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = SUB_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(sub_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -595,33 +836,8 @@ static int sub_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sub", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = SUB_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = SUB_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(sub_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.sub");
@@ -639,6 +855,312 @@ static int am_mathv_sub_into(lua_State *L) {
     return sub_impl(L, view);
 }
 
+static void vec_mul_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->vec_mul_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = MUL_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = MUL_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = MUL_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = MUL_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = MUL_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = MUL_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = MUL_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void vec_mul_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = MUL_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.vec_mul");        uint8_t arg_singleton_scratch[2][16*8];
@@ -659,6 +1181,7 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.vec_mul", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -668,33 +1191,9 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = MUL_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(vec_mul_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -703,33 +1202,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = MUL_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(vec_mul_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -738,33 +1212,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = MUL_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(vec_mul_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -773,33 +1222,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = MUL_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(vec_mul_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -808,33 +1232,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = MUL_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(vec_mul_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -843,33 +1242,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = MUL_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(vec_mul_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -878,33 +1252,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = MUL_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(vec_mul_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -913,33 +1262,8 @@ static int vec_mul_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.vec_mul", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = MUL_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = MUL_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(vec_mul_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.vec_mul");
@@ -957,6 +1281,312 @@ static int am_mathv_vec_mul_into(lua_State *L) {
     return vec_mul_impl(L, view);
 }
 
+static void div_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->div_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = DIV_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = DIV_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = DIV_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = DIV_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = DIV_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = DIV_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = DIV_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void div_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = DIV_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int div_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.div");        uint8_t arg_singleton_scratch[2][16*8];
@@ -977,6 +1607,7 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.div", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -986,33 +1617,9 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = DIV_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(div_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -1021,33 +1628,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = DIV_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(div_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -1056,33 +1638,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = DIV_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(div_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -1091,33 +1648,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = DIV_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(div_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -1126,33 +1658,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = DIV_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(div_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -1161,33 +1668,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = DIV_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(div_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -1196,33 +1678,8 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = DIV_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(div_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -1231,48 +1688,329 @@ static int div_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.div", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        run_mathv_loop(div_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
+        return 1;
+    }
+    return luaL_error(L, "invalid argument types for function mathv.div");
+}
+
+int am_mathv_div(lua_State *L) {
+    return div_impl(L, NULL);
+}
+
+static int am_mathv_div_into(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_buffer_view *view = am_check_buffer_view(L, 1);
+    lua_pushvalue(L, 1); // return view
+    lua_remove(L, 1);
+    return div_impl(L, view);
+}
+
+static void mod_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->mod_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = F32MOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = F32MOD_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = F64MOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = F64MOD_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = IMOD_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = IMOD_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void mod_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = IMOD_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = DIV_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    }
+}
+
+static void mod_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = IMOD_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
             }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = DIV_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
         }
-        return 1;
     }
-    return luaL_error(L, "invalid argument types for function mathv.div");
 }
 
-int am_mathv_div(lua_State *L) {
-    return div_impl(L, NULL);
+static void mod_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = IMOD_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
 }
 
-static int am_mathv_div_into(lua_State *L) {
-    am_check_nargs(L, 1);
-    am_buffer_view *view = am_check_buffer_view(L, 1);
-    lua_pushvalue(L, 1); // return view
-    lua_remove(L, 1);
-    return div_impl(L, view);
+static void mod_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = IMOD_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
 }
 
 static int mod_impl(lua_State *L, am_buffer_view *target) {
@@ -1295,6 +2033,7 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.mod", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -1304,33 +2043,9 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = F32MOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = F32MOD_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(mod_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -1339,33 +2054,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = F64MOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = F64MOD_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(mod_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -1374,33 +2064,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = IMOD_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(mod_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -1409,33 +2074,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = IMOD_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(mod_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -1444,33 +2084,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = IMOD_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(mod_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -1479,33 +2094,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = IMOD_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(mod_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -1514,33 +2104,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = IMOD_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(mod_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -1549,33 +2114,8 @@ static int mod_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mod", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = IMOD_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = IMOD_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(mod_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.mod");
@@ -1593,6 +2133,84 @@ static int am_mathv_mod_into(lua_State *L) {
     return mod_impl(L, view);
 }
 
+static void pow_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->pow_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = powf(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = powf(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void pow_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = pow(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = pow(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int pow_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.pow");        uint8_t arg_singleton_scratch[2][16*8];
@@ -1613,6 +2231,7 @@ static int pow_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.pow", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -1622,33 +2241,9 @@ static int pow_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.pow", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = powf(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = powf(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(pow_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -1657,33 +2252,8 @@ static int pow_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.pow", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = pow(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = pow(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(pow_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.pow");
@@ -1701,6 +2271,272 @@ static int am_mathv_pow_into(lua_State *L) {
     return pow_impl(L, view);
 }
 
+static void unm_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->unm_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = UNM_OP(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = UNM_OP(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int8_t *out_arr = (int8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int8_t*)output_data)[c] = UNM_OP(((int8_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = UNM_OP(((uint8_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int16_t *out_arr = (int16_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int16_t*)output_data)[c] = UNM_OP(((int16_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint16_t *out_arr = (uint16_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint16_t*)output_data)[c] = UNM_OP(((uint16_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        int32_t *out_arr = (int32_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((int32_t*)output_data)[c] = UNM_OP(((int32_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void unm_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint32_t *out_arr = (uint32_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = UNM_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint32_t*)output_data)[c] = UNM_OP(((uint32_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int unm_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     nargs = am_min(nargs, 1);        uint8_t arg_singleton_scratch[1][16*8];
@@ -1721,6 +2557,7 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.unm", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -1729,28 +2566,9 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = UNM_OP(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(unm_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -1758,28 +2576,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = UNM_OP(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(unm_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view)) {
@@ -1787,28 +2585,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int8_t *out_arr = (int8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int8_t*)output_data)[c] = UNM_OP(((int8_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(unm_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view)) {
@@ -1816,28 +2594,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = UNM_OP(((uint8_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(unm_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view)) {
@@ -1845,28 +2603,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int16_t *out_arr = (int16_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int16_t*)output_data)[c] = UNM_OP(((int16_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(unm_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view)) {
@@ -1874,28 +2612,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint16_t *out_arr = (uint16_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint16_t*)output_data)[c] = UNM_OP(((uint16_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(unm_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view)) {
@@ -1903,28 +2621,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_I32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            int32_t *out_arr = (int32_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((int32_t*)output_data)[c] = UNM_OP(((int32_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(unm_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view)) {
@@ -1932,28 +2630,8 @@ static int unm_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.unm", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint32_t *out_arr = (uint32_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = UNM_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint32_t*)output_data)[c] = UNM_OP(((uint32_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(unm_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.unm");
@@ -1971,6 +2649,74 @@ static int am_mathv_unm_into(lua_State *L) {
     return unm_impl(L, view);
 }
 
+static void abs_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->abs_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = fabsf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = fabsf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void abs_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = fabs(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = fabs(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int abs_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.abs");        uint8_t arg_singleton_scratch[1][16*8];
@@ -1991,6 +2737,7 @@ static int abs_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.abs", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -1999,28 +2746,9 @@ static int abs_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.abs", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = fabsf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = fabsf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(abs_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2028,28 +2756,8 @@ static int abs_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.abs", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = fabs(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = fabs(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(abs_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.abs");
@@ -2059,12 +2767,78 @@ static int am_mathv_abs(lua_State *L) {
     return abs_impl(L, NULL);
 }
 
-static int am_mathv_abs_into(lua_State *L) {
-    am_check_nargs(L, 1);
-    am_buffer_view *view = am_check_buffer_view(L, 1);
-    lua_pushvalue(L, 1); // return view
-    lua_remove(L, 1);
-    return abs_impl(L, view);
+static int am_mathv_abs_into(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_buffer_view *view = am_check_buffer_view(L, 1);
+    lua_pushvalue(L, 1); // return view
+    lua_remove(L, 1);
+    return abs_impl(L, view);
+}
+
+static void acos_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = acosf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = acosf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void acos_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = acos(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = acos(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
 }
 
 static int acos_impl(lua_State *L, am_buffer_view *target) {
@@ -2095,28 +2869,8 @@ static int acos_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.acos", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = acosf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = acosf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(acos_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2124,28 +2878,8 @@ static int acos_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.acos", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = acos(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = acos(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(acos_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.acos");
@@ -2163,6 +2897,72 @@ static int am_mathv_acos_into(lua_State *L) {
     return acos_impl(L, view);
 }
 
+static void asin_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = asinf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = asinf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void asin_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = asin(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = asin(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int asin_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.asin");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2191,28 +2991,8 @@ static int asin_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.asin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = asinf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = asinf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(asin_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2220,28 +3000,8 @@ static int asin_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.asin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = asin(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = asin(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(asin_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.asin");
@@ -2259,6 +3019,72 @@ static int am_mathv_asin_into(lua_State *L) {
     return asin_impl(L, view);
 }
 
+static void atan_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = atanf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = atanf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void atan_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = atan(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = atan(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int atan_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.atan");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2287,28 +3113,8 @@ static int atan_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.atan", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = atanf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = atanf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(atan_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2316,28 +3122,8 @@ static int atan_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.atan", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = atan(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = atan(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(atan_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.atan");
@@ -2355,6 +3141,82 @@ static int am_mathv_atan_into(lua_State *L) {
     return atan_impl(L, view);
 }
 
+static void atan2_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = atan2f(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = atan2f(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void atan2_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = atan2(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = atan2(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int atan2_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.atan2");        uint8_t arg_singleton_scratch[2][16*8];
@@ -2384,33 +3246,8 @@ static int atan2_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.atan2", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = atan2f(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = atan2f(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(atan2_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -2419,33 +3256,8 @@ static int atan2_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.atan2", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = atan2(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = atan2(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(atan2_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.atan2");
@@ -2463,6 +3275,74 @@ static int am_mathv_atan2_into(lua_State *L) {
     return atan2_impl(L, view);
 }
 
+static void ceil_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->ceil_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ceilf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = ceilf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void ceil_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = ceil(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = ceil(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int ceil_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.ceil");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2483,6 +3363,7 @@ static int ceil_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.ceil", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -2491,28 +3372,9 @@ static int ceil_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.ceil", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ceilf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = ceilf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(ceil_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2520,28 +3382,8 @@ static int ceil_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.ceil", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = ceil(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = ceil(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(ceil_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.ceil");
@@ -2559,6 +3401,94 @@ static int am_mathv_ceil_into(lua_State *L) {
     return ceil_impl(L, view);
 }
 
+static void clamp_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->clamp_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], (const float*)arg_data[2], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        float *arg3_arr = (float*)arg_data[2];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_clamp(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg3_ptr = arg_data[2];
+        int arg3_stride = arg_stride[2];
+        int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = am_clamp(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2], ((float*)arg3_ptr)[c & mask3]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            arg3_ptr += arg3_stride;
+            
+        }
+    }
+}
+
+static void clamp_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        double *arg3_arr = (double*)arg_data[2];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_clamp(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg3_ptr = arg_data[2];
+        int arg3_stride = arg_stride[2];
+        int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = am_clamp(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2], ((double*)arg3_ptr)[c & mask3]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            arg3_ptr += arg3_stride;
+            
+        }
+    }
+}
+
 static int clamp_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 3) return luaL_error(L, "too many arguments for mathv.clamp");        uint8_t arg_singleton_scratch[3][16*8];
@@ -2579,6 +3509,7 @@ static int clamp_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.clamp", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -2589,38 +3520,9 @@ static int clamp_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.clamp", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            float *arg3_arr = (float*)arg_data[2];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_clamp(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg3_ptr = arg_data[2];
-            int arg3_stride = arg_stride[2];
-            int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = am_clamp(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2], ((float*)arg3_ptr)[c & mask3]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                arg3_ptr += arg3_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(clamp_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 3  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -2630,38 +3532,8 @@ static int clamp_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.clamp", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            double *arg3_arr = (double*)arg_data[2];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_clamp(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg3_ptr = arg_data[2];
-            int arg3_stride = arg_stride[2];
-            int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = am_clamp(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2], ((double*)arg3_ptr)[c & mask3]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                arg3_ptr += arg3_stride;
-                
-            }
-        }
+        run_mathv_loop(clamp_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.clamp");
@@ -2679,6 +3551,74 @@ static int am_mathv_clamp_into(lua_State *L) {
     return clamp_impl(L, view);
 }
 
+static void cos_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->cos_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = cosf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = cosf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void cos_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = cos(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = cos(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int cos_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.cos");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2699,6 +3639,7 @@ static int cos_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.cos", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -2707,28 +3648,9 @@ static int cos_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.cos", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = cosf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = cosf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(cos_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2736,28 +3658,8 @@ static int cos_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.cos", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = cos(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = cos(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(cos_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.cos");
@@ -2775,6 +3677,74 @@ static int am_mathv_cos_into(lua_State *L) {
     return cos_impl(L, view);
 }
 
+static void floor_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->floor_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = floorf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = floorf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void floor_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = floor(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = floor(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int floor_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.floor");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2795,6 +3765,7 @@ static int floor_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.floor", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -2803,28 +3774,9 @@ static int floor_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.floor", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = floorf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = floorf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(floor_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2832,28 +3784,8 @@ static int floor_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.floor", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = floor(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = floor(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(floor_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.floor");
@@ -2871,6 +3803,74 @@ static int am_mathv_floor_into(lua_State *L) {
     return floor_impl(L, view);
 }
 
+static void fract_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->fract_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = glm::fract(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = glm::fract(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void fract_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = glm::fract(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = glm::fract(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int fract_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.fract");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2891,6 +3891,7 @@ static int fract_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.fract", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -2899,28 +3900,9 @@ static int fract_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.fract", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = glm::fract(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = glm::fract(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(fract_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -2928,28 +3910,8 @@ static int fract_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.fract", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = glm::fract(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = glm::fract(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(fract_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.fract");
@@ -2967,6 +3929,74 @@ static int am_mathv_fract_into(lua_State *L) {
     return fract_impl(L, view);
 }
 
+static void log_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->log_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = logf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = logf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void log_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = log(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = log(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int log_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.log");        uint8_t arg_singleton_scratch[1][16*8];
@@ -2987,6 +4017,7 @@ static int log_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.log", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -2995,28 +4026,9 @@ static int log_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.log", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = logf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = logf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(log_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -3024,28 +4036,8 @@ static int log_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.log", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = log(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = log(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(log_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.log");
@@ -3063,6 +4055,84 @@ static int am_mathv_log_into(lua_State *L) {
     return log_impl(L, view);
 }
 
+static void max_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->max_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_max(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = am_max(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void max_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_max(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = am_max(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int max_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.max");        uint8_t arg_singleton_scratch[2][16*8];
@@ -3083,6 +4153,7 @@ static int max_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.max", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -3092,33 +4163,9 @@ static int max_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.max", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_max(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = am_max(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(max_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -3127,33 +4174,8 @@ static int max_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.max", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_max(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = am_max(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(max_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.max");
@@ -3171,6 +4193,84 @@ static int am_mathv_max_into(lua_State *L) {
     return max_impl(L, view);
 }
 
+static void min_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->min_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_min(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = am_min(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void min_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_min(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = am_min(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int min_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.min");        uint8_t arg_singleton_scratch[2][16*8];
@@ -3191,6 +4291,7 @@ static int min_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.min", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -3200,33 +4301,9 @@ static int min_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.min", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_min(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = am_min(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(min_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -3235,33 +4312,8 @@ static int min_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.min", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_min(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = am_min(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(min_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.min");
@@ -3279,6 +4331,94 @@ static int am_mathv_min_into(lua_State *L) {
     return min_impl(L, view);
 }
 
+static void mix_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->mix_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], (const float*)arg_data[2], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        float *arg3_arr = (float*)arg_data[2];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = glm::mix(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg3_ptr = arg_data[2];
+        int arg3_stride = arg_stride[2];
+        int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = glm::mix(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2], ((float*)arg3_ptr)[c & mask3]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            arg3_ptr += arg3_stride;
+            
+        }
+    }
+}
+
+static void mix_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        double *arg3_arr = (double*)arg_data[2];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = glm::mix(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg3_ptr = arg_data[2];
+        int arg3_stride = arg_stride[2];
+        int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = glm::mix(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2], ((double*)arg3_ptr)[c & mask3]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            arg3_ptr += arg3_stride;
+            
+        }
+    }
+}
+
 static int mix_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 3) return luaL_error(L, "too many arguments for mathv.mix");        uint8_t arg_singleton_scratch[3][16*8];
@@ -3299,6 +4439,7 @@ static int mix_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.mix", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -3309,38 +4450,9 @@ static int mix_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mix", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            float *arg3_arr = (float*)arg_data[2];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = glm::mix(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg3_ptr = arg_data[2];
-            int arg3_stride = arg_stride[2];
-            int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = glm::mix(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2], ((float*)arg3_ptr)[c & mask3]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                arg3_ptr += arg3_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(mix_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 3  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -3350,38 +4462,8 @@ static int mix_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.mix", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            double *arg3_arr = (double*)arg_data[2];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = glm::mix(arg1_arr[i], arg2_arr[i], arg3_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg3_ptr = arg_data[2];
-            int arg3_stride = arg_stride[2];
-            int mask3 = arg_components[2] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = glm::mix(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2], ((double*)arg3_ptr)[c & mask3]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                arg3_ptr += arg3_stride;
-                
-            }
-        }
+        run_mathv_loop(mix_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.mix");
@@ -3399,6 +4481,74 @@ static int am_mathv_mix_into(lua_State *L) {
     return mix_impl(L, view);
 }
 
+static void sign_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->sign_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_sign(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = am_sign(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void sign_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = am_sign(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = am_sign(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int sign_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.sign");        uint8_t arg_singleton_scratch[1][16*8];
@@ -3419,6 +4569,7 @@ static int sign_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.sign", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -3427,28 +4578,9 @@ static int sign_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sign", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_sign(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = am_sign(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(sign_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -3456,28 +4588,8 @@ static int sign_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sign", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = am_sign(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = am_sign(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(sign_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.sign");
@@ -3495,6 +4607,74 @@ static int am_mathv_sign_into(lua_State *L) {
     return sign_impl(L, view);
 }
 
+static void sin_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->sin_f32((float*)output_data, (const float*)arg_data[0], output_count * output_components);
+    } else if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = sinf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = sinf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void sin_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = sin(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = sin(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int sin_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.sin");        uint8_t arg_singleton_scratch[1][16*8];
@@ -3515,6 +4695,7 @@ static int sin_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.sin", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -3523,28 +4704,9 @@ static int sin_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = sinf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = sinf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(sin_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -3552,28 +4714,8 @@ static int sin_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.sin", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = sin(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = sin(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(sin_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.sin");
@@ -3591,6 +4733,72 @@ static int am_mathv_sin_into(lua_State *L) {
     return sin_impl(L, view);
 }
 
+static void tan_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        float *out_arr = (float*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = tanf(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((float*)output_data)[c] = tanf(((float*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
+static void tan_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        double *out_arr = (double*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = tan(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((double*)output_data)[c] = tan(((double*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int tan_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.tan");        uint8_t arg_singleton_scratch[1][16*8];
@@ -3619,28 +4827,8 @@ static int tan_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.tan", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F32;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            float *out_arr = (float*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = tanf(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((float*)output_data)[c] = tanf(((float*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(tan_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 1  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -3648,43 +4836,329 @@ static int tan_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.tan", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_F64;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            double *out_arr = (double*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
+        run_mathv_loop(tan_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
+        return 1;
+    }
+    return luaL_error(L, "invalid argument types for function mathv.tan");
+}
+
+static int am_mathv_tan(lua_State *L) {
+    return tan_impl(L, NULL);
+}
+
+static int am_mathv_tan_into(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_buffer_view *view = am_check_buffer_view(L, 1);
+    lua_pushvalue(L, 1); // return view
+    lua_remove(L, 1);
+    return tan_impl(L, view);
+}
+
+static void lt_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->lt_f32((uint8_t*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = tan(arg1_arr[i]);
+        }
+    }
+}
+
+static void lt_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lt_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
             }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
             
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((double*)output_data)[c] = tan(((double*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
         }
-        return 1;
     }
-    return luaL_error(L, "invalid argument types for function mathv.tan");
-}
-
-static int am_mathv_tan(lua_State *L) {
-    return tan_impl(L, NULL);
 }
 
-static int am_mathv_tan_into(lua_State *L) {
-    am_check_nargs(L, 1);
-    am_buffer_view *view = am_check_buffer_view(L, 1);
-    lua_pushvalue(L, 1); // return view
-    lua_remove(L, 1);
-    return tan_impl(L, view);
+static void lt_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LT_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
 }
 
 static int lt_impl(lua_State *L, am_buffer_view *target) {
@@ -3707,6 +5181,7 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.lt", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -3716,33 +5191,9 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(lt_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -3751,33 +5202,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lt_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -3786,33 +5212,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lt_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -3821,33 +5222,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lt_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -3856,33 +5232,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lt_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -3891,33 +5242,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lt_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -3926,33 +5252,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lt_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -3961,33 +5262,8 @@ static int lt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LT_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lt_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.lt");
@@ -4005,6 +5281,312 @@ static int am_mathv_lt_into(lua_State *L) {
     return lt_impl(L, view);
 }
 
+static void lte_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->lte_f32((uint8_t*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void lte_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = LTE_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int lte_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.lte");        uint8_t arg_singleton_scratch[2][16*8];
@@ -4025,6 +5607,7 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.lte", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -4034,33 +5617,9 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(lte_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -4069,33 +5628,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lte_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4104,33 +5638,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lte_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4139,33 +5648,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lte_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4174,33 +5658,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lte_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4209,33 +5668,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lte_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4244,33 +5678,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lte_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4279,33 +5688,8 @@ static int lte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.lte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = LTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = LTE_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(lte_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.lte");
@@ -4323,6 +5707,312 @@ static int am_mathv_lte_into(lua_State *L) {
     return lte_impl(L, view);
 }
 
+static void gt_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->gt_f32((uint8_t*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gt_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GT_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int gt_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.gt");        uint8_t arg_singleton_scratch[2][16*8];
@@ -4343,6 +6033,7 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.gt", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -4352,68 +6043,19 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(gt_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
         arg_view_type[0] = AM_VIEW_TYPE_F64;
         arg_view_type[1] = AM_VIEW_TYPE_F64;
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
-        output_view_type = AM_VIEW_TYPE_U8;
-        create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        output_view_type = AM_VIEW_TYPE_U8;
+        create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
+        run_mathv_loop(gt_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4422,33 +6064,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gt_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4457,33 +6074,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gt_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4492,33 +6084,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gt_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4527,33 +6094,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gt_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4562,33 +6104,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gt_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4597,33 +6114,8 @@ static int gt_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gt", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GT_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GT_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gt_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.gt");
@@ -4641,6 +6133,312 @@ static int am_mathv_gt_into(lua_State *L) {
     return gt_impl(L, view);
 }
 
+static void gte_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->use_simd) {
+        am_mathv_simd->gte_f32((uint8_t*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count * output_components, loop->simd_bcast);
+    } else if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        float *arg1_arr = (float*)arg_data[0];
+        float *arg2_arr = (float*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        double *arg1_arr = (double*)arg_data[0];
+        double *arg2_arr = (double*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int8_t *arg1_arr = (int8_t*)arg_data[0];
+        int8_t *arg2_arr = (int8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint16_t *arg1_arr = (uint16_t*)arg_data[0];
+        uint16_t *arg2_arr = (uint16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int16_t *arg1_arr = (int16_t*)arg_data[0];
+        int16_t *arg2_arr = (int16_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint32_t *arg1_arr = (uint32_t*)arg_data[0];
+        uint32_t *arg2_arr = (uint32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
+static void gte_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        int32_t *arg1_arr = (int32_t*)arg_data[0];
+        int32_t *arg2_arr = (int32_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = GTE_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int gte_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.gte");        uint8_t arg_singleton_scratch[2][16*8];
@@ -4661,6 +6459,7 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
     uint8_t *output_data;
     bool args_are_dense;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     component_wise_setup(L, "mathv.gte", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count, &output_components, &args_are_dense);
@@ -4670,33 +6469,9 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            float *arg1_arr = (float*)arg_data[0];
-            float *arg2_arr = (float*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((float*)arg1_ptr)[c & mask1], ((float*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);
+        run_mathv_loop(gte_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -4705,33 +6480,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            double *arg1_arr = (double*)arg_data[0];
-            double *arg2_arr = (double*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((double*)arg1_ptr)[c & mask1], ((double*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gte_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4740,33 +6490,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gte_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I8) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I8) || arg_type[1] != MT_am_buffer_view)) {
@@ -4775,33 +6500,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int8_t *arg1_arr = (int8_t*)arg_data[0];
-            int8_t *arg2_arr = (int8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((int8_t*)arg1_ptr)[c & mask1], ((int8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gte_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4810,33 +6510,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint16_t *arg1_arr = (uint16_t*)arg_data[0];
-            uint16_t *arg2_arr = (uint16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((uint16_t*)arg1_ptr)[c & mask1], ((uint16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gte_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I16) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I16) || arg_type[1] != MT_am_buffer_view)) {
@@ -4845,33 +6520,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int16_t *arg1_arr = (int16_t*)arg_data[0];
-            int16_t *arg2_arr = (int16_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((int16_t*)arg1_ptr)[c & mask1], ((int16_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gte_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_U32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_U32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4880,33 +6530,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint32_t *arg1_arr = (uint32_t*)arg_data[0];
-            uint32_t *arg2_arr = (uint32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((uint32_t*)arg1_ptr)[c & mask1], ((uint32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gte_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     if (nargs == 2  && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_I32) || arg_type[0] != MT_am_buffer_view) && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_I32) || arg_type[1] != MT_am_buffer_view)) {
@@ -4915,33 +6540,8 @@ static int gte_impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.gte", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            int32_t *arg1_arr = (int32_t*)arg_data[0];
-            int32_t *arg2_arr = (int32_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = GTE_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = GTE_OP(((int32_t*)arg1_ptr)[c & mask1], ((int32_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(gte_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.gte");
@@ -4959,6 +6559,44 @@ static int am_mathv_gte_into(lua_State *L) {
     return gte_impl(L, view);
 }
 
+static void and__loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = AND_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = AND_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int and__impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.and_");        uint8_t arg_singleton_scratch[2][16*8];
@@ -4988,33 +6626,8 @@ static int and__impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.and_", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = AND_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = AND_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(and__loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.and_");
@@ -5032,6 +6645,44 @@ static int am_mathv_and__into(lua_State *L) {
     return and__impl(L, view);
 }
 
+static void or__loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        uint8_t *arg2_arr = (uint8_t*)arg_data[1];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = OR_OP(arg1_arr[i], arg2_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        uint8_t *arg2_ptr = arg_data[1];
+        int arg2_stride = arg_stride[1];
+        int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = OR_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            arg2_ptr += arg2_stride;
+            
+        }
+    }
+}
+
 static int or__impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.or_");        uint8_t arg_singleton_scratch[2][16*8];
@@ -5061,33 +6712,8 @@ static int or__impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.or_", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            uint8_t *arg2_arr = (uint8_t*)arg_data[1];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = OR_OP(arg1_arr[i], arg2_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            uint8_t *arg2_ptr = arg_data[1];
-            int arg2_stride = arg_stride[1];
-            int mask2 = arg_components[1] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = OR_OP(((uint8_t*)arg1_ptr)[c & mask1], ((uint8_t*)arg2_ptr)[c & mask2]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                arg2_ptr += arg2_stride;
-                
-            }
-        }
+        run_mathv_loop(or__loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.or_");
@@ -5105,6 +6731,39 @@ static int am_mathv_or__into(lua_State *L) {
     return or__impl(L, view);
 }
 
+static void not__loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+    if (loop->is_dense) {
+        uint8_t *out_arr = (uint8_t*)output_data;
+        uint8_t *arg1_arr = (uint8_t*)arg_data[0];
+        
+        unsigned int n = output_count * output_components;
+        for (unsigned int i = 0; i < n; ++i) {
+            out_arr[i] = NOT_OP(arg1_arr[i]);
+        }
+    } else {
+        uint8_t *arg1_ptr = arg_data[0];
+        int arg1_stride = arg_stride[0];
+        int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
+        
+        for (unsigned int i = 0; i < output_count; ++i) {
+            for (unsigned int c = 0; c < output_components; ++c) {
+                ((uint8_t*)output_data)[c] = NOT_OP(((uint8_t*)arg1_ptr)[c & mask1]);
+            }
+            output_data += output_stride;
+            arg1_ptr += arg1_stride;
+            
+        }
+    }
+}
+
 static int not__impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.not_");        uint8_t arg_singleton_scratch[1][16*8];
@@ -5133,28 +6792,8 @@ static int not__impl(lua_State *L, am_buffer_view *target) {
         setup_non_view_args(L, "mathv.not_", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);
         output_view_type = AM_VIEW_TYPE_U8;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        if (output_is_dense && args_are_dense) {
-            uint8_t *out_arr = (uint8_t*)output_data;
-            uint8_t *arg1_arr = (uint8_t*)arg_data[0];
-            
-            unsigned int n = output_count * output_components;
-            for (unsigned int i = 0; i < n; ++i) {
-                out_arr[i] = NOT_OP(arg1_arr[i]);
-            }
-        } else {
-            uint8_t *arg1_ptr = arg_data[0];
-            int arg1_stride = arg_stride[0];
-            int mask1 = arg_components[0] == 1 ? 0 : 0xFFFF;
-            
-            for (unsigned int i = 0; i < output_count; ++i) {
-                for (unsigned int c = 0; c < output_components; ++c) {
-                    ((uint8_t*)output_data)[c] = NOT_OP(((uint8_t*)arg1_ptr)[c & mask1]);
-                }
-                output_data += output_stride;
-                arg1_ptr += arg1_stride;
-                
-            }
-        }
+        run_mathv_loop(not__loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            output_is_dense && args_are_dense, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.not_");
@@ -5172,6 +6811,76 @@ static int am_mathv_not__into(lua_State *L) {
     return not__impl(L, view);
 }
 
+static void vec2_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec2*)output_data) = glm::vec2(*((float*)in_ptr_1), *((float*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec2_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec2*)output_data) = glm::vec2(*((glm::vec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void vec2_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec2*)output_data) = glm::dvec2(*((double*)in_ptr_1), *((double*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec2_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec2*)output_data) = glm::dvec2(*((glm::dvec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
 static int vec2_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.vec2");        uint8_t arg_singleton_scratch[2][16*8];
@@ -5201,16 +6910,8 @@ static int vec2_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 2;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec2*)output_data) = glm::vec2(*((float*)in_ptr_1), *((float*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec2_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -5219,13 +6920,8 @@ static int vec2_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 2;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec2*)output_data) = glm::vec2(*((glm::vec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec2_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -5235,16 +6931,8 @@ static int vec2_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 2;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec2*)output_data) = glm::dvec2(*((double*)in_ptr_1), *((double*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec2_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -5253,13 +6941,8 @@ static int vec2_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 2;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec2*)output_data) = glm::dvec2(*((glm::dvec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec2_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.vec2");
@@ -5277,6 +6960,158 @@ static int am_mathv_vec2_into(lua_State *L) {
     return vec2_impl(L, view);
 }
 
+static void vec3_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec3*)output_data) = glm::vec3(*((float*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void vec3_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec3*)output_data) = glm::vec3(*((glm::vec2*)in_ptr_1), *((float*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec3_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec3*)output_data) = glm::vec3(*((float*)in_ptr_1), *((glm::vec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec3_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec3*)output_data) = glm::vec3(*((glm::vec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void vec3_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec3*)output_data) = glm::dvec3(*((double*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void vec3_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec3*)output_data) = glm::dvec3(*((glm::dvec2*)in_ptr_1), *((double*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec3_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec3*)output_data) = glm::dvec3(*((double*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec3_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec3*)output_data) = glm::dvec3(*((glm::dvec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
 static int vec3_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 3) return luaL_error(L, "too many arguments for mathv.vec3");        uint8_t arg_singleton_scratch[3][16*8];
@@ -5307,19 +7142,8 @@ static int vec3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec3*)output_data) = glm::vec3(*((float*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec3_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -5329,16 +7153,8 @@ static int vec3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec3*)output_data) = glm::vec3(*((glm::vec2*)in_ptr_1), *((float*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec3_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -5348,16 +7164,8 @@ static int vec3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec3*)output_data) = glm::vec3(*((float*)in_ptr_1), *((glm::vec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec3_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -5366,13 +7174,8 @@ static int vec3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec3*)output_data) = glm::vec3(*((glm::vec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec3_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 1 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -5383,19 +7186,8 @@ static int vec3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec3*)output_data) = glm::dvec3(*((double*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec3_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -5405,16 +7197,8 @@ static int vec3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec3*)output_data) = glm::dvec3(*((glm::dvec2*)in_ptr_1), *((double*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec3_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -5424,16 +7208,8 @@ static int vec3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec3*)output_data) = glm::dvec3(*((double*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec3_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -5442,13 +7218,8 @@ static int vec3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec3*)output_data) = glm::dvec3(*((glm::dvec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec3_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.vec3");
@@ -5466,6 +7237,334 @@ static int am_mathv_vec3_into(lua_State *L) {
     return vec3_impl(L, view);
 }
 
+static void vec4_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[4];
+    uint8_t *output_data = mathv_loop_range(loop, 4, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    int in_stride_4 = arg_stride[3];
+    uint8_t *in_ptr_4 = &arg_data[3][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::vec4(*((float*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3), *((float*)in_ptr_4));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        in_ptr_4 += in_stride_4;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::vec4(*((glm::vec3*)in_ptr_1), *((float*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::vec4(*((float*)in_ptr_1), *((glm::vec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::vec4(*((glm::vec2*)in_ptr_1), *((glm::vec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::vec4(*((float*)in_ptr_1), *((float*)in_ptr_2), *((glm::vec2*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::vec4(*((float*)in_ptr_1), *((glm::vec2*)in_ptr_2), *((float*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::vec4(*((glm::vec2*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::vec4(*((glm::vec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop9(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[4];
+    uint8_t *output_data = mathv_loop_range(loop, 4, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    int in_stride_4 = arg_stride[3];
+    uint8_t *in_ptr_4 = &arg_data[3][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::dvec4(*((double*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3), *((double*)in_ptr_4));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        in_ptr_4 += in_stride_4;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop10(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::dvec4(*((glm::dvec3*)in_ptr_1), *((double*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop11(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::dvec4(*((double*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop12(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::dvec4(*((glm::dvec2*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop13(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::dvec4(*((double*)in_ptr_1), *((double*)in_ptr_2), *((glm::dvec2*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop14(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::dvec4(*((double*)in_ptr_1), *((glm::dvec2*)in_ptr_2), *((double*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop15(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::dvec4(*((glm::dvec2*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void vec4_loop16(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::dvec4(*((glm::dvec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
 static int vec4_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 4) return luaL_error(L, "too many arguments for mathv.vec4");        uint8_t arg_singleton_scratch[4][16*8];
@@ -5497,22 +7596,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        int in_stride_4 = arg_stride[3];
-        uint8_t *in_ptr_4 = &arg_data[3][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::vec4(*((float*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3), *((float*)in_ptr_4));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            in_ptr_4 += in_stride_4;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -5522,16 +7607,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::vec4(*((glm::vec3*)in_ptr_1), *((float*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -5541,16 +7618,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::vec4(*((float*)in_ptr_1), *((glm::vec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -5560,16 +7629,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::vec4(*((glm::vec2*)in_ptr_1), *((glm::vec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 2 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F32) || arg_type[2] != MT_am_buffer_view)) {
@@ -5580,19 +7641,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::vec4(*((float*)in_ptr_1), *((float*)in_ptr_2), *((glm::vec2*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 1 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F32) || arg_type[2] != MT_am_buffer_view)) {
@@ -5603,19 +7653,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::vec4(*((float*)in_ptr_1), *((glm::vec2*)in_ptr_2), *((float*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 1 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F32) || arg_type[2] != MT_am_buffer_view)) {
@@ -5626,19 +7665,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::vec4(*((glm::vec2*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -5647,13 +7675,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::vec4(*((glm::vec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 4  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 1 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view) && arg_components[3] == 1 && ((arg_type[3] == MT_am_buffer_view && arg_view_type[3] == AM_VIEW_TYPE_F64) || arg_type[3] != MT_am_buffer_view)) {
@@ -5665,22 +7688,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        int in_stride_4 = arg_stride[3];
-        uint8_t *in_ptr_4 = &arg_data[3][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::dvec4(*((double*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3), *((double*)in_ptr_4));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            in_ptr_4 += in_stride_4;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop9, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -5690,16 +7699,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::dvec4(*((glm::dvec3*)in_ptr_1), *((double*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop10, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -5709,16 +7710,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::dvec4(*((double*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop11, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -5728,16 +7721,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::dvec4(*((glm::dvec2*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop12, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 2 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -5748,19 +7733,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::dvec4(*((double*)in_ptr_1), *((double*)in_ptr_2), *((glm::dvec2*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop13, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 1 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -5771,19 +7745,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::dvec4(*((double*)in_ptr_1), *((glm::dvec2*)in_ptr_2), *((double*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop14, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 1 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -5794,19 +7757,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::dvec4(*((glm::dvec2*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop15, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -5815,13 +7767,8 @@ static int vec4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::dvec4(*((glm::dvec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(vec4_loop16, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.vec4");
@@ -5839,6 +7786,130 @@ static int am_mathv_vec4_into(lua_State *L) {
     return vec4_impl(L, view);
 }
 
+static void mat3_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[9];
+    uint8_t *output_data = mathv_loop_range(loop, 9, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    int in_stride_4 = arg_stride[3];
+    uint8_t *in_ptr_4 = &arg_data[3][0];
+    int in_stride_5 = arg_stride[4];
+    uint8_t *in_ptr_5 = &arg_data[4][0];
+    int in_stride_6 = arg_stride[5];
+    uint8_t *in_ptr_6 = &arg_data[5][0];
+    int in_stride_7 = arg_stride[6];
+    uint8_t *in_ptr_7 = &arg_data[6][0];
+    int in_stride_8 = arg_stride[7];
+    uint8_t *in_ptr_8 = &arg_data[7][0];
+    int in_stride_9 = arg_stride[8];
+    uint8_t *in_ptr_9 = &arg_data[8][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat3*)output_data) = glm::mat3(*((float*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3), *((float*)in_ptr_4), *((float*)in_ptr_5), *((float*)in_ptr_6), *((float*)in_ptr_7), *((float*)in_ptr_8), *((float*)in_ptr_9));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        in_ptr_4 += in_stride_4;
+        in_ptr_5 += in_stride_5;
+        in_ptr_6 += in_stride_6;
+        in_ptr_7 += in_stride_7;
+        in_ptr_8 += in_stride_8;
+        in_ptr_9 += in_stride_9;
+        output_data += output_stride;
+    }
+}
+
+static void mat3_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat3*)output_data) = glm::mat3(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2), *((glm::vec3*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
+static void mat3_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[9];
+    uint8_t *output_data = mathv_loop_range(loop, 9, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    int in_stride_4 = arg_stride[3];
+    uint8_t *in_ptr_4 = &arg_data[3][0];
+    int in_stride_5 = arg_stride[4];
+    uint8_t *in_ptr_5 = &arg_data[4][0];
+    int in_stride_6 = arg_stride[5];
+    uint8_t *in_ptr_6 = &arg_data[5][0];
+    int in_stride_7 = arg_stride[6];
+    uint8_t *in_ptr_7 = &arg_data[6][0];
+    int in_stride_8 = arg_stride[7];
+    uint8_t *in_ptr_8 = &arg_data[7][0];
+    int in_stride_9 = arg_stride[8];
+    uint8_t *in_ptr_9 = &arg_data[8][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat3*)output_data) = glm::dmat3(*((double*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3), *((double*)in_ptr_4), *((double*)in_ptr_5), *((double*)in_ptr_6), *((double*)in_ptr_7), *((double*)in_ptr_8), *((double*)in_ptr_9));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        in_ptr_4 += in_stride_4;
+        in_ptr_5 += in_stride_5;
+        in_ptr_6 += in_stride_6;
+        in_ptr_7 += in_stride_7;
+        in_ptr_8 += in_stride_8;
+        in_ptr_9 += in_stride_9;
+        output_data += output_stride;
+    }
+}
+
+static void mat3_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[3];
+    uint8_t *output_data = mathv_loop_range(loop, 3, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat3*)output_data) = glm::dmat3(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2), *((glm::dvec3*)in_ptr_3));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        output_data += output_stride;
+    }
+}
+
 static int mat3_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 9) return luaL_error(L, "too many arguments for mathv.mat3");        uint8_t arg_singleton_scratch[9][16*8];
@@ -5875,37 +7946,8 @@ static int mat3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        int in_stride_4 = arg_stride[3];
-        uint8_t *in_ptr_4 = &arg_data[3][0];
-        int in_stride_5 = arg_stride[4];
-        uint8_t *in_ptr_5 = &arg_data[4][0];
-        int in_stride_6 = arg_stride[5];
-        uint8_t *in_ptr_6 = &arg_data[5][0];
-        int in_stride_7 = arg_stride[6];
-        uint8_t *in_ptr_7 = &arg_data[6][0];
-        int in_stride_8 = arg_stride[7];
-        uint8_t *in_ptr_8 = &arg_data[7][0];
-        int in_stride_9 = arg_stride[8];
-        uint8_t *in_ptr_9 = &arg_data[8][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat3*)output_data) = glm::mat3(*((float*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3), *((float*)in_ptr_4), *((float*)in_ptr_5), *((float*)in_ptr_6), *((float*)in_ptr_7), *((float*)in_ptr_8), *((float*)in_ptr_9));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            in_ptr_4 += in_stride_4;
-            in_ptr_5 += in_stride_5;
-            in_ptr_6 += in_stride_6;
-            in_ptr_7 += in_stride_7;
-            in_ptr_8 += in_stride_8;
-            in_ptr_9 += in_stride_9;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat3_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 3 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F32) || arg_type[2] != MT_am_buffer_view)) {
@@ -5916,19 +7958,8 @@ static int mat3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat3*)output_data) = glm::mat3(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2), *((glm::vec3*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat3_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 9  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 1 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view) && arg_components[3] == 1 && ((arg_type[3] == MT_am_buffer_view && arg_view_type[3] == AM_VIEW_TYPE_F64) || arg_type[3] != MT_am_buffer_view) && arg_components[4] == 1 && ((arg_type[4] == MT_am_buffer_view && arg_view_type[4] == AM_VIEW_TYPE_F64) || arg_type[4] != MT_am_buffer_view) && arg_components[5] == 1 && ((arg_type[5] == MT_am_buffer_view && arg_view_type[5] == AM_VIEW_TYPE_F64) || arg_type[5] != MT_am_buffer_view) && arg_components[6] == 1 && ((arg_type[6] == MT_am_buffer_view && arg_view_type[6] == AM_VIEW_TYPE_F64) || arg_type[6] != MT_am_buffer_view) && arg_components[7] == 1 && ((arg_type[7] == MT_am_buffer_view && arg_view_type[7] == AM_VIEW_TYPE_F64) || arg_type[7] != MT_am_buffer_view) && arg_components[8] == 1 && ((arg_type[8] == MT_am_buffer_view && arg_view_type[8] == AM_VIEW_TYPE_F64) || arg_type[8] != MT_am_buffer_view)) {
@@ -5945,37 +7976,8 @@ static int mat3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        int in_stride_4 = arg_stride[3];
-        uint8_t *in_ptr_4 = &arg_data[3][0];
-        int in_stride_5 = arg_stride[4];
-        uint8_t *in_ptr_5 = &arg_data[4][0];
-        int in_stride_6 = arg_stride[5];
-        uint8_t *in_ptr_6 = &arg_data[5][0];
-        int in_stride_7 = arg_stride[6];
-        uint8_t *in_ptr_7 = &arg_data[6][0];
-        int in_stride_8 = arg_stride[7];
-        uint8_t *in_ptr_8 = &arg_data[7][0];
-        int in_stride_9 = arg_stride[8];
-        uint8_t *in_ptr_9 = &arg_data[8][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat3*)output_data) = glm::dmat3(*((double*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3), *((double*)in_ptr_4), *((double*)in_ptr_5), *((double*)in_ptr_6), *((double*)in_ptr_7), *((double*)in_ptr_8), *((double*)in_ptr_9));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            in_ptr_4 += in_stride_4;
-            in_ptr_5 += in_stride_5;
-            in_ptr_6 += in_stride_6;
-            in_ptr_7 += in_stride_7;
-            in_ptr_8 += in_stride_8;
-            in_ptr_9 += in_stride_9;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat3_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 3  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 3 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view)) {
@@ -5986,19 +7988,8 @@ static int mat3_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat3*)output_data) = glm::dmat3(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2), *((glm::dvec3*)in_ptr_3));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat3_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.mat3");
@@ -6016,6 +8007,178 @@ static int am_mathv_mat3_into(lua_State *L) {
     return mat3_impl(L, view);
 }
 
+static void mat4_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[16];
+    uint8_t *output_data = mathv_loop_range(loop, 16, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    int in_stride_4 = arg_stride[3];
+    uint8_t *in_ptr_4 = &arg_data[3][0];
+    int in_stride_5 = arg_stride[4];
+    uint8_t *in_ptr_5 = &arg_data[4][0];
+    int in_stride_6 = arg_stride[5];
+    uint8_t *in_ptr_6 = &arg_data[5][0];
+    int in_stride_7 = arg_stride[6];
+    uint8_t *in_ptr_7 = &arg_data[6][0];
+    int in_stride_8 = arg_stride[7];
+    uint8_t *in_ptr_8 = &arg_data[7][0];
+    int in_stride_9 = arg_stride[8];
+    uint8_t *in_ptr_9 = &arg_data[8][0];
+    int in_stride_10 = arg_stride[9];
+    uint8_t *in_ptr_10 = &arg_data[9][0];
+    int in_stride_11 = arg_stride[10];
+    uint8_t *in_ptr_11 = &arg_data[10][0];
+    int in_stride_12 = arg_stride[11];
+    uint8_t *in_ptr_12 = &arg_data[11][0];
+    int in_stride_13 = arg_stride[12];
+    uint8_t *in_ptr_13 = &arg_data[12][0];
+    int in_stride_14 = arg_stride[13];
+    uint8_t *in_ptr_14 = &arg_data[13][0];
+    int in_stride_15 = arg_stride[14];
+    uint8_t *in_ptr_15 = &arg_data[14][0];
+    int in_stride_16 = arg_stride[15];
+    uint8_t *in_ptr_16 = &arg_data[15][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat4*)output_data) = glm::mat4(*((float*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3), *((float*)in_ptr_4), *((float*)in_ptr_5), *((float*)in_ptr_6), *((float*)in_ptr_7), *((float*)in_ptr_8), *((float*)in_ptr_9), *((float*)in_ptr_10), *((float*)in_ptr_11), *((float*)in_ptr_12), *((float*)in_ptr_13), *((float*)in_ptr_14), *((float*)in_ptr_15), *((float*)in_ptr_16));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        in_ptr_4 += in_stride_4;
+        in_ptr_5 += in_stride_5;
+        in_ptr_6 += in_stride_6;
+        in_ptr_7 += in_stride_7;
+        in_ptr_8 += in_stride_8;
+        in_ptr_9 += in_stride_9;
+        in_ptr_10 += in_stride_10;
+        in_ptr_11 += in_stride_11;
+        in_ptr_12 += in_stride_12;
+        in_ptr_13 += in_stride_13;
+        in_ptr_14 += in_stride_14;
+        in_ptr_15 += in_stride_15;
+        in_ptr_16 += in_stride_16;
+        output_data += output_stride;
+    }
+}
+
+static void mat4_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[4];
+    uint8_t *output_data = mathv_loop_range(loop, 4, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    int in_stride_4 = arg_stride[3];
+    uint8_t *in_ptr_4 = &arg_data[3][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat4*)output_data) = glm::mat4(*((glm::vec4*)in_ptr_1), *((glm::vec4*)in_ptr_2), *((glm::vec4*)in_ptr_3), *((glm::vec4*)in_ptr_4));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        in_ptr_4 += in_stride_4;
+        output_data += output_stride;
+    }
+}
+
+static void mat4_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[16];
+    uint8_t *output_data = mathv_loop_range(loop, 16, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    int in_stride_4 = arg_stride[3];
+    uint8_t *in_ptr_4 = &arg_data[3][0];
+    int in_stride_5 = arg_stride[4];
+    uint8_t *in_ptr_5 = &arg_data[4][0];
+    int in_stride_6 = arg_stride[5];
+    uint8_t *in_ptr_6 = &arg_data[5][0];
+    int in_stride_7 = arg_stride[6];
+    uint8_t *in_ptr_7 = &arg_data[6][0];
+    int in_stride_8 = arg_stride[7];
+    uint8_t *in_ptr_8 = &arg_data[7][0];
+    int in_stride_9 = arg_stride[8];
+    uint8_t *in_ptr_9 = &arg_data[8][0];
+    int in_stride_10 = arg_stride[9];
+    uint8_t *in_ptr_10 = &arg_data[9][0];
+    int in_stride_11 = arg_stride[10];
+    uint8_t *in_ptr_11 = &arg_data[10][0];
+    int in_stride_12 = arg_stride[11];
+    uint8_t *in_ptr_12 = &arg_data[11][0];
+    int in_stride_13 = arg_stride[12];
+    uint8_t *in_ptr_13 = &arg_data[12][0];
+    int in_stride_14 = arg_stride[13];
+    uint8_t *in_ptr_14 = &arg_data[13][0];
+    int in_stride_15 = arg_stride[14];
+    uint8_t *in_ptr_15 = &arg_data[14][0];
+    int in_stride_16 = arg_stride[15];
+    uint8_t *in_ptr_16 = &arg_data[15][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat4*)output_data) = glm::dmat4(*((double*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3), *((double*)in_ptr_4), *((double*)in_ptr_5), *((double*)in_ptr_6), *((double*)in_ptr_7), *((double*)in_ptr_8), *((double*)in_ptr_9), *((double*)in_ptr_10), *((double*)in_ptr_11), *((double*)in_ptr_12), *((double*)in_ptr_13), *((double*)in_ptr_14), *((double*)in_ptr_15), *((double*)in_ptr_16));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        in_ptr_4 += in_stride_4;
+        in_ptr_5 += in_stride_5;
+        in_ptr_6 += in_stride_6;
+        in_ptr_7 += in_stride_7;
+        in_ptr_8 += in_stride_8;
+        in_ptr_9 += in_stride_9;
+        in_ptr_10 += in_stride_10;
+        in_ptr_11 += in_stride_11;
+        in_ptr_12 += in_stride_12;
+        in_ptr_13 += in_stride_13;
+        in_ptr_14 += in_stride_14;
+        in_ptr_15 += in_stride_15;
+        in_ptr_16 += in_stride_16;
+        output_data += output_stride;
+    }
+}
+
+static void mat4_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[4];
+    uint8_t *output_data = mathv_loop_range(loop, 4, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    int in_stride_3 = arg_stride[2];
+    uint8_t *in_ptr_3 = &arg_data[2][0];
+    int in_stride_4 = arg_stride[3];
+    uint8_t *in_ptr_4 = &arg_data[3][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat4*)output_data) = glm::dmat4(*((glm::dvec4*)in_ptr_1), *((glm::dvec4*)in_ptr_2), *((glm::dvec4*)in_ptr_3), *((glm::dvec4*)in_ptr_4));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        in_ptr_3 += in_stride_3;
+        in_ptr_4 += in_stride_4;
+        output_data += output_stride;
+    }
+}
+
 static int mat4_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 16) return luaL_error(L, "too many arguments for mathv.mat4");        uint8_t arg_singleton_scratch[16][16*8];
@@ -6059,58 +8222,8 @@ static int mat4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        int in_stride_4 = arg_stride[3];
-        uint8_t *in_ptr_4 = &arg_data[3][0];
-        int in_stride_5 = arg_stride[4];
-        uint8_t *in_ptr_5 = &arg_data[4][0];
-        int in_stride_6 = arg_stride[5];
-        uint8_t *in_ptr_6 = &arg_data[5][0];
-        int in_stride_7 = arg_stride[6];
-        uint8_t *in_ptr_7 = &arg_data[6][0];
-        int in_stride_8 = arg_stride[7];
-        uint8_t *in_ptr_8 = &arg_data[7][0];
-        int in_stride_9 = arg_stride[8];
-        uint8_t *in_ptr_9 = &arg_data[8][0];
-        int in_stride_10 = arg_stride[9];
-        uint8_t *in_ptr_10 = &arg_data[9][0];
-        int in_stride_11 = arg_stride[10];
-        uint8_t *in_ptr_11 = &arg_data[10][0];
-        int in_stride_12 = arg_stride[11];
-        uint8_t *in_ptr_12 = &arg_data[11][0];
-        int in_stride_13 = arg_stride[12];
-        uint8_t *in_ptr_13 = &arg_data[12][0];
-        int in_stride_14 = arg_stride[13];
-        uint8_t *in_ptr_14 = &arg_data[13][0];
-        int in_stride_15 = arg_stride[14];
-        uint8_t *in_ptr_15 = &arg_data[14][0];
-        int in_stride_16 = arg_stride[15];
-        uint8_t *in_ptr_16 = &arg_data[15][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat4*)output_data) = glm::mat4(*((float*)in_ptr_1), *((float*)in_ptr_2), *((float*)in_ptr_3), *((float*)in_ptr_4), *((float*)in_ptr_5), *((float*)in_ptr_6), *((float*)in_ptr_7), *((float*)in_ptr_8), *((float*)in_ptr_9), *((float*)in_ptr_10), *((float*)in_ptr_11), *((float*)in_ptr_12), *((float*)in_ptr_13), *((float*)in_ptr_14), *((float*)in_ptr_15), *((float*)in_ptr_16));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            in_ptr_4 += in_stride_4;
-            in_ptr_5 += in_stride_5;
-            in_ptr_6 += in_stride_6;
-            in_ptr_7 += in_stride_7;
-            in_ptr_8 += in_stride_8;
-            in_ptr_9 += in_stride_9;
-            in_ptr_10 += in_stride_10;
-            in_ptr_11 += in_stride_11;
-            in_ptr_12 += in_stride_12;
-            in_ptr_13 += in_stride_13;
-            in_ptr_14 += in_stride_14;
-            in_ptr_15 += in_stride_15;
-            in_ptr_16 += in_stride_16;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat4_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 4  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 4 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F32) || arg_type[2] != MT_am_buffer_view) && arg_components[3] == 4 && ((arg_type[3] == MT_am_buffer_view && arg_view_type[3] == AM_VIEW_TYPE_F32) || arg_type[3] != MT_am_buffer_view)) {
@@ -6122,22 +8235,8 @@ static int mat4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        int in_stride_4 = arg_stride[3];
-        uint8_t *in_ptr_4 = &arg_data[3][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat4*)output_data) = glm::mat4(*((glm::vec4*)in_ptr_1), *((glm::vec4*)in_ptr_2), *((glm::vec4*)in_ptr_3), *((glm::vec4*)in_ptr_4));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            in_ptr_4 += in_stride_4;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat4_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 16  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 1 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view) && arg_components[3] == 1 && ((arg_type[3] == MT_am_buffer_view && arg_view_type[3] == AM_VIEW_TYPE_F64) || arg_type[3] != MT_am_buffer_view) && arg_components[4] == 1 && ((arg_type[4] == MT_am_buffer_view && arg_view_type[4] == AM_VIEW_TYPE_F64) || arg_type[4] != MT_am_buffer_view) && arg_components[5] == 1 && ((arg_type[5] == MT_am_buffer_view && arg_view_type[5] == AM_VIEW_TYPE_F64) || arg_type[5] != MT_am_buffer_view) && arg_components[6] == 1 && ((arg_type[6] == MT_am_buffer_view && arg_view_type[6] == AM_VIEW_TYPE_F64) || arg_type[6] != MT_am_buffer_view) && arg_components[7] == 1 && ((arg_type[7] == MT_am_buffer_view && arg_view_type[7] == AM_VIEW_TYPE_F64) || arg_type[7] != MT_am_buffer_view) && arg_components[8] == 1 && ((arg_type[8] == MT_am_buffer_view && arg_view_type[8] == AM_VIEW_TYPE_F64) || arg_type[8] != MT_am_buffer_view) && arg_components[9] == 1 && ((arg_type[9] == MT_am_buffer_view && arg_view_type[9] == AM_VIEW_TYPE_F64) || arg_type[9] != MT_am_buffer_view) && arg_components[10] == 1 && ((arg_type[10] == MT_am_buffer_view && arg_view_type[10] == AM_VIEW_TYPE_F64) || arg_type[10] != MT_am_buffer_view) && arg_components[11] == 1 && ((arg_type[11] == MT_am_buffer_view && arg_view_type[11] == AM_VIEW_TYPE_F64) || arg_type[11] != MT_am_buffer_view) && arg_components[12] == 1 && ((arg_type[12] == MT_am_buffer_view && arg_view_type[12] == AM_VIEW_TYPE_F64) || arg_type[12] != MT_am_buffer_view) && arg_components[13] == 1 && ((arg_type[13] == MT_am_buffer_view && arg_view_type[13] == AM_VIEW_TYPE_F64) || arg_type[13] != MT_am_buffer_view) && arg_components[14] == 1 && ((arg_type[14] == MT_am_buffer_view && arg_view_type[14] == AM_VIEW_TYPE_F64) || arg_type[14] != MT_am_buffer_view) && arg_components[15] == 1 && ((arg_type[15] == MT_am_buffer_view && arg_view_type[15] == AM_VIEW_TYPE_F64) || arg_type[15] != MT_am_buffer_view)) {
@@ -6161,58 +8260,8 @@ static int mat4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        int in_stride_4 = arg_stride[3];
-        uint8_t *in_ptr_4 = &arg_data[3][0];
-        int in_stride_5 = arg_stride[4];
-        uint8_t *in_ptr_5 = &arg_data[4][0];
-        int in_stride_6 = arg_stride[5];
-        uint8_t *in_ptr_6 = &arg_data[5][0];
-        int in_stride_7 = arg_stride[6];
-        uint8_t *in_ptr_7 = &arg_data[6][0];
-        int in_stride_8 = arg_stride[7];
-        uint8_t *in_ptr_8 = &arg_data[7][0];
-        int in_stride_9 = arg_stride[8];
-        uint8_t *in_ptr_9 = &arg_data[8][0];
-        int in_stride_10 = arg_stride[9];
-        uint8_t *in_ptr_10 = &arg_data[9][0];
-        int in_stride_11 = arg_stride[10];
-        uint8_t *in_ptr_11 = &arg_data[10][0];
-        int in_stride_12 = arg_stride[11];
-        uint8_t *in_ptr_12 = &arg_data[11][0];
-        int in_stride_13 = arg_stride[12];
-        uint8_t *in_ptr_13 = &arg_data[12][0];
-        int in_stride_14 = arg_stride[13];
-        uint8_t *in_ptr_14 = &arg_data[13][0];
-        int in_stride_15 = arg_stride[14];
-        uint8_t *in_ptr_15 = &arg_data[14][0];
-        int in_stride_16 = arg_stride[15];
-        uint8_t *in_ptr_16 = &arg_data[15][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat4*)output_data) = glm::dmat4(*((double*)in_ptr_1), *((double*)in_ptr_2), *((double*)in_ptr_3), *((double*)in_ptr_4), *((double*)in_ptr_5), *((double*)in_ptr_6), *((double*)in_ptr_7), *((double*)in_ptr_8), *((double*)in_ptr_9), *((double*)in_ptr_10), *((double*)in_ptr_11), *((double*)in_ptr_12), *((double*)in_ptr_13), *((double*)in_ptr_14), *((double*)in_ptr_15), *((double*)in_ptr_16));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            in_ptr_4 += in_stride_4;
-            in_ptr_5 += in_stride_5;
-            in_ptr_6 += in_stride_6;
-            in_ptr_7 += in_stride_7;
-            in_ptr_8 += in_stride_8;
-            in_ptr_9 += in_stride_9;
-            in_ptr_10 += in_stride_10;
-            in_ptr_11 += in_stride_11;
-            in_ptr_12 += in_stride_12;
-            in_ptr_13 += in_stride_13;
-            in_ptr_14 += in_stride_14;
-            in_ptr_15 += in_stride_15;
-            in_ptr_16 += in_stride_16;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat4_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 4  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view) && arg_components[2] == 4 && ((arg_type[2] == MT_am_buffer_view && arg_view_type[2] == AM_VIEW_TYPE_F64) || arg_type[2] != MT_am_buffer_view) && arg_components[3] == 4 && ((arg_type[3] == MT_am_buffer_view && arg_view_type[3] == AM_VIEW_TYPE_F64) || arg_type[3] != MT_am_buffer_view)) {
@@ -6224,22 +8273,8 @@ static int mat4_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        int in_stride_3 = arg_stride[2];
-        uint8_t *in_ptr_3 = &arg_data[2][0];
-        int in_stride_4 = arg_stride[3];
-        uint8_t *in_ptr_4 = &arg_data[3][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat4*)output_data) = glm::dmat4(*((glm::dvec4*)in_ptr_1), *((glm::dvec4*)in_ptr_2), *((glm::dvec4*)in_ptr_3), *((glm::dvec4*)in_ptr_4));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            in_ptr_3 += in_stride_3;
-            in_ptr_4 += in_stride_4;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat4_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.mat4");
@@ -6257,6 +8292,386 @@ static int am_mathv_mat4_into(lua_State *L) {
     return mat4_impl(L, view);
 }
 
+static void mat_mul_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat4*)output_data) = MAT_MUL(*((glm::mat4*)in_ptr_1), *((glm::mat4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = MAT_MUL(*((glm::mat4*)in_ptr_1), *((glm::vec4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = MAT_MUL(*((glm::vec4*)in_ptr_1), *((glm::mat4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat4*)output_data) = MAT_MUL(*((float*)in_ptr_1), *((glm::mat4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat4*)output_data) = MAT_MUL(*((glm::mat4*)in_ptr_1), *((float*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat3*)output_data) = MAT_MUL(*((glm::mat3*)in_ptr_1), *((glm::mat3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec3*)output_data) = MAT_MUL(*((glm::mat3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec3*)output_data) = MAT_MUL(*((glm::vec3*)in_ptr_1), *((glm::mat3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop9(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat3*)output_data) = MAT_MUL(*((float*)in_ptr_1), *((glm::mat3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop10(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat3*)output_data) = MAT_MUL(*((glm::mat3*)in_ptr_1), *((float*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop11(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat4*)output_data) = MAT_MUL(*((glm::dmat4*)in_ptr_1), *((glm::dmat4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop12(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = MAT_MUL(*((glm::dmat4*)in_ptr_1), *((glm::dvec4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop13(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = MAT_MUL(*((glm::dvec4*)in_ptr_1), *((glm::dmat4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop14(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat4*)output_data) = MAT_MUL(*((double*)in_ptr_1), *((glm::dmat4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop15(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat4*)output_data) = MAT_MUL(*((glm::dmat4*)in_ptr_1), *((double*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop16(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat3*)output_data) = MAT_MUL(*((glm::dmat3*)in_ptr_1), *((glm::dmat3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop17(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec3*)output_data) = MAT_MUL(*((glm::dmat3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop18(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec3*)output_data) = MAT_MUL(*((glm::dvec3*)in_ptr_1), *((glm::dmat3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop19(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat3*)output_data) = MAT_MUL(*((double*)in_ptr_1), *((glm::dmat3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void mat_mul_loop20(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat3*)output_data) = MAT_MUL(*((glm::dmat3*)in_ptr_1), *((double*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
 static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.mat_mul");        uint8_t arg_singleton_scratch[2][16*8];
@@ -6286,16 +8701,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat4*)output_data) = MAT_MUL(*((glm::mat4*)in_ptr_1), *((glm::mat4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 16 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6305,16 +8712,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = MAT_MUL(*((glm::mat4*)in_ptr_1), *((glm::vec4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 16 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6324,16 +8723,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = MAT_MUL(*((glm::vec4*)in_ptr_1), *((glm::mat4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 16 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6343,16 +8734,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat4*)output_data) = MAT_MUL(*((float*)in_ptr_1), *((glm::mat4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 16 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6362,16 +8745,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat4*)output_data) = MAT_MUL(*((glm::mat4*)in_ptr_1), *((float*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 9 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 9 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6381,16 +8756,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat3*)output_data) = MAT_MUL(*((glm::mat3*)in_ptr_1), *((glm::mat3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 9 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6400,16 +8767,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec3*)output_data) = MAT_MUL(*((glm::mat3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 9 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6419,16 +8778,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec3*)output_data) = MAT_MUL(*((glm::vec3*)in_ptr_1), *((glm::mat3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 9 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6438,16 +8789,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat3*)output_data) = MAT_MUL(*((float*)in_ptr_1), *((glm::mat3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop9, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 9 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6457,16 +8800,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat3*)output_data) = MAT_MUL(*((glm::mat3*)in_ptr_1), *((float*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop10, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 16 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 16 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6476,16 +8811,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat4*)output_data) = MAT_MUL(*((glm::dmat4*)in_ptr_1), *((glm::dmat4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop11, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 16 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6495,16 +8822,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = MAT_MUL(*((glm::dmat4*)in_ptr_1), *((glm::dvec4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop12, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 16 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6514,16 +8833,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = MAT_MUL(*((glm::dvec4*)in_ptr_1), *((glm::dmat4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop13, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 16 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6533,16 +8844,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat4*)output_data) = MAT_MUL(*((double*)in_ptr_1), *((glm::dmat4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop14, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 16 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6552,16 +8855,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat4*)output_data) = MAT_MUL(*((glm::dmat4*)in_ptr_1), *((double*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop15, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 9 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 9 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6571,16 +8866,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat3*)output_data) = MAT_MUL(*((glm::dmat3*)in_ptr_1), *((glm::dmat3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop16, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 9 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6590,16 +8877,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec3*)output_data) = MAT_MUL(*((glm::dmat3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop17, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 9 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6609,16 +8888,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec3*)output_data) = MAT_MUL(*((glm::dvec3*)in_ptr_1), *((glm::dmat3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop18, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 9 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6628,16 +8899,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat3*)output_data) = MAT_MUL(*((double*)in_ptr_1), *((glm::dmat3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop19, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 9 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6647,16 +8910,8 @@ static int mat_mul_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat3*)output_data) = MAT_MUL(*((glm::dmat3*)in_ptr_1), *((double*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(mat_mul_loop20, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.mat_mul");
@@ -6674,6 +8929,48 @@ static int am_mathv_mat_mul_into(lua_State *L) {
     return mat_mul_impl(L, view);
 }
 
+static void cross_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->cross3_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count, loop->simd_bcast);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec3*)output_data) = glm::cross(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void cross_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec3*)output_data) = glm::cross(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
 static int cross_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.cross");        uint8_t arg_singleton_scratch[2][16*8];
@@ -6693,6 +8990,7 @@ static int cross_impl(lua_State *L, am_buffer_view *target) {
     unsigned int output_stride;
     uint8_t *output_data;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     element_wise_setup(L, "mathv.cross", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count);
@@ -6703,16 +9001,9 @@ static int cross_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec3*)output_data) = glm::cross(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(cross_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6722,16 +9013,8 @@ static int cross_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec3*)output_data) = glm::cross(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(cross_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.cross");
@@ -6749,6 +9032,120 @@ static int am_mathv_cross_into(lua_State *L) {
     return cross_impl(L, view);
 }
 
+static void distance_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::distance(*((glm::vec2*)in_ptr_1), *((glm::vec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void distance_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::distance(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void distance_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::distance(*((glm::vec4*)in_ptr_1), *((glm::vec4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void distance_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::distance(*((glm::dvec2*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void distance_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::distance(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void distance_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::distance(*((glm::dvec4*)in_ptr_1), *((glm::dvec4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
 static int distance_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.distance");        uint8_t arg_singleton_scratch[2][16*8];
@@ -6778,16 +9175,8 @@ static int distance_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::distance(*((glm::vec2*)in_ptr_1), *((glm::vec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(distance_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6797,16 +9186,8 @@ static int distance_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::distance(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(distance_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6816,16 +9197,8 @@ static int distance_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::distance(*((glm::vec4*)in_ptr_1), *((glm::vec4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(distance_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6835,16 +9208,8 @@ static int distance_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::distance(*((glm::dvec2*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(distance_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6854,16 +9219,8 @@ static int distance_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::distance(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(distance_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6873,16 +9230,8 @@ static int distance_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::distance(*((glm::dvec4*)in_ptr_1), *((glm::dvec4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(distance_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.distance");
@@ -6900,6 +9249,132 @@ static int am_mathv_distance_into(lua_State *L) {
     return distance_impl(L, view);
 }
 
+static void dot_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->dot2_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count, loop->simd_bcast);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::dot(*((glm::vec2*)in_ptr_1), *((glm::vec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void dot_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->dot3_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count, loop->simd_bcast);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::dot(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void dot_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->dot4_f32((float*)output_data, (const float*)arg_data[0], (const float*)arg_data[1], output_count, loop->simd_bcast);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::dot(*((glm::vec4*)in_ptr_1), *((glm::vec4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void dot_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::dot(*((glm::dvec2*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void dot_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::dot(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void dot_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::dot(*((glm::dvec4*)in_ptr_1), *((glm::dvec4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
 static int dot_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.dot");        uint8_t arg_singleton_scratch[2][16*8];
@@ -6919,6 +9394,7 @@ static int dot_impl(lua_State *L, am_buffer_view *target) {
     unsigned int output_stride;
     uint8_t *output_data;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     element_wise_setup(L, "mathv.dot", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count);
@@ -6929,16 +9405,9 @@ static int dot_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::dot(*((glm::vec2*)in_ptr_1), *((glm::vec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(dot_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6948,16 +9417,9 @@ static int dot_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::dot(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(dot_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -6967,16 +9429,9 @@ static int dot_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::dot(*((glm::vec4*)in_ptr_1), *((glm::vec4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(dot_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -6986,16 +9441,8 @@ static int dot_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::dot(*((glm::dvec2*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(dot_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -7005,16 +9452,8 @@ static int dot_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::dot(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(dot_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -7024,16 +9463,8 @@ static int dot_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::dot(*((glm::dvec4*)in_ptr_1), *((glm::dvec4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(dot_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.dot");
@@ -7051,6 +9482,70 @@ static int am_mathv_dot_into(lua_State *L) {
     return dot_impl(L, view);
 }
 
+static void inverse_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat3*)output_data) = glm::inverse(*((glm::mat3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void inverse_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::mat4*)output_data) = glm::inverse(*((glm::mat4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void inverse_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat3*)output_data) = glm::inverse(*((glm::dmat3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void inverse_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dmat4*)output_data) = glm::inverse(*((glm::dmat4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
 static int inverse_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.inverse");        uint8_t arg_singleton_scratch[1][16*8];
@@ -7079,13 +9574,8 @@ static int inverse_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat3*)output_data) = glm::inverse(*((glm::mat3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(inverse_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 16 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7094,13 +9584,8 @@ static int inverse_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::mat4*)output_data) = glm::inverse(*((glm::mat4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(inverse_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 9 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7109,13 +9594,8 @@ static int inverse_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 9;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat3*)output_data) = glm::inverse(*((glm::dmat3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(inverse_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 16 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7124,13 +9604,8 @@ static int inverse_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 16;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dmat4*)output_data) = glm::inverse(*((glm::dmat4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(inverse_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.inverse");
@@ -7148,6 +9623,114 @@ static int am_mathv_inverse_into(lua_State *L) {
     return inverse_impl(L, view);
 }
 
+static void length_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->length2_f32((float*)output_data, (const float*)arg_data[0], output_count);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::length(*((glm::vec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void length_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->length3_f32((float*)output_data, (const float*)arg_data[0], output_count);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::length(*((glm::vec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void length_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->length4_f32((float*)output_data, (const float*)arg_data[0], output_count);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::length(*((glm::vec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void length_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::length(*((glm::dvec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void length_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::length(*((glm::dvec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void length_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::length(*((glm::dvec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
 static int length_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.length");        uint8_t arg_singleton_scratch[1][16*8];
@@ -7167,6 +9750,7 @@ static int length_impl(lua_State *L, am_buffer_view *target) {
     unsigned int output_stride;
     uint8_t *output_data;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     element_wise_setup(L, "mathv.length", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count);
@@ -7176,13 +9760,9 @@ static int length_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::length(*((glm::vec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(length_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7191,13 +9771,9 @@ static int length_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::length(*((glm::vec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(length_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7206,13 +9782,9 @@ static int length_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::length(*((glm::vec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(length_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7221,13 +9793,8 @@ static int length_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::length(*((glm::dvec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(length_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7236,13 +9803,8 @@ static int length_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::length(*((glm::dvec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(length_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7251,13 +9813,8 @@ static int length_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::length(*((glm::dvec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(length_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.length");
@@ -7275,6 +9832,114 @@ static int am_mathv_length_into(lua_State *L) {
     return length_impl(L, view);
 }
 
+static void normalize_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->normalize2_f32((float*)output_data, (const float*)arg_data[0], output_count);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec2*)output_data) = glm::normalize(*((glm::vec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void normalize_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->normalize3_f32((float*)output_data, (const float*)arg_data[0], output_count);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec3*)output_data) = glm::normalize(*((glm::vec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void normalize_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    if (loop->use_simd) {
+        am_mathv_simd->normalize4_f32((float*)output_data, (const float*)arg_data[0], output_count);
+        return;
+    }
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::vec4*)output_data) = glm::normalize(*((glm::vec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void normalize_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec2*)output_data) = glm::normalize(*((glm::dvec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void normalize_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec3*)output_data) = glm::normalize(*((glm::dvec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void normalize_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((glm::dvec4*)output_data) = glm::normalize(*((glm::dvec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
 static int normalize_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.normalize");        uint8_t arg_singleton_scratch[1][16*8];
@@ -7294,6 +9959,7 @@ static int normalize_impl(lua_State *L, am_buffer_view *target) {
     unsigned int output_stride;
     uint8_t *output_data;
     bool output_is_dense;
+    unsigned int simd_bcast = 0;
     element_wise_setup(L, "mathv.normalize", nargs, 
         arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
         &output_count);
@@ -7303,13 +9969,9 @@ static int normalize_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 2;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec2*)output_data) = glm::normalize(*((glm::vec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(normalize_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7318,13 +9980,9 @@ static int normalize_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec3*)output_data) = glm::normalize(*((glm::vec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(normalize_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7333,13 +9991,9 @@ static int normalize_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::vec4*)output_data) = glm::normalize(*((glm::vec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);
+        run_mathv_loop(normalize_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, use_simd, simd_bcast);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7348,13 +10002,8 @@ static int normalize_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 2;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec2*)output_data) = glm::normalize(*((glm::dvec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(normalize_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7363,13 +10012,8 @@ static int normalize_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 3;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec3*)output_data) = glm::normalize(*((glm::dvec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(normalize_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7378,13 +10022,8 @@ static int normalize_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 4;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((glm::dvec4*)output_data) = glm::normalize(*((glm::dvec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(normalize_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.normalize");
@@ -7402,6 +10041,286 @@ static int am_mathv_normalize_into(lua_State *L) {
     return normalize_impl(L, view);
 }
 
+static void perlin_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = PERLIN1_F32(*((float*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::perlin(*((glm::vec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::perlin(*((glm::vec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::perlin(*((glm::vec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = PERLIN2_F32(*((float*)in_ptr_1), *((float*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::perlin(*((glm::vec2*)in_ptr_1), *((glm::vec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::perlin(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::perlin(*((glm::vec4*)in_ptr_1), *((glm::vec4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop9(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = PERLIN1_F64(*((double*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop10(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::perlin(*((glm::dvec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop11(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::perlin(*((glm::dvec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop12(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::perlin(*((glm::dvec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop13(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = PERLIN2_F64(*((double*)in_ptr_1), *((double*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop14(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::perlin(*((glm::dvec2*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop15(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::perlin(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
+static void perlin_loop16(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[2];
+    uint8_t *output_data = mathv_loop_range(loop, 2, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    int in_stride_2 = arg_stride[1];
+    uint8_t *in_ptr_2 = &arg_data[1][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = glm::perlin(*((glm::dvec4*)in_ptr_1), *((glm::dvec4*)in_ptr_2));
+        in_ptr_1 += in_stride_1;
+        in_ptr_2 += in_stride_2;
+        output_data += output_stride;
+    }
+}
+
 static int perlin_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 2) return luaL_error(L, "too many arguments for mathv.perlin");        uint8_t arg_singleton_scratch[2][16*8];
@@ -7430,13 +10349,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = PERLIN1_F32(*((float*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7445,13 +10359,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::perlin(*((glm::vec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7460,13 +10369,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::perlin(*((glm::vec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7475,13 +10379,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::perlin(*((glm::vec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -7491,16 +10390,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = PERLIN2_F32(*((float*)in_ptr_1), *((float*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -7510,16 +10401,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::perlin(*((glm::vec2*)in_ptr_1), *((glm::vec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -7529,16 +10412,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::perlin(*((glm::vec3*)in_ptr_1), *((glm::vec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F32) || arg_type[1] != MT_am_buffer_view)) {
@@ -7548,16 +10423,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::perlin(*((glm::vec4*)in_ptr_1), *((glm::vec4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7566,13 +10433,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = PERLIN1_F64(*((double*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop9, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7581,13 +10443,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::perlin(*((glm::dvec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop10, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7596,13 +10453,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::perlin(*((glm::dvec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop11, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7611,13 +10463,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::perlin(*((glm::dvec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop12, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 1 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -7627,16 +10474,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = PERLIN2_F64(*((double*)in_ptr_1), *((double*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop13, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 2 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -7646,16 +10485,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::perlin(*((glm::dvec2*)in_ptr_1), *((glm::dvec2*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop14, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 3 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -7665,16 +10496,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::perlin(*((glm::dvec3*)in_ptr_1), *((glm::dvec3*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop15, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 2  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view) && arg_components[1] == 4 && ((arg_type[1] == MT_am_buffer_view && arg_view_type[1] == AM_VIEW_TYPE_F64) || arg_type[1] != MT_am_buffer_view)) {
@@ -7684,16 +10507,8 @@ static int perlin_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        int in_stride_2 = arg_stride[1];
-        uint8_t *in_ptr_2 = &arg_data[1][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = glm::perlin(*((glm::dvec4*)in_ptr_1), *((glm::dvec4*)in_ptr_2));
-            in_ptr_1 += in_stride_1;
-            in_ptr_2 += in_stride_2;
-            output_data += output_stride;
-        }
+        run_mathv_loop(perlin_loop16, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.perlin");
@@ -7711,6 +10526,134 @@ static int am_mathv_perlin_into(lua_State *L) {
     return perlin_impl(L, view);
 }
 
+static void simplex_loop1(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = SIMPLEX1_F32(*((float*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void simplex_loop2(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::simplex(*((glm::vec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void simplex_loop3(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::simplex(*((glm::vec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void simplex_loop4(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((float*)output_data) = glm::simplex(*((glm::vec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void simplex_loop5(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = SIMPLEX1_F64(*((double*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void simplex_loop6(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = SIMPLEX2_F64(*((glm::dvec2*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void simplex_loop7(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = SIMPLEX3_F64(*((glm::dvec3*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
+static void simplex_loop8(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[1];
+    uint8_t *output_data = mathv_loop_range(loop, 1, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    int in_stride_1 = arg_stride[0];
+    uint8_t *in_ptr_1 = &arg_data[0][0];
+    for (unsigned int i = 0; i < output_count; ++i) {
+        *((double*)output_data) = SIMPLEX4_F64(*((glm::dvec4*)in_ptr_1));
+        in_ptr_1 += in_stride_1;
+        output_data += output_stride;
+    }
+}
+
 static int simplex_impl(lua_State *L, am_buffer_view *target) {
     int nargs = lua_gettop(L) - (target == NULL ? 0 : 1);
     if (nargs > 1) return luaL_error(L, "too many arguments for mathv.simplex");        uint8_t arg_singleton_scratch[1][16*8];
@@ -7739,13 +10682,8 @@ static int simplex_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = SIMPLEX1_F32(*((float*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(simplex_loop1, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7754,13 +10692,8 @@ static int simplex_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::simplex(*((glm::vec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(simplex_loop2, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7769,13 +10702,8 @@ static int simplex_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::simplex(*((glm::vec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(simplex_loop3, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F32) || arg_type[0] != MT_am_buffer_view)) {
@@ -7784,13 +10712,8 @@ static int simplex_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F32;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((float*)output_data) = glm::simplex(*((glm::vec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(simplex_loop4, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 1 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7799,13 +10722,8 @@ static int simplex_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = SIMPLEX1_F64(*((double*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(simplex_loop5, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 2 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7814,13 +10732,8 @@ static int simplex_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = SIMPLEX2_F64(*((glm::dvec2*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(simplex_loop6, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 3 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7829,13 +10742,8 @@ static int simplex_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = SIMPLEX3_F64(*((glm::dvec3*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(simplex_loop7, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     if (nargs == 1  && arg_components[0] == 4 && ((arg_type[0] == MT_am_buffer_view && arg_view_type[0] == AM_VIEW_TYPE_F64) || arg_type[0] != MT_am_buffer_view)) {
@@ -7844,13 +10752,8 @@ static int simplex_impl(lua_State *L, am_buffer_view *target) {
         output_view_type = AM_VIEW_TYPE_F64;
         output_components = 1;
         create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);
-        int in_stride_1 = arg_stride[0];
-        uint8_t *in_ptr_1 = &arg_data[0][0];
-        for (unsigned int i = 0; i < output_count; ++i) {
-            *((double*)output_data) = SIMPLEX4_F64(*((glm::dvec4*)in_ptr_1));
-            in_ptr_1 += in_stride_1;
-            output_data += output_stride;
-        }
+        run_mathv_loop(simplex_loop8, arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,
+            false, false, 0);
         return 1;
     }
     return luaL_error(L, "invalid argument types for function mathv.simplex");
@@ -7892,6 +10795,421 @@ static int am_mathv_eq_into(lua_State *L) {
     return eq_impl(L, view);
 }
 
+static const mathv_op_variant add_variants[] = {
+    {add_loop1, AM_VIEW_TYPE_F32, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {add_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {add_loop3, AM_VIEW_TYPE_I8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {add_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {add_loop5, AM_VIEW_TYPE_I16, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {add_loop6, AM_VIEW_TYPE_U16, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {add_loop7, AM_VIEW_TYPE_I32, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+    {add_loop8, AM_VIEW_TYPE_U32, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+};
+
+static const mathv_op_variant sub_variants[] = {
+    {sub_loop1, AM_VIEW_TYPE_F32, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {sub_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {sub_loop3, AM_VIEW_TYPE_I8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {sub_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {sub_loop5, AM_VIEW_TYPE_I16, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {sub_loop6, AM_VIEW_TYPE_U16, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {sub_loop7, AM_VIEW_TYPE_I32, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+    {sub_loop8, AM_VIEW_TYPE_U32, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+};
+
+static const mathv_op_variant vec_mul_variants[] = {
+    {vec_mul_loop1, AM_VIEW_TYPE_F32, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {vec_mul_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {vec_mul_loop3, AM_VIEW_TYPE_I8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {vec_mul_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {vec_mul_loop5, AM_VIEW_TYPE_I16, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {vec_mul_loop6, AM_VIEW_TYPE_U16, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {vec_mul_loop7, AM_VIEW_TYPE_I32, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+    {vec_mul_loop8, AM_VIEW_TYPE_U32, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+};
+
+static const mathv_op_variant div_variants[] = {
+    {div_loop1, AM_VIEW_TYPE_F32, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {div_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {div_loop3, AM_VIEW_TYPE_I8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {div_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {div_loop5, AM_VIEW_TYPE_I16, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {div_loop6, AM_VIEW_TYPE_U16, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {div_loop7, AM_VIEW_TYPE_I32, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+    {div_loop8, AM_VIEW_TYPE_U32, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+};
+
+static const mathv_op_variant mod_variants[] = {
+    {mod_loop1, AM_VIEW_TYPE_F32, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {mod_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {mod_loop3, AM_VIEW_TYPE_I8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {mod_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {mod_loop5, AM_VIEW_TYPE_I16, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {mod_loop6, AM_VIEW_TYPE_U16, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {mod_loop7, AM_VIEW_TYPE_I32, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+    {mod_loop8, AM_VIEW_TYPE_U32, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+};
+
+static const mathv_op_variant pow_variants[] = {
+    {pow_loop1, AM_VIEW_TYPE_F32, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {pow_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant unm_variants[] = {
+    {unm_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {unm_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+    {unm_loop3, AM_VIEW_TYPE_I8, 0, false, 1, {{AM_VIEW_TYPE_I8, 0}}},
+    {unm_loop4, AM_VIEW_TYPE_U8, 0, false, 1, {{AM_VIEW_TYPE_U8, 0}}},
+    {unm_loop5, AM_VIEW_TYPE_I16, 0, false, 1, {{AM_VIEW_TYPE_I16, 0}}},
+    {unm_loop6, AM_VIEW_TYPE_U16, 0, false, 1, {{AM_VIEW_TYPE_U16, 0}}},
+    {unm_loop7, AM_VIEW_TYPE_I32, 0, false, 1, {{AM_VIEW_TYPE_I32, 0}}},
+    {unm_loop8, AM_VIEW_TYPE_U32, 0, false, 1, {{AM_VIEW_TYPE_U32, 0}}},
+};
+
+static const mathv_op_variant abs_variants[] = {
+    {abs_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {abs_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant acos_variants[] = {
+    {acos_loop1, AM_VIEW_TYPE_F32, 0, false, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {acos_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant asin_variants[] = {
+    {asin_loop1, AM_VIEW_TYPE_F32, 0, false, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {asin_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant atan_variants[] = {
+    {atan_loop1, AM_VIEW_TYPE_F32, 0, false, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {atan_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant atan2_variants[] = {
+    {atan2_loop1, AM_VIEW_TYPE_F32, 0, false, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {atan2_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant ceil_variants[] = {
+    {ceil_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {ceil_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant clamp_variants[] = {
+    {clamp_loop1, AM_VIEW_TYPE_F32, 0, true, 3, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {clamp_loop2, AM_VIEW_TYPE_F64, 0, false, 3, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant cos_variants[] = {
+    {cos_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {cos_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant floor_variants[] = {
+    {floor_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {floor_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant fract_variants[] = {
+    {fract_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {fract_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant log_variants[] = {
+    {log_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {log_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant max_variants[] = {
+    {max_loop1, AM_VIEW_TYPE_F32, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {max_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant min_variants[] = {
+    {min_loop1, AM_VIEW_TYPE_F32, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {min_loop2, AM_VIEW_TYPE_F64, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant mix_variants[] = {
+    {mix_loop1, AM_VIEW_TYPE_F32, 0, true, 3, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {mix_loop2, AM_VIEW_TYPE_F64, 0, false, 3, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant sign_variants[] = {
+    {sign_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {sign_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant sin_variants[] = {
+    {sin_loop1, AM_VIEW_TYPE_F32, 0, true, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {sin_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant tan_variants[] = {
+    {tan_loop1, AM_VIEW_TYPE_F32, 0, false, 1, {{AM_VIEW_TYPE_F32, 0}}},
+    {tan_loop2, AM_VIEW_TYPE_F64, 0, false, 1, {{AM_VIEW_TYPE_F64, 0}}},
+};
+
+static const mathv_op_variant lt_variants[] = {
+    {lt_loop1, AM_VIEW_TYPE_U8, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {lt_loop2, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {lt_loop3, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {lt_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {lt_loop5, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {lt_loop6, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {lt_loop7, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+    {lt_loop8, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+};
+
+static const mathv_op_variant lte_variants[] = {
+    {lte_loop1, AM_VIEW_TYPE_U8, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {lte_loop2, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {lte_loop3, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {lte_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {lte_loop5, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {lte_loop6, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {lte_loop7, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+    {lte_loop8, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+};
+
+static const mathv_op_variant gt_variants[] = {
+    {gt_loop1, AM_VIEW_TYPE_U8, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {gt_loop2, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {gt_loop3, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {gt_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {gt_loop5, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {gt_loop6, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {gt_loop7, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+    {gt_loop8, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+};
+
+static const mathv_op_variant gte_variants[] = {
+    {gte_loop1, AM_VIEW_TYPE_U8, 0, true, 2, {{AM_VIEW_TYPE_F32, 0}, {AM_VIEW_TYPE_F32, 0}}},
+    {gte_loop2, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_F64, 0}, {AM_VIEW_TYPE_F64, 0}}},
+    {gte_loop3, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+    {gte_loop4, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I8, 0}, {AM_VIEW_TYPE_I8, 0}}},
+    {gte_loop5, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U16, 0}, {AM_VIEW_TYPE_U16, 0}}},
+    {gte_loop6, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I16, 0}, {AM_VIEW_TYPE_I16, 0}}},
+    {gte_loop7, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U32, 0}, {AM_VIEW_TYPE_U32, 0}}},
+    {gte_loop8, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_I32, 0}, {AM_VIEW_TYPE_I32, 0}}},
+};
+
+static const mathv_op_variant and__variants[] = {
+    {and__loop1, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+};
+
+static const mathv_op_variant or__variants[] = {
+    {or__loop1, AM_VIEW_TYPE_U8, 0, false, 2, {{AM_VIEW_TYPE_U8, 0}, {AM_VIEW_TYPE_U8, 0}}},
+};
+
+static const mathv_op_variant not__variants[] = {
+    {not__loop1, AM_VIEW_TYPE_U8, 0, false, 1, {{AM_VIEW_TYPE_U8, 0}}},
+};
+
+static const mathv_op_variant vec2_variants[] = {
+    {vec2_loop1, AM_VIEW_TYPE_F32, 2, false, 2, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}}},
+    {vec2_loop2, AM_VIEW_TYPE_F32, 2, false, 1, {{AM_VIEW_TYPE_F32, 2}}},
+    {vec2_loop3, AM_VIEW_TYPE_F64, 2, false, 2, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}}},
+    {vec2_loop4, AM_VIEW_TYPE_F64, 2, false, 1, {{AM_VIEW_TYPE_F64, 2}}},
+};
+
+static const mathv_op_variant vec3_variants[] = {
+    {vec3_loop1, AM_VIEW_TYPE_F32, 3, false, 3, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}}},
+    {vec3_loop2, AM_VIEW_TYPE_F32, 3, false, 2, {{AM_VIEW_TYPE_F32, 2}, {AM_VIEW_TYPE_F32, 1}}},
+    {vec3_loop3, AM_VIEW_TYPE_F32, 3, false, 2, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 2}}},
+    {vec3_loop4, AM_VIEW_TYPE_F32, 3, false, 1, {{AM_VIEW_TYPE_F32, 3}}},
+    {vec3_loop5, AM_VIEW_TYPE_F64, 3, false, 3, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}}},
+    {vec3_loop6, AM_VIEW_TYPE_F64, 3, false, 2, {{AM_VIEW_TYPE_F64, 2}, {AM_VIEW_TYPE_F64, 1}}},
+    {vec3_loop7, AM_VIEW_TYPE_F64, 3, false, 2, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 2}}},
+    {vec3_loop8, AM_VIEW_TYPE_F64, 3, false, 1, {{AM_VIEW_TYPE_F64, 3}}},
+};
+
+static const mathv_op_variant vec4_variants[] = {
+    {vec4_loop1, AM_VIEW_TYPE_F32, 4, false, 4, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}}},
+    {vec4_loop2, AM_VIEW_TYPE_F32, 4, false, 2, {{AM_VIEW_TYPE_F32, 3}, {AM_VIEW_TYPE_F32, 1}}},
+    {vec4_loop3, AM_VIEW_TYPE_F32, 4, false, 2, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 3}}},
+    {vec4_loop4, AM_VIEW_TYPE_F32, 4, false, 2, {{AM_VIEW_TYPE_F32, 2}, {AM_VIEW_TYPE_F32, 2}}},
+    {vec4_loop5, AM_VIEW_TYPE_F32, 4, false, 3, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 2}}},
+    {vec4_loop6, AM_VIEW_TYPE_F32, 4, false, 3, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 2}, {AM_VIEW_TYPE_F32, 1}}},
+    {vec4_loop7, AM_VIEW_TYPE_F32, 4, false, 3, {{AM_VIEW_TYPE_F32, 2}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}}},
+    {vec4_loop8, AM_VIEW_TYPE_F32, 4, false, 1, {{AM_VIEW_TYPE_F32, 4}}},
+    {vec4_loop9, AM_VIEW_TYPE_F64, 4, false, 4, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}}},
+    {vec4_loop10, AM_VIEW_TYPE_F64, 4, false, 2, {{AM_VIEW_TYPE_F64, 3}, {AM_VIEW_TYPE_F64, 1}}},
+    {vec4_loop11, AM_VIEW_TYPE_F64, 4, false, 2, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 3}}},
+    {vec4_loop12, AM_VIEW_TYPE_F64, 4, false, 2, {{AM_VIEW_TYPE_F64, 2}, {AM_VIEW_TYPE_F64, 2}}},
+    {vec4_loop13, AM_VIEW_TYPE_F64, 4, false, 3, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 2}}},
+    {vec4_loop14, AM_VIEW_TYPE_F64, 4, false, 3, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 2}, {AM_VIEW_TYPE_F64, 1}}},
+    {vec4_loop15, AM_VIEW_TYPE_F64, 4, false, 3, {{AM_VIEW_TYPE_F64, 2}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}}},
+    {vec4_loop16, AM_VIEW_TYPE_F64, 4, false, 1, {{AM_VIEW_TYPE_F64, 4}}},
+};
+
+static const mathv_op_variant mat3_variants[] = {
+    {mat3_loop1, AM_VIEW_TYPE_F32, 9, false, 9, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}}},
+    {mat3_loop2, AM_VIEW_TYPE_F32, 9, false, 3, {{AM_VIEW_TYPE_F32, 3}, {AM_VIEW_TYPE_F32, 3}, {AM_VIEW_TYPE_F32, 3}}},
+    {mat3_loop3, AM_VIEW_TYPE_F64, 9, false, 9, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}}},
+    {mat3_loop4, AM_VIEW_TYPE_F64, 9, false, 3, {{AM_VIEW_TYPE_F64, 3}, {AM_VIEW_TYPE_F64, 3}, {AM_VIEW_TYPE_F64, 3}}},
+};
+
+static const mathv_op_variant mat4_variants[] = {
+    {mat4_loop1, AM_VIEW_TYPE_F32, 16, false, 16, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}}},
+    {mat4_loop2, AM_VIEW_TYPE_F32, 16, false, 4, {{AM_VIEW_TYPE_F32, 4}, {AM_VIEW_TYPE_F32, 4}, {AM_VIEW_TYPE_F32, 4}, {AM_VIEW_TYPE_F32, 4}}},
+    {mat4_loop3, AM_VIEW_TYPE_F64, 16, false, 16, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}}},
+    {mat4_loop4, AM_VIEW_TYPE_F64, 16, false, 4, {{AM_VIEW_TYPE_F64, 4}, {AM_VIEW_TYPE_F64, 4}, {AM_VIEW_TYPE_F64, 4}, {AM_VIEW_TYPE_F64, 4}}},
+};
+
+static const mathv_op_variant mat_mul_variants[] = {
+    {mat_mul_loop1, AM_VIEW_TYPE_F32, 16, false, 2, {{AM_VIEW_TYPE_F32, 16}, {AM_VIEW_TYPE_F32, 16}}},
+    {mat_mul_loop2, AM_VIEW_TYPE_F32, 4, false, 2, {{AM_VIEW_TYPE_F32, 16}, {AM_VIEW_TYPE_F32, 4}}},
+    {mat_mul_loop3, AM_VIEW_TYPE_F32, 4, false, 2, {{AM_VIEW_TYPE_F32, 4}, {AM_VIEW_TYPE_F32, 16}}},
+    {mat_mul_loop4, AM_VIEW_TYPE_F32, 16, false, 2, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 16}}},
+    {mat_mul_loop5, AM_VIEW_TYPE_F32, 16, false, 2, {{AM_VIEW_TYPE_F32, 16}, {AM_VIEW_TYPE_F32, 1}}},
+    {mat_mul_loop6, AM_VIEW_TYPE_F32, 9, false, 2, {{AM_VIEW_TYPE_F32, 9}, {AM_VIEW_TYPE_F32, 9}}},
+    {mat_mul_loop7, AM_VIEW_TYPE_F32, 3, false, 2, {{AM_VIEW_TYPE_F32, 9}, {AM_VIEW_TYPE_F32, 3}}},
+    {mat_mul_loop8, AM_VIEW_TYPE_F32, 3, false, 2, {{AM_VIEW_TYPE_F32, 3}, {AM_VIEW_TYPE_F32, 9}}},
+    {mat_mul_loop9, AM_VIEW_TYPE_F32, 9, false, 2, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 9}}},
+    {mat_mul_loop10, AM_VIEW_TYPE_F32, 9, false, 2, {{AM_VIEW_TYPE_F32, 9}, {AM_VIEW_TYPE_F32, 1}}},
+    {mat_mul_loop11, AM_VIEW_TYPE_F64, 16, false, 2, {{AM_VIEW_TYPE_F64, 16}, {AM_VIEW_TYPE_F64, 16}}},
+    {mat_mul_loop12, AM_VIEW_TYPE_F64, 4, false, 2, {{AM_VIEW_TYPE_F64, 16}, {AM_VIEW_TYPE_F64, 4}}},
+    {mat_mul_loop13, AM_VIEW_TYPE_F64, 4, false, 2, {{AM_VIEW_TYPE_F64, 4}, {AM_VIEW_TYPE_F64, 16}}},
+    {mat_mul_loop14, AM_VIEW_TYPE_F64, 16, false, 2, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 16}}},
+    {mat_mul_loop15, AM_VIEW_TYPE_F64, 16, false, 2, {{AM_VIEW_TYPE_F64, 16}, {AM_VIEW_TYPE_F64, 1}}},
+    {mat_mul_loop16, AM_VIEW_TYPE_F64, 9, false, 2, {{AM_VIEW_TYPE_F64, 9}, {AM_VIEW_TYPE_F64, 9}}},
+    {mat_mul_loop17, AM_VIEW_TYPE_F64, 3, false, 2, {{AM_VIEW_TYPE_F64, 9}, {AM_VIEW_TYPE_F64, 3}}},
+    {mat_mul_loop18, AM_VIEW_TYPE_F64, 3, false, 2, {{AM_VIEW_TYPE_F64, 3}, {AM_VIEW_TYPE_F64, 9}}},
+    {mat_mul_loop19, AM_VIEW_TYPE_F64, 9, false, 2, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 9}}},
+    {mat_mul_loop20, AM_VIEW_TYPE_F64, 9, false, 2, {{AM_VIEW_TYPE_F64, 9}, {AM_VIEW_TYPE_F64, 1}}},
+};
+
+static const mathv_op_variant cross_variants[] = {
+    {cross_loop1, AM_VIEW_TYPE_F32, 3, true, 2, {{AM_VIEW_TYPE_F32, 3}, {AM_VIEW_TYPE_F32, 3}}},
+    {cross_loop2, AM_VIEW_TYPE_F64, 3, false, 2, {{AM_VIEW_TYPE_F64, 3}, {AM_VIEW_TYPE_F64, 3}}},
+};
+
+static const mathv_op_variant distance_variants[] = {
+    {distance_loop1, AM_VIEW_TYPE_F32, 1, false, 2, {{AM_VIEW_TYPE_F32, 2}, {AM_VIEW_TYPE_F32, 2}}},
+    {distance_loop2, AM_VIEW_TYPE_F32, 1, false, 2, {{AM_VIEW_TYPE_F32, 3}, {AM_VIEW_TYPE_F32, 3}}},
+    {distance_loop3, AM_VIEW_TYPE_F32, 1, false, 2, {{AM_VIEW_TYPE_F32, 4}, {AM_VIEW_TYPE_F32, 4}}},
+    {distance_loop4, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 2}, {AM_VIEW_TYPE_F64, 2}}},
+    {distance_loop5, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 3}, {AM_VIEW_TYPE_F64, 3}}},
+    {distance_loop6, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 4}, {AM_VIEW_TYPE_F64, 4}}},
+};
+
+static const mathv_op_variant dot_variants[] = {
+    {dot_loop1, AM_VIEW_TYPE_F32, 1, true, 2, {{AM_VIEW_TYPE_F32, 2}, {AM_VIEW_TYPE_F32, 2}}},
+    {dot_loop2, AM_VIEW_TYPE_F32, 1, true, 2, {{AM_VIEW_TYPE_F32, 3}, {AM_VIEW_TYPE_F32, 3}}},
+    {dot_loop3, AM_VIEW_TYPE_F32, 1, true, 2, {{AM_VIEW_TYPE_F32, 4}, {AM_VIEW_TYPE_F32, 4}}},
+    {dot_loop4, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 2}, {AM_VIEW_TYPE_F64, 2}}},
+    {dot_loop5, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 3}, {AM_VIEW_TYPE_F64, 3}}},
+    {dot_loop6, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 4}, {AM_VIEW_TYPE_F64, 4}}},
+};
+
+static const mathv_op_variant inverse_variants[] = {
+    {inverse_loop1, AM_VIEW_TYPE_F32, 9, false, 1, {{AM_VIEW_TYPE_F32, 9}}},
+    {inverse_loop2, AM_VIEW_TYPE_F32, 16, false, 1, {{AM_VIEW_TYPE_F32, 16}}},
+    {inverse_loop3, AM_VIEW_TYPE_F64, 9, false, 1, {{AM_VIEW_TYPE_F64, 9}}},
+    {inverse_loop4, AM_VIEW_TYPE_F64, 16, false, 1, {{AM_VIEW_TYPE_F64, 16}}},
+};
+
+static const mathv_op_variant length_variants[] = {
+    {length_loop1, AM_VIEW_TYPE_F32, 1, true, 1, {{AM_VIEW_TYPE_F32, 2}}},
+    {length_loop2, AM_VIEW_TYPE_F32, 1, true, 1, {{AM_VIEW_TYPE_F32, 3}}},
+    {length_loop3, AM_VIEW_TYPE_F32, 1, true, 1, {{AM_VIEW_TYPE_F32, 4}}},
+    {length_loop4, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 2}}},
+    {length_loop5, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 3}}},
+    {length_loop6, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 4}}},
+};
+
+static const mathv_op_variant normalize_variants[] = {
+    {normalize_loop1, AM_VIEW_TYPE_F32, 2, true, 1, {{AM_VIEW_TYPE_F32, 2}}},
+    {normalize_loop2, AM_VIEW_TYPE_F32, 3, true, 1, {{AM_VIEW_TYPE_F32, 3}}},
+    {normalize_loop3, AM_VIEW_TYPE_F32, 4, true, 1, {{AM_VIEW_TYPE_F32, 4}}},
+    {normalize_loop4, AM_VIEW_TYPE_F64, 2, false, 1, {{AM_VIEW_TYPE_F64, 2}}},
+    {normalize_loop5, AM_VIEW_TYPE_F64, 3, false, 1, {{AM_VIEW_TYPE_F64, 3}}},
+    {normalize_loop6, AM_VIEW_TYPE_F64, 4, false, 1, {{AM_VIEW_TYPE_F64, 4}}},
+};
+
+static const mathv_op_variant perlin_variants[] = {
+    {perlin_loop1, AM_VIEW_TYPE_F32, 1, false, 1, {{AM_VIEW_TYPE_F32, 1}}},
+    {perlin_loop2, AM_VIEW_TYPE_F32, 1, false, 1, {{AM_VIEW_TYPE_F32, 2}}},
+    {perlin_loop3, AM_VIEW_TYPE_F32, 1, false, 1, {{AM_VIEW_TYPE_F32, 3}}},
+    {perlin_loop4, AM_VIEW_TYPE_F32, 1, false, 1, {{AM_VIEW_TYPE_F32, 4}}},
+    {perlin_loop5, AM_VIEW_TYPE_F32, 1, false, 2, {{AM_VIEW_TYPE_F32, 1}, {AM_VIEW_TYPE_F32, 1}}},
+    {perlin_loop6, AM_VIEW_TYPE_F32, 1, false, 2, {{AM_VIEW_TYPE_F32, 2}, {AM_VIEW_TYPE_F32, 2}}},
+    {perlin_loop7, AM_VIEW_TYPE_F32, 1, false, 2, {{AM_VIEW_TYPE_F32, 3}, {AM_VIEW_TYPE_F32, 3}}},
+    {perlin_loop8, AM_VIEW_TYPE_F32, 1, false, 2, {{AM_VIEW_TYPE_F32, 4}, {AM_VIEW_TYPE_F32, 4}}},
+    {perlin_loop9, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 1}}},
+    {perlin_loop10, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 2}}},
+    {perlin_loop11, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 3}}},
+    {perlin_loop12, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 4}}},
+    {perlin_loop13, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 1}, {AM_VIEW_TYPE_F64, 1}}},
+    {perlin_loop14, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 2}, {AM_VIEW_TYPE_F64, 2}}},
+    {perlin_loop15, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 3}, {AM_VIEW_TYPE_F64, 3}}},
+    {perlin_loop16, AM_VIEW_TYPE_F64, 1, false, 2, {{AM_VIEW_TYPE_F64, 4}, {AM_VIEW_TYPE_F64, 4}}},
+};
+
+static const mathv_op_variant simplex_variants[] = {
+    {simplex_loop1, AM_VIEW_TYPE_F32, 1, false, 1, {{AM_VIEW_TYPE_F32, 1}}},
+    {simplex_loop2, AM_VIEW_TYPE_F32, 1, false, 1, {{AM_VIEW_TYPE_F32, 2}}},
+    {simplex_loop3, AM_VIEW_TYPE_F32, 1, false, 1, {{AM_VIEW_TYPE_F32, 3}}},
+    {simplex_loop4, AM_VIEW_TYPE_F32, 1, false, 1, {{AM_VIEW_TYPE_F32, 4}}},
+    {simplex_loop5, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 1}}},
+    {simplex_loop6, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 2}}},
+    {simplex_loop7, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 3}}},
+    {simplex_loop8, AM_VIEW_TYPE_F64, 1, false, 1, {{AM_VIEW_TYPE_F64, 4}}},
+};
+
+static const mathv_op mathv_ops[] = {
+    {"add", false, 8, add_variants},
+    {"sub", false, 8, sub_variants},
+    {"vec_mul", false, 8, vec_mul_variants},
+    {"div", false, 8, div_variants},
+    {"mod", false, 8, mod_variants},
+    {"pow", false, 2, pow_variants},
+    {"unm", false, 8, unm_variants},
+    {"abs", false, 2, abs_variants},
+    {"acos", false, 2, acos_variants},
+    {"asin", false, 2, asin_variants},
+    {"atan", false, 2, atan_variants},
+    {"atan2", false, 2, atan2_variants},
+    {"ceil", false, 2, ceil_variants},
+    {"clamp", false, 2, clamp_variants},
+    {"cos", false, 2, cos_variants},
+    {"floor", false, 2, floor_variants},
+    {"fract", false, 2, fract_variants},
+    {"log", false, 2, log_variants},
+    {"max", false, 2, max_variants},
+    {"min", false, 2, min_variants},
+    {"mix", false, 2, mix_variants},
+    {"sign", false, 2, sign_variants},
+    {"sin", false, 2, sin_variants},
+    {"tan", false, 2, tan_variants},
+    {"lt", false, 8, lt_variants},
+    {"lte", false, 8, lte_variants},
+    {"gt", false, 8, gt_variants},
+    {"gte", false, 8, gte_variants},
+    {"and_", false, 1, and__variants},
+    {"or_", false, 1, or__variants},
+    {"not_", false, 1, not__variants},
+    {"vec2", true, 4, vec2_variants},
+    {"vec3", true, 8, vec3_variants},
+    {"vec4", true, 16, vec4_variants},
+    {"mat3", true, 4, mat3_variants},
+    {"mat4", true, 4, mat4_variants},
+    {"mat_mul", true, 20, mat_mul_variants},
+    {"cross", true, 2, cross_variants},
+    {"distance", true, 6, distance_variants},
+    {"dot", true, 6, dot_variants},
+    {"inverse", true, 4, inverse_variants},
+    {"length", true, 6, length_variants},
+    {"normalize", true, 6, normalize_variants},
+    {"perlin", true, 16, perlin_variants},
+    {"simplex", true, 8, simplex_variants},
+    {NULL, false, 0, NULL}
+};
+
+#include "am_mathv_compile.inc"
+
 void am_register_mathv_view_methods(lua_State *L) {
     lua_pushcclosure(L, am_mathv_add, 0);
     lua_setfield(L, -2, "__add");
@@ -8004,6 +11322,7 @@ void am_register_mathv_view_methods(lua_State *L) {
 }
 
 void am_open_mathv_module(lua_State *L) {
+    am_init_mathv_simd();
     luaL_Reg vfuncs[] = {
         {"range",    am_mathv_range},
         {"random",   am_mathv_random},
@@ -8012,6 +11331,11 @@ void am_open_mathv_module(lua_State *L) {
         {"sum",      am_mathv_sum},
         {"greatest", am_mathv_greatest},
         {"least",    am_mathv_least},
+        {"compile",  am_mathv_compile},
+        {"_supported_simd", am_mathv_supported_simd},
+        {"_set_simd", am_mathv_set_simd},
+        {"_threads", am_mathv_threads},
+        {"_set_threads", am_mathv_set_threads},
         {"add", am_mathv_add},
         {"sub", am_mathv_sub},
         {"vec_mul", am_mathv_vec_mul},
@@ -8062,4 +11386,5 @@ void am_open_mathv_module(lua_State *L) {
         {NULL, NULL}
     };
     am_open_module(L, "mathv", vfuncs);
+    register_mathv_kernel_mt(L);
 }
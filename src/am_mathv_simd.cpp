@@ -0,0 +1,113 @@
+#include "amulet.h"
+
+#if defined(AM_MATHV_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+am_mathv_simd_kernels *am_mathv_simd = NULL;
+
+#ifdef AM_MATHV_SIMD_X86
+
+static bool cpu_supports_sse41() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 19)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.1");
+#endif
+}
+
+static bool cpu_supports_avx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    // check the OS saves the ymm registers
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+static int supported_kernels(am_mathv_simd_kernels **kernels) {
+    int n = 0;
+#ifdef AM_MATHV_SIMD_X86
+    if (cpu_supports_avx2()) {
+        kernels[n++] = &am_mathv_simd_avx2_kernels;
+    }
+    if (cpu_supports_sse41()) {
+        kernels[n++] = &am_mathv_simd_sse41_kernels;
+    }
+#endif
+#ifdef AM_MATHV_SIMD_NEON
+    kernels[n++] = &am_mathv_simd_neon_kernels;
+#endif
+    return n;
+}
+
+void am_init_mathv_simd() {
+    // only select the kernels for the first engine, so job workers use
+    // the same ones as the main engine
+    static bool initialized = false;
+    if (initialized) return;
+    initialized = true;
+    am_mathv_simd_kernels *kernels[4];
+    int n = supported_kernels(kernels);
+    am_mathv_simd = n > 0 ? kernels[0] : NULL;
+}
+
+bool am_set_mathv_simd(const char *name) {
+    if (strcmp(name, "scalar") == 0) {
+        am_mathv_simd = NULL;
+        return true;
+    }
+    am_mathv_simd_kernels *kernels[4];
+    int n = supported_kernels(kernels);
+    for (int i = 0; i < n; i++) {
+        if (strcmp(kernels[i]->name, name) == 0) {
+            am_mathv_simd = kernels[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+int am_supported_mathv_simd(const char **names, int max) {
+    am_mathv_simd_kernels *kernels[4];
+    int n = supported_kernels(kernels);
+    if (n < max) {
+        kernels[n++] = NULL;
+    }
+    n = am_min(n, max);
+    for (int i = 0; i < n; i++) {
+        names[i] = kernels[i] == NULL ? "scalar" : kernels[i]->name;
+    }
+    return n;
+}
+
+int am_mathv_supported_simd(lua_State *L) {
+    const char *names[4];
+    int n = am_supported_mathv_simd(names, 4);
+    lua_createtable(L, n, 0);
+    for (int i = 0; i < n; i++) {
+        lua_pushstring(L, names[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+    return 1;
+}
+
+int am_mathv_set_simd(lua_State *L) {
+    am_check_nargs(L, 1);
+    lua_pushboolean(L, am_set_mathv_simd(luaL_checkstring(L, 1)));
+    return 1;
+}
@@ -0,0 +1,48 @@
+// Vectorized kernels for the dense paths of the f32 mathv functions.
+// The list of kernels and the expression each one computes is generated
+// by tools/gen_mathv.lua (am_mathv_simd_kernels.inc) and the kernels are
+// compiled once per instruction set from am_mathv_simd_impl.inc (see
+// am_mathv_simd_sse41.cpp etc). The fastest set the CPU supports is
+// selected in am_init_mathv_simd.
+
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(AM_HTML)
+#define AM_MATHV_SIMD_X86
+#elif defined(__aarch64__) || defined(_M_ARM64)
+// 32 bit ARM has no vector division, sqrt or rounding.
+#define AM_MATHV_SIMD_NEON
+#endif
+
+// n is the number of floats for component wise kernels and the number of
+// vectors for element wise kernels. Bit i of bcast is set if argument i
+// is a single value (or vector) to use for every element.
+typedef void (*am_mathv_simd_unary_func)(float *out, const float *x, unsigned int n);
+typedef void (*am_mathv_simd_binary_func)(float *out, const float *x, const float *y, unsigned int n, unsigned int bcast);
+typedef void (*am_mathv_simd_ternary_func)(float *out, const float *x, const float *y, const float *z, unsigned int n, unsigned int bcast);
+typedef void (*am_mathv_simd_compare_func)(uint8_t *out, const float *x, const float *y, unsigned int n, unsigned int bcast);
+typedef am_mathv_simd_unary_func am_mathv_simd_elem1_func;
+typedef am_mathv_simd_binary_func am_mathv_simd_elem2_func;
+
+struct am_mathv_simd_kernels {
+    const char *name;
+#define AM_SIMD_KERNEL(kind, kname, comps, ret_comps, expr) am_mathv_simd_##kind##_func kname;
+#include "am_mathv_simd_kernels.inc"
+#undef AM_SIMD_KERNEL
+};
+
+#if defined(AM_MATHV_SIMD_X86)
+extern am_mathv_simd_kernels am_mathv_simd_sse41_kernels;
+extern am_mathv_simd_kernels am_mathv_simd_avx2_kernels;
+#elif defined(AM_MATHV_SIMD_NEON)
+extern am_mathv_simd_kernels am_mathv_simd_neon_kernels;
+#endif
+
+// NULL if there are no kernels for this CPU, in which case the scalar
+// loops are used.
+extern am_mathv_simd_kernels *am_mathv_simd;
+
+void am_init_mathv_simd();
+// Returns false if the named kernels aren't supported on this CPU.
+// "scalar" disables the kernels.
+bool am_set_mathv_simd(const char *name);
+// Returns the names of the supported kernels, fastest first.
+int am_supported_mathv_simd(const char **names, int max);
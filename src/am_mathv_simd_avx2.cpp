@@ -0,0 +1,103 @@
+#include "amulet.h"
+
+#ifdef AM_MATHV_SIMD_X86
+
+#include <immintrin.h>
+
+// FMA is deliberately not enabled, so the compiler can't fuse multiplies
+// and adds and the results are the same as the SSE4.1 kernels.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AM_SIMD_TARGET
+#else
+#define AM_SIMD_TARGET __attribute__((target("avx2")))
+#endif
+
+#define AM_SIMD_TABLE am_mathv_simd_avx2_kernels
+#define AM_SIMD_NAME "avx2"
+
+#define VW 8
+typedef __m256 vf;
+typedef __m256 vm;
+typedef __m256i vi;
+
+#include "am_mathv_simd_x86.inc"
+
+AM_SIMD_TARGET static inline vf vf_load(const float *p) { return _mm256_loadu_ps(p); }
+AM_SIMD_TARGET static inline void vf_store(float *p, vf a) { _mm256_storeu_ps(p, a); }
+AM_SIMD_TARGET static inline vf vf_set1(float x) { return _mm256_set1_ps(x); }
+AM_SIMD_TARGET static inline vf vf_add(vf a, vf b) { return _mm256_add_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_sub(vf a, vf b) { return _mm256_sub_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_mul(vf a, vf b) { return _mm256_mul_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_div(vf a, vf b) { return _mm256_div_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_min(vf a, vf b) { return _mm256_min_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_max(vf a, vf b) { return _mm256_max_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_sqrt(vf a) { return _mm256_sqrt_ps(a); }
+AM_SIMD_TARGET static inline vf vf_floor(vf a) { return _mm256_floor_ps(a); }
+AM_SIMD_TARGET static inline vf vf_ceil(vf a) { return _mm256_ceil_ps(a); }
+AM_SIMD_TARGET static inline vf vf_abs(vf a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+AM_SIMD_TARGET static inline vf vf_neg(vf a) { return _mm256_xor_ps(_mm256_set1_ps(-0.0f), a); }
+AM_SIMD_TARGET static inline vm vf_lt(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+AM_SIMD_TARGET static inline vm vf_le(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+AM_SIMD_TARGET static inline vm vf_gt(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+AM_SIMD_TARGET static inline vm vf_ge(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+AM_SIMD_TARGET static inline vm vf_eq(vf a, vf b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+AM_SIMD_TARGET static inline vf vf_select(vm m, vf a, vf b) { return _mm256_blendv_ps(b, a, m); }
+AM_SIMD_TARGET static inline vm vm_and(vm a, vm b) { return _mm256_and_ps(a, b); }
+AM_SIMD_TARGET static inline vm vm_not(vm a) { return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+AM_SIMD_TARGET static inline bool vm_any(vm a) { return _mm256_movemask_ps(a) != 0; }
+AM_SIMD_TARGET static inline void vm_store_bools(uint8_t *p, vm a) {
+    __m128i lo = _mm_castps_si128(_mm256_castps256_ps128(a));
+    __m128i hi = _mm_castps_si128(_mm256_extractf128_ps(a, 1));
+    __m128i m = _mm_packs_epi32(lo, hi);
+    _mm_storel_epi64((__m128i*)p, _mm_and_si128(_mm_packs_epi16(m, m), _mm_set1_epi8(1)));
+}
+AM_SIMD_TARGET static inline vi vf_to_vi_trunc(vf a) { return _mm256_cvttps_epi32(a); }
+AM_SIMD_TARGET static inline vf vi_to_vf(vi a) { return _mm256_cvtepi32_ps(a); }
+AM_SIMD_TARGET static inline vi vf_as_vi(vf a) { return _mm256_castps_si256(a); }
+AM_SIMD_TARGET static inline vf vi_as_vf(vi a) { return _mm256_castsi256_ps(a); }
+AM_SIMD_TARGET static inline vi vi_set1(int x) { return _mm256_set1_epi32(x); }
+AM_SIMD_TARGET static inline vi vi_add(vi a, vi b) { return _mm256_add_epi32(a, b); }
+AM_SIMD_TARGET static inline vi vi_sub(vi a, vi b) { return _mm256_sub_epi32(a, b); }
+AM_SIMD_TARGET static inline vi vi_and(vi a, vi b) { return _mm256_and_si256(a, b); }
+AM_SIMD_TARGET static inline vi vi_andnot(vi a, vi b) { return _mm256_andnot_si256(a, b); }
+AM_SIMD_TARGET static inline vi vi_or(vi a, vi b) { return _mm256_or_si256(a, b); }
+AM_SIMD_TARGET static inline vi vi_xor(vi a, vi b) { return _mm256_xor_si256(a, b); }
+AM_SIMD_TARGET static inline vi vi_sll(vi a, int n) { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+AM_SIMD_TARGET static inline vi vi_srl(vi a, int n) { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+AM_SIMD_TARGET static inline vm vi_eq(vi a, vi b) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)); }
+
+// The vec2/3/4 transposes are done 4 vectors at a time with SSE, then
+// the halves are combined.
+#define AM_AVX2_LOAD_AOS(comps) \
+AM_SIMD_TARGET static inline void vf_load_aos##comps(const float *p, vf *v) { \
+    __m128 lo[comps]; \
+    __m128 hi[comps]; \
+    sse_load_aos##comps(p, lo); \
+    sse_load_aos##comps(p + 4 * comps, hi); \
+    for (int k = 0; k < comps; k++) { \
+        v[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(lo[k]), hi[k], 1); \
+    } \
+}
+
+#define AM_AVX2_STORE_AOS(comps) \
+AM_SIMD_TARGET static inline void vf_store_aos##comps(float *p, const vf *v) { \
+    __m128 lo[comps]; \
+    __m128 hi[comps]; \
+    for (int k = 0; k < comps; k++) { \
+        lo[k] = _mm256_castps256_ps128(v[k]); \
+        hi[k] = _mm256_extractf128_ps(v[k], 1); \
+    } \
+    sse_store_aos##comps(p, lo); \
+    sse_store_aos##comps(p + 4 * comps, hi); \
+}
+
+AM_AVX2_LOAD_AOS(2)
+AM_AVX2_LOAD_AOS(3)
+AM_AVX2_LOAD_AOS(4)
+AM_AVX2_STORE_AOS(2)
+AM_AVX2_STORE_AOS(3)
+AM_AVX2_STORE_AOS(4)
+
+#include "am_mathv_simd_impl.inc"
+
+#endif
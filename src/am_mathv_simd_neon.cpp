@@ -0,0 +1,111 @@
+#include "amulet.h"
+
+#ifdef AM_MATHV_SIMD_NEON
+
+#include <arm_neon.h>
+
+#define AM_SIMD_TARGET
+
+#define AM_SIMD_TABLE am_mathv_simd_neon_kernels
+#define AM_SIMD_NAME "neon"
+
+#define VW 4
+typedef float32x4_t vf;
+typedef uint32x4_t vm;
+typedef int32x4_t vi;
+
+static inline vf vf_load(const float *p) { return vld1q_f32(p); }
+static inline void vf_store(float *p, vf a) { vst1q_f32(p, a); }
+static inline vf vf_set1(float x) { return vdupq_n_f32(x); }
+static inline vf vf_add(vf a, vf b) { return vaddq_f32(a, b); }
+static inline vf vf_sub(vf a, vf b) { return vsubq_f32(a, b); }
+static inline vf vf_mul(vf a, vf b) { return vmulq_f32(a, b); }
+static inline vf vf_div(vf a, vf b) { return vdivq_f32(a, b); }
+// vminq/vmaxq propagate NaNs, unlike am_min and am_max.
+static inline vf vf_min(vf a, vf b) { return vbslq_f32(vcltq_f32(a, b), a, b); }
+static inline vf vf_max(vf a, vf b) { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+static inline vf vf_sqrt(vf a) { return vsqrtq_f32(a); }
+static inline vf vf_floor(vf a) { return vrndmq_f32(a); }
+static inline vf vf_ceil(vf a) { return vrndpq_f32(a); }
+static inline vf vf_abs(vf a) { return vabsq_f32(a); }
+static inline vf vf_neg(vf a) { return vnegq_f32(a); }
+static inline vm vf_lt(vf a, vf b) { return vcltq_f32(a, b); }
+static inline vm vf_le(vf a, vf b) { return vcleq_f32(a, b); }
+static inline vm vf_gt(vf a, vf b) { return vcgtq_f32(a, b); }
+static inline vm vf_ge(vf a, vf b) { return vcgeq_f32(a, b); }
+static inline vm vf_eq(vf a, vf b) { return vceqq_f32(a, b); }
+static inline vf vf_select(vm m, vf a, vf b) { return vbslq_f32(m, a, b); }
+static inline vm vm_and(vm a, vm b) { return vandq_u32(a, b); }
+static inline vm vm_not(vm a) { return vmvnq_u32(a); }
+static inline bool vm_any(vm a) { return vmaxvq_u32(a) != 0; }
+static inline void vm_store_bools(uint8_t *p, vm a) {
+    uint16x4_t h = vmovn_u32(a);
+    uint8x8_t b = vand_u8(vmovn_u16(vcombine_u16(h, h)), vdup_n_u8(1));
+    uint32_t bytes = vget_lane_u32(vreinterpret_u32_u8(b), 0);
+    memcpy(p, &bytes, 4);
+}
+static inline vi vf_to_vi_trunc(vf a) { return vcvtq_s32_f32(a); }
+static inline vf vi_to_vf(vi a) { return vcvtq_f32_s32(a); }
+static inline vi vf_as_vi(vf a) { return vreinterpretq_s32_f32(a); }
+static inline vf vi_as_vf(vi a) { return vreinterpretq_f32_s32(a); }
+static inline vi vi_set1(int x) { return vdupq_n_s32(x); }
+static inline vi vi_add(vi a, vi b) { return vaddq_s32(a, b); }
+static inline vi vi_sub(vi a, vi b) { return vsubq_s32(a, b); }
+static inline vi vi_and(vi a, vi b) { return vandq_s32(a, b); }
+static inline vi vi_andnot(vi a, vi b) { return vbicq_s32(b, a); }
+static inline vi vi_or(vi a, vi b) { return vorrq_s32(a, b); }
+static inline vi vi_xor(vi a, vi b) { return veorq_s32(a, b); }
+static inline vi vi_sll(vi a, int n) { return vshlq_s32(a, vdupq_n_s32(n)); }
+static inline vi vi_srl(vi a, int n) {
+    return vreinterpretq_s32_u32(vshlq_u32(vreinterpretq_u32_s32(a), vdupq_n_s32(-n)));
+}
+static inline vm vi_eq(vi a, vi b) { return vceqq_s32(a, b); }
+
+static inline void vf_load_aos2(const float *p, vf *v) {
+    float32x4x2_t t = vld2q_f32(p);
+    v[0] = t.val[0];
+    v[1] = t.val[1];
+}
+
+static inline void vf_load_aos3(const float *p, vf *v) {
+    float32x4x3_t t = vld3q_f32(p);
+    v[0] = t.val[0];
+    v[1] = t.val[1];
+    v[2] = t.val[2];
+}
+
+static inline void vf_load_aos4(const float *p, vf *v) {
+    float32x4x4_t t = vld4q_f32(p);
+    v[0] = t.val[0];
+    v[1] = t.val[1];
+    v[2] = t.val[2];
+    v[3] = t.val[3];
+}
+
+static inline void vf_store_aos2(float *p, const vf *v) {
+    float32x4x2_t t;
+    t.val[0] = v[0];
+    t.val[1] = v[1];
+    vst2q_f32(p, t);
+}
+
+static inline void vf_store_aos3(float *p, const vf *v) {
+    float32x4x3_t t;
+    t.val[0] = v[0];
+    t.val[1] = v[1];
+    t.val[2] = v[2];
+    vst3q_f32(p, t);
+}
+
+static inline void vf_store_aos4(float *p, const vf *v) {
+    float32x4x4_t t;
+    t.val[0] = v[0];
+    t.val[1] = v[1];
+    t.val[2] = v[2];
+    t.val[3] = v[3];
+    vst4q_f32(p, t);
+}
+
+#include "am_mathv_simd_impl.inc"
+
+#endif
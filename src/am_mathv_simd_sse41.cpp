@@ -0,0 +1,77 @@
+#include "amulet.h"
+
+#ifdef AM_MATHV_SIMD_X86
+
+#include <smmintrin.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AM_SIMD_TARGET
+#else
+#define AM_SIMD_TARGET __attribute__((target("sse4.1")))
+#endif
+
+#define AM_SIMD_TABLE am_mathv_simd_sse41_kernels
+#define AM_SIMD_NAME "sse4.1"
+
+#define VW 4
+typedef __m128 vf;
+typedef __m128 vm;
+typedef __m128i vi;
+
+#include "am_mathv_simd_x86.inc"
+
+AM_SIMD_TARGET static inline vf vf_load(const float *p) { return _mm_loadu_ps(p); }
+AM_SIMD_TARGET static inline void vf_store(float *p, vf a) { _mm_storeu_ps(p, a); }
+AM_SIMD_TARGET static inline vf vf_set1(float x) { return _mm_set1_ps(x); }
+AM_SIMD_TARGET static inline vf vf_add(vf a, vf b) { return _mm_add_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_sub(vf a, vf b) { return _mm_sub_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_mul(vf a, vf b) { return _mm_mul_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_div(vf a, vf b) { return _mm_div_ps(a, b); }
+// minps/maxps return the second operand unless the comparison is true,
+// the same as am_min and am_max.
+AM_SIMD_TARGET static inline vf vf_min(vf a, vf b) { return _mm_min_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_max(vf a, vf b) { return _mm_max_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_sqrt(vf a) { return _mm_sqrt_ps(a); }
+AM_SIMD_TARGET static inline vf vf_floor(vf a) { return _mm_floor_ps(a); }
+AM_SIMD_TARGET static inline vf vf_ceil(vf a) { return _mm_ceil_ps(a); }
+AM_SIMD_TARGET static inline vf vf_abs(vf a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+AM_SIMD_TARGET static inline vf vf_neg(vf a) { return _mm_xor_ps(_mm_set1_ps(-0.0f), a); }
+AM_SIMD_TARGET static inline vm vf_lt(vf a, vf b) { return _mm_cmplt_ps(a, b); }
+AM_SIMD_TARGET static inline vm vf_le(vf a, vf b) { return _mm_cmple_ps(a, b); }
+AM_SIMD_TARGET static inline vm vf_gt(vf a, vf b) { return _mm_cmpgt_ps(a, b); }
+AM_SIMD_TARGET static inline vm vf_ge(vf a, vf b) { return _mm_cmpge_ps(a, b); }
+AM_SIMD_TARGET static inline vm vf_eq(vf a, vf b) { return _mm_cmpeq_ps(a, b); }
+AM_SIMD_TARGET static inline vf vf_select(vm m, vf a, vf b) { return _mm_blendv_ps(b, a, m); }
+AM_SIMD_TARGET static inline vm vm_and(vm a, vm b) { return _mm_and_ps(a, b); }
+AM_SIMD_TARGET static inline vm vm_not(vm a) { return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+AM_SIMD_TARGET static inline bool vm_any(vm a) { return _mm_movemask_ps(a) != 0; }
+AM_SIMD_TARGET static inline void vm_store_bools(uint8_t *p, vm a) {
+    __m128i m = _mm_castps_si128(a);
+    __m128i b = _mm_and_si128(_mm_packs_epi16(_mm_packs_epi32(m, m), m), _mm_set1_epi8(1));
+    int bytes = _mm_cvtsi128_si32(b);
+    memcpy(p, &bytes, 4);
+}
+AM_SIMD_TARGET static inline vi vf_to_vi_trunc(vf a) { return _mm_cvttps_epi32(a); }
+AM_SIMD_TARGET static inline vf vi_to_vf(vi a) { return _mm_cvtepi32_ps(a); }
+AM_SIMD_TARGET static inline vi vf_as_vi(vf a) { return _mm_castps_si128(a); }
+AM_SIMD_TARGET static inline vf vi_as_vf(vi a) { return _mm_castsi128_ps(a); }
+AM_SIMD_TARGET static inline vi vi_set1(int x) { return _mm_set1_epi32(x); }
+AM_SIMD_TARGET static inline vi vi_add(vi a, vi b) { return _mm_add_epi32(a, b); }
+AM_SIMD_TARGET static inline vi vi_sub(vi a, vi b) { return _mm_sub_epi32(a, b); }
+AM_SIMD_TARGET static inline vi vi_and(vi a, vi b) { return _mm_and_si128(a, b); }
+AM_SIMD_TARGET static inline vi vi_andnot(vi a, vi b) { return _mm_andnot_si128(a, b); }
+AM_SIMD_TARGET static inline vi vi_or(vi a, vi b) { return _mm_or_si128(a, b); }
+AM_SIMD_TARGET static inline vi vi_xor(vi a, vi b) { return _mm_xor_si128(a, b); }
+AM_SIMD_TARGET static inline vi vi_sll(vi a, int n) { return _mm_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+AM_SIMD_TARGET static inline vi vi_srl(vi a, int n) { return _mm_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+AM_SIMD_TARGET static inline vm vi_eq(vi a, vi b) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a, b)); }
+AM_SIMD_TARGET static inline void vf_load_aos2(const float *p, vf *v) { sse_load_aos2(p, v); }
+AM_SIMD_TARGET static inline void vf_load_aos3(const float *p, vf *v) { sse_load_aos3(p, v); }
+AM_SIMD_TARGET static inline void vf_load_aos4(const float *p, vf *v) { sse_load_aos4(p, v); }
+AM_SIMD_TARGET static inline void vf_store_aos2(float *p, const vf *v) { sse_store_aos2(p, v); }
+AM_SIMD_TARGET static inline void vf_store_aos3(float *p, const vf *v) { sse_store_aos3(p, v); }
+AM_SIMD_TARGET static inline void vf_store_aos4(float *p, const vf *v) { sse_store_aos4(p, v); }
+
+#include "am_mathv_simd_impl.inc"
+
+#endif
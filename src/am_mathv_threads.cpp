@@ -0,0 +1,156 @@
+#include "amulet.h"
+
+struct mathv_worker {
+    am_thread *thread;
+    am_semaphore *start;
+    bool quit;
+};
+
+static std::vector<mathv_worker*> workers;
+static am_semaphore *workers_done = NULL;
+
+// 0 means one thread per cpu. Both are set from any engine, so they're
+// only read and written atomically.
+static volatile uint32_t requested_threads = 0;
+static volatile uint32_t parallel_threshold = AM_MATHV_DEFAULT_PARALLEL_THRESHOLD;
+
+// Non-zero while a thread is using the pool. Calls made while the pool is
+// busy (e.g. from a job worker) run on the calling thread instead.
+static volatile uint32_t pool_in_use = 0;
+
+static am_mathv_range_func job_func = NULL;
+static void *job_data = NULL;
+static unsigned int job_count = 0;
+static volatile uint32_t next_block = 0;
+
+static void run_claimed_blocks() {
+    unsigned int num_blocks = (job_count + AM_MATHV_BLOCK_SIZE - 1) / AM_MATHV_BLOCK_SIZE;
+    while (true) {
+        unsigned int b = am_atomic_add(&next_block, 1) - 1;
+        if (b >= num_blocks) break;
+        unsigned int start = b * AM_MATHV_BLOCK_SIZE;
+        job_func(job_data, start, am_min(start + AM_MATHV_BLOCK_SIZE, job_count));
+    }
+}
+
+static void mathv_worker_main(void *data) {
+    mathv_worker *worker = (mathv_worker*)data;
+    while (true) {
+        am_wait_semaphore(worker->start);
+        if (worker->quit) break;
+        run_claimed_blocks();
+        am_signal_semaphore(workers_done);
+    }
+}
+
+static void stop_workers() {
+    for (unsigned int i = 0; i < workers.size(); i++) {
+        mathv_worker *worker = workers[i];
+        worker->quit = true;
+        am_signal_semaphore(worker->start);
+        am_join_thread(worker->thread);
+        am_destroy_semaphore(worker->start);
+        delete worker;
+    }
+    workers.clear();
+}
+
+// Called by the thread that owns the pool.
+static void update_workers() {
+    int num_threads = (int)am_atomic_load(&requested_threads);
+    if (num_threads == 0) {
+        num_threads = am_min(am_cpu_count(), AM_MAX_MATHV_THREADS);
+    }
+    int num_workers = num_threads - 1;
+    if (num_workers == (int)workers.size()) return;
+    stop_workers();
+    if (num_workers > 0 && workers_done == NULL) {
+        workers_done = am_create_semaphore();
+    }
+    for (int i = 0; i < num_workers; i++) {
+        mathv_worker *worker = new mathv_worker();
+        worker->start = am_create_semaphore();
+        worker->quit = false;
+        worker->thread = am_create_thread(mathv_worker_main, worker);
+        if (worker->thread == NULL) {
+            // threads not supported
+            am_destroy_semaphore(worker->start);
+            delete worker;
+            break;
+        }
+        workers.push_back(worker);
+    }
+    // don't keep retrying if threads couldn't be created
+    am_atomic_store(&requested_threads, (uint32_t)workers.size() + 1);
+}
+
+static void run_serial(am_mathv_range_func func, void *data, unsigned int count) {
+    for (unsigned int start = 0; start < count; start += AM_MATHV_BLOCK_SIZE) {
+        func(data, start, am_min(start + AM_MATHV_BLOCK_SIZE, count));
+    }
+}
+
+void am_mathv_parallel_for(am_mathv_range_func func, void *data, unsigned int count) {
+    if (count < am_atomic_load(&parallel_threshold) || count <= AM_MATHV_BLOCK_SIZE) {
+        run_serial(func, data, count);
+        return;
+    }
+    if (am_atomic_add(&pool_in_use, 1) != 1) {
+        am_atomic_add(&pool_in_use, (uint32_t)-1);
+        run_serial(func, data, count);
+        return;
+    }
+    update_workers();
+    unsigned int num_blocks = (count + AM_MATHV_BLOCK_SIZE - 1) / AM_MATHV_BLOCK_SIZE;
+    int num_woken = am_min((int)workers.size(), (int)num_blocks - 1);
+    job_func = func;
+    job_data = data;
+    job_count = count;
+    am_atomic_store(&next_block, 0);
+    for (int w = 0; w < num_woken; w++) {
+        am_signal_semaphore(workers[w]->start);
+    }
+    run_claimed_blocks();
+    for (int w = 0; w < num_woken; w++) {
+        am_wait_semaphore(workers_done);
+    }
+    am_atomic_add(&pool_in_use, (uint32_t)-1);
+}
+
+void am_destroy_mathv_threads() {
+    stop_workers();
+    if (workers_done != NULL) {
+        am_destroy_semaphore(workers_done);
+        workers_done = NULL;
+    }
+    am_atomic_store(&requested_threads, 0);
+    am_atomic_store(&parallel_threshold, AM_MATHV_DEFAULT_PARALLEL_THRESHOLD);
+}
+
+int am_mathv_threads(lua_State *L) {
+    int n = (int)am_atomic_load(&requested_threads);
+    if (n == 0) {
+        n = am_min(am_cpu_count(), AM_MAX_MATHV_THREADS);
+    }
+    lua_pushinteger(L, n);
+    lua_pushinteger(L, am_atomic_load(&parallel_threshold));
+    return 2;
+}
+
+int am_mathv_set_threads(lua_State *L) {
+    int nargs = am_check_nargs(L, 1);
+    int n = luaL_checkinteger(L, 1);
+    if (n < 1) {
+        return luaL_error(L, "number of mathv threads must be at least 1");
+    }
+    // the pool is resized the next time it's used
+    am_atomic_store(&requested_threads, (uint32_t)am_min(n, AM_MAX_MATHV_THREADS));
+    if (nargs > 1) {
+        int threshold = luaL_checkinteger(L, 2);
+        if (threshold < 0) {
+            return luaL_error(L, "mathv parallel threshold must be non-negative");
+        }
+        am_atomic_store(&parallel_threshold, (uint32_t)threshold);
+    }
+    return 0;
+}
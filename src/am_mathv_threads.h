@@ -0,0 +1,21 @@
+// Runs the loops of large mathv calls on a pool of threads shared by the
+// main engine and the job workers. The elements are always processed in
+// blocks of AM_MATHV_BLOCK_SIZE, whether or not the pool is used, so the
+// results don't depend on the number of threads.
+
+#define AM_MATHV_BLOCK_SIZE 4096
+#define AM_MATHV_DEFAULT_PARALLEL_THRESHOLD 65536
+#define AM_MAX_MATHV_THREADS 64
+
+// Computes output elements [start, end).
+typedef void (*am_mathv_range_func)(void *data, unsigned int start, unsigned int end);
+
+// Calls func for each block of [0, count). The blocks are shared with the
+// pool's threads if count is at least the parallel threshold and no
+// other thread is using the pool.
+void am_mathv_parallel_for(am_mathv_range_func func, void *data, unsigned int count);
+
+void am_destroy_mathv_threads();
+
+int am_mathv_threads(lua_State *L);
+int am_mathv_set_threads(lua_State *L);
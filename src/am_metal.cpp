@@ -65,6 +65,10 @@ int am_max_vertex_texture_image_units;
 int am_max_vertex_uniform_vectors;
 int am_frame_draw_calls;
 int am_frame_use_program_calls;
+bool am_instancing_supported = true;
+// Attribute layouts are already turned into vertex descriptors and cached
+// with the pipeline states, so there's nothing for vertex arrays to save.
+bool am_vertex_arrays_supported = false;
 
 bool am_metal_use_highdpi = false;
 bool am_metal_window_depth_buffer = false;
@@ -238,6 +242,7 @@ struct attr_layout {
     int dims;
     bool normalized;
     int stride;
+    int divisor;
 };
 
 struct attr_descr {
@@ -1149,12 +1154,18 @@ void am_set_buffer_data(am_buffer_target target, int size, void *data, am_buffer
     check_initialized();
     metal_buffer *buf = get_active_buffer(target);
     if (buf == NULL) return;
-    if (buf->size != size) {
+    if (buf->size != size || data == NULL) {
+        // command buffers retain the buffers they use, so releasing the
+        // old buffer here is safe even if it's still being drawn from.
         if (buf->mtlbuf != nil) {
             [buf->mtlbuf release];
             buf->mtlbuf = nil;
         }
-        buf->mtlbuf = [metal_device newBufferWithBytes:data length:size options:MTLResourceStorageModeShared];
+        if (data == NULL) {
+            buf->mtlbuf = [metal_device newBufferWithLength:size options:MTLResourceStorageModeShared];
+        } else {
+            buf->mtlbuf = [metal_device newBufferWithBytes:data length:size options:MTLResourceStorageModeShared];
+        }
         buf->size = size;
     } else {
         memcpy([buf->mtlbuf contents], data, size);
@@ -1557,6 +1568,7 @@ bool am_link_program(am_program_id program_id) {
         attr_state *attr = &prog->attrs[i];
         attr->bufid = 0;
         attr->offset = 0;
+        attr->layout.divisor = 0;
         const char *name;
         glslopt_basic_type type;
         glslopt_precision prec;
@@ -1834,6 +1846,29 @@ void am_set_attribute_pointer(am_gluint location, int dims, am_attribute_client_
     attr->layout.stride = stride;
 }
 
+void am_set_attribute_divisor(am_gluint location, int divisor) {
+    check_initialized();
+    if (metal_active_program == 0) return;
+    metal_program *prog = metal_program_freelist.get(metal_active_program);
+    attr_state *attr = &prog->attrs[location];
+    attr->layout.divisor = divisor;
+}
+
+// Vertex Array Objects
+
+am_vertex_array_id am_create_vertex_array() {
+    check_initialized(0);
+    return 0;
+}
+
+void am_delete_vertex_array(am_vertex_array_id vao) {
+    check_initialized();
+}
+
+void am_bind_vertex_array(am_vertex_array_id vao) {
+    check_initialized();
+}
+
 // Texture Objects
 
 void am_set_active_texture_unit(int texture_unit) {
@@ -2350,7 +2385,8 @@ static bool setup_pipeline(metal_program *prog) {
             if (cached_layout->type != active_layout->type ||
                 cached_layout->dims != active_layout->dims ||
                 cached_layout->stride != active_layout->stride ||
-                cached_layout->normalized != active_layout->normalized)
+                cached_layout->normalized != active_layout->normalized ||
+                cached_layout->divisor != active_layout->divisor)
             {
                 match = false;
                 break;
@@ -2408,8 +2444,13 @@ static bool setup_pipeline(metal_program *prog) {
             [[vertdescr attributes] setObject:attrdescr atIndexedSubscript:attr->descr.location];
             [attrdescr release];
             MTLVertexBufferLayoutDescriptor *layoutdescr = [[MTLVertexBufferLayoutDescriptor alloc] init];
-            layoutdescr.stepFunction = MTLVertexStepFunctionPerVertex;
-            layoutdescr.stepRate = 1;
+            if (attr->layout.divisor > 0) {
+                layoutdescr.stepFunction = MTLVertexStepFunctionPerInstance;
+                layoutdescr.stepRate = attr->layout.divisor;
+            } else {
+                layoutdescr.stepFunction = MTLVertexStepFunctionPerVertex;
+                layoutdescr.stepRate = 1;
+            }
             layoutdescr.stride = attr->layout.stride;
             [[vertdescr layouts] setObject:layoutdescr atIndexedSubscript:i + 1];
             [layoutdescr release];
@@ -2633,6 +2674,31 @@ void am_draw_elements(am_draw_mode mode, int count, am_element_index_type type,
             indexBufferOffset:offset];
 }
 
+void am_draw_arrays_instanced(am_draw_mode mode, int first, int count, int instances) {
+    check_initialized();
+    if (!pre_draw_setup()) return;
+    [metal_encoder drawPrimitives:to_metal_prim(mode) vertexStart: first vertexCount: count instanceCount: instances];
+}
+
+void am_draw_elements_instanced(am_draw_mode mode, int count, am_element_index_type type, int offset, int instances) {
+    check_initialized();
+    if (metal_active_element_buffer == 0) return;
+    metal_buffer *elembuf = metal_buffer_freelist.get(metal_active_element_buffer);
+    if (elembuf->mtlbuf == nil) return;
+    if (!pre_draw_setup()) return;
+    MTLIndexType itype = MTLIndexTypeUInt32;
+    switch (type) {
+        case AM_ELEMENT_TYPE_USHORT: itype = MTLIndexTypeUInt16; break;
+        case AM_ELEMENT_TYPE_UINT: itype = MTLIndexTypeUInt32; break;
+    }
+    [metal_encoder drawIndexedPrimitives:to_metal_prim(mode)
+                   indexCount:count
+                    indexType:itype
+                  indexBuffer:elembuf->mtlbuf
+            indexBufferOffset:offset
+                instanceCount:instances];
+}
+
 void am_gl_end_framebuffer_render() {
     check_initialized();
     if (metal_encoder != nil) {
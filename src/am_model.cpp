@@ -4,16 +4,8 @@ struct t_face_component {
     int v;
     int t;
     int n;
-
-    t_face_component() {
-        v = 0;
-        t = 0;
-        n = 0;
-    }
 };
 
-typedef std::vector<t_face_component> t_face;
-
 char *skip_line(char *str) {
     while (*str != '\n' && *str != '\0') {
         str++;
@@ -25,18 +17,261 @@ char *skip_line(char *str) {
     }
 }
 
-static float* read_obj(const char *filename, char *str, int len,
+static const double pow10_table[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// Parses a decimal number on the current line. This is much faster than
+// strtod, which is only used for things this doesn't handle (hex, inf, nan,
+// very long mantissas and very large exponents). Unlike strtod it doesn't
+// skip newlines, so a missing value doesn't consume the next line.
+static float parse_float(char *str, char **end) {
+    char *p = str;
+    while (*p == ' ' || *p == '\t') p++;
+    char *start = p;
+    bool neg = false;
+    if (*p == '-') {
+        neg = true;
+        p++;
+    } else if (*p == '+') {
+        p++;
+    }
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exp10 = 0;
+    bool any_digits = false;
+    while (*p >= '0' && *p <= '9') {
+        if (mantissa != 0 || *p != '0') {
+            mantissa = mantissa * 10 + (*p - '0');
+            digits++;
+        }
+        any_digits = true;
+        p++;
+    }
+    if (*p == '.') {
+        p++;
+        while (*p >= '0' && *p <= '9') {
+            if (mantissa != 0 || *p != '0') {
+                mantissa = mantissa * 10 + (*p - '0');
+                digits++;
+            }
+            exp10--;
+            any_digits = true;
+            p++;
+        }
+    }
+    if (!any_digits) {
+        if (*p == 'i' || *p == 'I' || *p == 'n' || *p == 'N' || *p == 'x' || *p == 'X') {
+            return (float)strtod(start, end);
+        }
+        *end = str;
+        return 0.0f;
+    }
+    if (*p == 'e' || *p == 'E') {
+        char *e = p + 1;
+        bool eneg = false;
+        if (*e == '-') {
+            eneg = true;
+            e++;
+        } else if (*e == '+') {
+            e++;
+        }
+        if (*e >= '0' && *e <= '9') {
+            int ev = 0;
+            while (*e >= '0' && *e <= '9') {
+                if (ev < 10000) ev = ev * 10 + (*e - '0');
+                e++;
+            }
+            exp10 += eneg ? -ev : ev;
+            p = e;
+        }
+    }
+    if (digits > 18 || exp10 > 22 || exp10 < -22) {
+        return (float)strtod(start, end);
+    }
+    *end = p;
+    double val = (double)mantissa;
+    if (exp10 < 0) {
+        val /= pow10_table[-exp10];
+    } else {
+        val *= pow10_table[exp10];
+    }
+    return (float)(neg ? -val : val);
+}
+
+static int parse_int(char *str, char **end) {
+    char *p = str;
+    bool neg = false;
+    if (*p == '-') {
+        neg = true;
+        p++;
+    }
+    int val = 0;
+    while (*p >= '0' && *p <= '9') {
+        val = val * 10 + (*p - '0');
+        p++;
+    }
+    *end = p;
+    return neg ? -val : val;
+}
+
+// Converts a possibly negative (relative) OBJ index to a 0 based index,
+// or -1 if the index is missing or out of range.
+static int resolve_index(int i, int count) {
+    if (i > 0 && i <= count) return i - 1;
+    if (i < 0 && -i <= count) return count + i;
+    return -1;
+}
+
+// Vertex cache optimization using Tom Forsyth's "Linear-Speed Vertex Cache
+// Optimisation" algorithm. Triangles are greedily emitted in order of a
+// score that favours vertices recently used (so likely in the post-transform
+// cache) and vertices with few remaining triangles (so they can be retired
+// from the cache).
+
+#define VCACHE_SIZE 32
+
+static float vcache_vertex_score(int cache_pos, int remaining) {
+    if (remaining == 0) return -1.0f;
+    float score = 0.0f;
+    if (cache_pos >= 0) {
+        if (cache_pos < 3) {
+            // the last triangle's vertices are penalised slightly so the
+            // algorithm doesn't favour long strips
+            score = 0.75f;
+        } else {
+            score = powf(1.0f - (float)(cache_pos - 3) / (float)(VCACHE_SIZE - 3), 1.5f);
+        }
+    }
+    return score + 2.0f / sqrtf((float)remaining);
+}
+
+static void optimize_vertex_cache(uint32_t *indices, int num_indices, int num_vertices) {
+    int num_tris = num_indices / 3;
+    if (num_tris < 2) return;
+
+    // per-vertex lists of triangles not yet emitted
+    std::vector<int> remaining(num_vertices, 0);
+    for (int i = 0; i < num_indices; i++) {
+        remaining[indices[i]]++;
+    }
+    std::vector<int> tri_offset(num_vertices + 1, 0);
+    for (int v = 0; v < num_vertices; v++) {
+        tri_offset[v + 1] = tri_offset[v] + remaining[v];
+    }
+    std::vector<int> tris(num_indices);
+    std::vector<int> fill(tri_offset.begin(), tri_offset.end() - 1);
+    for (int i = 0; i < num_indices; i++) {
+        tris[fill[indices[i]]++] = i / 3;
+    }
+
+    std::vector<int> cache_pos(num_vertices, -1);
+    std::vector<float> vertex_score(num_vertices);
+    for (int v = 0; v < num_vertices; v++) {
+        vertex_score[v] = vcache_vertex_score(-1, remaining[v]);
+    }
+    std::vector<float> tri_score(num_tris);
+    std::vector<char> emitted(num_tris, 0);
+    for (int t = 0; t < num_tris; t++) {
+        tri_score[t] = vertex_score[indices[t * 3]]
+            + vertex_score[indices[t * 3 + 1]]
+            + vertex_score[indices[t * 3 + 2]];
+    }
+
+    std::vector<uint32_t> output(num_indices);
+    int cache[VCACHE_SIZE + 3];
+    int cache_len = 0;
+    int next_unemitted = 0;
+    int best = 0;
+    float best_score = -1.0f;
+    for (int t = 0; t < num_tris; t++) {
+        if (tri_score[t] > best_score) {
+            best_score = tri_score[t];
+            best = t;
+        }
+    }
+
+    for (int n = 0; n < num_tris; n++) {
+        emitted[best] = 1;
+        uint32_t *tri = &indices[best * 3];
+        int new_cache[VCACHE_SIZE + 3];
+        int new_len = 0;
+        for (int k = 0; k < 3; k++) {
+            int v = tri[k];
+            output[n * 3 + k] = v;
+            new_cache[new_len++] = v;
+            // remove the triangle from the vertex's list
+            int *list = &tris[tri_offset[v]];
+            int count = remaining[v];
+            for (int j = 0; j < count; j++) {
+                if (list[j] == best) {
+                    list[j] = list[count - 1];
+                    break;
+                }
+            }
+            remaining[v]--;
+        }
+        for (int i = 0; i < cache_len; i++) {
+            int v = cache[i];
+            if (v != (int)tri[0] && v != (int)tri[1] && v != (int)tri[2]) {
+                new_cache[new_len++] = v;
+            }
+        }
+        for (int i = 0; i < new_len; i++) {
+            int v = new_cache[i];
+            cache_pos[v] = i < VCACHE_SIZE ? i : -1;
+            vertex_score[v] = vcache_vertex_score(cache_pos[v], remaining[v]);
+        }
+        cache_len = am_min(new_len, VCACHE_SIZE);
+        memcpy(cache, new_cache, cache_len * sizeof(int));
+
+        // rescore the triangles using vertices whose scores changed and
+        // pick the best one of those
+        best = -1;
+        best_score = -1.0f;
+        for (int i = 0; i < new_len; i++) {
+            int v = new_cache[i];
+            int *list = &tris[tri_offset[v]];
+            for (int j = 0; j < remaining[v]; j++) {
+                int t = list[j];
+                float score = vertex_score[indices[t * 3]]
+                    + vertex_score[indices[t * 3 + 1]]
+                    + vertex_score[indices[t * 3 + 2]];
+                tri_score[t] = score;
+                if (score > best_score) {
+                    best_score = score;
+                    best = t;
+                }
+            }
+        }
+        if (best < 0) {
+            // nothing in the cache is connected to any remaining
+            // triangles, so start on the next disconnected part
+            while (next_unemitted < num_tris && emitted[next_unemitted]) {
+                next_unemitted++;
+            }
+            best = next_unemitted;
+        }
+    }
+    memcpy(indices, &output[0], num_indices * sizeof(uint32_t));
+}
+
+static float* read_obj(const char *filename, char *str, int len, bool indexed,
         int *size, int *stride, int *normals_offset, int *texture_coords_offset,
+        uint32_t **indices, int *num_indices, int *num_vertices,
         char **errmsg) {
     *errmsg = NULL;
-    std::vector<glm::vec3> vertices;
-    std::vector<glm::vec2> texture_coords;
-    std::vector<glm::vec3> normals;
-    std::vector<t_face> faces;
+    std::vector<float> vertices;
+    std::vector<float> texture_coords;
+    std::vector<float> normals;
+    // 3 per face, since only triangles are supported
+    std::vector<t_face_component> corners;
 
     char *end = str + len;
 
     int line = 1;
+    int num_faces = 0;
     while (str < end) {
         switch (*str) {
             case '#':
@@ -45,33 +280,28 @@ static float* read_obj(const char *filename, char *str, int len,
             case 'v': {
                 str++;
                 switch (*str) {
-                    case ' ': {
+                    case ' ':
+                    case '\t': {
                         str++;
                         // t_vertex
-                        glm::vec3 v;
-                        v.x = strtod(str, &str);
-                        v.y = strtod(str, &str);
-                        v.z = strtod(str, &str);
-                        vertices.push_back(v);
+                        vertices.push_back(parse_float(str, &str));
+                        vertices.push_back(parse_float(str, &str));
+                        vertices.push_back(parse_float(str, &str));
                         break;
                     }
                     case 't': {
                         str++;
                         // texture coord
-                        glm::vec2 t;
-                        t.x = strtod(str, &str);
-                        t.y = strtod(str, &str);
-                        texture_coords.push_back(t);
+                        texture_coords.push_back(parse_float(str, &str));
+                        texture_coords.push_back(parse_float(str, &str));
                         break;
                     }
                     case 'n': {
                         str++;
                         // t_normal
-                        glm::vec3 n;
-                        n.x = strtod(str, &str);
-                        n.y = strtod(str, &str);
-                        n.z = strtod(str, &str);
-                        normals.push_back(n);
+                        normals.push_back(parse_float(str, &str));
+                        normals.push_back(parse_float(str, &str));
+                        normals.push_back(parse_float(str, &str));
                         break;
                     }
                     case 'p': {
@@ -89,32 +319,39 @@ static float* read_obj(const char *filename, char *str, int len,
             case 'f': {
                 str++;
                 // face
-                t_face fa;
-                while (*str != '\n' && *str != '\0') {
+                int nv = vertices.size() / 3;
+                int nt = texture_coords.size() / 2;
+                int nn = normals.size() / 3;
+                int face_size = 0;
+                while (true) {
+                    while (*str != '\n' && *str != '\0' && *str != '-' && (*str < '0' || *str > '9')) {
+                        str++;
+                    }
+                    if (*str == '\n' || *str == '\0') break;
                     t_face_component fc;
-                    fc.v = strtol(str, &str, 10);
+                    fc.v = resolve_index(parse_int(str, &str), nv);
+                    fc.t = -1;
+                    fc.n = -1;
                     if (*str == '/') {
                         str++;
-                        if (*str == '/') {
-                            fc.t = 0;
-                        } else {
-                            fc.t = strtol(str, &str, 10);
+                        if (*str != '/') {
+                            fc.t = resolve_index(parse_int(str, &str), nt);
                         }
                         if (*str == '/') {
                             str++;
-                            if (*str >= '0' && *str <= '9') {
-                                fc.n = strtol(str, &str, 10);
-                            } else {
-                                fc.n = 0;
-                            }
+                            fc.n = resolve_index(parse_int(str, &str), nn);
                         }
                     }
-                    fa.push_back(fc);
-                    while (*str != '\n' && *str != '\0' && *str != '/' && (*str < '0' || *str > '9')) {
-                        str++;
+                    if (face_size < 3) {
+                        corners.push_back(fc);
                     }
+                    face_size++;
+                }
+                if (face_size != 3) {
+                    *errmsg = am_format("%s: sorry, only triangle faces are currently supported (f%d=%d)", filename, num_faces, face_size);
+                    return NULL;
                 }
-                faces.push_back(fa);
+                num_faces++;
                 break;
             }
             default: {
@@ -126,22 +363,13 @@ static float* read_obj(const char *filename, char *str, int len,
         line++;
     }
 
-    int num_faces = faces.size();
     if (num_faces == 0) {
         *errmsg = am_format("%s contains no faces", filename);
         return NULL;
     }
 
-    // Check all faces are triangles
-    for (int i = 0; i < num_faces; i++) {
-        if (faces[i].size() != 3) {
-            *errmsg = am_format("%s: sorry, only triangle faces are currently supported (f%d=%d)", filename, i, faces[i].size());
-            return NULL;
-        }
-    }
-
-    bool has_normals = faces[0][0].n > 0;
-    bool has_texture_coords = faces[0][0].t > 0;   
+    bool has_normals = corners[0].n >= 0;
+    bool has_texture_coords = corners[0].t >= 0;
     *stride = 12;
     if (has_normals) {
         *normals_offset = *stride;
@@ -152,46 +380,102 @@ static float* read_obj(const char *filename, char *str, int len,
         *stride += 8;
     }
 
-    *size = *stride * 3 * num_faces;
-    float *vert_data = (float*)malloc(*size);
-    float *ptr = vert_data;
+    int num_corners = num_faces * 3;
+    for (int i = 0; i < num_corners; i++) {
+        if (corners[i].v < 0) {
+            *errmsg = am_format("%s: missing vertex in face %d, vertex %d", filename, i/3+1, i%3+1);
+            return NULL;
+        }
+        if (has_normals && corners[i].n < 0) {
+            *errmsg = am_format("%s: missing normal in face %d, t_vertex %d", filename, i/3+1, i%3+1);
+            return NULL;
+        }
+        if (has_texture_coords && corners[i].t < 0) {
+            *errmsg = am_format("%s: missing texture coords in face %d, vertex %d", filename, i/3+1, i%3+1);
+            return NULL;
+        }
+        if (!has_normals) corners[i].n = -1;
+        if (!has_texture_coords) corners[i].t = -1;
+    }
 
-    for (int i = 0; i < num_faces; i++) {
-        for (int j = 0; j < 3; j++) {
-            int v = faces[i][j].v - 1;
-            if (v < 0) {
-                free(vert_data);
-                *errmsg = am_format("%s: missing vertex in face %d, vertex %d", filename, i+1, j+1);
-                return NULL;
-            }
-            int n = faces[i][j].n - 1;
-            if (has_normals && n < 0) {
-                free(vert_data);
-                *errmsg = am_format("%s: missing normal in face %d, t_vertex %d", filename, i+1, j+1);
-                return NULL;
+    // corner index of each output vertex
+    std::vector<int> output_corners;
+    if (indexed) {
+        // deduplicate the corners using an open addressing hash table
+        // of unique vertex index + 1
+        uint32_t table_size = 16;
+        while (table_size < (uint32_t)num_corners * 2) table_size *= 2;
+        uint32_t mask = table_size - 1;
+        std::vector<int> table(table_size, 0);
+        std::vector<int> unique_corners;
+        uint32_t *elems = (uint32_t*)malloc(num_corners * sizeof(uint32_t));
+        for (int i = 0; i < num_corners; i++) {
+            t_face_component *c = &corners[i];
+            uint32_t h = ((uint32_t)c->v * 73856093u)
+                ^ ((uint32_t)c->t * 19349663u)
+                ^ ((uint32_t)c->n * 83492791u);
+            uint32_t slot = h & mask;
+            while (true) {
+                int u = table[slot];
+                if (u == 0) {
+                    unique_corners.push_back(i);
+                    table[slot] = unique_corners.size();
+                    elems[i] = unique_corners.size() - 1;
+                    break;
+                }
+                t_face_component *o = &corners[unique_corners[u - 1]];
+                if (o->v == c->v && o->t == c->t && o->n == c->n) {
+                    elems[i] = u - 1;
+                    break;
+                }
+                slot = (slot + 1) & mask;
             }
-            int t = faces[i][j].t - 1;
-            if (has_texture_coords && t < 0) {
-                free(vert_data);
-                *errmsg = am_format("%s: missing texture coords in face %d, vertex %d", filename, i+1, j+1);
-                return NULL;
+        }
+        int nverts = unique_corners.size();
+        optimize_vertex_cache(elems, num_corners, nverts);
+
+        // renumber the vertices in the order they're first used, so
+        // vertex fetches are also mostly sequential
+        std::vector<int> remap(nverts, -1);
+        output_corners.resize(nverts);
+        int next = 0;
+        for (int i = 0; i < num_corners; i++) {
+            int u = elems[i];
+            if (remap[u] < 0) {
+                remap[u] = next;
+                output_corners[next] = unique_corners[u];
+                next++;
             }
+            elems[i] = remap[u];
+        }
+        *indices = elems;
+        *num_indices = num_corners;
+        *num_vertices = nverts;
+    } else {
+        output_corners.resize(num_corners);
+        for (int i = 0; i < num_corners; i++) {
+            output_corners[i] = i;
+        }
+        *indices = NULL;
+        *num_indices = 0;
+        *num_vertices = num_corners;
+    }
 
-            ptr[0] = vertices[v].x;
-            ptr[1] = vertices[v].y;
-            ptr[2] = vertices[v].z;
+    *size = *stride * *num_vertices;
+    float *vert_data = (float*)malloc(*size);
+    float *ptr = vert_data;
+
+    for (int i = 0; i < *num_vertices; i++) {
+        t_face_component *c = &corners[output_corners[i]];
+        memcpy(ptr, &vertices[c->v * 3], 3 * sizeof(float));
+        ptr += 3;
+        if (c->n >= 0) {
+            memcpy(ptr, &normals[c->n * 3], 3 * sizeof(float));
             ptr += 3;
-            if (n >= 0) {
-                ptr[0] = normals[n].x;
-                ptr[1] = normals[n].y;
-                ptr[2] = normals[n].z;
-                ptr += 3;
-            }
-            if (t >= 0) {
-                ptr[0] = texture_coords[t].x;
-                ptr[1] = texture_coords[t].y;
-                ptr += 2;
-            }
+        }
+        if (c->t >= 0) {
+            memcpy(ptr, &texture_coords[c->t * 2], 2 * sizeof(float));
+            ptr += 2;
         }
     }
 
@@ -199,8 +483,9 @@ static float* read_obj(const char *filename, char *str, int len,
 }
 
 static int load_obj(lua_State *L) {
-    am_check_nargs(L, 1);
+    int nargs = am_check_nargs(L, 1);
     const char *filename = luaL_checkstring(L, 1);
+    bool indexed = nargs > 1 && lua_toboolean(L, 2);
     char *errmsg = NULL;
 
     int len;
@@ -210,13 +495,20 @@ static int load_obj(lua_State *L) {
         free(errmsg);
         return lua_error(L);
     }
+    // the parser relies on the text being null terminated
+    str = (char*)realloc(str, len + 1);
+    str[len] = '\0';
 
     int size;
     int stride;
     int normals_offset = -1;
     int texture_coords_offset = -1;
-    uint8_t *data = (uint8_t*)read_obj(filename, str, len, &size,
-        &stride, &normals_offset, &texture_coords_offset, &errmsg);
+    uint32_t *indices = NULL;
+    int num_indices = 0;
+    int num_vertices = 0;
+    uint8_t *data = (uint8_t*)read_obj(filename, str, len, indexed, &size,
+        &stride, &normals_offset, &texture_coords_offset,
+        &indices, &num_indices, &num_vertices, &errmsg);
     free(str);
     if (data == NULL) {
         lua_pushstring(L, errmsg);
@@ -235,12 +527,504 @@ static int load_obj(lua_State *L) {
     } else {
         lua_pushnil(L);
     }
-    return 4;
+    if (!indexed) {
+        return 4;
+    }
+
+    am_buffer_view_type elem_type;
+    int elem_size;
+    if (num_vertices <= 65535) {
+        // narrow the indices in place
+        uint16_t *indices16 = (uint16_t*)indices;
+        for (int i = 0; i < num_indices; i++) {
+            indices16[i] = (uint16_t)indices[i];
+        }
+        elem_type = AM_VIEW_TYPE_U16E;
+        elem_size = 2;
+    } else {
+        elem_type = AM_VIEW_TYPE_U32E;
+        elem_size = 4;
+    }
+    am_push_new_buffer_with_data(L, num_indices * elem_size, indices);
+    am_buffer_view *view = am_new_buffer_view(L, elem_type, 1);
+    view->buffer = am_get_userdata(L, am_buffer, -2);
+    view->buffer_ref = view->ref(L, -2);
+    view->offset = 0;
+    view->stride = elem_size;
+    view->size = num_indices;
+    lua_remove(L, -2); // elements buffer
+    return 5;
+}
+
+// Binary glTF (.glb) loading. The file is loaded into a single buffer
+// and the accessors are mapped to views of the binary chunk in that
+// buffer, so the vertex and index data isn't copied.
+
+#define GLB_MAGIC       0x46546C67 // "glTF"
+#define GLB_CHUNK_JSON  0x4E4F534A // "JSON"
+#define GLB_CHUNK_BIN   0x004E4942 // "BIN\0"
+
+#define GLTF_BYTE           5120
+#define GLTF_UNSIGNED_BYTE  5121
+#define GLTF_SHORT          5122
+#define GLTF_UNSIGNED_SHORT 5123
+#define GLTF_UNSIGNED_INT   5125
+#define GLTF_FLOAT          5126
+
+struct glb_state {
+    const char *filename;
+    am_buffer *buf;     // contains the whole file
+    int buf_idx;
+    int json_idx;       // the parsed json chunk
+    int views_idx;      // views already created, keyed by accessor
+    int bin_offset;     // offset of the binary chunk data in buf
+    int bin_size;       // -1 if there's no binary chunk
+};
+
+static uint32_t read_u32le(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int get_int_field(lua_State *L, int idx, const char *field, int def) {
+    lua_getfield(L, idx, field);
+    int val = lua_isnumber(L, -1) ? (int)lua_tointeger(L, -1) : def;
+    lua_pop(L, 1);
+    return val;
+}
+
+// Pushes json[array][i + 1], or nil if there's no such element.
+static void push_gltf_element(lua_State *L, glb_state *state, const char *array, int i) {
+    lua_getfield(L, state->json_idx, array);
+    if (lua_istable(L, -1)) {
+        lua_rawgeti(L, -1, i + 1);
+    } else {
+        lua_pushnil(L);
+    }
+    lua_remove(L, -2);
+}
+
+// Pushes a table of the 1 based indices in the given field, which should
+// be an array of 0 based indices.
+static void push_gltf_indices(lua_State *L, int idx, const char *field) {
+    lua_newtable(L);
+    lua_getfield(L, idx, field);
+    if (lua_istable(L, -1)) {
+        int n = lua_objlen(L, -1);
+        for (int i = 1; i <= n; i++) {
+            lua_rawgeti(L, -1, i);
+            lua_pushinteger(L, lua_tointeger(L, -1) + 1);
+            lua_rawseti(L, -4, i);
+            lua_pop(L, 1);
+        }
+    }
+    lua_pop(L, 1);
+}
+
+static void push_accessor_view(lua_State *L, glb_state *state, int accessor, bool elements) {
+    luaL_checkstack(L, 8, "GLB too deeply nested");
+    // views used as element arrays have different types, so are kept
+    // under negative keys
+    int key = elements ? -(accessor + 1) : accessor + 1;
+    lua_rawgeti(L, state->views_idx, key);
+    if (!lua_isnil(L, -1)) return;
+    lua_pop(L, 1);
+
+    const char *filename = state->filename;
+    push_gltf_element(L, state, "accessors", accessor);
+    if (!lua_istable(L, -1)) {
+        luaL_error(L, "%s: missing accessor %d", filename, accessor);
+    }
+    int acc_idx = lua_gettop(L);
+    lua_getfield(L, acc_idx, "sparse");
+    if (!lua_isnil(L, -1)) {
+        luaL_error(L, "%s: sparse accessors are not supported (accessor %d)", filename, accessor);
+    }
+    lua_pop(L, 1);
+    int buffer_view = get_int_field(L, acc_idx, "bufferView", -1);
+    if (buffer_view < 0) {
+        luaL_error(L, "%s: accessors without buffer views are not supported (accessor %d)", filename, accessor);
+    }
+    int component_type = get_int_field(L, acc_idx, "componentType", 0);
+    int count = get_int_field(L, acc_idx, "count", 0);
+    int acc_offset = get_int_field(L, acc_idx, "byteOffset", 0);
+    lua_getfield(L, acc_idx, "normalized");
+    bool normalized = lua_toboolean(L, -1);
+    lua_pop(L, 1);
+    lua_getfield(L, acc_idx, "type");
+    const char *type_name = lua_tostring(L, -1);
+    int components = 0;
+    if (type_name == NULL) {
+        components = 0;
+    } else if (strcmp(type_name, "SCALAR") == 0) {
+        components = 1;
+    } else if (strcmp(type_name, "VEC2") == 0) {
+        components = 2;
+    } else if (strcmp(type_name, "VEC3") == 0) {
+        components = 3;
+    } else if (strcmp(type_name, "VEC4") == 0 || strcmp(type_name, "MAT2") == 0) {
+        components = 4;
+    } else if (strcmp(type_name, "MAT3") == 0) {
+        components = 9;
+    } else if (strcmp(type_name, "MAT4") == 0) {
+        components = 16;
+    }
+    lua_pop(L, 1);
+    if (components == 0) {
+        luaL_error(L, "%s: unsupported type for accessor %d", filename, accessor);
+    }
+    if (components > 4 && component_type != GLTF_FLOAT) {
+        luaL_error(L, "%s: only float matrices are supported (accessor %d)", filename, accessor);
+    }
+
+    push_gltf_element(L, state, "bufferViews", buffer_view);
+    if (!lua_istable(L, -1)) {
+        luaL_error(L, "%s: missing buffer view %d", filename, buffer_view);
+    }
+    int bv_idx = lua_gettop(L);
+    if (get_int_field(L, bv_idx, "buffer", 0) != 0 || state->bin_size < 0) {
+        luaL_error(L, "%s: only the binary chunk is supported as a buffer (buffer view %d)", filename, buffer_view);
+    }
+    int bv_offset = get_int_field(L, bv_idx, "byteOffset", 0);
+    int bv_length = get_int_field(L, bv_idx, "byteLength", 0);
+    int bv_stride = get_int_field(L, bv_idx, "byteStride", 0);
+    lua_pop(L, 1); // buffer view
+
+    am_buffer_view_type type;
+    switch (component_type) {
+        case GLTF_BYTE:
+            type = normalized ? AM_VIEW_TYPE_I8N : AM_VIEW_TYPE_I8;
+            break;
+        case GLTF_UNSIGNED_BYTE:
+            type = normalized ? AM_VIEW_TYPE_U8N : AM_VIEW_TYPE_U8;
+            break;
+        case GLTF_SHORT:
+            type = normalized ? AM_VIEW_TYPE_I16N : AM_VIEW_TYPE_I16;
+            break;
+        case GLTF_UNSIGNED_SHORT:
+            type = elements ? AM_VIEW_TYPE_U16E :
+                normalized ? AM_VIEW_TYPE_U16N : AM_VIEW_TYPE_U16;
+            break;
+        case GLTF_UNSIGNED_INT:
+            type = elements ? AM_VIEW_TYPE_U32E : AM_VIEW_TYPE_U32;
+            break;
+        case GLTF_FLOAT:
+            type = AM_VIEW_TYPE_F32;
+            break;
+        default:
+            luaL_error(L, "%s: unsupported component type %d (accessor %d)", filename, component_type, accessor);
+            return;
+    }
+    if (elements && (components != 1 || (component_type != GLTF_UNSIGNED_BYTE
+        && component_type != GLTF_UNSIGNED_SHORT && component_type != GLTF_UNSIGNED_INT)))
+    {
+        luaL_error(L, "%s: invalid indices accessor %d", filename, accessor);
+    }
+
+    int type_size = am_view_type_infos[type].size * components;
+    int stride = bv_stride > 0 ? bv_stride : type_size;
+    if (bv_offset < 0 || bv_length < 0 || acc_offset < 0 || count < 0
+        || (int64_t)bv_offset + bv_length > state->bin_size
+        || (count > 0 && (int64_t)acc_offset + (int64_t)(count - 1) * stride + type_size > bv_length))
+    {
+        luaL_error(L, "%s: accessor %d is out of range", filename, accessor);
+    }
+    int offset = state->bin_offset + bv_offset + acc_offset;
+
+    am_buffer_view *view;
+    if (elements && component_type == GLTF_UNSIGNED_BYTE) {
+        // byte indices can't be drawn, so widen them
+        uint16_t *indices = (uint16_t*)malloc(am_max(count, 1) * 2);
+        uint8_t *src = state->buf->data + offset;
+        for (int i = 0; i < count; i++) {
+            indices[i] = src[i * stride];
+        }
+        am_push_new_buffer_with_data(L, count * 2, indices);
+        view = am_new_buffer_view(L, AM_VIEW_TYPE_U16E, 1);
+        view->buffer = am_get_userdata(L, am_buffer, -2);
+        view->buffer_ref = view->ref(L, -2);
+        view->offset = 0;
+        view->stride = 2;
+        lua_remove(L, -2); // indices buffer
+    } else {
+        view = am_new_buffer_view(L, type, components);
+        view->buffer = state->buf;
+        view->buffer_ref = view->ref(L, state->buf_idx);
+        view->offset = offset;
+        view->stride = stride;
+    }
+    view->size = count;
+    lua_remove(L, acc_idx);
+
+    lua_pushvalue(L, -1);
+    lua_rawseti(L, state->views_idx, key);
+}
+
+static const char *gltf_modes[] = {
+    "points",
+    "lines",
+    "line_loop",
+    "line_strip",
+    "triangles",
+    "triangle_strip",
+    "triangle_fan",
+};
+
+static void push_glb_primitive(lua_State *L, glb_state *state, int prim_idx) {
+    luaL_checkstack(L, 8, "GLB too deeply nested");
+    lua_newtable(L);
+    int mode = get_int_field(L, prim_idx, "mode", 4);
+    if (mode < 0 || mode > 6) {
+        luaL_error(L, "%s: invalid primitive mode %d", state->filename, mode);
+    }
+    lua_pushstring(L, gltf_modes[mode]);
+    lua_setfield(L, -2, "mode");
+
+    lua_newtable(L);
+    lua_getfield(L, prim_idx, "attributes");
+    if (lua_istable(L, -1)) {
+        lua_pushnil(L);
+        while (lua_next(L, -2) != 0) {
+            int accessor = lua_tointeger(L, -1);
+            lua_pop(L, 1);
+            lua_pushvalue(L, -1); // attribute name
+            push_accessor_view(L, state, accessor, false);
+            lua_rawset(L, -5);
+        }
+    }
+    lua_pop(L, 1);
+    lua_setfield(L, -2, "attributes");
+
+    int indices = get_int_field(L, prim_idx, "indices", -1);
+    if (indices >= 0) {
+        push_accessor_view(L, state, indices, true);
+        lua_setfield(L, -2, "elements");
+    }
+    int material = get_int_field(L, prim_idx, "material", -1);
+    if (material >= 0) {
+        lua_pushinteger(L, material + 1);
+        lua_setfield(L, -2, "material");
+    }
+}
+
+static void push_glb_meshes(lua_State *L, glb_state *state) {
+    luaL_checkstack(L, 8, "GLB too deeply nested");
+    lua_newtable(L);
+    lua_getfield(L, state->json_idx, "meshes");
+    if (!lua_istable(L, -1)) {
+        lua_pop(L, 1);
+        return;
+    }
+    int n = lua_objlen(L, -1);
+    for (int i = 1; i <= n; i++) {
+        lua_rawgeti(L, -1, i);
+        int mesh_idx = lua_gettop(L);
+        lua_newtable(L);
+        lua_getfield(L, mesh_idx, "name");
+        lua_setfield(L, -2, "name");
+        lua_newtable(L);
+        lua_getfield(L, mesh_idx, "primitives");
+        if (lua_istable(L, -1)) {
+            int np = lua_objlen(L, -1);
+            for (int j = 1; j <= np; j++) {
+                lua_rawgeti(L, -1, j);
+                push_glb_primitive(L, state, lua_gettop(L));
+                lua_rawseti(L, -4, j);
+                lua_pop(L, 1); // json primitive
+            }
+        }
+        lua_pop(L, 1);
+        lua_setfield(L, -2, "primitives");
+        lua_rawseti(L, -4, i);
+        lua_pop(L, 1); // json mesh
+    }
+    lua_pop(L, 1);
+}
+
+// Reads up to n numbers from the array in the given field. Returns false
+// if the field isn't present.
+static bool get_number_array_field(lua_State *L, int idx, const char *field, double *vals, int n) {
+    lua_getfield(L, idx, field);
+    if (!lua_istable(L, -1)) {
+        lua_pop(L, 1);
+        return false;
+    }
+    for (int i = 0; i < n; i++) {
+        lua_rawgeti(L, -1, i + 1);
+        if (lua_isnumber(L, -1)) {
+            vals[i] = lua_tonumber(L, -1);
+        }
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+    return true;
+}
+
+static void push_glb_nodes(lua_State *L, glb_state *state) {
+    luaL_checkstack(L, 8, "GLB too deeply nested");
+    lua_newtable(L);
+    lua_getfield(L, state->json_idx, "nodes");
+    if (!lua_istable(L, -1)) {
+        lua_pop(L, 1);
+        return;
+    }
+    int n = lua_objlen(L, -1);
+    for (int i = 1; i <= n; i++) {
+        lua_rawgeti(L, -1, i);
+        int node_idx = lua_gettop(L);
+        lua_newtable(L);
+        lua_getfield(L, node_idx, "name");
+        lua_setfield(L, -2, "name");
+        int mesh = get_int_field(L, node_idx, "mesh", -1);
+        if (mesh >= 0) {
+            lua_pushinteger(L, mesh + 1);
+            lua_setfield(L, -2, "mesh");
+        }
+        push_gltf_indices(L, node_idx, "children");
+        lua_setfield(L, -2, "children");
+
+        glm::dmat4 m(1.0);
+        if (!get_number_array_field(L, node_idx, "matrix", glm::value_ptr(m), 16)) {
+            double t[3] = {0.0, 0.0, 0.0};
+            double r[4] = {0.0, 0.0, 0.0, 1.0};
+            double s[3] = {1.0, 1.0, 1.0};
+            get_number_array_field(L, node_idx, "translation", t, 3);
+            get_number_array_field(L, node_idx, "rotation", r, 4);
+            get_number_array_field(L, node_idx, "scale", s, 3);
+            m = glm::translate(glm::dmat4(1.0), glm::dvec3(t[0], t[1], t[2]))
+                * glm::mat4_cast(glm::dquat(r[3], r[0], r[1], r[2]))
+                * glm::scale(glm::dmat4(1.0), glm::dvec3(s[0], s[1], s[2]));
+        }
+        am_mat4 *mat = am_new_userdata(L, am_mat4);
+        mat->m = m;
+        lua_setfield(L, -2, "transform");
+
+        lua_rawseti(L, -4, i);
+        lua_pop(L, 1); // json node
+    }
+    lua_pop(L, 1);
+}
+
+// Pushes the root nodes of the default scene. If there are no scenes
+// the roots are all the nodes that aren't children of other nodes.
+static void push_glb_roots(lua_State *L, glb_state *state, int nodes_idx) {
+    int scene = get_int_field(L, state->json_idx, "scene", 0);
+    push_gltf_element(L, state, "scenes", scene);
+    if (lua_istable(L, -1)) {
+        push_gltf_indices(L, lua_gettop(L), "nodes");
+        lua_remove(L, -2);
+        return;
+    }
+    lua_pop(L, 1);
+    int n = lua_objlen(L, nodes_idx);
+    std::vector<bool> is_child(n + 1, false);
+    for (int i = 1; i <= n; i++) {
+        lua_rawgeti(L, nodes_idx, i);
+        lua_getfield(L, -1, "children");
+        int nc = lua_objlen(L, -1);
+        for (int j = 1; j <= nc; j++) {
+            lua_rawgeti(L, -1, j);
+            int c = lua_tointeger(L, -1);
+            if (c >= 1 && c <= n) is_child[c] = true;
+            lua_pop(L, 1);
+        }
+        lua_pop(L, 2);
+    }
+    lua_newtable(L);
+    int r = 1;
+    for (int i = 1; i <= n; i++) {
+        if (!is_child[i]) {
+            lua_pushinteger(L, i);
+            lua_rawseti(L, -2, r++);
+        }
+    }
+}
+
+static int load_glb(lua_State *L) {
+    am_check_nargs(L, 1);
+    const char *filename = luaL_checkstring(L, 1);
+    int len;
+    char *errmsg = NULL;
+    am_buffer *buf = NULL;
+    am_package *pkg = am_get_resource_package(filename);
+    if (pkg != NULL) {
+        // stored package entries can be used without copying
+        void *data = am_map_package_resource(pkg, filename, &len);
+        if (data != NULL) {
+            buf = am_push_new_buffer_with_package_data(L, len, data, pkg);
+        }
+    }
+    if (buf == NULL) {
+        void *data = am_read_resource(filename, &len, &errmsg);
+        if (data == NULL) {
+            lua_pushstring(L, errmsg);
+            free(errmsg);
+            return lua_error(L);
+        }
+        buf = am_push_new_buffer_with_data(L, len, data);
+    }
+    buf->origin = filename;
+    buf->ref(L, 1);
+
+    glb_state state;
+    state.filename = filename;
+    state.buf = buf;
+    state.buf_idx = lua_gettop(L);
+    state.bin_size = -1;
+    state.bin_offset = 0;
+
+    uint8_t *data = buf->data;
+    if (len < 20 || read_u32le(data) != GLB_MAGIC) {
+        return luaL_error(L, "%s is not a GLB file", filename);
+    }
+    if (read_u32le(data + 4) != 2) {
+        return luaL_error(L, "%s: only version 2 GLB files are supported", filename);
+    }
+    int total = (int)am_min(read_u32le(data + 8), (uint32_t)len);
+    uint32_t json_len = read_u32le(data + 12);
+    if (read_u32le(data + 16) != GLB_CHUNK_JSON || json_len > (uint32_t)(total - 20)) {
+        return luaL_error(L, "%s: missing JSON chunk", filename);
+    }
+    int pos = 20 + json_len;
+    while (pos + 8 <= total) {
+        uint32_t chunk_len = read_u32le(data + pos);
+        uint32_t chunk_type = read_u32le(data + pos + 4);
+        if (chunk_len > (uint32_t)(total - pos - 8)) {
+            return luaL_error(L, "%s: truncated chunk", filename);
+        }
+        if (chunk_type == GLB_CHUNK_BIN) {
+            state.bin_offset = pos + 8;
+            state.bin_size = chunk_len;
+            break;
+        }
+        // unknown chunks must be ignored
+        pos += 8 + chunk_len;
+    }
+
+    if (am_parse_json_data(L, (const char*)data + 20, json_len) != 1) {
+        return luaL_error(L, "%s: %s", filename, lua_tostring(L, -1));
+    }
+    state.json_idx = lua_gettop(L);
+    lua_newtable(L);
+    state.views_idx = lua_gettop(L);
+
+    lua_newtable(L);
+    lua_pushvalue(L, state.buf_idx);
+    lua_setfield(L, -2, "buffer");
+    push_glb_meshes(L, &state);
+    lua_setfield(L, -2, "meshes");
+    push_glb_nodes(L, &state);
+    push_glb_roots(L, &state, lua_gettop(L));
+    lua_setfield(L, -3, "roots");
+    lua_setfield(L, -2, "nodes");
+    lua_pushvalue(L, state.json_idx);
+    lua_setfield(L, -2, "gltf");
+    return 1;
 }
 
 void am_open_model_module(lua_State *L) {
     luaL_Reg funcs[] = {
         {"load_obj", load_obj},
+        {"load_glb", load_glb},
         {NULL, NULL}
     };
     am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
@@ -75,7 +75,8 @@ static bool help_pack() {
     printf(
        /*-------------------------------------------------------------------------------*/
         "Usage: amulet pack -png <filename.png> -lua <filename.lua> \n"
-        "                   [-mono] [-minfilter <filter>] [-magfilter <filter>]\n"
+        "                   [-mono] [-sdf] [-sdf-range <pixels>]\n"
+        "                   [-minfilter <filter>] [-magfilter <filter>]\n"
         "                   [-no-premult] [-keep-padding] [-no-border] <files> ...\n"
         "\n"
         "  Packs images and/or fonts into a sprite sheet and generates a Lua\n"
@@ -85,6 +86,10 @@ static bool help_pack() {
         "  -png <filename.png>      The name of the png file to generate.\n"
         "  -lua <filename.lua>      The name of the Lua module to generate.\n"
         "  -mono                    Do not anti-alias fonts.\n"
+        "  -sdf                     Generate signed distance fields for font glyphs,\n"
+        "                           so the text can be drawn at any scale.\n"
+        "  -sdf-range <pixels>      The range of distances stored for -sdf fonts\n"
+        "                           (default is 4).\n"
         "  -minfilter               nearest or linear (default is linear).\n"
         "  -magfilter               nearest or linear (default is linear).\n"
         "  -no-premult              Do not pre-multiply RGB channels by alpha.\n"
@@ -1,10 +1,238 @@
 #include "amulet.h"
 
+#if !defined(AM_WINDOWS) && !defined(AM_HTML)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#define AM_PACKAGE_MMAP
+#endif
+
+struct am_package_entry {
+    uint32_t hash;
+    uint32_t name_offset;
+    uint32_t name_len;
+    int method;
+    bool encrypted;
+    uint64_t comp_size;
+    uint64_t uncomp_size;
+    uint64_t local_header_ofs;
+    int64_t data_ofs; // -1 until resolved from the local header
+    void *cached;
+    int pins; // pinned entries aren't evicted
+    int lru_prev;
+    int lru_next;
+};
+
+static uint32_t hash_name(const char *name, size_t len) {
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (uint8_t)name[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static bool map_package(am_package *pkg, const char *filename) {
+#if defined(AM_PACKAGE_MMAP)
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+    // keep the file open for mapping views of individual entries
+    pkg->map_fd = fd;
+    pkg->map_data = (uint8_t*)data;
+    pkg->map_size = (size_t)st.st_size;
+    return true;
+#elif defined(AM_WINDOWS)
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    // the mapping keeps the file open
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL) return false;
+    void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        CloseHandle(mapping);
+        return false;
+    }
+    pkg->map_handle = mapping;
+    pkg->map_data = (uint8_t*)data;
+    pkg->map_size = (size_t)size.QuadPart;
+    return true;
+#else
+    return false;
+#endif
+}
+
+static void unmap_package(am_package *pkg) {
+    if (pkg->map_data == NULL) return;
+#if defined(AM_PACKAGE_MMAP)
+    munmap(pkg->map_data, pkg->map_size);
+    close(pkg->map_fd);
+#elif defined(AM_WINDOWS)
+    UnmapViewOfFile(pkg->map_data);
+    CloseHandle((HANDLE)pkg->map_handle);
+#endif
+    pkg->map_data = NULL;
+    pkg->map_size = 0;
+}
+
+// Views must start at a multiple of this.
+static size_t map_granularity() {
+#if defined(AM_PACKAGE_MMAP)
+    return (size_t)sysconf(_SC_PAGESIZE);
+#elif defined(AM_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwAllocationGranularity;
+#else
+    return 1;
+#endif
+}
+
+// Maps a private copy-on-write view of size bytes of the package
+// at offset ofs.
+static void *map_view(am_package *pkg, uint64_t ofs, size_t size) {
+    uint64_t base_ofs = ofs - ofs % map_granularity();
+    size_t view_size = (size_t)(ofs - base_ofs) + size;
+#if defined(AM_PACKAGE_MMAP)
+    void *base = mmap(NULL, view_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, pkg->map_fd, (off_t)base_ofs);
+    if (base == MAP_FAILED) return NULL;
+#elif defined(AM_WINDOWS)
+    void *base = MapViewOfFile((HANDLE)pkg->map_handle, FILE_MAP_COPY,
+        (DWORD)(base_ofs >> 32), (DWORD)(base_ofs & 0xFFFFFFFF), view_size);
+    if (base == NULL) return NULL;
+#else
+    return NULL;
+#endif
+    return (uint8_t*)base + (ofs - base_ofs);
+}
+
+static void unmap_view(void *data, size_t size) {
+    // views start on a multiple of the granularity
+    size_t gran = map_granularity();
+    uint8_t *base = (uint8_t*)((uintptr_t)data - (uintptr_t)data % gran);
+#if defined(AM_PACKAGE_MMAP)
+    munmap(base, (size_t)((uint8_t*)data - base) + size);
+#elif defined(AM_WINDOWS)
+    UnmapViewOfFile(base);
+#endif
+}
+
+static void build_index(am_package *pkg) {
+    mz_zip_archive *zip = (mz_zip_archive*)pkg->handle;
+    int n = (int)mz_zip_reader_get_num_files(zip);
+    pkg->num_entries = n;
+    pkg->entries = (am_package_entry*)malloc(sizeof(am_package_entry) * am_max(n, 1));
+
+    // collect the entry names into one block
+    size_t names_size = 0;
+    for (int i = 0; i < n; i++) {
+        names_size += mz_zip_reader_get_filename(zip, i, NULL, 0);
+    }
+    pkg->names = (char*)malloc(am_max(names_size, (size_t)1));
+
+    uint32_t capacity = 16;
+    while (capacity < (uint32_t)n * 2) capacity *= 2;
+    pkg->index = (int*)malloc(sizeof(int) * capacity);
+    memset(pkg->index, 0, sizeof(int) * capacity);
+    pkg->index_mask = capacity - 1;
+
+    uint32_t name_offset = 0;
+    for (int i = 0; i < n; i++) {
+        am_package_entry *entry = &pkg->entries[i];
+        char *name = pkg->names + name_offset;
+        // includes the nul terminator
+        uint32_t name_size = mz_zip_reader_get_filename(zip, i, name, (mz_uint)(names_size - name_offset));
+        mz_zip_archive_file_stat stat;
+        if (name_size == 0 || !mz_zip_reader_file_stat(zip, i, &stat)) {
+            entry->name_offset = name_offset;
+            entry->name_len = 0;
+            entry->hash = 0;
+            entry->method = -1;
+            entry->encrypted = false;
+            entry->comp_size = 0;
+            entry->uncomp_size = 0;
+            entry->local_header_ofs = 0;
+        } else {
+            entry->name_offset = name_offset;
+            entry->name_len = name_size - 1;
+            entry->hash = hash_name(name, entry->name_len);
+            entry->method = stat.m_method;
+            entry->encrypted = (stat.m_bit_flag & 1) != 0;
+            entry->comp_size = stat.m_comp_size;
+            entry->uncomp_size = stat.m_uncomp_size;
+            entry->local_header_ofs = stat.m_local_header_ofs;
+            // Keep the first entry with a given name, which is what
+            // mz_zip_reader_locate_file would find.
+            uint32_t slot = entry->hash & pkg->index_mask;
+            bool duplicate = false;
+            while (pkg->index[slot] != 0) {
+                am_package_entry *other = &pkg->entries[pkg->index[slot] - 1];
+                if (other->hash == entry->hash && other->name_len == entry->name_len
+                    && memcmp(pkg->names + other->name_offset, name, entry->name_len) == 0)
+                {
+                    duplicate = true;
+                    break;
+                }
+                slot = (slot + 1) & pkg->index_mask;
+            }
+            if (!duplicate) pkg->index[slot] = i + 1;
+        }
+        entry->data_ofs = -1;
+        entry->cached = NULL;
+        entry->pins = 0;
+        entry->lru_prev = -1;
+        entry->lru_next = -1;
+        name_offset += name_size;
+    }
+}
+
+static int find_entry(am_package *pkg, const char *filename) {
+    size_t len = strlen(filename);
+    uint32_t hash = hash_name(filename, len);
+    uint32_t slot = hash & pkg->index_mask;
+    while (pkg->index[slot] != 0) {
+        int i = pkg->index[slot] - 1;
+        am_package_entry *entry = &pkg->entries[i];
+        if (entry->hash == hash && entry->name_len == len
+            && memcmp(pkg->names + entry->name_offset, filename, len) == 0)
+        {
+            return i;
+        }
+        slot = (slot + 1) & pkg->index_mask;
+    }
+    return -1;
+}
+
 am_package* am_open_package(const char *filename, char **errmsg) {
     am_package *pkg = (am_package*)malloc(sizeof(am_package));
+    memset(pkg, 0, sizeof(am_package));
     pkg->handle = (mz_zip_archive*)malloc(sizeof(mz_zip_archive));
     memset(pkg->handle, 0, sizeof(mz_zip_archive));
-    if (!mz_zip_reader_init_file((mz_zip_archive*)pkg->handle, filename, MZ_ZIP_FLAG_CASE_SENSITIVE)) {
+    bool ok;
+    if (map_package(pkg, filename)) {
+        ok = mz_zip_reader_init_mem((mz_zip_archive*)pkg->handle, pkg->map_data, pkg->map_size, 0);
+    } else {
+        ok = mz_zip_reader_init_file((mz_zip_archive*)pkg->handle, filename, 0);
+    }
+    if (!ok) {
+        unmap_package(pkg);
         free(pkg->handle);
         free(pkg);
         *errmsg = am_format("unable to open file %s", filename);
@@ -12,29 +240,468 @@ am_package* am_open_package(const char *filename, char **errmsg) {
     }
     pkg->filename = (char*)malloc(strlen(filename) + 1);
     strcpy(pkg->filename, filename);
+    build_index(pkg);
+    pkg->mutex = am_create_mutex();
+    pkg->refs = 1;
+    pkg->lru_head = -1;
+    pkg->lru_tail = -1;
+    pkg->cache_bytes = 0;
+    pkg->cache_limit = AM_PACKAGE_CACHE_SIZE;
     return pkg;
 }
 
-void am_close_package(am_package *pkg) {
+static void free_package(am_package *pkg) {
+    for (int i = 0; i < pkg->num_entries; i++) {
+        if (pkg->entries[i].cached != NULL) {
+            free(pkg->entries[i].cached);
+        }
+    }
     mz_zip_reader_end((mz_zip_archive*)pkg->handle);
+    unmap_package(pkg);
+    am_destroy_mutex(pkg->mutex);
+    free(pkg->entries);
+    free(pkg->names);
+    free(pkg->index);
     free(pkg->filename);
     free(pkg->handle);
     free(pkg);
 }
 
+void am_retain_package(am_package *pkg) {
+    am_lock_mutex(pkg->mutex);
+    pkg->refs++;
+    am_unlock_mutex(pkg->mutex);
+}
+
+void am_release_package(am_package *pkg) {
+    am_lock_mutex(pkg->mutex);
+    int refs = --pkg->refs;
+    am_unlock_mutex(pkg->mutex);
+    if (refs == 0) {
+        free_package(pkg);
+    }
+}
+
+void am_close_package(am_package *pkg) {
+    am_release_package(pkg);
+}
+
+// The following cache functions must be called with the package mutex held.
+
+static void cache_unlink(am_package *pkg, int i) {
+    am_package_entry *entry = &pkg->entries[i];
+    if (entry->lru_prev != -1) {
+        pkg->entries[entry->lru_prev].lru_next = entry->lru_next;
+    } else {
+        pkg->lru_head = entry->lru_next;
+    }
+    if (entry->lru_next != -1) {
+        pkg->entries[entry->lru_next].lru_prev = entry->lru_prev;
+    } else {
+        pkg->lru_tail = entry->lru_prev;
+    }
+    entry->lru_prev = -1;
+    entry->lru_next = -1;
+}
+
+static void cache_push_front(am_package *pkg, int i) {
+    am_package_entry *entry = &pkg->entries[i];
+    entry->lru_prev = -1;
+    entry->lru_next = pkg->lru_head;
+    if (pkg->lru_head != -1) {
+        pkg->entries[pkg->lru_head].lru_prev = i;
+    } else {
+        pkg->lru_tail = i;
+    }
+    pkg->lru_head = i;
+}
+
+static void cache_insert(am_package *pkg, int i, void *data) {
+    am_package_entry *entry = &pkg->entries[i];
+    int evict = pkg->lru_tail;
+    while (evict != -1 && pkg->cache_bytes + entry->uncomp_size > pkg->cache_limit) {
+        int prev = pkg->entries[evict].lru_prev;
+        if (pkg->entries[evict].pins == 0) {
+            cache_unlink(pkg, evict);
+            free(pkg->entries[evict].cached);
+            pkg->entries[evict].cached = NULL;
+            pkg->cache_bytes -= pkg->entries[evict].uncomp_size;
+        }
+        evict = prev;
+    }
+    entry->cached = data;
+    pkg->cache_bytes += entry->uncomp_size;
+    cache_push_front(pkg, i);
+}
+
+// Returns the cached data of the entry, or NULL if it isn't cached.
+static void *cache_lookup(am_package *pkg, int i) {
+    am_package_entry *entry = &pkg->entries[i];
+    if (entry->cached == NULL) return NULL;
+    if (pkg->lru_head != i) {
+        cache_unlink(pkg, i);
+        cache_push_front(pkg, i);
+    }
+    return entry->cached;
+}
+
+// Entries bigger than a quarter of the cache would evict too much.
+static bool cacheable(am_package *pkg, am_package_entry *entry, size_t sz) {
+    return entry->cached == NULL && sz == entry->uncomp_size && sz <= pkg->cache_limit / 4;
+}
+
+// Inflates entry i. Must be called with the package mutex held, which
+// is released while inflating if the package is mapped.
+static void *extract_entry(am_package *pkg, int i, size_t *sz) {
+    // Reading from memory has no shared state, so only hold the lock
+    // while extracting if miniz is reading from the file.
+    bool mapped_pkg = pkg->map_data != NULL;
+    if (mapped_pkg) am_unlock_mutex(pkg->mutex);
+    void *data = mz_zip_reader_extract_to_heap((mz_zip_archive*)pkg->handle, i, sz, 0);
+    if (mapped_pkg) am_lock_mutex(pkg->mutex);
+    return data;
+}
+
+// Returns a pointer to the entry's data in the package mapping, or NULL
+// if it's compressed or out of range.
+static uint8_t *mapped_entry_data(am_package *pkg, am_package_entry *entry) {
+    if (pkg->map_data == NULL || entry->method != 0 || entry->encrypted
+        || entry->comp_size != entry->uncomp_size)
+    {
+        return NULL;
+    }
+    if (entry->data_ofs < 0) {
+        // the data follows the local header, whose name and extra
+        // fields may differ in length from the central directory's
+        uint64_t hdr = entry->local_header_ofs;
+        if (hdr + 30 > pkg->map_size) return NULL;
+        const uint8_t *p = pkg->map_data + hdr;
+        uint32_t sig = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+        if (sig != 0x04034b50) return NULL;
+        uint32_t name_len = p[26] | (p[27] << 8);
+        uint32_t extra_len = p[28] | (p[29] << 8);
+        uint64_t ofs = hdr + 30 + name_len + extra_len;
+        if (ofs + entry->comp_size > pkg->map_size) return NULL;
+        entry->data_ofs = (int64_t)ofs;
+    }
+    return pkg->map_data + entry->data_ofs;
+}
+
 void *am_read_package_resource(am_package *pkg, const char *filename, int *len, char **errmsg) {
+    int i = find_entry(pkg, filename);
+    if (i < 0) {
+        *errmsg = am_format("unable to read entry %s from package %s", filename, pkg->filename);
+        return NULL;
+    }
+    am_package_entry *entry = &pkg->entries[i];
+
+    am_lock_mutex(pkg->mutex);
+    uint8_t *mapped = mapped_entry_data(pkg, entry);
+    if (mapped != NULL) {
+        am_unlock_mutex(pkg->mutex);
+        void *data = malloc(am_max(entry->uncomp_size, (uint64_t)1));
+        memcpy(data, mapped, entry->uncomp_size);
+        *len = (int)entry->uncomp_size;
+        return data;
+    }
+    void *cached = cache_lookup(pkg, i);
+    if (cached != NULL) {
+        // the caller owns the result, so it needs a copy (use
+        // am_pin_package_resource to avoid this)
+        void *data = malloc(am_max(entry->uncomp_size, (uint64_t)1));
+        memcpy(data, cached, entry->uncomp_size);
+        am_unlock_mutex(pkg->mutex);
+        *len = (int)entry->uncomp_size;
+        return data;
+    }
     size_t sz;
-    void *data = mz_zip_reader_extract_file_to_heap((mz_zip_archive*)pkg->handle,
-        filename, &sz, MZ_ZIP_FLAG_CASE_SENSITIVE);
+    void *data = extract_entry(pkg, i, &sz);
     if (data == NULL) {
+        am_unlock_mutex(pkg->mutex);
         *errmsg = am_format("unable to read entry %s from package %s", filename, pkg->filename);
         return NULL;
     }
+    if (cacheable(pkg, entry, sz)) {
+        void *copy = malloc(am_max(sz, (size_t)1));
+        memcpy(copy, data, sz);
+        cache_insert(pkg, i, copy);
+    }
+    am_unlock_mutex(pkg->mutex);
     *len = (int)sz;
     return data;
 }
 
+const void *am_pin_package_resource(am_package *pkg, const char *filename, int *len, char **errmsg) {
+    int i = find_entry(pkg, filename);
+    if (i < 0) {
+        *errmsg = am_format("unable to read entry %s from package %s", filename, pkg->filename);
+        return NULL;
+    }
+    am_package_entry *entry = &pkg->entries[i];
+
+    am_lock_mutex(pkg->mutex);
+    const void *data = mapped_entry_data(pkg, entry);
+    if (data == NULL) {
+        data = cache_lookup(pkg, i);
+        if (data == NULL) {
+            size_t sz;
+            void *extracted = extract_entry(pkg, i, &sz);
+            if (extracted == NULL) {
+                am_unlock_mutex(pkg->mutex);
+                *errmsg = am_format("unable to read entry %s from package %s", filename, pkg->filename);
+                return NULL;
+            }
+            if (cacheable(pkg, entry, sz)) {
+                cache_insert(pkg, i, extracted);
+            } else if (entry->cached != NULL) {
+                // another thread cached it while we were inflating
+                free(extracted);
+                cache_lookup(pkg, i);
+            } else {
+                // not cached, so am_unpin_package_resource frees it
+                am_unlock_mutex(pkg->mutex);
+                am_retain_package(pkg);
+                *len = (int)sz;
+                return extracted;
+            }
+            data = entry->cached;
+        }
+        entry->pins++;
+    }
+    pkg->refs++;
+    am_unlock_mutex(pkg->mutex);
+    *len = (int)entry->uncomp_size;
+    return data;
+}
+
+void am_unpin_package_resource(am_package *pkg, const char *filename, const void *data) {
+    int i = find_entry(pkg, filename);
+    am_always_assert(i >= 0);
+    am_package_entry *entry = &pkg->entries[i];
+    am_lock_mutex(pkg->mutex);
+    if (data == entry->cached) {
+        entry->pins--;
+    } else if (!(pkg->map_data != NULL && (const uint8_t*)data >= pkg->map_data
+        && (const uint8_t*)data <= pkg->map_data + pkg->map_size))
+    {
+        free((void*)data);
+    }
+    am_unlock_mutex(pkg->mutex);
+    am_release_package(pkg);
+}
+
+void *am_map_package_resource(am_package *pkg, const char *filename, int *len) {
+    int i = find_entry(pkg, filename);
+    if (i < 0) return NULL;
+    am_package_entry *entry = &pkg->entries[i];
+    am_lock_mutex(pkg->mutex);
+    bool stored = mapped_entry_data(pkg, entry) != NULL;
+    am_unlock_mutex(pkg->mutex);
+    if (!stored || entry->uncomp_size == 0) return NULL;
+    void *data = map_view(pkg, (uint64_t)entry->data_ofs, (size_t)entry->uncomp_size);
+    if (data == NULL) return NULL;
+    am_retain_package(pkg);
+    *len = (int)entry->uncomp_size;
+    return data;
+}
+
+void am_unmap_package_resource(am_package *pkg, void *data, int len) {
+    unmap_view(data, (size_t)len);
+    am_release_package(pkg);
+}
+
 bool am_package_resource_exists(am_package *pkg, const char *filename) {
-    return -1 !=
-        mz_zip_reader_locate_file((mz_zip_archive*)pkg->handle, filename, NULL, MZ_ZIP_FLAG_CASE_SENSITIVE);
+    return find_entry(pkg, filename) >= 0;
+}
+
+const void *am_acquire_resource(const char *filename, int *len, char **errmsg) {
+    am_package *pkg = am_get_resource_package(filename);
+    if (pkg != NULL) {
+        return am_pin_package_resource(pkg, filename, len, errmsg);
+    }
+    return am_read_resource(filename, len, errmsg);
+}
+
+void am_release_resource(const char *filename, const void *data) {
+    am_package *pkg = am_get_resource_package(filename);
+    if (pkg != NULL) {
+        am_unpin_package_resource(pkg, filename, data);
+    } else {
+        free((void*)data);
+    }
+}
+
+// Lua bindings. These give the tests direct access to a package, so
+// they can check index lookups and what the cache holds.
+
+struct am_package_pin {
+    char *filename;
+    const void *data;
+};
+
+struct am_package_handle {
+    am_package *pkg;
+    std::vector<am_package_pin> pins;
+};
+
+static am_package_handle *check_package_handle(lua_State *L, int idx) {
+    am_package_handle *handle = am_get_userdata(L, am_package_handle, idx);
+    if (handle->pkg == NULL) {
+        luaL_error(L, "package is closed");
+    }
+    return handle;
+}
+
+static int open_package(lua_State *L) {
+    int nargs = am_check_nargs(L, 1);
+    const char *filename = luaL_checkstring(L, 1);
+    char *errmsg;
+    am_package *pkg = am_open_package(filename, &errmsg);
+    if (pkg == NULL) {
+        lua_pushstring(L, errmsg);
+        free(errmsg);
+        return lua_error(L);
+    }
+    if (nargs > 1) {
+        pkg->cache_limit = (size_t)luaL_checkinteger(L, 2);
+    }
+    am_package_handle *handle = am_new_userdata(L, am_package_handle);
+    handle->pkg = pkg;
+    return 1;
+}
+
+static int close_package_handle(lua_State *L) {
+    am_package_handle *handle = am_get_userdata(L, am_package_handle, 1);
+    if (handle->pkg == NULL) return 0;
+    for (unsigned int i = 0; i < handle->pins.size(); i++) {
+        am_unpin_package_resource(handle->pkg, handle->pins[i].filename, handle->pins[i].data);
+        free(handle->pins[i].filename);
+    }
+    handle->pins.clear();
+    am_close_package(handle->pkg);
+    handle->pkg = NULL;
+    return 0;
+}
+
+static int package_handle_gc(lua_State *L) {
+    close_package_handle(L);
+    am_package_handle *handle = am_get_userdata(L, am_package_handle, 1);
+    handle->~am_package_handle();
+    return 0;
+}
+
+static int package_read(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_package_handle *handle = check_package_handle(L, 1);
+    const char *filename = luaL_checkstring(L, 2);
+    int len;
+    char *errmsg;
+    void *data = am_read_package_resource(handle->pkg, filename, &len, &errmsg);
+    if (data == NULL) {
+        lua_pushnil(L);
+        lua_pushstring(L, errmsg);
+        free(errmsg);
+        return 2;
+    }
+    lua_pushlstring(L, (const char*)data, len);
+    free(data);
+    return 1;
+}
+
+// Pins the entry until unpin is called with the same name, or the
+// package is closed, and returns its contents.
+static int package_pin(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_package_handle *handle = check_package_handle(L, 1);
+    const char *filename = luaL_checkstring(L, 2);
+    int len;
+    char *errmsg;
+    const void *data = am_pin_package_resource(handle->pkg, filename, &len, &errmsg);
+    if (data == NULL) {
+        lua_pushnil(L);
+        lua_pushstring(L, errmsg);
+        free(errmsg);
+        return 2;
+    }
+    am_package_pin pin;
+    pin.filename = (char*)malloc(strlen(filename) + 1);
+    strcpy(pin.filename, filename);
+    pin.data = data;
+    handle->pins.push_back(pin);
+    lua_pushlstring(L, (const char*)data, len);
+    return 1;
+}
+
+static int package_unpin(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_package_handle *handle = check_package_handle(L, 1);
+    const char *filename = luaL_checkstring(L, 2);
+    for (unsigned int i = 0; i < handle->pins.size(); i++) {
+        am_package_pin pin = handle->pins[i];
+        if (strcmp(pin.filename, filename) == 0) {
+            handle->pins.erase(handle->pins.begin() + i);
+            am_unpin_package_resource(handle->pkg, pin.filename, pin.data);
+            free(pin.filename);
+            return 0;
+        }
+    }
+    return luaL_error(L, "%s is not pinned", filename);
+}
+
+static int package_exists(lua_State *L) {
+    am_check_nargs(L, 2);
+    am_package_handle *handle = check_package_handle(L, 1);
+    lua_pushboolean(L, am_package_resource_exists(handle->pkg, luaL_checkstring(L, 2)));
+    return 1;
+}
+
+// Returns the names of the cached entries, most recently used first,
+// and the number of bytes they take up.
+static int package_cache(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_package_handle *handle = check_package_handle(L, 1);
+    am_package *pkg = handle->pkg;
+    am_lock_mutex(pkg->mutex);
+    lua_newtable(L);
+    int n = 1;
+    for (int i = pkg->lru_head; i != -1; i = pkg->entries[i].lru_next) {
+        am_package_entry *entry = &pkg->entries[i];
+        lua_pushlstring(L, pkg->names + entry->name_offset, entry->name_len);
+        lua_rawseti(L, -2, n++);
+    }
+    lua_pushinteger(L, (lua_Integer)pkg->cache_bytes);
+    am_unlock_mutex(pkg->mutex);
+    return 2;
+}
+
+static void register_package_handle_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_default_index_func, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, package_handle_gc, 0);
+    lua_setfield(L, -2, "__gc");
+
+    lua_pushcclosure(L, package_read, 0);
+    lua_setfield(L, -2, "read");
+    lua_pushcclosure(L, package_pin, 0);
+    lua_setfield(L, -2, "pin");
+    lua_pushcclosure(L, package_unpin, 0);
+    lua_setfield(L, -2, "unpin");
+    lua_pushcclosure(L, package_exists, 0);
+    lua_setfield(L, -2, "exists");
+    lua_pushcclosure(L, package_cache, 0);
+    lua_setfield(L, -2, "cache");
+    lua_pushcclosure(L, close_package_handle, 0);
+    lua_setfield(L, -2, "close");
+
+    am_register_metatable(L, "package", MT_am_package_handle, 0);
+}
+
+void am_open_package_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"_open_package", open_package},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_package_handle_mt(L);
 }
@@ -1,12 +1,67 @@
+// Packages are zip files. Where the platform supports it the whole
+// package is memory mapped and entries are found through a hash index
+// built when the package is opened. Stored (uncompressed) entries can
+// then be mapped directly with am_map_package_resource. Deflated entries
+// are decompressed on demand and kept in a bounded LRU cache, so
+// loading the same resource again doesn't inflate it again. Readers that
+// don't need their own copy pin the cached data instead of copying it.
+
+#define AM_PACKAGE_CACHE_SIZE (32 * 1024 * 1024)
+
+struct am_package_entry;
+
 struct am_package {
     char *filename;
-    void *handle;
+    void *handle; // mz_zip_archive
+    uint8_t *map_data; // read only, NULL if the package isn't mapped
+    size_t map_size;
+    int map_fd;
+    void *map_handle;
+    am_package_entry *entries;
+    int num_entries;
+    char *names;
+    int *index; // open addressing hash table of entry index + 1
+    uint32_t index_mask;
+    am_mutex *mutex;
+    int refs;
+    int lru_head;
+    int lru_tail;
+    size_t cache_bytes;
+    size_t cache_limit;
 };
 
 am_package* am_open_package(const char *filename, char **errmsg);
+// The package stays open until all retained references are released.
 void am_close_package(am_package *pkg);
+void am_retain_package(am_package *pkg);
+void am_release_package(am_package *pkg);
 
 // free returned pointer with free()
 void *am_read_package_resource(am_package *pkg, const char *filename, int *len, char **errmsg);
 
+// Returns a read only pointer to an entry's data without copying it.
+// Stored entries point into the package mapping and deflated entries are
+// pinned in the cache, so they aren't evicted while in use. Entries that
+// can't be cached are inflated into a block of their own. Release the
+// pointer with am_unpin_package_resource, which also releases the
+// reference to the package the pin holds.
+const void *am_pin_package_resource(am_package *pkg, const char *filename, int *len, char **errmsg);
+void am_unpin_package_resource(am_package *pkg, const char *filename, const void *data);
+
+// Maps a private copy-on-write view of a stored entry, so the data may
+// be modified without affecting the package or other views of it.
+// Returns NULL if the entry doesn't exist, is compressed or the package
+// isn't mapped. The view keeps the package open until it's unmapped
+// with am_unmap_package_resource.
+void *am_map_package_resource(am_package *pkg, const char *filename, int *len);
+void am_unmap_package_resource(am_package *pkg, void *data, int len);
+
 bool am_package_resource_exists(am_package *pkg, const char *filename);
+
+// Like am_read_resource, but resources in a package are pinned with
+// am_pin_package_resource instead of copied. Release the returned pointer
+// with am_release_resource.
+const void *am_acquire_resource(const char *filename, int *len, char **errmsg);
+void am_release_resource(const char *filename, const void *data);
+
+void am_open_package_module(lua_State *L);
@@ -0,0 +1,460 @@
+#include "amulet.h"
+
+#if defined(AM_OSX) || defined(AM_IOS)
+#include <mach/mach_time.h>
+#endif
+
+#define DEFAULT_MAX_EVENTS (1 << 18)
+#define MAX_SCOPE_DEPTH 256
+
+bool am_profiler_running = false;
+
+enum profile_event_kind {
+    EVENT_BEGIN,     // name is a string constant
+    EVENT_BEGIN_TAG, // id is a scene node tag
+    EVENT_BEGIN_ID,  // id is a key in the AM_PROFILER_NAMES table
+    EVENT_END,
+    EVENT_INSTANT,   // name is a string constant
+    EVENT_COUNTER,   // name is a string constant, id is the value
+};
+
+struct profile_event {
+    uint64_t time; // nanoseconds
+    const char *name;
+    uint32_t id;
+    uint32_t kind;
+};
+
+struct profile_ring {
+    profile_event *events;
+    uint32_t capacity; // a power of 2
+    uint32_t count;    // events recorded, including ones since overwritten
+    volatile uint32_t writing;
+};
+
+static profile_ring rings[AM_PROFILE_NUM_THREADS];
+static const char *thread_names[AM_PROFILE_NUM_THREADS] = {"main", "audio"};
+
+// Set while the profiler is running. Unlike am_profiler_running this is
+// safe to read from other threads.
+static volatile uint32_t recording = 0;
+static uint64_t start_time = 0;
+static int next_name_id = 1;
+static bool gc_sentinel_alive = false;
+
+static uint64_t profiler_now() {
+#if defined(AM_WINDOWS)
+    static double ns_per_tick = 0.0;
+    LARGE_INTEGER t;
+    if (ns_per_tick == 0.0) {
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+        ns_per_tick = 1e9 / (double)freq.QuadPart;
+    }
+    QueryPerformanceCounter(&t);
+    return (uint64_t)((double)t.QuadPart * ns_per_tick);
+#elif defined(AM_OSX) || defined(AM_IOS)
+    static mach_timebase_info_data_t timebase = {0, 0};
+    if (timebase.denom == 0) {
+        mach_timebase_info(&timebase);
+    }
+    return mach_absolute_time() * timebase.numer / timebase.denom;
+#elif defined(AM_HTML)
+    return (uint64_t)(emscripten_get_now() * 1e6);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static void record(am_profile_thread thread, profile_event_kind kind, const char *name, uint32_t id) {
+    profile_ring *ring = &rings[thread];
+    am_atomic_add(&ring->writing, 1);
+    if (am_atomic_load(&recording)) {
+        profile_event *e = &ring->events[ring->count & (ring->capacity - 1)];
+        e->time = profiler_now();
+        e->name = name;
+        e->id = id;
+        e->kind = kind;
+        ring->count++;
+    }
+    am_atomic_add(&ring->writing, (uint32_t)-1);
+}
+
+void am_profile_begin(am_profile_thread thread, const char *name) {
+    if (!am_profiler_running) return;
+    record(thread, EVENT_BEGIN, name, 0);
+}
+
+void am_profile_begin_tag(uint16_t tag) {
+    if (!am_profiler_running) return;
+    record(AM_PROFILE_MAIN_THREAD, EVENT_BEGIN_TAG, NULL, tag);
+}
+
+void am_profile_end(am_profile_thread thread) {
+    if (!am_profiler_running) return;
+    record(thread, EVENT_END, NULL, 0);
+}
+
+void am_profile_lua_heap(lua_State *L) {
+    if (!am_profiler_running) return;
+    record(AM_PROFILE_MAIN_THREAD, EVENT_COUNTER, "lua heap", (uint32_t)lua_gc(L, LUA_GCCOUNT, 0));
+}
+
+static void stop_recording() {
+    am_profiler_running = false;
+    if (am_atomic_load(&recording)) {
+        am_atomic_add(&recording, (uint32_t)-1);
+    }
+    // wait for any event the audio thread is in the middle of writing
+    for (int t = 0; t < AM_PROFILE_NUM_THREADS; t++) {
+        while (am_atomic_load(&rings[t].writing) != 0) {}
+    }
+}
+
+void am_destroy_profiler() {
+    stop_recording();
+    for (int t = 0; t < AM_PROFILE_NUM_THREADS; t++) {
+        free(rings[t].events);
+        rings[t].events = NULL;
+        rings[t].capacity = 0;
+        rings[t].count = 0;
+    }
+}
+
+/*
+ * Lua 5.1 has no hooks for the garbage collector, so the end of each
+ * collection cycle is detected by the finalizer of an otherwise
+ * unreferenced userdata, which creates a new one for the next cycle.
+ * Upvalue 1 is the sentinel's metatable.
+ */
+static void new_gc_sentinel(lua_State *L, int mt_idx) {
+    lua_newuserdata(L, 1);
+    lua_pushvalue(L, mt_idx);
+    lua_setmetatable(L, -2);
+    lua_pop(L, 1);
+    gc_sentinel_alive = true;
+}
+
+static int gc_sentinel_gc(lua_State *L) {
+    gc_sentinel_alive = false;
+    if (!am_profiler_running) return 0;
+    record(AM_PROFILE_MAIN_THREAD, EVENT_INSTANT, "gc cycle", 0);
+    new_gc_sentinel(L, lua_upvalueindex(1));
+    return 0;
+}
+
+/*------------------------ lua api ----------------------------*/
+
+// Upvalue 1 is the gc sentinel metatable.
+static int profiler_start(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    int max_events = DEFAULT_MAX_EVENTS;
+    if (nargs > 0 && !lua_isnil(L, 1)) {
+        max_events = luaL_checkinteger(L, 1);
+        if (max_events < 1) {
+            return luaL_error(L, "max_events must be positive");
+        }
+    }
+    uint32_t capacity = 1;
+    while (capacity < (uint32_t)max_events && capacity < (1u << 28)) {
+        capacity <<= 1;
+    }
+    stop_recording();
+    for (int t = 0; t < AM_PROFILE_NUM_THREADS; t++) {
+        profile_ring *ring = &rings[t];
+        if (ring->capacity != capacity) {
+            free(ring->events);
+            ring->events = (profile_event*)malloc(capacity * sizeof(profile_event));
+            ring->capacity = capacity;
+        }
+        ring->count = 0;
+    }
+    start_time = profiler_now();
+    if (!gc_sentinel_alive) {
+        new_gc_sentinel(L, lua_upvalueindex(1));
+    }
+    am_atomic_add(&recording, 1);
+    am_profiler_running = true;
+    return 0;
+}
+
+static int profiler_stop(lua_State *L) {
+    stop_recording();
+    return 0;
+}
+
+static int profiler_running(lua_State *L) {
+    lua_pushboolean(L, am_profiler_running);
+    return 1;
+}
+
+// Begins a scope with the given name. Names are mapped to integer ids
+// in the AM_PROFILER_NAMES table (which maps both ways), so the ring
+// doesn't have to hold references to Lua strings.
+static int profile_begin(lua_State *L) {
+    if (!am_profiler_running) return 0;
+    luaL_checkstring(L, 1);
+    lua_rawgeti(L, LUA_REGISTRYINDEX, AM_PROFILER_NAMES);
+    lua_pushvalue(L, 1);
+    lua_rawget(L, -2);
+    int id;
+    if (lua_isnil(L, -1)) {
+        id = next_name_id++;
+        lua_pushvalue(L, 1);
+        lua_pushinteger(L, id);
+        lua_rawset(L, -4);
+        lua_pushvalue(L, 1);
+        lua_rawseti(L, -3, id);
+    } else {
+        id = lua_tointeger(L, -1);
+    }
+    record(AM_PROFILE_MAIN_THREAD, EVENT_BEGIN_ID, NULL, (uint32_t)id);
+    return 0;
+}
+
+static int profile_end(lua_State *L) {
+    am_profile_end(AM_PROFILE_MAIN_THREAD);
+    return 0;
+}
+
+/*------------------------ trace export ----------------------------*/
+
+struct trace_writer {
+    char *buf;
+    size_t size;
+    size_t capacity;
+};
+
+static void reserve(trace_writer *w, size_t n) {
+    if (w->size + n <= w->capacity) return;
+    while (w->size + n > w->capacity) {
+        w->capacity *= 2;
+    }
+    w->buf = (char*)realloc(w->buf, w->capacity);
+}
+
+static void appends(trace_writer *w, const char *str) {
+    size_t len = strlen(str);
+    reserve(w, len);
+    memcpy(w->buf + w->size, str, len);
+    w->size += len;
+}
+
+static void appendf(trace_writer *w, const char *fmt, ...) {
+    va_list args;
+    reserve(w, 128);
+    va_start(args, fmt);
+    int n = vsnprintf(w->buf + w->size, w->capacity - w->size, fmt, args);
+    va_end(args);
+    if (n >= 0 && (size_t)n >= w->capacity - w->size) {
+        reserve(w, n + 1);
+        va_start(args, fmt);
+        vsnprintf(w->buf + w->size, w->capacity - w->size, fmt, args);
+        va_end(args);
+    }
+    if (n > 0) w->size += n;
+}
+
+static void append_json_string(trace_writer *w, const char *str) {
+    appends(w, "\"");
+    for (const char *c = str; *c != 0; c++) {
+        switch (*c) {
+            case '"': appends(w, "\\\""); break;
+            case '\\': appends(w, "\\\\"); break;
+            case '\n': appends(w, "\\n"); break;
+            case '\r': appends(w, "\\r"); break;
+            case '\t': appends(w, "\\t"); break;
+            default:
+                if ((unsigned char)*c < 0x20) {
+                    appendf(w, "\\u%04x", (unsigned int)(unsigned char)*c);
+                } else {
+                    reserve(w, 1);
+                    w->buf[w->size++] = *c;
+                }
+        }
+    }
+    appends(w, "\"");
+}
+
+// tags_idx has a table from tag ids to names and names_idx the
+// AM_PROFILER_NAMES table.
+static const char *event_name(lua_State *L, profile_event *e, int tags_idx, int names_idx) {
+    const char *name = e->name;
+    if (e->kind == EVENT_BEGIN_TAG || e->kind == EVENT_BEGIN_ID) {
+        lua_rawgeti(L, e->kind == EVENT_BEGIN_TAG ? tags_idx : names_idx, e->id);
+        // the string is still referenced from the table after popping
+        name = lua_tostring(L, -1);
+        lua_pop(L, 1);
+    }
+    return name == NULL ? "?" : name;
+}
+
+static const char *event_category(profile_event *e) {
+    switch (e->kind) {
+        case EVENT_BEGIN_TAG: return "node";
+        case EVENT_BEGIN_ID: return "lua";
+        default: return "engine";
+    }
+}
+
+static double event_ts(uint64_t time) {
+    return (double)(time - start_time) / 1000.0;
+}
+
+static void begin_trace_event(trace_writer *w, bool *first) {
+    appends(w, *first ? "\n" : ",\n");
+    *first = false;
+}
+
+static void write_scope(trace_writer *w, lua_State *L, int tid, profile_event *begin, uint64_t end_time,
+    int tags_idx, int names_idx, bool *first)
+{
+    begin_trace_event(w, first);
+    appends(w, "{\"name\":");
+    append_json_string(w, event_name(L, begin, tags_idx, names_idx));
+    appendf(w, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+        event_category(begin), event_ts(begin->time),
+        (double)(end_time - begin->time) / 1000.0, tid);
+}
+
+/*
+ * Pairs up the begin and end events in a ring and writes them as
+ * complete ("X") events. Ends whose begin was overwritten are dropped
+ * and scopes still open when the profiler stopped end at the last
+ * event.
+ */
+static void write_thread_events(trace_writer *w, lua_State *L, int thread, int tags_idx, int names_idx, bool *first) {
+    profile_ring *ring = &rings[thread];
+    if (ring->events == NULL) return;
+    int tid = thread + 1;
+    begin_trace_event(w, first);
+    appendf(w, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+        tid, thread_names[thread]);
+    uint32_t count = ring->count;
+    uint32_t i = count > ring->capacity ? count - ring->capacity : 0;
+    uint32_t mask = ring->capacity - 1;
+    uint32_t open[MAX_SCOPE_DEPTH];
+    int depth = 0;
+    uint64_t last_time = start_time;
+    for (; i != count; i++) {
+        profile_event *e = &ring->events[i & mask];
+        last_time = e->time;
+        switch (e->kind) {
+            case EVENT_BEGIN:
+            case EVENT_BEGIN_TAG:
+            case EVENT_BEGIN_ID:
+                if (depth < MAX_SCOPE_DEPTH) open[depth] = i;
+                depth++;
+                break;
+            case EVENT_END:
+                if (depth == 0) break;
+                depth--;
+                if (depth < MAX_SCOPE_DEPTH) {
+                    write_scope(w, L, tid, &ring->events[open[depth] & mask], e->time, tags_idx, names_idx, first);
+                }
+                break;
+            case EVENT_INSTANT:
+                begin_trace_event(w, first);
+                appends(w, "{\"name\":");
+                append_json_string(w, e->name);
+                appendf(w, ",\"cat\":\"engine\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+                    event_ts(e->time), tid);
+                break;
+            case EVENT_COUNTER:
+                begin_trace_event(w, first);
+                appends(w, "{\"name\":");
+                append_json_string(w, e->name);
+                appendf(w, ",\"cat\":\"engine\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":%d,\"args\":{\"KB\":%u}}",
+                    event_ts(e->time), tid, (unsigned int)e->id);
+                break;
+        }
+    }
+    while (depth > 0) {
+        depth--;
+        if (depth < MAX_SCOPE_DEPTH) {
+            write_scope(w, L, tid, &ring->events[open[depth] & mask], last_time, tags_idx, names_idx, first);
+        }
+    }
+}
+
+static int profiler_dump(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    const char *filename = NULL;
+    if (nargs > 0 && !lua_isnil(L, 1)) {
+        filename = luaL_checkstring(L, 1);
+    }
+    stop_recording();
+
+    // invert the tag table so tags can be looked up by id
+    lua_newtable(L);
+    int tags_idx = lua_gettop(L);
+    lua_rawgeti(L, LUA_REGISTRYINDEX, AM_TAG_TABLE);
+    lua_pushnil(L);
+    while (lua_next(L, -2)) {
+        lua_pushvalue(L, -2);
+        lua_rawseti(L, tags_idx, lua_tointeger(L, -2));
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1); // tag table
+    lua_rawgeti(L, LUA_REGISTRYINDEX, AM_PROFILER_NAMES);
+    int names_idx = lua_gettop(L);
+
+    trace_writer w;
+    w.capacity = 4096;
+    w.size = 0;
+    w.buf = (char*)malloc(w.capacity);
+    appends(&w, "{\"traceEvents\":[");
+    bool first = true;
+    for (int t = 0; t < AM_PROFILE_NUM_THREADS; t++) {
+        write_thread_events(&w, L, t, tags_idx, names_idx, &first);
+    }
+    appends(&w, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    if (filename != NULL) {
+        FILE *f = am_fopen(filename, "wb");
+        if (f == NULL) {
+            free(w.buf);
+            lua_pushnil(L);
+            lua_pushfstring(L, "unable to open %s for writing", filename);
+            return 2;
+        }
+        fwrite(w.buf, 1, w.size, f);
+        fclose(f);
+        lua_pushboolean(L, 1);
+    } else {
+        lua_pushlstring(L, w.buf, w.size);
+    }
+    free(w.buf);
+    return 1;
+}
+
+void am_open_profiler_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"_profiler_running", profiler_running},
+        {"_profile_begin", profile_begin},
+        {"_profile_end", profile_end},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+
+    lua_newtable(L);
+    lua_rawseti(L, LUA_REGISTRYINDEX, AM_PROFILER_NAMES);
+
+    lua_getglobal(L, AMULET_LUA_MODULE_NAME);
+    lua_newtable(L);
+    lua_newtable(L); // gc sentinel metatable
+    int mt_idx = lua_gettop(L);
+    lua_pushvalue(L, mt_idx);
+    lua_pushcclosure(L, gc_sentinel_gc, 1);
+    lua_setfield(L, mt_idx, "__gc");
+    lua_pushcclosure(L, profiler_start, 1);
+    lua_setfield(L, -2, "start");
+    lua_pushcclosure(L, profiler_stop, 0);
+    lua_setfield(L, -2, "stop");
+    lua_pushcclosure(L, profiler_dump, 0);
+    lua_setfield(L, -2, "dump");
+    lua_setfield(L, -2, "profiler");
+    lua_pop(L, 1); // am table
+}
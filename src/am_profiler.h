@@ -0,0 +1,29 @@
+// A low overhead profiler for am.profiler. While it's running, nested
+// timing scopes are recorded into a fixed size ring buffer per thread
+// (the oldest events are overwritten when a ring is full) and
+// am.profiler.dump converts them to Chrome trace event JSON.
+//
+// Each ring must only be written by one thread at a time. Recording a
+// scope when the profiler isn't running costs a single test of
+// am_profiler_running.
+
+enum am_profile_thread {
+    AM_PROFILE_MAIN_THREAD,
+    AM_PROFILE_AUDIO_THREAD,
+    AM_PROFILE_NUM_THREADS,
+};
+
+extern bool am_profiler_running;
+
+// name must be a string constant.
+void am_profile_begin(am_profile_thread thread, const char *name);
+// Begins a scope named after a scene node tag (main thread only).
+void am_profile_begin_tag(uint16_t tag);
+void am_profile_end(am_profile_thread thread);
+
+// Records the size of the Lua heap once per frame.
+void am_profile_lua_heap(lua_State *L);
+
+void am_destroy_profiler();
+
+void am_open_profiler_module(lua_State *L);
@@ -1,7 +1,16 @@
 #include "amulet.h"
 
+int am_frame_uniform_uploads = 0;
+int am_frame_uniform_skips = 0;
+int am_frame_vertex_array_hits = 0;
+int am_frame_vertex_array_misses = 0;
+
+// A program's cached vertex arrays are discarded when it has this many,
+// to bound the memory used by programs drawn with many different arrays.
+#define MAX_CACHED_VERTEX_ARRAYS 16384
+
 static bool bind_attribute_array(am_render_state *rstate, am_gluint location,
-    am_buffer_view *view)
+    am_buffer_view *view, bool per_instance)
 {
     if (!view->can_be_gl_attrib()) {
         return false;
@@ -11,23 +20,214 @@ static bool bind_attribute_array(am_render_state *rstate, am_gluint location,
         return false;
     }
     buf->update_if_dirty();
-    am_bind_buffer(AM_ARRAY_BUFFER, buf->arraybuf->get_latest_id());
-    am_set_attribute_pointer(location, view->components, view->gl_client_type(), view->is_normalized(), view->stride, view->offset);
-    if (view->size < rstate->max_draw_array_size) {
+    int offset = buf->arraybuf->bind(buf);
+    am_set_attribute_pointer(location, view->components, view->gl_client_type(), view->is_normalized(), view->stride, view->offset + offset);
+    if (per_instance) {
+        int n = rstate->num_bound_instance_attrs;
+        assert(n < AM_MAX_INSTANCE_ATTRIBUTES);
+        if (am_instancing_supported) {
+            am_set_attribute_divisor(location, 1);
+        }
+        rstate->bound_instance_attr_locations[n] = location;
+        rstate->bound_instance_attr_views[n] = view;
+        rstate->num_bound_instance_attrs++;
+        if (view->size < rstate->max_instance_array_size) {
+            rstate->max_instance_array_size = view->size;
+        }
+    } else if (view->size < rstate->max_draw_array_size) {
         rstate->max_draw_array_size = view->size;
     }
     return true;
 }
 
-static void bind_sampler2d(am_render_state *rstate,
-    am_gluint location, int texture_unit, am_texture2d *texture)
+static uint32_t hash_vertex_array_attrs(am_vertex_array_attr *attrs, int n) {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < n; i++) {
+        am_vertex_array_attr *a = &attrs[i];
+        uint32_t words[4] = {a->buffer, (uint32_t)a->offset, (uint32_t)a->stride,
+            a->components | (a->client_type << 8) | ((uint32_t)a->normalized << 16)};
+        for (int j = 0; j < 4; j++) {
+            h = (h ^ words[j]) * 16777619u;
+        }
+    }
+    return h;
+}
+
+static int find_vertex_array(am_vertex_array_cache *cache,
+    uint32_t hash, am_vertex_array_attr *attrs, int n)
+{
+    if (cache->table.empty()) return -1;
+    uint32_t mask = cache->table.size() - 1;
+    for (uint32_t i = hash & mask; cache->table[i] != 0; i = (i + 1) & mask) {
+        int index = cache->table[i] - 1;
+        if (cache->hashes[index] == hash &&
+            memcmp(&cache->attrs[index * n], attrs, n * sizeof(am_vertex_array_attr)) == 0)
+        {
+            return index;
+        }
+    }
+    return -1;
+}
+
+static void insert_vertex_array_index(am_vertex_array_cache *cache, int index) {
+    uint32_t mask = cache->table.size() - 1;
+    uint32_t i = cache->hashes[index] & mask;
+    while (cache->table[i] != 0) i = (i + 1) & mask;
+    cache->table[i] = index + 1;
+}
+
+static void add_vertex_array(am_vertex_array_cache *cache, am_vertex_array_id vao,
+    uint32_t hash, am_vertex_array_attr *attrs, int n)
+{
+    cache->vaos.push_back(vao);
+    cache->hashes.push_back(hash);
+    cache->attrs.insert(cache->attrs.end(), attrs, attrs + n);
+    int count = cache->vaos.size();
+    if (count * 2 > (int)cache->table.size()) {
+        // keep the table at most half full
+        int size = am_max(16, (int)cache->table.size() * 2);
+        cache->table.assign(size, 0);
+        for (int i = 0; i < count; i++) {
+            insert_vertex_array_index(cache, i);
+        }
+    } else {
+        insert_vertex_array_index(cache, count - 1);
+    }
+}
+
+static void clear_vertex_arrays(am_vertex_array_cache *cache) {
+    // All of a program's vaos enable the same attribute arrays and
+    // have every attribute pointer respecified when set up, so they
+    // can be reused for other combinations of arrays.
+    cache->unused.insert(cache->unused.end(), cache->vaos.begin(), cache->vaos.end());
+    cache->vaos.clear();
+    cache->hashes.clear();
+    cache->attrs.clear();
+    cache->table.assign(cache->table.size(), 0);
+    cache->buffer_deletions = am_array_buffer_deletions;
+}
+
+static void delete_vertex_arrays(am_program *prog) {
+    am_vertex_array_cache *cache = prog->vertex_arrays;
+    if (cache == NULL) return;
+    clear_vertex_arrays(cache);
+    for (unsigned int i = 0; i < cache->unused.size(); i++) {
+        am_delete_vertex_array(cache->unused[i]);
+    }
+    delete cache;
+    prog->vertex_arrays = NULL;
+}
+
+bool am_bind_cached_vertex_array(am_render_state *rstate, am_program *prog) {
+    int n = prog->num_vaas;
+    if (n == 0 || n > AM_MAX_VERTEX_ARRAY_ATTRS) return false;
+    am_vertex_array_attr attrs[AM_MAX_VERTEX_ARRAY_ATTRS];
+    memset(attrs, 0, sizeof(attrs)); // compared with memcmp
+    int max_draw_array_size = INT_MAX;
+    // attribute params come before uniform params
+    for (int i = 0; i < n; i++) {
+        am_program_param *param = &prog->params[i];
+        am_program_param_name_slot *slot = &rstate->param_name_map[param->name];
+        if (slot->value.type != AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY) return false;
+        am_buffer_view *view = slot->value.value.arr;
+        if (!view->can_be_gl_attrib()) return false;
+        am_buffer *buf = view->buffer;
+        if (buf->data == NULL || buf->arraybuf == NULL) return false;
+        buf->update_if_dirty();
+        // Stream buffers move around the stream ring every time they're
+        // updated, so aren't worth caching.
+        am_buffer_id id = buf->arraybuf->latest_slot_id();
+        if (id == 0) return false;
+        am_vertex_array_attr *attr = &attrs[i];
+        attr->buffer = id;
+        attr->offset = view->offset;
+        attr->stride = view->stride;
+        attr->components = view->components;
+        attr->client_type = view->gl_client_type();
+        attr->normalized = view->is_normalized();
+        if (view->size < max_draw_array_size) {
+            max_draw_array_size = view->size;
+        }
+    }
+    rstate->max_draw_array_size = max_draw_array_size;
+
+    am_vertex_array_cache *cache = prog->vertex_arrays;
+    if (cache == NULL) {
+        cache = new am_vertex_array_cache();
+        cache->buffer_deletions = am_array_buffer_deletions;
+        prog->vertex_arrays = cache;
+    } else if (cache->buffer_deletions != am_array_buffer_deletions) {
+        // a deleted buffer's id may have been reused
+        clear_vertex_arrays(cache);
+    }
+    uint32_t hash = hash_vertex_array_attrs(attrs, n);
+    int index = find_vertex_array(cache, hash, attrs, n);
+    if (index >= 0) {
+        rstate->bind_vertex_array(cache->vaos[index]);
+        am_frame_vertex_array_hits++;
+        return true;
+    }
+
+    if (cache->vaos.size() >= MAX_CACHED_VERTEX_ARRAYS) {
+        clear_vertex_arrays(cache);
+    }
+    am_vertex_array_id vao;
+    if (cache->unused.empty()) {
+        vao = am_create_vertex_array();
+        if (vao == 0) return false;
+    } else {
+        vao = cache->unused.back();
+        cache->unused.pop_back();
+    }
+    rstate->bind_vertex_array(vao);
+    am_buffer_id bound_buffer = 0;
+    for (int i = 0; i < n; i++) {
+        am_vertex_array_attr *attr = &attrs[i];
+        am_gluint location = prog->params[i].location;
+        if (attr->buffer != bound_buffer) {
+            am_bind_buffer(AM_ARRAY_BUFFER, attr->buffer);
+            bound_buffer = attr->buffer;
+        }
+        am_set_attribute_pointer(location, attr->components,
+            (am_attribute_client_type)attr->client_type, attr->normalized,
+            attr->stride, attr->offset);
+        am_set_attribute_array_enabled(location, true);
+    }
+    add_vertex_array(cache, vao, hash, attrs, n);
+    am_frame_vertex_array_misses++;
+    return true;
+}
+
+// Returns false if the n floats in fs are the same as the last ones
+// uploaded for param. Otherwise records them as uploaded and returns true.
+static bool shadow_changed(am_program_param *param, const float *fs, int n) {
+    if (param->shadow_valid && memcmp(param->shadow.f, fs, n * sizeof(float)) == 0) {
+        am_frame_uniform_skips++;
+        return false;
+    }
+    memcpy(param->shadow.f, fs, n * sizeof(float));
+    param->shadow_valid = true;
+    param->shadow_stamp = 0;
+    am_frame_uniform_uploads++;
+    return true;
+}
+
+static void bind_sampler2d(am_render_state *rstate, am_program_param *param,
+    int texture_unit, am_texture2d *texture)
 {
     if (texture->image_buffer != NULL) {
         texture->image_buffer->buffer->update_if_dirty();
     }
     am_set_active_texture_unit(texture_unit);
     am_bind_texture(AM_TEXTURE_BIND_TARGET_2D, texture->texture_id);
-    am_set_uniform1i(location, texture_unit);
+    if (param->shadow_valid && param->shadow.texture_unit == texture_unit) {
+        am_frame_uniform_skips++;
+        return;
+    }
+    am_set_uniform1i(param->location, texture_unit);
+    param->shadow.texture_unit = texture_unit;
+    param->shadow_valid = true;
+    am_frame_uniform_uploads++;
 }
 
 static void report_incompatible_param_type(am_render_state *rstate, am_program_param *param) {
@@ -57,7 +257,10 @@ bool am_program_param::bind(am_render_state *rstate) {
     switch (type) {
         case AM_PROGRAM_PARAM_UNIFORM_1F:
             if (slot->value.type == AM_PROGRAM_PARAM_CLIENT_TYPE_1F) {
-                am_set_uniform1f(location, slot->value.value.f);
+                float f = (float)slot->value.value.f;
+                if (shadow_changed(this, &f, 1)) {
+                    am_set_uniform1f(location, f);
+                }
                 bound = true;
             }
             break;
@@ -66,7 +269,9 @@ bool am_program_param::bind(am_render_state *rstate) {
                 float fs[2];
                 fs[0] = (float)slot->value.value.v2[0];
                 fs[1] = (float)slot->value.value.v2[1];
-                am_set_uniform2f(location, fs);
+                if (shadow_changed(this, fs, 2)) {
+                    am_set_uniform2f(location, fs);
+                }
                 bound = true;
             }
             break;
@@ -76,7 +281,9 @@ bool am_program_param::bind(am_render_state *rstate) {
                 fs[0] = (float)slot->value.value.v3[0];
                 fs[1] = (float)slot->value.value.v3[1];
                 fs[2] = (float)slot->value.value.v3[2];
-                am_set_uniform3f(location, fs);
+                if (shadow_changed(this, fs, 3)) {
+                    am_set_uniform3f(location, fs);
+                }
                 bound = true;
             }
             break;
@@ -87,7 +294,9 @@ bool am_program_param::bind(am_render_state *rstate) {
                 fs[1] = (float)slot->value.value.v4[1];
                 fs[2] = (float)slot->value.value.v4[2];
                 fs[3] = (float)slot->value.value.v4[3];
-                am_set_uniform4f(location, fs);
+                if (shadow_changed(this, fs, 4)) {
+                    am_set_uniform4f(location, fs);
+                }
                 bound = true;
             }
             break;
@@ -97,7 +306,9 @@ bool am_program_param::bind(am_render_state *rstate) {
                 for (int i = 0; i < 4; i++) {
                     fs[i] = (float)slot->value.value.m2[i];
                 }
-                am_set_uniform_mat2(location, fs);
+                if (shadow_changed(this, fs, 4)) {
+                    am_set_uniform_mat2(location, fs);
+                }
                 bound = true;
             }
             break;
@@ -107,24 +318,35 @@ bool am_program_param::bind(am_render_state *rstate) {
                 for (int i = 0; i < 9; i++) {
                     fs[i] = (float)slot->value.value.m3[i];
                 }
-                am_set_uniform_mat3(location, fs);
+                if (shadow_changed(this, fs, 9)) {
+                    am_set_uniform_mat3(location, fs);
+                }
                 bound = true;
             }
             break;
         case AM_PROGRAM_PARAM_UNIFORM_MAT4:
             if (slot->value.type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
-                float fs[16];
-                for (int i = 0; i < 16; i++) {
-                    fs[i] = (float)slot->value.value.m4[i];
+                uint32_t stamp = slot->value.mat4_stamp;
+                if (stamp != 0 && shadow_valid && shadow_stamp == stamp) {
+                    // same matrix as last time, so skip the conversion too
+                    am_frame_uniform_skips++;
+                } else {
+                    float fs[16];
+                    for (int i = 0; i < 16; i++) {
+                        fs[i] = (float)slot->value.value.m4[i];
+                    }
+                    if (shadow_changed(this, fs, 16)) {
+                        am_set_uniform_mat4(location, fs);
+                    }
+                    shadow_stamp = stamp;
                 }
-                am_set_uniform_mat4(location, fs);
                 bound = true;
             }
             break;
         case AM_PROGRAM_PARAM_UNIFORM_SAMPLER2D:
             if (slot->value.type == AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D) {
                 assert(slot->value.value.sampler2d.texture_unit >= 0);
-                bind_sampler2d(rstate, location, slot->value.value.sampler2d.texture_unit, slot->value.value.sampler2d.texture);
+                bind_sampler2d(rstate, this, slot->value.value.sampler2d.texture_unit, slot->value.value.sampler2d.texture);
                 bound = true;
             }
             break;
@@ -133,7 +355,8 @@ bool am_program_param::bind(am_render_state *rstate) {
         case AM_PROGRAM_PARAM_ATTRIBUTE_3F:
         case AM_PROGRAM_PARAM_ATTRIBUTE_4F:
             if (slot->value.type == AM_PROGRAM_PARAM_CLIENT_TYPE_ARRAY) {
-                bound = bind_attribute_array(rstate, location, slot->value.value.arr);
+                bound = bind_attribute_array(rstate, location, slot->value.value.arr,
+                    rstate->num_instance_params > 0 && rstate->is_instance_param(name));
             }
             break;
     }
@@ -141,6 +364,20 @@ bool am_program_param::bind(am_render_state *rstate) {
     return bound;
 }
 
+void am_reset_program_frame_stats() {
+    am_frame_uniform_uploads = 0;
+    am_frame_uniform_skips = 0;
+    am_frame_vertex_array_hits = 0;
+    am_frame_vertex_array_misses = 0;
+}
+
+uint32_t am_new_mat4_stamp() {
+    static uint32_t next_stamp = AM_IDENTITY_MAT4_STAMP + 1;
+    uint32_t stamp = next_stamp++;
+    if (next_stamp == 0) next_stamp = AM_IDENTITY_MAT4_STAMP + 1;
+    return stamp;
+}
+
 am_param_name_id am_lookup_param_name(lua_State *L, int name_idx) {
     am_render_state *g = am_global_render_state;
     name_idx = am_absindex(L, name_idx);
@@ -266,6 +503,7 @@ static int create_program(lua_State *L) {
     int num_params = num_attributes + num_uniforms;    
 
     am_program_param *params = (am_program_param*)malloc(sizeof(am_program_param) * num_params);
+    memset(params, 0, sizeof(am_program_param) * num_params);
 
     // Generate attribute params
     int i = 0;
@@ -385,12 +623,14 @@ static int create_program(lua_State *L) {
     prog->sets_point_size = (strstr(vertex_shader_src, "gl_PointSize") != NULL);
     prog->params = params;
     prog->num_vaas = num_attributes;
+    prog->vertex_arrays = NULL;
 
     return 1;
 }
 
 static int gc_program(lua_State *L) {
     am_program *prog = (am_program*)lua_touserdata(L, 1);
+    delete_vertex_arrays(prog);
     am_use_program(0);
     am_delete_program(prog->program_id);
     free(prog->params);
@@ -537,6 +777,7 @@ static void set_param_value(lua_State *L, am_program_param_value *param, int val
             break;
         case MT_am_mat4:
             param->set_mat4(am_get_userdata(L, am_mat4, val_idx)->m);
+            param->mat4_stamp = am_new_mat4_stamp();
             break;
         case MT_am_buffer_view: {
             am_buffer_view *view = am_get_userdata(L, am_buffer_view, val_idx);
@@ -855,12 +1096,36 @@ const char *am_program_param_client_type_name(am_program_param_name_slot *slot)
     return NULL;
 }
 
+static int get_frame_uniform_uploads(lua_State *L) {
+    lua_pushinteger(L, am_frame_uniform_uploads);
+    return 1;
+}
+
+static int get_frame_uniform_skips(lua_State *L) {
+    lua_pushinteger(L, am_frame_uniform_skips);
+    return 1;
+}
+
+static int get_frame_vertex_array_hits(lua_State *L) {
+    lua_pushinteger(L, am_frame_vertex_array_hits);
+    return 1;
+}
+
+static int get_frame_vertex_array_misses(lua_State *L) {
+    lua_pushinteger(L, am_frame_vertex_array_misses);
+    return 1;
+}
+
 void am_open_program_module(lua_State *L) {
     luaL_Reg funcs[] = {
         {"program", create_program},
         {"bind", create_bind_node},
         {"use_program", create_program_node},
         {"read_uniform", create_read_uniform_node},
+        {"_frame_uniform_uploads", get_frame_uniform_uploads},
+        {"_frame_uniform_skips", get_frame_uniform_skips},
+        {"_frame_vertex_array_hits", get_frame_vertex_array_hits},
+        {"_frame_vertex_array_misses", get_frame_vertex_array_misses},
         {NULL, NULL}
     };
     am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
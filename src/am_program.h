@@ -33,8 +33,14 @@ struct am_sampler2d_param_value {
     am_texture2d *texture;
 };
 
+// Stamp of the identity matrix the model-view matrix starts as.
+#define AM_IDENTITY_MAT4_STAMP 1
+
 struct am_program_param_value {
     am_program_param_client_type type;
+    // Identifies the contents of a mat4 value, so that transform nodes
+    // can tell when their parent matrix is unchanged. 0 if unknown.
+    uint32_t mat4_stamp;
     union {
         double f;
         double v2[2];
@@ -73,6 +79,7 @@ struct am_program_param_value {
     }
     void set_mat4(glm::dmat4 m4) {
         type = AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4;
+        mat4_stamp = 0;
         memcpy(&value.m4[0], glm::value_ptr(m4), sizeof(glm::dmat4));
     }
     void set_arr(am_buffer_view *arr) {
@@ -92,6 +99,7 @@ struct am_program_param_name_slot {
 };
 
 void am_init_param_name_map(lua_State *L);
+uint32_t am_new_mat4_stamp();
 am_param_name_id am_lookup_param_name(lua_State *L, int name_idx);
 
 struct am_program_param {
@@ -99,15 +107,51 @@ struct am_program_param {
     am_gluint location;
     am_param_name_id name;
 
+    // The last value uploaded for a uniform, so uploads of unchanged
+    // values can be skipped. Uniform values are part of the program
+    // object, so this stays valid across program switches.
+    bool shadow_valid;
+    uint32_t shadow_stamp; // mat4_stamp of the last uploaded mat4, or 0
+    union {
+        float f[16];
+        am_glint texture_unit;
+    } shadow;
+
     bool bind(am_render_state *rstate);
 };
 
+// Programs with more attributes than this don't use vertex array objects.
+#define AM_MAX_VERTEX_ARRAY_ATTRS 16
+
+// The gpu buffer and layout an attribute array was bound to.
+struct am_vertex_array_attr {
+    am_buffer_id buffer;
+    int offset;
+    int stride;
+    uint8_t components;
+    uint8_t client_type; // am_attribute_client_type
+    bool normalized;
+};
+
+// Vertex array objects recording the combinations of attribute arrays a
+// program has been drawn with, so later draws with the same arrays can
+// be set up with a single bind.
+struct am_vertex_array_cache {
+    std::vector<am_vertex_array_id> vaos;
+    std::vector<uint32_t> hashes;
+    std::vector<am_vertex_array_attr> attrs; // num_vaas per vao
+    std::vector<int> table; // open addressing, vao index + 1 or 0 if empty
+    std::vector<am_vertex_array_id> unused; // vaos of discarded entries
+    uint32_t buffer_deletions; // value of am_array_buffer_deletions when filled
+};
+
 struct am_program : am_nonatomic_userdata {
     am_program_id program_id;
     int num_params;
     bool sets_point_size;
     am_program_param *params;
     int num_vaas; // number of vertex attribute arrays
+    am_vertex_array_cache *vertex_arrays; // NULL until first needed
 };
 
 struct am_program_node : am_scene_node {
@@ -132,6 +176,18 @@ struct am_read_uniform_node : am_scene_node {
     virtual void render(am_render_state *rstate);
 };
 
+// stats for the last frame
+extern int am_frame_uniform_uploads;
+extern int am_frame_uniform_skips; // uploads skipped because the value was unchanged
+extern int am_frame_vertex_array_hits; // draws whose attributes were bound from a cached vao
+extern int am_frame_vertex_array_misses; // draws that had to set up a new vao
+void am_reset_program_frame_stats();
+
+// Binds the attribute arrays of the active program using a cached vertex
+// array object, setting one up if needed. Returns false if they can't be
+// cached, in which case they should be bound one at a time.
+bool am_bind_cached_vertex_array(am_render_state *rstate, am_program *prog);
+
 void am_open_program_module(lua_State *L);
 
 const char *am_program_param_type_name(am_program_param_type t);
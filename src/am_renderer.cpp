@@ -490,6 +490,13 @@ void am_render_state::enable_vaas(int n) {
     num_enabled_vaas = n;
 }
 
+void am_render_state::bind_vertex_array(am_vertex_array_id vao) {
+    if (bound_vertex_array != vao) {
+        am_bind_vertex_array(vao);
+        bound_vertex_array = vao;
+    }
+}
+
 bool am_render_state::update_state() {
     assert(active_program != NULL);
     active_viewport_state.bind(this, false);
@@ -503,7 +510,9 @@ bool am_render_state::update_state() {
     if (!bind_active_program_params()) {
         return false;
     }
-    enable_vaas(active_program->num_vaas);
+    if (bound_vertex_array == 0) {
+        enable_vaas(active_program->num_vaas);
+    }
     return true;
 }
 
@@ -567,6 +576,7 @@ static void setup(am_render_state *rstate, am_framebuffer_id fb,
 
     rstate->param_name_map[rstate->projection_param_index].value.set_mat4(proj);
     rstate->param_name_map[rstate->modelview_param_index].value.set_mat4(glm::dmat4(1.0));
+    rstate->param_name_map[rstate->modelview_param_index].value.mat4_stamp = AM_IDENTITY_MAT4_STAMP;
 }
 
 void am_render_state::do_render(am_scene_node **roots, int num_roots, am_framebuffer_id fb,
@@ -578,12 +588,21 @@ void am_render_state::do_render(am_scene_node **roots, int num_roots, am_framebu
     for (int i = 0; i < num_roots; i++) {
         am_scene_node *root = roots[i];
         if (root == NULL || am_node_hidden(root)) continue;
-        next_pass = 1;
-        do {
-            pass = next_pass;
+        if (single_traversal) {
+            pass = AM_ALL_PASSES;
             pass_mask = 1;
+            current_pass = 1;
             root->render(this);
-        } while (next_pass > pass);
+            replay_deferred_passes();
+        } else {
+            next_pass = 1;
+            do {
+                pass = next_pass;
+                pass_mask = 1;
+                current_pass = pass;
+                root->render(this);
+            } while (next_pass > pass);
+        }
     }
 
     // Unbind the current program, because it might be
@@ -591,6 +610,9 @@ void am_render_state::do_render(am_scene_node **roots, int num_roots, am_framebu
     // do_render.
     bound_program_id = 0;
     am_use_program(0);
+    // Likewise for the vao, which buffer updates outside do_render
+    // would also modify.
+    bind_vertex_array(0);
     am_gl_end_framebuffer_render();
 
     render_count++;
@@ -603,6 +625,107 @@ static bool check_pass(am_render_state *rstate) {
     return (rstate->pass & rstate->pass_mask);
 }
 
+// Captures the draw for each pass it's in after the current one and
+// returns whether it's also in the current pass.
+bool am_render_state::defer_later_passes(am_draw_mode mode, int first, int count,
+    am_buffer_view *indices_view, am_element_index_type type)
+{
+    uint32_t passes = pass & pass_mask;
+    uint32_t later = passes & ~current_pass;
+    if (later == 0) return true;
+    if (deferred == NULL) {
+        deferred = new am_deferred_passes();
+        deferred->pending = 0;
+    }
+    int index = deferred->draws.size();
+    am_batch_draw draw;
+    am_init_captured_draw(this, &draw, mode, first, count, indices_view, type, &deferred->values);
+    deferred->draws.push_back(draw);
+    if (batch != NULL && batch->depth > 0) {
+        deferred->batch_runs.push_back(batch->run);
+        deferred->batch_position_names.push_back(batch->position_name);
+    } else {
+        deferred->batch_runs.push_back(0);
+        deferred->batch_position_names.push_back(-1);
+    }
+    deferred->pending |= later;
+    for (int p = 0; p < 32; p++) {
+        if (later & (1u << p)) {
+            deferred->pass_draws[p].push_back(index);
+        }
+    }
+    return (passes & current_pass) != 0;
+}
+
+// Draws the deferred draws one pass at a time, in the order they
+// were captured, so the result is the same as traversing the scene
+// once per pass. Consecutive draws from the same batch node are
+// passed through the batch again, so they're merged as they would
+// have been in that pass.
+void am_render_state::replay_deferred_passes() {
+    if (deferred == NULL || deferred->pending == 0) return;
+
+    am_viewport_state       old_viewport_state = active_viewport_state;
+    am_scissor_test_state   old_scissor_test_state = active_scissor_test_state;
+    am_color_mask_state     old_color_mask_state = active_color_mask_state;
+    am_depth_test_state     old_depth_test_state = active_depth_test_state;
+    am_stencil_test_state   old_stencil_test_state = active_stencil_test_state;
+    am_cull_face_state      old_cull_face_state = active_cull_face_state;
+    am_blend_state          old_blend_state = active_blend_state;
+    am_program              *old_program = active_program;
+    std::vector<am_program_param_value> old_values(param_name_map_capacity);
+    for (int i = 0; i < param_name_map_capacity; i++) {
+        old_values[i] = param_name_map[i].value;
+    }
+
+    for (int p = 0; p < 32; p++) {
+        std::vector<int> *draws = &deferred->pass_draws[p];
+        if (draws->size() == 0) continue;
+        pass = 1u << p;
+        pass_mask = pass;
+        current_pass = pass;
+        uint32_t run = 0;
+        for (unsigned int i = 0; i < draws->size(); i++) {
+            int d = (*draws)[i];
+            if (deferred->batch_runs[d] != run) {
+                if (run != 0) {
+                    batch->depth = 0;
+                    am_batch_flush(this);
+                }
+                run = deferred->batch_runs[d];
+                if (run != 0) {
+                    batch->position_name = deferred->batch_position_names[d];
+                    batch->depth = 1;
+                }
+            }
+            am_batch_draw *draw = &deferred->draws[d];
+            am_replay_captured_draw(this, draw, &deferred->values[draw->values_offset]);
+        }
+        if (run != 0) {
+            batch->depth = 0;
+            am_batch_flush(this);
+        }
+        draws->clear();
+    }
+    deferred->draws.clear();
+    deferred->values.clear();
+    deferred->batch_runs.clear();
+    deferred->batch_position_names.clear();
+    deferred->pending = 0;
+
+    active_viewport_state = old_viewport_state;
+    active_scissor_test_state = old_scissor_test_state;
+    active_color_mask_state = old_color_mask_state;
+    active_depth_test_state = old_depth_test_state;
+    active_stencil_test_state = old_stencil_test_state;
+    active_cull_face_state = old_cull_face_state;
+    active_blend_state = old_blend_state;
+    active_program = old_program;
+    for (int i = 0; i < param_name_map_capacity; i++) {
+        param_name_map[i].value = old_values[i];
+    }
+}
+
 void am_render_state::draw_arrays(am_draw_mode mode, int first, int draw_array_count) {
     if (draw_array_count == 0) return;
     if (!check_pass(this)) { return; }
@@ -611,6 +734,15 @@ void am_render_state::draw_arrays(am_draw_mode mode, int first, int draw_array_c
             "because no shader program has been bound");
         return;
     }
+    if (recording != NULL) {
+        am_retained_capture_draw(this, mode, first, draw_array_count, NULL, AM_ELEMENT_TYPE_USHORT);
+        return;
+    }
+    if (!defer_later_passes(mode, first, draw_array_count, NULL, AM_ELEMENT_TYPE_USHORT)) return;
+    if (batch != NULL && batch->depth > 0) {
+        if (am_batch_capture_draw(this, mode, first, draw_array_count, NULL, AM_ELEMENT_TYPE_USHORT)) return;
+        am_batch_flush(this);
+    }
     if (!update_state()) {
         // warning would already have been emitted
         return;
@@ -624,7 +756,11 @@ void am_render_state::draw_arrays(am_draw_mode mode, int first, int draw_array_c
         int count = max_draw_array_size - first;
         if (count > draw_array_count) count = draw_array_count;
         if (count > 0) {
-            am_draw_arrays(mode, first, count);
+            if (instance_count > 0) {
+                draw_instances(mode, first, count, false, AM_ELEMENT_TYPE_USHORT);
+            } else {
+                am_draw_arrays(mode, first, count);
+            }
         }
     }
 }
@@ -639,6 +775,15 @@ void am_render_state::draw_elements(am_draw_mode mode, int first, int count,
             "because no shader program has been bound");
         return;
     }
+    if (recording != NULL) {
+        am_retained_capture_draw(this, mode, first, count, indices_view, type);
+        return;
+    }
+    if (!defer_later_passes(mode, first, count, indices_view, type)) return;
+    if (batch != NULL && batch->depth > 0) {
+        if (am_batch_capture_draw(this, mode, first, count, indices_view, type)) return;
+        am_batch_flush(this);
+    }
     if (!update_state()) {
         // warning would already have been emitted
         return;
@@ -661,8 +806,13 @@ void am_render_state::draw_elements(am_draw_mode mode, int first, int count,
             count = (indices_view->size - first);
         }
         if (count > 0) {
-            am_bind_buffer(AM_ELEMENT_ARRAY_BUFFER, indices_view->buffer->elembuf->get_latest_id());
-            am_draw_elements(mode, count, type, first * indices_view->stride);
+            int offset = indices_view->buffer->elembuf->bind(indices_view->buffer)
+                + first * indices_view->stride;
+            if (instance_count > 0) {
+                draw_instances(mode, offset, count, true, type);
+            } else {
+                am_draw_elements(mode, count, type, offset);
+            }
         }
     }
 }
@@ -698,7 +848,15 @@ void am_render_state::bind_active_program() {
 
 bool am_render_state::bind_active_program_params() {
     max_draw_array_size = INT_MAX;
-    for (int i = 0; i < active_program->num_params; i++) {
+    max_instance_array_size = INT_MAX;
+    // Attribute divisors are vao state, so instanced draws always
+    // bind their attributes to the default vao.
+    bool cached = am_vertex_arrays_supported && num_instance_params == 0
+        && am_bind_cached_vertex_array(this, active_program);
+    if (!cached) {
+        bind_vertex_array(0);
+    }
+    for (int i = cached ? active_program->num_vaas : 0; i < active_program->num_params; i++) {
         am_program_param *param = &active_program->params[i];
         if (!param->bind(this)) return false;
     }
@@ -709,10 +867,19 @@ am_render_state::am_render_state() {
     pass = 1;
     next_pass = 1;
     pass_mask = 1;
+    current_pass = 1;
+    single_traversal = false;
 
     max_draw_array_size = 0;
 
+    instance_count = 0;
+    num_instance_params = 0;
+    instance_param_names = NULL;
+    max_instance_array_size = 0;
+    num_bound_instance_attrs = 0;
+
     num_enabled_vaas = 0;
+    bound_vertex_array = 0;
     bound_program_id = 0;
     active_program = NULL;
 
@@ -725,6 +892,74 @@ am_render_state::am_render_state() {
     projection_param_index = -1;
 
     render_count = 0;
+
+    memset(stream_rings, 0, sizeof(stream_rings));
+
+    batch = NULL;
+    recording = NULL;
+    deferred = NULL;
+}
+
+bool am_render_state::is_instance_param(int name) {
+    for (int i = 0; i < num_instance_params; i++) {
+        if (instance_param_names[i] == name) return true;
+    }
+    return false;
+}
+
+// first is a byte offset into the element buffer if elements is true.
+void am_render_state::draw_instances(am_draw_mode mode, int first, int count,
+    bool elements, am_element_index_type type)
+{
+    int instances = instance_count;
+    if (instances > max_instance_array_size) instances = max_instance_array_size;
+    if (instances <= 0) return;
+    if (am_instancing_supported) {
+        if (elements) {
+            am_draw_elements_instanced(mode, count, type, first, instances);
+        } else {
+            am_draw_arrays_instanced(mode, first, count, instances);
+        }
+        return;
+    }
+    // No hardware instancing, so issue a draw per instance with the
+    // per-instance attributes set to constant values.
+    for (int j = 0; j < num_bound_instance_attrs; j++) {
+        am_set_attribute_array_enabled(bound_instance_attr_locations[j], false);
+    }
+    for (int i = 0; i < instances; i++) {
+        for (int j = 0; j < num_bound_instance_attrs; j++) {
+            am_buffer_view *view = bound_instance_attr_views[j];
+            am_view_type_info *info = &am_view_type_infos[view->type];
+            uint8_t *ptr = view->buffer->data + view->offset + i * view->stride;
+            float value[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+            for (int c = 0; c < view->components; c++) {
+                value[c] = (float)info->num_reader(ptr + c * info->size);
+            }
+            am_set_attribute4f(bound_instance_attr_locations[j], value);
+        }
+        if (elements) {
+            am_draw_elements(mode, count, type, first);
+        } else {
+            am_draw_arrays(mode, first, count);
+        }
+    }
+    for (int j = 0; j < num_bound_instance_attrs; j++) {
+        am_set_attribute_array_enabled(bound_instance_attr_locations[j], true);
+    }
+}
+
+void am_render_state::reset_instance_attrs() {
+    if (am_instancing_supported && num_bound_instance_attrs > 0) {
+        bind_vertex_array(0);
+        for (int j = 0; j < num_bound_instance_attrs; j++) {
+            am_set_attribute_divisor(bound_instance_attr_locations[j], 0);
+        }
+    }
+    num_bound_instance_attrs = 0;
+    instance_count = 0;
+    num_instance_params = 0;
+    instance_param_names = NULL;
 }
 
 am_draw_node::am_draw_node() {
@@ -892,13 +1127,151 @@ static int create_draw_node(lua_State *L) {
     return 1;
 }
 
+void am_draw_instanced_node::render(am_render_state *rstate) {
+    if (instances <= 0) return;
+    am_program_param_value *old_vals = (am_program_param_value*)alloca(sizeof(am_program_param_value) * num_attrs);
+    for (int i = 0; i < num_attrs; i++) {
+        am_program_param_value *param = &rstate->param_name_map[names[i]].value;
+        old_vals[i] = *param;
+        param->set_arr(views[i]);
+    }
+    rstate->instance_count = instances;
+    rstate->num_instance_params = num_attrs;
+    rstate->instance_param_names = names;
+    am_draw_node::render(rstate);
+    rstate->reset_instance_attrs();
+    for (int i = 0; i < num_attrs; i++) {
+        rstate->param_name_map[names[i]].value = old_vals[i];
+    }
+}
+
+static am_draw_instanced_node *new_draw_instanced_node(lua_State *L, int num_attrs) {
+    // allocate extra space for the attribute names, views and refs
+    size_t node_sz = sizeof(am_draw_instanced_node);
+    am_align_size(node_sz);
+    size_t names_sz = sizeof(int) * num_attrs;
+    am_align_size(names_sz);
+    size_t views_sz = sizeof(am_buffer_view*) * num_attrs;
+    am_align_size(views_sz);
+    size_t refs_sz = sizeof(int) * num_attrs;
+    am_align_size(refs_sz);
+    am_draw_instanced_node *node = (am_draw_instanced_node*)am_set_metatable(L,
+        new (lua_newuserdata(L, node_sz + names_sz + views_sz + refs_sz))
+        am_draw_instanced_node(), MT_am_draw_instanced_node);
+    node->num_attrs = num_attrs;
+    node->names = (int*)(((uint8_t*)node) + node_sz);
+    node->views = (am_buffer_view**)(((uint8_t*)node) + node_sz + names_sz);
+    node->refs = (int*)(((uint8_t*)node) + node_sz + names_sz + views_sz);
+    return node;
+}
+
+static int create_draw_instanced_node(lua_State *L) {
+    int nargs = am_check_nargs(L, 3);
+    am_draw_mode mode = am_get_enum(L, am_draw_mode, 1);
+    int instances = luaL_checkinteger(L, 2);
+    if (instances < 0) {
+        return luaL_error(L, "instance count must be non-negative (in fact %d)", instances);
+    }
+    if (!lua_istable(L, 3)) {
+        return luaL_error(L, "expecting a table of per-instance attributes in position 3");
+    }
+    int num_attrs = 0;
+    lua_pushnil(L);
+    while (lua_next(L, 3)) {
+        if (!lua_isstring(L, -2)) {
+            return luaL_error(L, "all attribute names must be strings");
+        }
+        am_buffer_view *view = am_check_buffer_view(L, -1);
+        if (!view->can_be_gl_attrib()) {
+            return luaL_error(L, "attribute '%s' has a view type that can't be used as a vertex attribute",
+                lua_tostring(L, -2));
+        }
+        num_attrs++;
+        lua_pop(L, 1);
+    }
+    if (num_attrs > AM_MAX_INSTANCE_ATTRIBUTES) {
+        return luaL_error(L, "too many per-instance attributes (max %d)", AM_MAX_INSTANCE_ATTRIBUTES);
+    }
+    am_draw_instanced_node *node = new_draw_instanced_node(L, num_attrs);
+    node->tags.push_back(L, AM_TAG_DRAW);
+    node->mode = mode;
+    node->instances = instances;
+    int index = 0;
+    lua_pushnil(L);
+    while (lua_next(L, 3)) {
+        am_buffer_view *view = am_get_userdata(L, am_buffer_view, -1);
+        if (view->buffer->arraybuf == NULL) {
+            view->buffer->create_arraybuf(L);
+        }
+        node->names[index] = am_lookup_param_name(L, -2);
+        node->views[index] = view;
+        node->refs[index] = node->ref(L, -1);
+        index++;
+        lua_pop(L, 1);
+    }
+    int nxt_arg = 4;
+    if (nargs >= nxt_arg && !lua_isnumber(L, nxt_arg)) {
+        set_indices(L, node, nxt_arg);
+        nxt_arg++;
+    }
+    if (nargs >= nxt_arg) {
+        node->first = luaL_checkinteger(L, nxt_arg) - 1;
+        if (node->first < 0) {
+            return luaL_error(L, "argument %d must be positive", nxt_arg);
+        }
+        nxt_arg++;
+    }
+    if (nargs >= nxt_arg) {
+        node->count = luaL_checkinteger(L, nxt_arg);
+        if (node->count < 0) {
+            return luaL_error(L, "argument %d must be non-negative", nxt_arg);
+        }
+        nxt_arg++;
+    }
+    return 1;
+}
+
+static void get_draw_instanced_node_instances(lua_State *L, void *obj) {
+    am_draw_instanced_node *node = (am_draw_instanced_node*)obj;
+    lua_pushinteger(L, node->instances);
+}
+
+static void set_draw_instanced_node_instances(lua_State *L, void *obj) {
+    am_draw_instanced_node *node = (am_draw_instanced_node*)obj;
+    int instances = luaL_checkinteger(L, 3);
+    if (instances < 0) {
+        luaL_error(L, "value must be non-negative (in fact %d)", instances);
+    }
+    node->instances = instances;
+}
+
+static am_property draw_instanced_node_instances_property =
+    {get_draw_instanced_node_instances, set_draw_instanced_node_instances};
+
+static void register_draw_instanced_node_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_scene_node_index, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, am_scene_node_newindex, 0);
+    lua_setfield(L, -2, "__newindex");
+
+    am_register_property(L, "instances", &draw_instanced_node_instances_property);
+
+    am_register_metatable(L, "draw_instanced", MT_am_draw_instanced_node, MT_am_draw_node);
+}
+
 void am_pass_filter_node::render(am_render_state *rstate) {
-    if (rstate->pass & mask) {
-        uint32_t old = rstate->pass_mask;
-        rstate->pass_mask = rstate->pass;
+    uint32_t passes = rstate->pass & mask;
+    if (passes) {
+        uint32_t old_pass = rstate->pass;
+        uint32_t old_mask = rstate->pass_mask;
+        rstate->pass = passes;
+        rstate->pass_mask = passes;
         render_children(rstate);
-        rstate->pass_mask = old;
+        rstate->pass = old_pass;
+        rstate->pass_mask = old_mask;
     }
+    if (rstate->single_traversal) return;
     uint32_t next = rstate->pass << 1;
     while (next && !(next & mask)) {
         next <<= 1;
@@ -918,6 +1291,12 @@ static int create_pass_filter_node(lua_State *L) {
     return 1;
 }
 
+static int set_single_traversal(lua_State *L) {
+    am_check_nargs(L, 1);
+    am_global_render_state->single_traversal = lua_toboolean(L, 1);
+    return 0;
+}
+
 static void register_pass_filter_node_mt(lua_State *L) {
     lua_newtable(L);
     lua_pushcclosure(L, am_scene_node_index, 0);
@@ -953,7 +1332,9 @@ static void init_param_name_map(am_render_state *rstate, lua_State *L) {
 void am_open_renderer_module(lua_State *L) {
     luaL_Reg funcs[] = {
         {"draw", create_draw_node},
+        {"draw_instanced", create_draw_instanced_node},
         {"pass", create_pass_filter_node},
+        {"set_single_traversal", set_single_traversal},
         {NULL, NULL}
     };
     am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
@@ -971,6 +1352,7 @@ void am_open_renderer_module(lua_State *L) {
     am_register_enum(L, ENUM_am_draw_mode, draw_mode_enum);
 
     register_draw_node_mt(L);
+    register_draw_instanced_node_mt(L);
     register_pass_filter_node_mt(L);
 
 #if defined(AM_ANDROID)
@@ -981,6 +1363,14 @@ void am_open_renderer_module(lua_State *L) {
             free(am_global_render_state->param_name_map);
             am_global_render_state->param_name_map = NULL;
         }
+        if (am_global_render_state->batch != NULL) {
+            delete am_global_render_state->batch;
+            am_global_render_state->batch = NULL;
+        }
+        if (am_global_render_state->deferred != NULL) {
+            delete am_global_render_state->deferred;
+            am_global_render_state->deferred = NULL;
+        }
         delete am_global_render_state;
         am_global_render_state = NULL;
     }
@@ -1,7 +1,15 @@
+#define AM_MAX_INSTANCE_ATTRIBUTES 16
+
+// The pass set used when traversing the scene once for all passes.
+#define AM_ALL_PASSES 0xFFFFFFFF
+
 struct am_program;
 struct am_program_param;
 struct am_program_param_name_slot;
 struct am_program_param_value;
+struct am_batch_state;
+struct am_retained_segment;
+struct am_deferred_passes;
 
 struct am_viewport_state {
     int                     x;
@@ -157,9 +165,16 @@ struct am_dither_state {
 };
 
 struct am_render_state {
+    // pass is the set of passes in which the node being rendered is
+    // reached and pass_mask the set of passes pass filters allow draws
+    // in. Each is a single pass unless single_traversal is set, in
+    // which case the scene is traversed once for all passes and draws
+    // not in current_pass are deferred until the end of the traversal.
     uint32_t                pass;
     uint32_t                next_pass;
     uint32_t                pass_mask;
+    uint32_t                current_pass;
+    bool                    single_traversal;
 
     am_viewport_state       bound_viewport_state;
     am_viewport_state       active_viewport_state;
@@ -178,7 +193,17 @@ struct am_render_state {
 
     int                     max_draw_array_size;
 
-    int                     num_enabled_vaas; // num enabled vertex attribute arrays
+    // per-instance attributes of the instanced draw being rendered
+    int                     instance_count; // 0 if not drawing instances
+    int                     num_instance_params;
+    int                     *instance_param_names; // am_param_name_ids
+    int                     max_instance_array_size;
+    int                     num_bound_instance_attrs;
+    am_gluint               bound_instance_attr_locations[AM_MAX_INSTANCE_ATTRIBUTES];
+    am_buffer_view          *bound_instance_attr_views[AM_MAX_INSTANCE_ATTRIBUTES];
+
+    int                     num_enabled_vaas; // num enabled vertex attribute arrays of the default vao
+    am_vertex_array_id      bound_vertex_array; // 0 if the default vao is bound
     am_program_id           bound_program_id;
     am_program              *active_program;
     int                     param_name_map_capacity;
@@ -191,16 +216,30 @@ struct am_render_state {
 
     uint32_t                render_count;
 
+    am_stream_ring          stream_rings[2]; // array and element buffers
+
+    am_batch_state          *batch; // NULL until the first batch node is rendered
+    am_retained_segment     *recording; // non-NULL while a retained node records a child
+    am_deferred_passes      *deferred; // NULL until a draw is first deferred
+
     am_render_state();
 
     void draw_arrays(am_draw_mode mode, int first, int count);
     void draw_elements(am_draw_mode mode, int first, int count,
         am_buffer_view *indices_view, am_element_index_type type);
+    bool defer_later_passes(am_draw_mode mode, int first, int count,
+        am_buffer_view *indices_view, am_element_index_type type);
+    void replay_deferred_passes();
     bool validate_active_program(am_draw_mode mode);
     void bind_active_program();
     bool bind_active_program_params();
     bool update_state();
     void enable_vaas(int n);
+    void bind_vertex_array(am_vertex_array_id vao);
+    bool is_instance_param(int name);
+    void draw_instances(am_draw_mode mode, int first, int count,
+        bool elements, am_element_index_type type);
+    void reset_instance_attrs();
     void do_render(am_scene_node **roots, int num_roots, am_framebuffer_id fb, 
         bool clear, glm::dvec4 clear_color, int stencil_clear_val,
         int x, int y, int w, int h, int fbw, int fbh, glm::dmat4 proj, bool has_depthbuffer);
@@ -218,6 +257,16 @@ struct am_draw_node : am_scene_node {
     virtual void render(am_render_state *rstate);
 };
 
+struct am_draw_instanced_node : am_draw_node {
+    int instances;
+    int num_attrs;
+    int *names; // am_param_name_ids
+    am_buffer_view **views;
+    int *refs;
+
+    virtual void render(am_render_state *rstate);
+};
+
 struct am_pass_filter_node : am_scene_node {
     uint32_t mask;
     virtual void render(am_render_state *rstate);
@@ -10,6 +10,7 @@ typedef enum {
     AM_ROOT_AUDIO_NODE,
     AM_BUFFER_DATA_ALLOCATOR,
     AM_DEFAULT_RAND,
+    AM_PROFILER_NAMES,
 
     MT_am_window,
     MT_am_program,
@@ -37,8 +38,12 @@ typedef enum {
     MT_am_cull_face_node,
     MT_am_cull_sphere_node,
     MT_am_cull_box_node,
+    MT_am_cull_bvh_node,
     MT_am_draw_node,
+    MT_am_draw_instanced_node,
     MT_am_pass_filter_node,
+    MT_am_batch_node,
+    MT_am_retained_node,
     MT_tag_search_result,
 
     MT_am_audio_buffer,
@@ -83,9 +88,15 @@ typedef enum {
     MT_am_quat,
 
     MT_am_http_request,
+    MT_am_job_future,
     MT_am_socket,
 
     MT_am_rand,
+    MT_am_mathv_kernel,
+    MT_am_json_doc,
+    MT_am_json_value,
+    MT_am_text_font,
+    MT_am_package_handle,
 
     MT_am_iap_product,
 
@@ -0,0 +1,351 @@
+#include "amulet.h"
+
+// memcmp may report states as different because of padding,
+// which only causes an unnecessary re-record.
+#define SAME_STATE(a, b) (memcmp(&(a), &(b), sizeof(a)) == 0)
+
+void am_retained_record_node(am_render_state *rstate, am_scene_node *node) {
+    am_retained_node_version nv;
+    nv.node = node;
+    nv.version = node->version;
+    rstate->recording->nodes.push_back(nv);
+}
+
+void am_retained_capture_draw(am_render_state *rstate, am_draw_mode mode,
+    int first, int count, am_buffer_view *indices_view, am_element_index_type type)
+{
+    am_retained_segment *seg = rstate->recording;
+    am_batch_draw draw;
+    am_init_captured_draw(rstate, &draw, mode, first, count, indices_view, type, &seg->values);
+    seg->draws.push_back(draw);
+}
+
+static am_retained_pass *get_pass(am_retained_node *node, am_render_state *rstate) {
+    std::vector<am_retained_pass> *passes = node->passes;
+    for (unsigned int i = 0; i < passes->size(); i++) {
+        if ((*passes)[i].pass == rstate->pass) return &(*passes)[i];
+    }
+    passes->push_back(am_retained_pass());
+    am_retained_pass *p = &passes->back();
+    p->pass = rstate->pass;
+    p->pass_mask = 0; // forces the entry state to be saved
+    p->node_version = node->version - 1;
+    p->program = NULL;
+    p->next_free_texture_unit = -1;
+    p->commands_valid = false;
+    return p;
+}
+
+static bool entry_state_matches(am_render_state *rstate, am_retained_pass *p) {
+    if (p->pass_mask != rstate->pass_mask) return false;
+    if (p->program != rstate->active_program) return false;
+    if (p->next_free_texture_unit != rstate->next_free_texture_unit) return false;
+    if (!SAME_STATE(p->viewport_state, rstate->active_viewport_state)) return false;
+    if (!SAME_STATE(p->scissor_test_state, rstate->active_scissor_test_state)) return false;
+    if (!SAME_STATE(p->color_mask_state, rstate->active_color_mask_state)) return false;
+    if (!SAME_STATE(p->depth_test_state, rstate->active_depth_test_state)) return false;
+    if (!SAME_STATE(p->stencil_test_state, rstate->active_stencil_test_state)) return false;
+    if (!SAME_STATE(p->cull_face_state, rstate->active_cull_face_state)) return false;
+    if (!SAME_STATE(p->blend_state, rstate->active_blend_state)) return false;
+    if ((int)p->params.size() != rstate->param_name_map_capacity) return false;
+    for (int i = 0; i < rstate->param_name_map_capacity; i++) {
+        if (memcmp(&p->params[i], &rstate->param_name_map[i].value, sizeof(am_program_param_value)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void save_entry_state(am_render_state *rstate, am_retained_pass *p) {
+    p->pass_mask = rstate->pass_mask;
+    p->program = rstate->active_program;
+    p->next_free_texture_unit = rstate->next_free_texture_unit;
+    p->viewport_state = rstate->active_viewport_state;
+    p->scissor_test_state = rstate->active_scissor_test_state;
+    p->color_mask_state = rstate->active_color_mask_state;
+    p->depth_test_state = rstate->active_depth_test_state;
+    p->stencil_test_state = rstate->active_stencil_test_state;
+    p->cull_face_state = rstate->active_cull_face_state;
+    p->blend_state = rstate->active_blend_state;
+    p->params.resize(rstate->param_name_map_capacity);
+    for (int i = 0; i < rstate->param_name_map_capacity; i++) {
+        p->params[i] = rstate->param_name_map[i].value;
+    }
+}
+
+static void restore_entry_state(am_render_state *rstate, am_retained_pass *p) {
+    rstate->active_program = p->program;
+    rstate->active_viewport_state = p->viewport_state;
+    rstate->active_scissor_test_state = p->scissor_test_state;
+    rstate->active_color_mask_state = p->color_mask_state;
+    rstate->active_depth_test_state = p->depth_test_state;
+    rstate->active_stencil_test_state = p->stencil_test_state;
+    rstate->active_cull_face_state = p->cull_face_state;
+    rstate->active_blend_state = p->blend_state;
+    for (int i = 0; i < rstate->param_name_map_capacity; i++) {
+        rstate->param_name_map[i].value = p->params[i];
+    }
+}
+
+static void swap_segments(am_retained_segment *a, am_retained_segment *b) {
+    am_scene_node *child = a->child;
+    bool valid = a->valid;
+    uint32_t next_pass = a->next_pass;
+    a->child = b->child;
+    a->valid = b->valid;
+    a->next_pass = b->next_pass;
+    b->child = child;
+    b->valid = valid;
+    b->next_pass = next_pass;
+    a->nodes.swap(b->nodes);
+    a->draws.swap(b->draws);
+    a->values.swap(b->values);
+}
+
+// Matches up segments with the node's current children, so that
+// adding, removing or reordering children only requires recording
+// the new ones. Only child pointers are compared here, since the old
+// children may have been freed.
+static void sync_segments(am_retained_node *node, am_retained_pass *p) {
+    std::vector<am_retained_segment> old;
+    old.swap(p->segments);
+    p->segments.resize(node->children.size);
+    for (int i = 0; i < node->children.size; i++) {
+        am_retained_segment *seg = &p->segments[i];
+        seg->child = node->children.arr[i].child;
+        seg->valid = false;
+        for (unsigned int j = 0; j < old.size(); j++) {
+            if (old[j].child == seg->child) {
+                swap_segments(seg, &old[j]);
+                old[j].child = NULL;
+                break;
+            }
+        }
+    }
+    p->node_version = node->version;
+    p->commands_valid = false;
+}
+
+static bool segment_up_to_date(am_retained_segment *seg) {
+    if (!seg->valid) return false;
+    // Nodes were recorded in pre-order, so a node is only dereferenced
+    // after its parent was found to be unchanged, which means it's still
+    // alive.
+    for (unsigned int i = 0; i < seg->nodes.size(); i++) {
+        am_retained_node_version *nv = &seg->nodes[i];
+        if (nv->node->version != nv->version) return false;
+    }
+    return true;
+}
+
+static void record_segment(am_render_state *rstate, am_retained_segment *seg) {
+    seg->nodes.clear();
+    seg->draws.clear();
+    seg->values.clear();
+    uint32_t old_next_pass = rstate->next_pass;
+    rstate->next_pass = rstate->pass;
+    rstate->recording = seg;
+    am_retained_record_node(rstate, seg->child);
+    if (!am_node_hidden(seg->child)) {
+        seg->child->render(rstate);
+    }
+    rstate->recording = NULL;
+    seg->next_pass = rstate->next_pass;
+    rstate->next_pass = old_next_pass;
+    seg->valid = true;
+}
+
+static uint64_t sort_key(am_render_state *rstate, uint32_t pass,
+    am_batch_draw *draw, am_program_param_value *values)
+{
+    am_program *prog = draw->program;
+    uint64_t pass_index = 0;
+    while (pass > 1) {
+        pass >>= 1;
+        pass_index++;
+    }
+    uint64_t texture = 0;
+    uint64_t depth = 0;
+    for (int i = 0; i < prog->num_params; i++) {
+        am_program_param_value *value = &values[i];
+        if (value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_SAMPLER2D) {
+            if (texture == 0 && value->value.sampler2d.texture != NULL) {
+                texture = value->value.sampler2d.texture->texture_id & 0xFFFF;
+            }
+        } else if (prog->params[i].name == rstate->modelview_param_index
+            && value->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4)
+        {
+            // Distance in front of the camera. The bit patterns of
+            // positive floats order the same way as their values.
+            float dist = (float)-value->value.m4[14];
+            if (dist > 0.0f) {
+                uint32_t bits;
+                memcpy(&bits, &dist, sizeof(bits));
+                depth = bits >> 8;
+            }
+        }
+    }
+    return ((pass_index & 0xFF) << 56)
+        | (((uint64_t)prog->program_id & 0xFFFF) << 40)
+        | (texture << 24)
+        | depth;
+}
+
+static bool command_less(const am_retained_command &a, const am_retained_command &b) {
+    return a.key < b.key;
+}
+
+// A draw can be reordered with its neighbours if each of its fragments
+// either writes both color and depth or nothing, and whether it passes
+// doesn't depend on what was drawn before at the same depth. Blending,
+// stenciling, disabled depth writes or color channels and depth funcs
+// like EQUAL, LEQUAL or ALWAYS all make the result order dependent.
+static bool draw_is_sortable(am_batch_draw *draw) {
+    am_depth_test_state *depth = &draw->depth_test_state;
+    am_color_mask_state *color = &draw->color_mask_state;
+    return depth->test_enabled && depth->mask_enabled
+        && (depth->func == AM_DEPTH_FUNC_LESS || depth->func == AM_DEPTH_FUNC_GREATER)
+        && color->r && color->g && color->b && color->a
+        && !draw->blend_state.enabled
+        && !draw->stencil_test_state.enabled;
+}
+
+static void build_commands(am_render_state *rstate, am_retained_pass *p, bool sort) {
+    p->commands.clear();
+    for (unsigned int s = 0; s < p->segments.size(); s++) {
+        am_retained_segment *seg = &p->segments[s];
+        for (unsigned int d = 0; d < seg->draws.size(); d++) {
+            am_batch_draw *draw = &seg->draws[d];
+            am_retained_command cmd;
+            cmd.key = sort_key(rstate, p->pass, draw, &seg->values[draw->values_offset]);
+            cmd.segment = s;
+            cmd.draw = d;
+            cmd.sortable = draw_is_sortable(draw);
+            cmd.depth_func = draw->depth_test_state.func;
+            p->commands.push_back(cmd);
+        }
+    }
+    if (sort) {
+        // only reorder within runs of sortable draws with the same depth func
+        unsigned int start = 0;
+        while (start < p->commands.size()) {
+            if (!p->commands[start].sortable) {
+                start++;
+                continue;
+            }
+            unsigned int end = start + 1;
+            while (end < p->commands.size() && p->commands[end].sortable
+                && p->commands[end].depth_func == p->commands[start].depth_func)
+            {
+                end++;
+            }
+            std::stable_sort(p->commands.begin() + start, p->commands.begin() + end, command_less);
+            start = end;
+        }
+    }
+    p->commands_valid = true;
+}
+
+static void submit_commands(am_render_state *rstate, am_retained_pass *p) {
+    if (p->commands.size() == 0) return;
+    for (unsigned int i = 0; i < p->commands.size(); i++) {
+        am_retained_command *cmd = &p->commands[i];
+        am_retained_segment *seg = &p->segments[cmd->segment];
+        am_batch_draw *draw = &seg->draws[cmd->draw];
+        am_replay_captured_draw(rstate, draw, &seg->values[draw->values_offset]);
+    }
+    restore_entry_state(rstate, p);
+}
+
+void am_retained_node::render(am_render_state *rstate) {
+    if (rstate->recording != NULL) {
+        // an enclosing retained node is recording us
+        render_children(rstate);
+        return;
+    }
+    if (recursion_limit < 0) return;
+    am_retained_pass *p = get_pass(this, rstate);
+    if (!entry_state_matches(rstate, p)) {
+        save_entry_state(rstate, p);
+        for (unsigned int i = 0; i < p->segments.size(); i++) {
+            p->segments[i].valid = false;
+        }
+    }
+    if (p->node_version != version) {
+        sync_segments(this, p);
+    }
+    recursion_limit--;
+    for (unsigned int i = 0; i < p->segments.size(); i++) {
+        am_retained_segment *seg = &p->segments[i];
+        if (!segment_up_to_date(seg)) {
+            record_segment(rstate, seg);
+            p->commands_valid = false;
+        }
+    }
+    recursion_limit++;
+    if (!p->commands_valid) {
+        build_commands(rstate, p, sort);
+    }
+    submit_commands(rstate, p);
+
+    // pass on requests for further passes made by pass filters
+    for (unsigned int i = 0; i < p->segments.size(); i++) {
+        uint32_t next = p->segments[i].next_pass;
+        if (next != rstate->pass && (rstate->next_pass == rstate->pass || next < rstate->next_pass)) {
+            rstate->next_pass = next;
+        }
+    }
+}
+
+static int create_retained_node(lua_State *L) {
+    int nargs = am_check_nargs(L, 0);
+    am_retained_node *node = am_new_userdata(L, am_retained_node);
+    node->tags.push_back(L, AM_TAG_RETAINED);
+    node->sort = true;
+    if (nargs > 0 && !lua_isnil(L, 1)) {
+        node->sort = lua_toboolean(L, 1);
+    }
+    node->passes = new std::vector<am_retained_pass>();
+    return 1;
+}
+
+static int retained_node_gc(lua_State *L) {
+    am_retained_node *node = (am_retained_node*)lua_touserdata(L, 1);
+    delete node->passes;
+    return 0;
+}
+
+static void get_sort(lua_State *L, void *obj) {
+    am_retained_node *node = (am_retained_node*)obj;
+    lua_pushboolean(L, node->sort);
+}
+
+static void set_sort(lua_State *L, void *obj) {
+    am_retained_node *node = (am_retained_node*)obj;
+    node->sort = lua_toboolean(L, 3);
+}
+
+static am_property sort_property = {get_sort, set_sort};
+
+static void register_retained_node_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, am_scene_node_index, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcclosure(L, am_scene_node_newindex, 0);
+    lua_setfield(L, -2, "__newindex");
+    lua_pushcclosure(L, retained_node_gc, 0);
+    lua_setfield(L, -2, "__gc");
+
+    am_register_property(L, "sort", &sort_property);
+
+    am_register_metatable(L, "retained", MT_am_retained_node, MT_am_scene_node);
+}
+
+void am_open_retained_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"retained", create_retained_node},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_retained_node_mt(L);
+}
@@ -0,0 +1,59 @@
+struct am_retained_node_version {
+    am_scene_node   *node;
+    uint32_t        version;
+};
+
+// The draws recorded for one child of a retained node, along with
+// every node visited while recording them (in pre-order), so that
+// we can tell when the recording is out of date.
+struct am_retained_segment {
+    am_scene_node                           *child;
+    bool                                    valid;
+    uint32_t                                next_pass; // as requested by pass filters in the child
+    std::vector<am_retained_node_version>   nodes;
+    std::vector<am_batch_draw>              draws;
+    std::vector<am_program_param_value>     values;
+};
+
+struct am_retained_command {
+    uint64_t    key; // pass (8 bits), program (16), texture (16), depth (24)
+    int         segment;
+    int         draw;
+    bool        sortable;
+    am_depth_func depth_func;
+};
+
+// What a retained node recorded for one render pass. Recordings are
+// only reused if the render state on entry to the node is the same
+// as when they were made.
+struct am_retained_pass {
+    uint32_t                            pass;
+    uint32_t                            pass_mask;
+    uint32_t                            node_version;
+    am_program                          *program;
+    int                                 next_free_texture_unit;
+    am_viewport_state                   viewport_state;
+    am_scissor_test_state               scissor_test_state;
+    am_color_mask_state                 color_mask_state;
+    am_depth_test_state                 depth_test_state;
+    am_stencil_test_state               stencil_test_state;
+    am_cull_face_state                  cull_face_state;
+    am_blend_state                      blend_state;
+    std::vector<am_program_param_value> params; // values of all param name slots on entry
+    std::vector<am_retained_segment>    segments;
+    std::vector<am_retained_command>    commands;
+    bool                                commands_valid;
+};
+
+struct am_retained_node : am_scene_node {
+    bool sort;
+    std::vector<am_retained_pass> *passes;
+    virtual void render(am_render_state *rstate);
+};
+
+// Called while recording, for each node visited.
+void am_retained_record_node(am_render_state *rstate, am_scene_node *node);
+void am_retained_capture_draw(am_render_state *rstate, am_draw_mode mode,
+    int first, int count, am_buffer_view *indices_view, am_element_index_type type);
+
+void am_open_retained_module(lua_State *L);
@@ -18,9 +18,13 @@ am_tag AM_TAG_DEPTH_TEST;
 am_tag AM_TAG_STENCIL_TEST;
 am_tag AM_TAG_CULL_SPHERE;
 am_tag AM_TAG_CULL_BOX;
+am_tag AM_TAG_CULL_BVH;
 am_tag AM_TAG_READ_UNIFORM;
+am_tag AM_TAG_BATCH;
+am_tag AM_TAG_RETAINED;
 
 static am_tag lookup_tag(lua_State *L, int name_idx);
+static am_tag first_user_tag(am_scene_node *node);
 static am_scene_node *find_tag(am_scene_node *node, am_tag tag, am_scene_node **parent);
 
 am_scene_node::am_scene_node() {
@@ -30,6 +34,7 @@ am_scene_node::am_scene_node() {
     flags = 0;
     actions_ref = LUA_NOREF;
     action_seq = 0;
+    version = 0;
 }
 
 void am_scene_node::render_children(am_render_state *rstate) {
@@ -37,8 +42,20 @@ void am_scene_node::render_children(am_render_state *rstate) {
     recursion_limit--;
     for (int i = 0; i < children.size; i++) {
         am_scene_node *child = children.arr[i].child;
+        if (rstate->recording != NULL) {
+            // hidden children are recorded too, so that showing them
+            // invalidates the recording.
+            am_retained_record_node(rstate, child);
+        }
         if (!am_node_hidden(child)) {
-            child->render(rstate);
+            am_tag tag = am_profiler_running ? first_user_tag(child) : 0;
+            if (tag != 0) {
+                am_profile_begin_tag(tag);
+                child->render(rstate);
+                am_profile_end(AM_PROFILE_MAIN_THREAD);
+            } else {
+                child->render(rstate);
+            }
         }
     }
     recursion_limit++;
@@ -48,11 +65,17 @@ void am_scene_node::render(am_render_state *rstate) {
     render_children(rstate);
 }
 
+bool am_scene_node::cull_bounds(int *names, int num_names, am_cull_bounds *bounds) {
+    return false;
+}
+
 int am_scene_node_index(lua_State *L) {
     return am_default_index_func(L);
 }
 
 int am_scene_node_newindex(lua_State *L) {
+    am_scene_node *node = (am_scene_node*)lua_touserdata(L, 1);
+    node->version++;
     return am_default_newindex_func(L);
 }
 
@@ -64,6 +87,7 @@ static int append_child(lua_State *L) {
     child_slot.child = child;
     child_slot.ref = parent->ref(L, 2); // ref from parent to child
     parent->children.push_back(L, child_slot);
+    parent->version++;
     lua_pushvalue(L, 1); // for chaining
     return 1;
 }
@@ -76,6 +100,7 @@ static int prepend_child(lua_State *L) {
     child_slot.child = child;
     child_slot.ref = parent->ref(L, 2); // ref from parent to child
     parent->children.push_front(L, child_slot);
+    parent->version++;
     lua_pushvalue(L, 1); // for chaining
     return 1;
 }
@@ -97,6 +122,7 @@ static int remove(lua_State *L) {
         if (parent->children.arr[i].child == child) {
             parent->unref(L, parent->children.arr[i].ref);
             parent->children.remove(i);
+            parent->version++;
             break;
         }
     }
@@ -128,6 +154,7 @@ static int replace(lua_State *L) {
             slot.child = new_child;
             slot.ref = parent->ref(L, 3);
             parent->children.insert(L, i, slot);
+            parent->version++;
             break;
         }
     }
@@ -142,6 +169,7 @@ static int remove_all(lua_State *L) {
     for (int i = parent->children.size-1; i >= 0; i--) {
         parent->unref(L, parent->children.arr[i].ref);
         parent->children.remove(i);
+        parent->version++;
     }
     assert(parent->children.size == 0);
     lua_pushvalue(L, 1); // for chaining
@@ -196,6 +224,7 @@ static void add_chain_children(lua_State *L, am_scene_node *parent) {
             child_slot.child = child;
             child_slot.ref = parent->ref(L, -1); // ref from parent to child
             parent->children.push_back(L, child_slot);
+            parent->version++;
             lua_pop(L, 1); // child
             i++;
         } while (true);
@@ -205,6 +234,7 @@ static void add_chain_children(lua_State *L, am_scene_node *parent) {
         child_slot.child = child;
         child_slot.ref = parent->ref(L, 2); // ref from parent to child
         parent->children.push_back(L, child_slot);
+        parent->version++;
     }
 }
 
@@ -295,6 +325,9 @@ void am_wrap_node::render(am_render_state *rstate) {
         render_children(rstate);
         inside = true;
     } else {
+        if (rstate->recording != NULL) {
+            am_retained_record_node(rstate, wrapped);
+        }
         inside = true;
         wrapped->render(rstate);
         inside = false;
@@ -350,6 +383,7 @@ static void register_tag_search_result_mt(lua_State *L) {
 // Tags
 
 static int next_tag = 0;
+static am_tag last_builtin_tag = 0;
 
 static void init_tag_table(lua_State *L) {
     next_tag = 1;
@@ -567,9 +601,35 @@ static void init_default_tags(lua_State *L) {
     AM_TAG_CULL_BOX = lookup_tag(L, -1);
     lua_pop(L, 1);
 
+    lua_pushstring(L, "cull_bvh");
+    AM_TAG_CULL_BVH = lookup_tag(L, -1);
+    lua_pop(L, 1);
+
     lua_pushstring(L, "read_uniform");
     AM_TAG_READ_UNIFORM = lookup_tag(L, -1);
     lua_pop(L, 1);
+
+    lua_pushstring(L, "batch");
+    AM_TAG_BATCH = lookup_tag(L, -1);
+    lua_pop(L, 1);
+
+    lua_pushstring(L, "retained");
+    AM_TAG_RETAINED = lookup_tag(L, -1);
+    lua_pop(L, 1);
+
+    last_builtin_tag = (am_tag)(next_tag - 1);
+}
+
+// Returns the first tag of the node that isn't one of the built-in
+// tags above (so it was added with node:tag or by a node type defined
+// in Lua), or 0 if there isn't one.
+static am_tag first_user_tag(am_scene_node *node) {
+    for (int i = 0; i < node->tags.size; i++) {
+        if (node->tags.arr[i] > last_builtin_tag) {
+            return node->tags.arr[i];
+        }
+    }
+    return 0;
 }
 
 // Other stuff
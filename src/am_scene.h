@@ -20,6 +20,7 @@ struct am_node_child {
 };
 
 struct am_render_state;
+struct am_cull_bounds;
 
 #define AM_MAX_TAG UINT16_MAX
 typedef uint16_t am_tag;
@@ -42,7 +43,10 @@ extern am_tag AM_TAG_DEPTH_TEST;
 extern am_tag AM_TAG_STENCIL_TEST;
 extern am_tag AM_TAG_CULL_SPHERE;
 extern am_tag AM_TAG_CULL_BOX;
+extern am_tag AM_TAG_CULL_BVH;
 extern am_tag AM_TAG_READ_UNIFORM;
+extern am_tag AM_TAG_BATCH;
+extern am_tag AM_TAG_RETAINED;
 
 struct am_scene_node : am_nonatomic_userdata {
     am_lua_array<am_node_child> children;
@@ -51,10 +55,14 @@ struct am_scene_node : am_nonatomic_userdata {
     uint32_t flags;
     int actions_ref;
     unsigned int action_seq; // used to avoid duplicating action in lua action list
+    uint32_t version; // incremented whenever a field or the child list changes
 
     am_scene_node();
     virtual void render(am_render_state *rstate);
     void render_children(am_render_state *rstate);
+    // Returns true if the node only renders its children when the given
+    // bounds are visible to the product of the named matrices.
+    virtual bool cull_bounds(int *names, int num_names, am_cull_bounds *bounds);
 };
 
 struct am_wrap_node : am_scene_node {
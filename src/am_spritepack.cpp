@@ -3,6 +3,7 @@
 
 #include "ft2build.h"
 #include FT_FREETYPE_H
+#include FT_OUTLINE_H
 
 #define STB_RECT_PACK_IMPLEMENTATION
 #include "stb_rect_pack.h"
@@ -10,6 +11,9 @@
 #define MAX_ITEMS 4096
 #define MAX_TEX_SIZE 4096
 #define ADVANCE_SCALE 0.015625f
+#define DEFAULT_SDF_RANGE 4.0
+// maximum error, in pixels, when flattening glyph outline curves
+#define SDF_FLATNESS 0.015625
 
 #define NUMFMT "%.16g"
 
@@ -59,6 +63,15 @@ static int do_premult = 1;
 static int keep_padding = 0;
 static int border = 1;
 static int default_font = 0;
+static int sdf = 0;
+static double sdf_range = DEFAULT_SDF_RANGE;
+
+// distance field of the last glyph loaded in sdf mode (one byte per pixel)
+static unsigned char *sdf_data = NULL;
+static int sdf_width = 0;
+static int sdf_rows = 0;
+static int sdf_left = 0;
+static int sdf_top = 0;
 
 static void process_args(int argc, char *argv[]);
 static void gen_rects();
@@ -72,6 +85,7 @@ static bool char_exists(int c);
 static void load_image(int s);
 static void compute_bordered_image();
 static void compute_bbox();
+static void compute_sdf(int c);
 
 bool am_pack_sprites(int argc, char *argv[]) {
     if (FT_Init_FreeType(&ft_library)) {
@@ -101,6 +115,7 @@ bool am_pack_sprites(int argc, char *argv[]) {
     write_png();
     free(rects);
     free(atlas_data);
+    free(sdf_data);
     FT_Done_Face(ft_face);
     return true;
 }
@@ -135,8 +150,13 @@ static void gen_rects() {
                 if (char_exists(cp)) {
                     load_char(cp);
                     rects[r].id = 0;
-                    rects[r].w = char_bitmap.width + 2;
-                    rects[r].h = char_bitmap.rows + 2;
+                    if (sdf) {
+                        rects[r].w = sdf_width + 2;
+                        rects[r].h = sdf_rows + 2;
+                    } else {
+                        rects[r].w = char_bitmap.width + 2;
+                        rects[r].h = char_bitmap.rows + 2;
+                    }
                     r++;
                 }
                 c++;
@@ -211,6 +231,10 @@ static void write_data() {
             fprintf(f, ",\n");
             fprintf(f, "        filename = \"%s\",\n", filename);
             fprintf(f, "        face = %d,\n", items[s].face);
+            if (sdf) {
+                fprintf(f, "        sdf = true,\n");
+                fprintf(f, "        distance_range = " NUMFMT ",\n", sdf_range);
+            }
             fprintf(f, "        chars = (function()\n");
             fprintf(f, "            local chrs = {}\n");
             c = 0;
@@ -225,13 +249,20 @@ static void write_data() {
                     continue;
                 }
                 load_char(cp);
-                rows = char_bitmap.rows;
-                width = char_bitmap.width;
-                pitch = char_bitmap.pitch;
-                src_ptr = char_bitmap.buffer;
+                if (sdf) {
+                    rows = sdf_rows;
+                    width = sdf_width;
+                    pitch = sdf_width;
+                    src_ptr = sdf_data;
+                } else {
+                    rows = char_bitmap.rows;
+                    width = char_bitmap.width;
+                    pitch = char_bitmap.pitch;
+                    src_ptr = char_bitmap.buffer;
+                }
                 dest_ptr = atlas_data + (rects[r].x+1) * 4 +
                     (rects[r].y+1) * atlas_width * 4;
-                if (char_bitmap.pixel_mode == FT_PIXEL_MODE_GRAY) {
+                if (sdf || char_bitmap.pixel_mode == FT_PIXEL_MODE_GRAY) {
                     for (i = 0; i < rows; i++) {
                         for (j = 0; j < width; j++) {
                             dest_ptr[j*4+0] = 0xFF;
@@ -270,10 +301,15 @@ static void write_data() {
                 t1 = t2 - h;
                 s2 = s1 + w;
 
-                x1 = (double)ft_face->glyph->bitmap_left - 1.0;
-                y2 = (double)ft_face->glyph->bitmap_top + 2.0;
-                w = (double)char_bitmap.width + 2.0;
-                h = (double)char_bitmap.rows + 2.0;
+                if (sdf) {
+                    x1 = (double)sdf_left - 1.0;
+                    y2 = (double)sdf_top + 1.0;
+                } else {
+                    x1 = (double)ft_face->glyph->bitmap_left - 1.0;
+                    y2 = (double)ft_face->glyph->bitmap_top + 2.0;
+                }
+                w = (double)width + 2.0;
+                h = (double)rows + 2.0;
                 x2 = x1 + w;
                 y1 = y2 - h;
 
@@ -396,7 +432,14 @@ static bool char_exists(int c) {
 }
 
 static void load_char(int c) {
-    if (is_mono) {
+    if (sdf) {
+        // the distance field is scaled when drawn, so use the unhinted outline
+        if (FT_Load_Char(ft_face, c, FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING)) {
+            fprintf(stderr, "unable to load codepoint %d\n", c);
+            exit(EXIT_FAILURE);
+        }
+        compute_sdf(c);
+    } else if (is_mono) {
         if (FT_Load_Char(ft_face, c, FT_LOAD_TARGET_MONO)) {
             fprintf(stderr, "unable to load codepoint %d\n", c);
             exit(EXIT_FAILURE);
@@ -413,6 +456,172 @@ static void load_char(int c) {
     }
 }
 
+// Glyph outlines are flattened to line segments (in pixels) and the
+// distance field is computed exactly from those.
+
+typedef struct {
+    double x0, y0, x1, y1;
+} outline_segment;
+
+static outline_segment *segments = NULL;
+static int num_segments = 0;
+static int segments_capacity = 0;
+static double pen_x = 0;
+static double pen_y = 0;
+
+static void add_segment(double x, double y) {
+    if (num_segments == segments_capacity) {
+        segments_capacity = segments_capacity == 0 ? 256 : segments_capacity * 2;
+        segments = (outline_segment*)realloc(segments, sizeof(outline_segment) * segments_capacity);
+    }
+    outline_segment *seg = &segments[num_segments++];
+    seg->x0 = pen_x;
+    seg->y0 = pen_y;
+    seg->x1 = x;
+    seg->y1 = y;
+    pen_x = x;
+    pen_y = y;
+}
+
+// number of line segments needed to approximate a curve whose
+// control polygon has the given maximum second difference
+static int curve_steps(double dd) {
+    int n = (int)ceil(sqrt(dd / (8.0 * SDF_FLATNESS)));
+    return am_clamp(n, 1, 64);
+}
+
+static int outline_move_to(const FT_Vector *to, void *user) {
+    pen_x = to->x / 64.0;
+    pen_y = to->y / 64.0;
+    return 0;
+}
+
+static int outline_line_to(const FT_Vector *to, void *user) {
+    add_segment(to->x / 64.0, to->y / 64.0);
+    return 0;
+}
+
+static int outline_conic_to(const FT_Vector *control, const FT_Vector *to, void *user) {
+    double x0 = pen_x, y0 = pen_y;
+    double x1 = control->x / 64.0, y1 = control->y / 64.0;
+    double x2 = to->x / 64.0, y2 = to->y / 64.0;
+    double ddx = x0 - 2.0 * x1 + x2;
+    double ddy = y0 - 2.0 * y1 + y2;
+    int n = curve_steps(sqrt(ddx * ddx + ddy * ddy));
+    for (int i = 1; i <= n; i++) {
+        double t = (double)i / (double)n;
+        double u = 1.0 - t;
+        add_segment(
+            u * u * x0 + 2.0 * u * t * x1 + t * t * x2,
+            u * u * y0 + 2.0 * u * t * y1 + t * t * y2);
+    }
+    return 0;
+}
+
+static int outline_cubic_to(const FT_Vector *control1, const FT_Vector *control2,
+    const FT_Vector *to, void *user)
+{
+    double x0 = pen_x, y0 = pen_y;
+    double x1 = control1->x / 64.0, y1 = control1->y / 64.0;
+    double x2 = control2->x / 64.0, y2 = control2->y / 64.0;
+    double x3 = to->x / 64.0, y3 = to->y / 64.0;
+    double ddx1 = x0 - 2.0 * x1 + x2, ddy1 = y0 - 2.0 * y1 + y2;
+    double ddx2 = x1 - 2.0 * x2 + x3, ddy2 = y1 - 2.0 * y2 + y3;
+    double dd = am_max(sqrt(ddx1 * ddx1 + ddy1 * ddy1), sqrt(ddx2 * ddx2 + ddy2 * ddy2));
+    int n = curve_steps(dd * 6.0);
+    for (int i = 1; i <= n; i++) {
+        double t = (double)i / (double)n;
+        double u = 1.0 - t;
+        add_segment(
+            u * u * u * x0 + 3.0 * u * u * t * x1 + 3.0 * u * t * t * x2 + t * t * t * x3,
+            u * u * u * y0 + 3.0 * u * u * t * y1 + 3.0 * u * t * t * y2 + t * t * t * y3);
+    }
+    return 0;
+}
+
+static double segment_dist_sq(outline_segment *seg, double x, double y) {
+    double dx = seg->x1 - seg->x0;
+    double dy = seg->y1 - seg->y0;
+    double len_sq = dx * dx + dy * dy;
+    double t = 0.0;
+    if (len_sq > 0.0) {
+        t = ((x - seg->x0) * dx + (y - seg->y0) * dy) / len_sq;
+        t = am_clamp(t, 0.0, 1.0);
+    }
+    double ex = seg->x0 + t * dx - x;
+    double ey = seg->y0 + t * dy - y;
+    return ex * ex + ey * ey;
+}
+
+// Computes the signed distance field of the current glyph's outline into
+// sdf_data. Distances are positive inside the glyph and are mapped so
+// that 0 and 255 are sdf_range pixels apart, with the edge at 128.
+static void compute_sdf(int c) {
+    FT_Outline *outline = &ft_face->glyph->outline;
+    FT_Outline_Funcs funcs;
+    funcs.move_to = outline_move_to;
+    funcs.line_to = outline_line_to;
+    funcs.conic_to = outline_conic_to;
+    funcs.cubic_to = outline_cubic_to;
+    funcs.shift = 0;
+    funcs.delta = 0;
+    num_segments = 0;
+    if (ft_face->glyph->format != FT_GLYPH_FORMAT_OUTLINE
+        || FT_Outline_Decompose(outline, &funcs, NULL))
+    {
+        fprintf(stderr, "unable to read outline of codepoint %d\n", c);
+        exit(EXIT_FAILURE);
+    }
+    if (num_segments == 0) {
+        // e.g. space
+        sdf_width = 0;
+        sdf_rows = 0;
+        sdf_left = 0;
+        sdf_top = 0;
+        return;
+    }
+
+    FT_BBox cbox;
+    FT_Outline_Get_CBox(outline, &cbox);
+    int pad = (int)ceil(sdf_range * 0.5);
+    int xmin = (int)floor(cbox.xMin / 64.0);
+    int xmax = (int)ceil(cbox.xMax / 64.0);
+    int ymin = (int)floor(cbox.yMin / 64.0);
+    int ymax = (int)ceil(cbox.yMax / 64.0);
+    sdf_left = xmin - pad;
+    sdf_top = ymax + pad;
+    sdf_width = xmax - xmin + 2 * pad;
+    sdf_rows = ymax - ymin + 2 * pad;
+    sdf_data = (unsigned char*)realloc(sdf_data, sdf_width * sdf_rows);
+
+    bool even_odd = (outline->flags & FT_OUTLINE_EVEN_ODD_FILL) != 0;
+    for (int i = 0; i < sdf_rows; i++) {
+        double y = (double)sdf_top - (double)i - 0.5;
+        for (int j = 0; j < sdf_width; j++) {
+            double x = (double)sdf_left + (double)j + 0.5;
+            double min_dist_sq = INFINITY;
+            int winding = 0;
+            for (int k = 0; k < num_segments; k++) {
+                outline_segment *seg = &segments[k];
+                double d = segment_dist_sq(seg, x, y);
+                if (d < min_dist_sq) min_dist_sq = d;
+                // winding number of a ray cast in the +x direction
+                if ((seg->y0 <= y) != (seg->y1 <= y)) {
+                    double cross_x = seg->x0 + (y - seg->y0) * (seg->x1 - seg->x0) / (seg->y1 - seg->y0);
+                    if (cross_x > x) {
+                        winding += seg->y1 > seg->y0 ? 1 : -1;
+                    }
+                }
+            }
+            bool inside = even_odd ? (winding & 1) != 0 : winding != 0;
+            double dist = sqrt(min_dist_sq);
+            if (!inside) dist = -dist;
+            double val = 0.5 + dist / sdf_range;
+            sdf_data[i * sdf_width + j] = (unsigned char)(am_clamp(val, 0.0, 1.0) * 255.0 + 0.5);
+        }
+    }
+}
+
 static void load_image(int s) {
     int components = 4;
     if (image_data != NULL) {
@@ -697,7 +906,7 @@ check_size:
 }
 
 static void usage() {
-    fprintf(stderr, "Usage: amulet pack -png filename.png -lua filename.lua [-mono] [-minfiler <filter>] [-magfilter <filter>] [-no-premult] [-keep-padding] <spec> ...\n");
+    fprintf(stderr, "Usage: amulet pack -png filename.png -lua filename.lua [-mono] [-sdf] [-sdf-range <pixels>] [-minfiler <filter>] [-magfilter <filter>] [-no-premult] [-keep-padding] <spec> ...\n");
     fprintf(stderr, "  where <spec> is either an image file or a font spec of the form:\n");
     fprintf(stderr, "  font.ttf@16[:A-Z,0x20-0x2F]\n");
     exit(EXIT_FAILURE);
@@ -719,6 +928,15 @@ static void process_args(int argc, char *argv[]) {
             lua_filename = argv[a];
         } else if (strcmp(arg, "-mono") == 0) {
             is_mono = 1;
+        } else if (strcmp(arg, "-sdf") == 0) {
+            sdf = 1;
+        } else if (strcmp(arg, "-sdf-range") == 0) {
+            if (++a >= argc) usage();
+            sdf_range = strtod(argv[a], NULL);
+            if (sdf_range <= 0.0) {
+                fprintf(stderr, "sdf range must be positive\n");
+                exit(EXIT_FAILURE);
+            }
         } else if (strcmp(arg, "-default") == 0) {
             default_font = 1;
         } else if (strcmp(arg, "-minfilter") == 0) {
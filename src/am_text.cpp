@@ -0,0 +1,358 @@
+#include "amulet.h"
+
+// Number of laid out strings cached per font (must be a power of 2).
+// Strings longer than RUN_MAX_BYTES aren't cached.
+#define RUN_CACHE_SIZE 256
+#define RUN_MAX_BYTES 64
+
+// Floats per character in a laid out string: 4 vertices of x, y, s, t.
+#define FLOATS_PER_CHAR 16
+
+#define NEWLINE_GLYPH -2
+
+enum text_halign {
+    TEXT_HALIGN_LEFT,
+    TEXT_HALIGN_CENTER,
+    TEXT_HALIGN_RIGHT,
+};
+
+enum text_valign {
+    TEXT_VALIGN_TOP,
+    TEXT_VALIGN_CENTER,
+    TEXT_VALIGN_BOTTOM,
+};
+
+struct text_glyph {
+    int codepoint;
+    double x1, y1, x2, y2;
+    double s1, t1, s2, t2;
+    double advance;
+};
+
+struct text_run {
+    char *str; // NULL if the slot is unused
+    int len;
+    int halign;
+    int valign;
+    int num_chars;
+    double width;
+    double height;
+    float *verts; // FLOATS_PER_CHAR per character
+};
+
+struct am_text_font : am_nonatomic_userdata {
+    double line_height;
+    int num_glyphs;
+    text_glyph *glyphs; // sorted by codepoint
+    int ascii[128]; // glyph indexes of ascii characters, or -1
+    int fallback; // glyph used for characters not in the font, or -1
+    int space; // glyph whose texture coords newlines use, or -1
+    text_run runs[RUN_CACHE_SIZE];
+};
+
+// Scratch space for laying out strings (main thread only).
+static std::vector<int> glyph_scratch;
+static std::vector<double> row_width_scratch;
+static std::vector<float> verts_scratch;
+
+static int find_glyph(am_text_font *font, int c) {
+    if (c >= 0 && c < 128) return font->ascii[c];
+    int lo = 0;
+    int hi = font->num_glyphs - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int mc = font->glyphs[mid].codepoint;
+        if (mc == c) return mid;
+        if (mc < c) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return -1;
+}
+
+static int compare_glyphs(const void *a, const void *b) {
+    return ((const text_glyph*)a)->codepoint - ((const text_glyph*)b)->codepoint;
+}
+
+static double get_glyph_field(lua_State *L, const char *name) {
+    lua_getfield(L, -1, name);
+    double val = lua_tonumber(L, -1);
+    lua_pop(L, 1);
+    return val;
+}
+
+static int create_text_font(lua_State *L) {
+    am_check_nargs(L, 2);
+    luaL_checktype(L, 1, LUA_TTABLE);
+    double line_height = luaL_checknumber(L, 2);
+    int num_glyphs = 0;
+    lua_pushnil(L);
+    while (lua_next(L, 1)) {
+        if (lua_type(L, -2) == LUA_TNUMBER && lua_istable(L, -1)) num_glyphs++;
+        lua_pop(L, 1);
+    }
+    text_glyph *glyphs = (text_glyph*)malloc(sizeof(text_glyph) * am_max(num_glyphs, 1));
+    int i = 0;
+    lua_pushnil(L);
+    while (lua_next(L, 1)) {
+        if (lua_type(L, -2) == LUA_TNUMBER && lua_istable(L, -1)) {
+            text_glyph *g = &glyphs[i++];
+            g->codepoint = lua_tointeger(L, -2);
+            g->x1 = get_glyph_field(L, "x1");
+            g->y1 = get_glyph_field(L, "y1");
+            g->x2 = get_glyph_field(L, "x2");
+            g->y2 = get_glyph_field(L, "y2");
+            g->s1 = get_glyph_field(L, "s1");
+            g->t1 = get_glyph_field(L, "t1");
+            g->s2 = get_glyph_field(L, "s2");
+            g->t2 = get_glyph_field(L, "t2");
+            g->advance = get_glyph_field(L, "advance");
+        }
+        lua_pop(L, 1);
+    }
+    qsort(glyphs, num_glyphs, sizeof(text_glyph), compare_glyphs);
+
+    am_text_font *font = am_new_userdata(L, am_text_font);
+    font->line_height = line_height;
+    font->num_glyphs = num_glyphs;
+    font->glyphs = glyphs;
+    for (int c = 0; c < 128; c++) {
+        font->ascii[c] = -1;
+    }
+    for (i = 0; i < num_glyphs; i++) {
+        int c = glyphs[i].codepoint;
+        if (c >= 0 && c < 128) font->ascii[c] = i;
+    }
+    font->space = find_glyph(font, ' ');
+    font->fallback = find_glyph(font, 0);
+    if (font->fallback < 0) font->fallback = font->space;
+    memset(font->runs, 0, sizeof(font->runs));
+    return 1;
+}
+
+static int text_font_gc(lua_State *L) {
+    am_text_font *font = (am_text_font*)lua_touserdata(L, 1);
+    free(font->glyphs);
+    font->glyphs = NULL;
+    font->num_glyphs = 0;
+    for (int i = 0; i < RUN_CACHE_SIZE; i++) {
+        free(font->runs[i].str);
+        free(font->runs[i].verts);
+        font->runs[i].str = NULL;
+        font->runs[i].verts = NULL;
+    }
+    return 0;
+}
+
+static double row_start_x(double row_width, int halign) {
+    switch (halign) {
+        case TEXT_HALIGN_CENTER: return -floor(row_width / 2);
+        case TEXT_HALIGN_RIGHT: return -row_width;
+    }
+    return 0;
+}
+
+static float *write_quad(float *v, double x1, double y1, double x2, double y2,
+    text_glyph *g)
+{
+    double s1 = 0, t1 = 0, s2 = 0, t2 = 0;
+    if (g != NULL) {
+        s1 = g->s1;
+        t1 = g->t1;
+        s2 = g->s2;
+        t2 = g->t2;
+    }
+    v[0]  = x1; v[1]  = y2; v[2]  = s1; v[3]  = t2;
+    v[4]  = x1; v[5]  = y1; v[6]  = s1; v[7]  = t1;
+    v[8]  = x2; v[9]  = y1; v[10] = s2; v[11] = t1;
+    v[12] = x2; v[13] = y2; v[14] = s2; v[15] = t2;
+    return v + FLOATS_PER_CHAR;
+}
+
+// Lays out str into verts_scratch, returning the number of characters.
+static int layout_text(lua_State *L, am_text_font *font, const char *str, int len,
+    int halign, int valign, double *width, double *height)
+{
+    // decode and look up the glyphs, measuring each row
+    glyph_scratch.clear();
+    row_width_scratch.clear();
+    row_width_scratch.push_back(0);
+    double max_width = 0;
+    double h = font->line_height;
+    const char *p = str;
+    const char *end = str + len;
+    while (p < end) {
+        int c;
+        const char *next = am_utf8_decode(p, &c);
+        if (next == NULL || (next < end && (*next & 0xC0) == 0x80)) {
+            luaL_error(L, "invalid UTF-8 code");
+            return 0;
+        }
+        p = next;
+        if (c == '\n') {
+            glyph_scratch.push_back(NEWLINE_GLYPH);
+            h += font->line_height;
+            row_width_scratch.push_back(0);
+        } else {
+            int g = find_glyph(font, c);
+            if (g < 0) g = font->fallback;
+            if (g < 0) {
+                luaL_error(L, "font has no character %d and no fallback character", c);
+                return 0;
+            }
+            glyph_scratch.push_back(g);
+            double w = row_width_scratch.back() + font->glyphs[g].advance;
+            row_width_scratch.back() = w;
+            if (w > max_width) max_width = w;
+        }
+    }
+
+    int num_chars = glyph_scratch.size();
+    verts_scratch.resize(am_max(num_chars, 1) * FLOATS_PER_CHAR);
+    float *v = &verts_scratch[0];
+    int row = 0;
+    double x = row_start_x(row_width_scratch[0], halign);
+    double y;
+    switch (valign) {
+        case TEXT_VALIGN_CENTER: y = floor(h / 2) - font->line_height; break;
+        case TEXT_VALIGN_BOTTOM: y = h - font->line_height; break;
+        default: y = -font->line_height; break;
+    }
+    text_glyph *space = font->space < 0 ? NULL : &font->glyphs[font->space];
+    for (int i = 0; i < num_chars; i++) {
+        int g = glyph_scratch[i];
+        if (g == NEWLINE_GLYPH) {
+            // newlines get an empty quad, so characters and quads match up
+            y -= font->line_height;
+            row++;
+            x = row_start_x(row_width_scratch[row], halign);
+            v = write_quad(v, x, y, x, y, space);
+        } else {
+            text_glyph *glyph = &font->glyphs[g];
+            v = write_quad(v, x + glyph->x1, y + glyph->y1, x + glyph->x2, y + glyph->y2, glyph);
+            x += glyph->advance;
+        }
+    }
+    *width = max_width;
+    *height = h;
+    return num_chars;
+}
+
+static void check_text_view(lua_State *L, am_buffer_view *view, int num_verts, int arg) {
+    if (view->type != AM_VIEW_TYPE_F32 || view->components < 2) {
+        luaL_error(L, "expecting a vec2 view in position %d", arg);
+    }
+    if (view->size < num_verts) {
+        luaL_error(L, "view in position %d is too small (%d elements, need %d)",
+            arg, view->size, num_verts);
+    }
+}
+
+static void write_text_views(am_buffer_view *verts, am_buffer_view *uvs, float *data, int num_verts) {
+    uint8_t *vp = verts->buffer->data + verts->offset;
+    uint8_t *up = uvs->buffer->data + uvs->offset;
+    for (int i = 0; i < num_verts; i++) {
+        memcpy(vp, &data[i * 4], 2 * sizeof(float));
+        memcpy(up, &data[i * 4 + 2], 2 * sizeof(float));
+        vp += verts->stride;
+        up += uvs->stride;
+    }
+    verts->mark_dirty(0, num_verts);
+    uvs->mark_dirty(0, num_verts);
+}
+
+static int parse_halign(lua_State *L, int idx) {
+    const char *str = luaL_checkstring(L, idx);
+    if (strcmp(str, "center") == 0) return TEXT_HALIGN_CENTER;
+    if (strcmp(str, "right") == 0) return TEXT_HALIGN_RIGHT;
+    return TEXT_HALIGN_LEFT;
+}
+
+static int parse_valign(lua_State *L, int idx) {
+    const char *str = luaL_checkstring(L, idx);
+    if (strcmp(str, "center") == 0) return TEXT_VALIGN_CENTER;
+    if (strcmp(str, "bottom") == 0) return TEXT_VALIGN_BOTTOM;
+    return TEXT_VALIGN_TOP;
+}
+
+static uint32_t hash_run(const char *str, int len, int halign, int valign) {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h = (h ^ (uint8_t)str[i]) * 16777619u;
+    }
+    h = (h ^ (uint32_t)(halign * 3 + valign)) * 16777619u;
+    return h;
+}
+
+// am._layout_text(font, str, halign, valign, verts, uvs) lays out str,
+// writing 4 vertices per character to verts and uvs, and returns
+// its width, height and number of characters.
+static int layout_text_into_views(lua_State *L) {
+    am_check_nargs(L, 6);
+    am_text_font *font = am_get_userdata(L, am_text_font, 1);
+    size_t len;
+    const char *str = luaL_checklstring(L, 2, &len);
+    int halign = parse_halign(L, 3);
+    int valign = parse_valign(L, 4);
+    am_buffer_view *verts = am_check_buffer_view(L, 5);
+    am_buffer_view *uvs = am_check_buffer_view(L, 6);
+
+    text_run *run = &font->runs[hash_run(str, len, halign, valign) & (RUN_CACHE_SIZE - 1)];
+    if (run->str == NULL || run->len != (int)len || run->halign != halign
+        || run->valign != valign || memcmp(run->str, str, len) != 0)
+    {
+        double width = 0, height = 0;
+        int num_chars = layout_text(L, font, str, len, halign, valign, &width, &height);
+        check_text_view(L, verts, num_chars * 4, 5);
+        check_text_view(L, uvs, num_chars * 4, 6);
+        if (num_chars > 0) {
+            write_text_views(verts, uvs, &verts_scratch[0], num_chars * 4);
+        }
+        if (len <= RUN_MAX_BYTES) {
+            free(run->str);
+            run->str = (char*)malloc(am_max((int)len, 1));
+            memcpy(run->str, str, len);
+            run->len = len;
+            run->halign = halign;
+            run->valign = valign;
+            run->num_chars = num_chars;
+            run->width = width;
+            run->height = height;
+            run->verts = (float*)realloc(run->verts, sizeof(float) * am_max(num_chars, 1) * FLOATS_PER_CHAR);
+            memcpy(run->verts, &verts_scratch[0], sizeof(float) * num_chars * FLOATS_PER_CHAR);
+        }
+        lua_pushnumber(L, width);
+        lua_pushnumber(L, height);
+        lua_pushinteger(L, num_chars);
+        return 3;
+    }
+
+    check_text_view(L, verts, run->num_chars * 4, 5);
+    check_text_view(L, uvs, run->num_chars * 4, 6);
+    if (run->num_chars > 0) {
+        write_text_views(verts, uvs, run->verts, run->num_chars * 4);
+    }
+    lua_pushnumber(L, run->width);
+    lua_pushnumber(L, run->height);
+    lua_pushinteger(L, run->num_chars);
+    return 3;
+}
+
+static void register_text_font_mt(lua_State *L) {
+    lua_newtable(L);
+    lua_pushcclosure(L, text_font_gc, 0);
+    lua_setfield(L, -2, "__gc");
+    am_register_metatable(L, "text_font", MT_am_text_font, 0);
+}
+
+void am_open_text_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"_text_font", create_text_font},
+        {"_layout_text", layout_text_into_views},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
+    register_text_font_mt(L);
+}
@@ -0,0 +1,9 @@
+// Native text layout for am.text (see lua/text.lua).
+//
+// A font's glyph metrics are copied from its Lua chars table into an
+// am_text_font once, and strings are laid out from that straight into
+// the vertex and texture coordinate views of a text node. Recently laid
+// out strings are kept in a small cache on the font, so labels that keep
+// switching between the same few strings are just copied.
+
+void am_open_text_module(lua_State *L);
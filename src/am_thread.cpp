@@ -0,0 +1,283 @@
+#include "amulet.h"
+
+#if defined(AM_HAVE_THREADS) && !defined(AM_WINDOWS)
+#include <pthread.h>
+#endif
+
+#if defined(AM_HAVE_THREADS)
+
+struct am_thread_start {
+    am_thread_func func;
+    void *data;
+};
+
+#if defined(AM_WINDOWS)
+
+struct am_thread {
+    HANDLE handle;
+};
+
+struct am_mutex {
+    CRITICAL_SECTION cs;
+};
+
+struct am_semaphore {
+    HANDLE handle;
+};
+
+static DWORD WINAPI thread_main(LPVOID arg) {
+    am_thread_start start = *(am_thread_start*)arg;
+    free(arg);
+    start.func(start.data);
+    return 0;
+}
+
+am_thread *am_create_thread(am_thread_func func, void *data) {
+    am_thread_start *start = (am_thread_start*)malloc(sizeof(am_thread_start));
+    start->func = func;
+    start->data = data;
+    HANDLE handle = CreateThread(NULL, 0, thread_main, start, 0, NULL);
+    if (handle == NULL) {
+        free(start);
+        return NULL;
+    }
+    am_thread *thread = new am_thread();
+    thread->handle = handle;
+    return thread;
+}
+
+void am_join_thread(am_thread *thread) {
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    delete thread;
+}
+
+am_mutex *am_create_mutex() {
+    am_mutex *mutex = new am_mutex();
+    InitializeCriticalSection(&mutex->cs);
+    return mutex;
+}
+
+void am_destroy_mutex(am_mutex *mutex) {
+    DeleteCriticalSection(&mutex->cs);
+    delete mutex;
+}
+
+void am_lock_mutex(am_mutex *mutex) {
+    EnterCriticalSection(&mutex->cs);
+}
+
+void am_unlock_mutex(am_mutex *mutex) {
+    LeaveCriticalSection(&mutex->cs);
+}
+
+am_semaphore *am_create_semaphore() {
+    am_semaphore *sem = new am_semaphore();
+    sem->handle = CreateSemaphore(NULL, 0, LONG_MAX, NULL);
+    return sem;
+}
+
+void am_destroy_semaphore(am_semaphore *sem) {
+    CloseHandle(sem->handle);
+    delete sem;
+}
+
+void am_signal_semaphore(am_semaphore *sem) {
+    ReleaseSemaphore(sem->handle, 1, NULL);
+}
+
+void am_wait_semaphore(am_semaphore *sem) {
+    WaitForSingleObject(sem->handle, INFINITE);
+}
+
+bool am_wait_semaphore_timeout(am_semaphore *sem, int timeout_ms) {
+    return WaitForSingleObject(sem->handle, (DWORD)timeout_ms) == WAIT_OBJECT_0;
+}
+
+int am_cpu_count() {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return am_max(1, (int)info.dwNumberOfProcessors);
+}
+
+#else
+
+struct am_thread {
+    pthread_t handle;
+};
+
+struct am_mutex {
+    pthread_mutex_t mutex;
+};
+
+// unnamed posix semaphores aren't available on all our
+// targets (e.g. osx), so use a condition variable instead.
+struct am_semaphore {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    int count;
+};
+
+static void *thread_main(void *arg) {
+    am_thread_start start = *(am_thread_start*)arg;
+    free(arg);
+    start.func(start.data);
+    return NULL;
+}
+
+am_thread *am_create_thread(am_thread_func func, void *data) {
+    am_thread_start *start = (am_thread_start*)malloc(sizeof(am_thread_start));
+    start->func = func;
+    start->data = data;
+    am_thread *thread = new am_thread();
+    if (pthread_create(&thread->handle, NULL, thread_main, start) != 0) {
+        free(start);
+        delete thread;
+        return NULL;
+    }
+    return thread;
+}
+
+void am_join_thread(am_thread *thread) {
+    pthread_join(thread->handle, NULL);
+    delete thread;
+}
+
+am_mutex *am_create_mutex() {
+    am_mutex *mutex = new am_mutex();
+    pthread_mutex_init(&mutex->mutex, NULL);
+    return mutex;
+}
+
+void am_destroy_mutex(am_mutex *mutex) {
+    pthread_mutex_destroy(&mutex->mutex);
+    delete mutex;
+}
+
+void am_lock_mutex(am_mutex *mutex) {
+    pthread_mutex_lock(&mutex->mutex);
+}
+
+void am_unlock_mutex(am_mutex *mutex) {
+    pthread_mutex_unlock(&mutex->mutex);
+}
+
+am_semaphore *am_create_semaphore() {
+    am_semaphore *sem = new am_semaphore();
+    pthread_mutex_init(&sem->mutex, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = 0;
+    return sem;
+}
+
+void am_destroy_semaphore(am_semaphore *sem) {
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->mutex);
+    delete sem;
+}
+
+void am_signal_semaphore(am_semaphore *sem) {
+    pthread_mutex_lock(&sem->mutex);
+    sem->count++;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->mutex);
+}
+
+void am_wait_semaphore(am_semaphore *sem) {
+    pthread_mutex_lock(&sem->mutex);
+    while (sem->count == 0) {
+        pthread_cond_wait(&sem->cond, &sem->mutex);
+    }
+    sem->count--;
+    pthread_mutex_unlock(&sem->mutex);
+}
+
+bool am_wait_semaphore_timeout(am_semaphore *sem, int timeout_ms) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout_ms / 1000;
+    deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    pthread_mutex_lock(&sem->mutex);
+    while (sem->count == 0) {
+        if (pthread_cond_timedwait(&sem->cond, &sem->mutex, &deadline) != 0) break;
+    }
+    bool signalled = sem->count > 0;
+    if (signalled) sem->count--;
+    pthread_mutex_unlock(&sem->mutex);
+    return signalled;
+}
+
+int am_cpu_count() {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1 ? 1 : (int)n;
+}
+
+#endif
+
+#else // !AM_HAVE_THREADS
+
+struct am_mutex {
+    int unused;
+};
+
+struct am_semaphore {
+    int count;
+};
+
+am_thread *am_create_thread(am_thread_func func, void *data) {
+    return NULL;
+}
+
+void am_join_thread(am_thread *thread) {
+}
+
+am_mutex *am_create_mutex() {
+    return new am_mutex();
+}
+
+void am_destroy_mutex(am_mutex *mutex) {
+    delete mutex;
+}
+
+void am_lock_mutex(am_mutex *mutex) {
+}
+
+void am_unlock_mutex(am_mutex *mutex) {
+}
+
+am_semaphore *am_create_semaphore() {
+    am_semaphore *sem = new am_semaphore();
+    sem->count = 0;
+    return sem;
+}
+
+void am_destroy_semaphore(am_semaphore *sem) {
+    delete sem;
+}
+
+void am_signal_semaphore(am_semaphore *sem) {
+    sem->count++;
+}
+
+void am_wait_semaphore(am_semaphore *sem) {
+    // nothing else can signal the semaphore, so waiting on
+    // a zero count would block forever
+    am_always_assert(sem->count > 0);
+    sem->count--;
+}
+
+bool am_wait_semaphore_timeout(am_semaphore *sem, int timeout_ms) {
+    if (sem->count == 0) return false;
+    sem->count--;
+    return true;
+}
+
+int am_cpu_count() {
+    return 1;
+}
+
+#endif
@@ -0,0 +1,55 @@
+// Minimal threading primitives. The html backend has no threads, so
+// am_create_thread always returns NULL there and callers must fall back
+// to doing the work on the calling thread.
+
+#if !defined(AM_HTML)
+#define AM_HAVE_THREADS 1
+#endif
+
+struct am_thread;
+struct am_mutex;
+struct am_semaphore;
+
+typedef void (*am_thread_func)(void *data);
+
+// Returns NULL if the thread could not be created.
+am_thread *am_create_thread(am_thread_func func, void *data);
+void am_join_thread(am_thread *thread);
+
+am_mutex *am_create_mutex();
+void am_destroy_mutex(am_mutex *mutex);
+void am_lock_mutex(am_mutex *mutex);
+void am_unlock_mutex(am_mutex *mutex);
+
+am_semaphore *am_create_semaphore();
+void am_destroy_semaphore(am_semaphore *sem);
+void am_signal_semaphore(am_semaphore *sem);
+void am_wait_semaphore(am_semaphore *sem);
+// Returns false if the semaphore wasn't signalled within timeout_ms.
+bool am_wait_semaphore_timeout(am_semaphore *sem, int timeout_ms);
+
+int am_cpu_count();
+
+// Atomic operations on 32 bit values. Loads have acquire semantics and
+// stores have release semantics. am_atomic_add returns the new value.
+#if defined(AM_MSVC)
+static inline uint32_t am_atomic_load(volatile uint32_t *ptr) {
+    return (uint32_t)InterlockedCompareExchange((volatile LONG*)ptr, 0, 0);
+}
+static inline void am_atomic_store(volatile uint32_t *ptr, uint32_t val) {
+    InterlockedExchange((volatile LONG*)ptr, (LONG)val);
+}
+static inline uint32_t am_atomic_add(volatile uint32_t *ptr, uint32_t val) {
+    return (uint32_t)InterlockedExchangeAdd((volatile LONG*)ptr, (LONG)val) + val;
+}
+#else
+static inline uint32_t am_atomic_load(volatile uint32_t *ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+static inline void am_atomic_store(volatile uint32_t *ptr, uint32_t val) {
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+static inline uint32_t am_atomic_add(volatile uint32_t *ptr, uint32_t val) {
+    return __atomic_add_fetch(ptr, val, __ATOMIC_ACQ_REL);
+}
+#endif
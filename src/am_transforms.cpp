@@ -15,6 +15,27 @@ static void maybe_insert_default_mv(lua_State *L) {
     }
 }
 
+am_transform_cache::am_transform_cache() {
+    in_stamp = 0;
+    out_stamp = 0;
+    version = 0;
+}
+
+// The cached result can be reused if neither the node nor its parent
+// matrix has changed since it was computed. Parent matrices of
+// unknown provenance (stamp 0) are never reused.
+static bool cache_valid(am_transform_cache *cache, am_scene_node *node, am_program_param_value *param) {
+    return param->mat4_stamp != 0
+        && param->mat4_stamp == cache->in_stamp
+        && node->version == cache->version;
+}
+
+static void update_cache(am_transform_cache *cache, am_scene_node *node, am_program_param_value *param) {
+    cache->in_stamp = param->mat4_stamp;
+    cache->out_stamp = am_new_mat4_stamp();
+    cache->version = node->version;
+}
+
 /* Translate */
 
 void am_translate_node::render(am_render_state *rstate) {
@@ -22,9 +43,16 @@ void am_translate_node::render(am_render_state *rstate) {
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
         glm::dvec4 old_column = (*m)[3];
-        (*m)[3] = (*m)[0] * v[0] + (*m)[1] * v[1] + (*m)[2] * v[2] + (*m)[3];
+        uint32_t old_stamp = param->mat4_stamp;
+        if (!cache_valid(&cache, this, param)) {
+            cached_column = (*m)[0] * v[0] + (*m)[1] * v[1] + (*m)[2] * v[2] + (*m)[3];
+            update_cache(&cache, this, param);
+        }
+        (*m)[3] = cached_column;
+        param->mat4_stamp = cache.out_stamp;
         render_children(rstate);
         (*m)[3] = old_column;
+        param->mat4_stamp = old_stamp;
     } else {
         log_ignored_transform(rstate, name, "translate");
         render_children(rstate);
@@ -148,9 +176,16 @@ void am_scale_node::render(am_render_state *rstate) {
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
         glm::dmat4 old = *m;
-        *m = glm::scale(*m, v);
+        uint32_t old_stamp = param->mat4_stamp;
+        if (!cache_valid(&cache, this, param)) {
+            cached_mat = glm::scale(*m, v);
+            update_cache(&cache, this, param);
+        }
+        *m = cached_mat;
+        param->mat4_stamp = cache.out_stamp;
         render_children(rstate);
         *m = old;
+        param->mat4_stamp = old_stamp;
     } else {
         log_ignored_transform(rstate, name, "scale");
         render_children(rstate);
@@ -275,9 +310,16 @@ void am_rotate_node::render(am_render_state *rstate) {
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
         glm::dmat4 old = *m;
-        *m *= glm::mat4_cast(rotation);
+        uint32_t old_stamp = param->mat4_stamp;
+        if (!cache_valid(&cache, this, param)) {
+            cached_mat = (*m) * glm::mat4_cast(rotation);
+            update_cache(&cache, this, param);
+        }
+        *m = cached_mat;
+        param->mat4_stamp = cache.out_stamp;
         render_children(rstate);
         *m = old;
+        param->mat4_stamp = old_stamp;
     } else {
         log_ignored_transform(rstate, name, "rotate");
         render_children(rstate);
@@ -368,9 +410,16 @@ void am_transform_node::render(am_render_state *rstate) {
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
         glm::dmat4 old = *m;
-        *m = (*m) * mat;
+        uint32_t old_stamp = param->mat4_stamp;
+        if (!cache_valid(&cache, this, param)) {
+            cached_mat = (*m) * mat;
+            update_cache(&cache, this, param);
+        }
+        *m = cached_mat;
+        param->mat4_stamp = cache.out_stamp;
         render_children(rstate);
         *m = old;
+        param->mat4_stamp = old_stamp;
     } else {
         log_ignored_transform(rstate, name, "transform");
         render_children(rstate);
@@ -416,8 +465,14 @@ static void register_transform_node_mt(lua_State *L) {
 void am_lookat_node::render(am_render_state *rstate) {
     am_program_param_value *param = &rstate->param_name_map[name].value;
     am_program_param_value old_val = *param;
-    param->type = AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4;
-    memcpy(&param->value.m4[0], glm::value_ptr(glm::lookAt(eye, center, up)), 16 * sizeof(double));
+    // the result doesn't depend on the parent matrix
+    if (cache.out_stamp == 0 || cache.version != version) {
+        cached_mat = glm::lookAt(eye, center, up);
+        cache.out_stamp = am_new_mat4_stamp();
+        cache.version = version;
+    }
+    param->set_mat4(cached_mat);
+    param->mat4_stamp = cache.out_stamp;
     render_children(rstate);
     *param = old_val;
 }
@@ -494,6 +549,12 @@ void am_billboard_node::render(am_render_state *rstate) {
     if (param->type == AM_PROGRAM_PARAM_CLIENT_TYPE_MAT4) {
         glm::dmat4 *m = (glm::dmat4*)&param->value.m4[0];
         glm::dmat4 old = *m;
+        uint32_t old_stamp = param->mat4_stamp;
+        // cheap enough to recompute, but keep the stamp so that
+        // transforms below can reuse their results
+        if (!cache_valid(&cache, this, param)) {
+            update_cache(&cache, this, param);
+        }
         double s = 1.0;
         if (preserve_uniform_scaling) {
             s = glm::length(glm::dvec3((*m)[0][0], (*m)[1][0], (*m)[2][0]));
@@ -507,8 +568,10 @@ void am_billboard_node::render(am_render_state *rstate) {
         (*m)[2][0] = 0.0;
         (*m)[2][1] = 0.0;
         (*m)[2][2] = s;
+        param->mat4_stamp = cache.out_stamp;
         render_children(rstate);
         *m = old;
+        param->mat4_stamp = old_stamp;
     } else {
         log_ignored_transform(rstate, name, "billboard");
         render_children(rstate);
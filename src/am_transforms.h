@@ -1,12 +1,26 @@
+// Remembers which parent matrix and node version a transform node's
+// result was computed for, so it can be reused in later frames.
+struct am_transform_cache {
+    uint32_t in_stamp;  // stamp of the parent matrix
+    uint32_t out_stamp; // stamp of the result
+    uint32_t version;   // node version
+
+    am_transform_cache();
+};
+
 struct am_translate_node : am_scene_node {
     am_param_name_id name;
     glm::dvec3 v;
+    am_transform_cache cache;
+    glm::dvec4 cached_column;
     virtual void render(am_render_state *rstate);
 };
 
 struct am_scale_node : am_scene_node {
     am_param_name_id name;
     glm::dvec3 v;
+    am_transform_cache cache;
+    glm::dmat4 cached_mat;
     virtual void render(am_render_state *rstate);
 };
 
@@ -15,12 +29,16 @@ struct am_rotate_node : am_scene_node {
     glm::dquat rotation;
     double angle;
     glm::dvec3 axis;
+    am_transform_cache cache;
+    glm::dmat4 cached_mat;
     virtual void render(am_render_state *rstate);
 };
 
 struct am_transform_node : am_scene_node {
     am_param_name_id name;
     glm::dmat4 mat;
+    am_transform_cache cache;
+    glm::dmat4 cached_mat;
     virtual void render(am_render_state *rstate);
 };
 
@@ -29,12 +47,15 @@ struct am_lookat_node : am_scene_node {
     glm::dvec3 eye;
     glm::dvec3 center;
     glm::dvec3 up;
+    am_transform_cache cache;
+    glm::dmat4 cached_mat;
     virtual void render(am_render_state *rstate);
 };
 
 struct am_billboard_node : am_scene_node {
     am_param_name_id name;
     bool preserve_uniform_scaling;
+    am_transform_cache cache;
     virtual void render(am_render_state *rstate);
 };
 
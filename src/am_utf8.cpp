@@ -223,6 +223,10 @@ static int iter_codes (lua_State *L) {
   return 3;
 }
 
+const char *am_utf8_decode(const char *s, int *val) {
+    return utf8_decode(s, val);
+}
+
 void am_open_utf8_module(lua_State *L) {
     luaL_Reg funcs[] = {
         {"offset", byteoffset},
@@ -1 +1,5 @@
+// Decodes one UTF-8 sequence from s into *val and returns a pointer
+// to the next one, or NULL if the sequence is invalid.
+const char *am_utf8_decode(const char *s, int *val);
+
 void am_open_utf8_module(lua_State *L);
@@ -1,5 +1,9 @@
 #include "amulet.h"
 
+uint32_t am_array_buffer_deletions = 0;
+int am_frame_upload_bytes = 0;
+int am_frame_vbo_stalls = 0;
+
 static int vbo_gc(lua_State *L) {
     am_vbo *vbo = am_get_userdata(L, am_vbo, 1);
     vbo->delete_vbo_slots();
@@ -14,6 +18,9 @@ void am_vbo::init(am_buffer_target t) {
         slots[i].last_update_start = -1;
         slots[i].last_update_end = -1;
     }
+    streamed = false;
+    stream_offset = 0;
+    stream_generation = 0;
 }
 
 void am_vbo::delete_vbo_slots() {
@@ -21,6 +28,7 @@ void am_vbo::delete_vbo_slots() {
         if (slots[i].id != 0) {
             am_bind_buffer(target, 0);
             am_delete_buffer(slots[i].id);
+            if (target == AM_ARRAY_BUFFER) am_array_buffer_deletions++;
             slots[i].id = 0;
             slots[i].last_update_frame = -1;
             slots[i].last_update_start = -1;
@@ -69,16 +77,29 @@ static void create_slot(am_vbo *vbo, am_vbo_slot *slot, am_buffer *buf) {
     slot->last_update_start = 0;
     slot->last_update_end = buf->size;
     am_bind_buffer(vbo->target, slot->id);
-    am_set_buffer_data(vbo->target, buf->size, &buf->data[0], AM_BUFFER_USAGE_STATIC_DRAW);
+    am_set_buffer_data(vbo->target, buf->size, &buf->data[0], buf->usage);
+    am_frame_upload_bytes += buf->size;
 }
 
 static void update_slot(am_vbo *vbo, am_vbo_slot *slot, am_buffer *buf, int start, int end) {
     am_bind_buffer(vbo->target, slot->id);
-    am_set_buffer_sub_data(vbo->target, start, end - start, buf->data + start);
+    if (start == 0 && end == buf->size) {
+        // Respecifying the whole buffer lets the driver orphan the old
+        // storage instead of waiting for draws that use it to finish.
+        am_set_buffer_data(vbo->target, buf->size, buf->data, buf->usage);
+    } else {
+        am_set_buffer_sub_data(vbo->target, start, end - start, buf->data + start);
+    }
+    am_frame_upload_bytes += end - start;
     uint32_t curr_frame = am_global_render_state->render_count;
-    slot->last_update_frame = curr_frame;
-    slot->last_update_start = start;
-    slot->last_update_end = end;
+    if (slot->last_update_frame == curr_frame) {
+        slot->last_update_start = am_min(slot->last_update_start, buf->dirty_start);
+        slot->last_update_end = am_max(slot->last_update_end, buf->dirty_end);
+    } else {
+        slot->last_update_frame = curr_frame;
+        slot->last_update_start = buf->dirty_start;
+        slot->last_update_end = buf->dirty_end;
+    }
 }
 
 static void compute_update_start_end(am_vbo *vbo, uint32_t since, int *start, int *end) {
@@ -99,45 +120,145 @@ void am_vbo::create_slot_if_missing(am_buffer *buf) {
     }
 }
 
+static am_stream_ring *get_stream_ring(am_buffer_target target) {
+    return &am_global_render_state->stream_rings[target == AM_ARRAY_BUFFER ? 0 : 1];
+}
+
+static bool use_stream_ring(am_buffer *buf) {
+    return buf->usage == AM_BUFFER_USAGE_STREAM_DRAW
+        && buf->size <= AM_STREAM_RING_SIZE / AM_STREAM_RING_MAX_FRACTION;
+}
+
+static void upload_to_stream_ring(am_vbo *vbo, am_buffer *buf) {
+    vbo->stream_offset = am_stream_upload(vbo->target, buf->data, buf->size, &vbo->stream_generation);
+    vbo->streamed = true;
+}
+
 void am_vbo::update_dirty(am_buffer *buf) {
+    if (use_stream_ring(buf)) {
+        upload_to_stream_ring(this, buf);
+        return;
+    }
+    if (streamed) {
+        // the slots missed the updates made while streaming
+        delete_vbo_slots();
+        streamed = false;
+    }
     uint32_t curr_frame = am_global_render_state->render_count;
-    // sanity check: there shouldn't be any slots for the current frame
-    for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
-        if (slots[i].last_update_frame == curr_frame) {
-            am_log0("INTERNAL ERROR: vbo slot %d already updated this frame (%d)!", i, curr_frame);
-            return;
+    am_vbo_slot *latest = get_latest_slot(this);
+    if (latest == NULL) {
+        create_slot(this, &slots[0], buf);
+        return;
+    }
+    if (latest->last_update_frame == curr_frame) {
+        // Updated again in the same frame. Earlier draws in this frame
+        // may still be using the slot, so unless the whole buffer is being
+        // respecified this will stall.
+        if (buf->dirty_start > 0 || buf->dirty_end < buf->size) {
+            am_frame_vbo_stalls++;
         }
+        update_slot(this, latest, buf, buf->dirty_start, buf->dirty_end);
+        return;
     }
     am_vbo_slot *earliest = get_earliest_slot(this);
-    if (earliest == NULL) {
-        create_slot(this, &slots[0], buf);
-    } else {
-        if (curr_frame - earliest->last_update_frame < AM_MAX_VBO_SLOTS) {
-            // too soon to re-use the earliest vbo, so create a new one
-            am_vbo_slot *new_slot = get_free_slot(this);
-            if (new_slot == NULL) {
-                am_log0("INTERNAL ERROR: couldn't find free vbo slot! (%d %d)", curr_frame, earliest->last_update_frame);
-                for (int i = 0; i < AM_MAX_VBO_SLOTS; i++) {
-                    am_log0("slot %d: %d (%d)", i, slots[i].last_update_frame, slots[i].id);
-                }
-                return;
-            }
+    if (curr_frame - earliest->last_update_frame < AM_MAX_VBO_SLOTS) {
+        // too soon to re-use the earliest vbo, so create a new one
+        am_vbo_slot *new_slot = get_free_slot(this);
+        if (new_slot != NULL) {
             create_slot(this, new_slot, buf);
+            return;
+        }
+        // can't happen if the buffer is updated at most once per frame,
+        // but be safe
+        am_frame_vbo_stalls++;
+    }
+    // it's been long enough since this vbo was updated that we
+    // can re-use it.
+    int start = buf->dirty_start;
+    int end = buf->dirty_end;
+    compute_update_start_end(this, earliest->last_update_frame, &start, &end);
+    update_slot(this, earliest, buf, start, end);
+}
+
+int am_vbo::bind(am_buffer *buf) {
+    if (streamed) {
+        if (stream_generation != am_stream_ring_generation(target)) {
+            // the ring was orphaned since the data was uploaded
+            upload_to_stream_ring(this, buf);
         } else {
-            // it's been long enough since this vbo was updated that we
-            // can re-use it.
-            int start = buf->dirty_start;
-            int end = buf->dirty_end;
-            compute_update_start_end(this, earliest->last_update_frame, &start, &end);
-            update_slot(this, earliest, buf, start, end);
+            am_bind_buffer(target, get_stream_ring(target)->id);
         }
+        return stream_offset;
     }
+    am_vbo_slot *latest = get_latest_slot(this);
+    am_bind_buffer(target, latest == NULL ? 0 : latest->id);
+    return 0;
 }
 
-am_buffer_id am_vbo::get_latest_id() {
+am_buffer_id am_vbo::latest_slot_id() {
+    if (streamed) return 0;
     am_vbo_slot *latest = get_latest_slot(this);
-    if (latest == NULL) return 0;
-    return latest->id;
+    return latest == NULL ? 0 : latest->id;
+}
+
+uint32_t am_stream_ring_generation(am_buffer_target target) {
+    return get_stream_ring(target)->generation;
+}
+
+int am_stream_upload(am_buffer_target target, void *data, int size, uint32_t *generation) {
+    am_stream_ring *ring = get_stream_ring(target);
+    // keep allocations aligned for any attribute type
+    int aligned_size = (size + 15) & ~15;
+    if (ring->id == 0) {
+        ring->id = am_create_buffer_object();
+        ring->capacity = 0;
+    }
+    am_bind_buffer(target, ring->id);
+    if (ring->capacity == 0 || ring->used + aligned_size > ring->capacity) {
+        while (ring->capacity < am_max(aligned_size, AM_STREAM_RING_SIZE)) {
+            ring->capacity = ring->capacity == 0 ? AM_STREAM_RING_SIZE : ring->capacity * 2;
+        }
+        // orphan the current storage. Draws already issued from it
+        // keep using it.
+        am_set_buffer_data(target, ring->capacity, NULL, AM_BUFFER_USAGE_STREAM_DRAW);
+        ring->used = 0;
+        ring->generation++;
+    }
+    int offset = ring->used;
+    am_set_buffer_sub_data(target, offset, size, data);
+    ring->used += aligned_size;
+    am_frame_upload_bytes += size;
+    if (generation != NULL) *generation = ring->generation;
+    return offset;
+}
+
+void am_delete_stream_rings() {
+    if (am_global_render_state == NULL) return;
+    for (int i = 0; i < 2; i++) {
+        am_stream_ring *ring = &am_global_render_state->stream_rings[i];
+        if (ring->id != 0) {
+            am_buffer_target target = i == 0 ? AM_ARRAY_BUFFER : AM_ELEMENT_ARRAY_BUFFER;
+            am_bind_buffer(target, 0);
+            am_delete_buffer(ring->id);
+            if (target == AM_ARRAY_BUFFER) am_array_buffer_deletions++;
+            memset(ring, 0, sizeof(am_stream_ring));
+        }
+    }
+}
+
+void am_reset_vbo_frame_stats() {
+    am_frame_upload_bytes = 0;
+    am_frame_vbo_stalls = 0;
+}
+
+static int get_frame_upload_bytes(lua_State *L) {
+    lua_pushinteger(L, am_frame_upload_bytes);
+    return 1;
+}
+
+static int get_frame_vbo_stalls(lua_State *L) {
+    lua_pushinteger(L, am_frame_vbo_stalls);
+    return 1;
 }
 
 static void register_vbo_mt(lua_State *L) {
@@ -150,5 +271,11 @@ static void register_vbo_mt(lua_State *L) {
 }
 
 void am_open_vbo_module(lua_State *L) {
+    luaL_Reg funcs[] = {
+        {"_frame_upload_bytes", get_frame_upload_bytes},
+        {"_frame_vbo_stalls", get_frame_vbo_stalls},
+        {NULL, NULL}
+    };
+    am_open_module(L, AMULET_LUA_MODULE_NAME, funcs);
     register_vbo_mt(L);
 }
@@ -1,10 +1,23 @@
-#define AM_MAX_VBO_SLOTS 1 // set to 1 for now because it needs more testing
+#define AM_MAX_VBO_SLOTS 3
+
+// Size of the rings that stream buffers are uploaded to. A ring
+// grows if a single upload doesn't fit.
+#define AM_STREAM_RING_SIZE (4 * 1024 * 1024)
+
+// Buffers with "stream" usage no bigger than this fraction of the
+// ring are uploaded to the ring instead of having their own vbos.
+#define AM_STREAM_RING_MAX_FRACTION 4
 
 // Each am_vbo may contain several slots (actual gpu vbos) which we
 // cycle between to avoid contension on vbos between frames.
+// A slot is only created when a vbo is updated while all its existing
+// slots were updated less than AM_MAX_VBO_SLOTS frames ago, so static
+// buffers only ever use one slot.
 struct am_vbo_slot {
     am_buffer_id id;
     uint32_t last_update_frame;
+    // the range of the buffer that was dirty when the slot was last
+    // updated (not including ranges copied over from other slots)
     int last_update_start;
     int last_update_end;
 };
@@ -13,12 +26,54 @@ struct am_vbo {
     am_vbo_slot slots[AM_MAX_VBO_SLOTS];
     am_buffer_target target;
 
+    // set if the buffer's latest data is in a stream ring
+    bool streamed;
+    int stream_offset;
+    uint32_t stream_generation;
+
     void init(am_buffer_target t);
     void delete_vbo_slots();
 
-    am_buffer_id get_latest_id();
     void create_slot_if_missing(am_buffer *buf);
     void update_dirty(am_buffer *buf);
+
+    // Binds the gpu buffer containing the buffer's latest data and
+    // returns the offset of the data in it.
+    int bind(am_buffer *buf);
+
+    // Returns the vbo slot containing the buffer's latest data without
+    // binding it, or 0 if the data is in a stream ring or not uploaded.
+    am_buffer_id latest_slot_id();
 };
 
+// A large gpu buffer that stream buffers and batches are sub-allocated
+// from. Allocations are made one after the other and when the ring is
+// full its storage is orphaned and allocation starts again from the
+// beginning, so data drawn from earlier in the frame is never overwritten.
+struct am_stream_ring {
+    am_buffer_id id;
+    int capacity;
+    int used;
+    uint32_t generation; // incremented each time the storage is orphaned
+};
+
+// Copies data to the stream ring for target, binds the ring and returns
+// the offset of the data in it. If generation is not NULL it is set to the
+// ring's generation, which can be compared with am_stream_ring_generation
+// to check whether the data is still valid.
+int am_stream_upload(am_buffer_target target, void *data, int size, uint32_t *generation);
+uint32_t am_stream_ring_generation(am_buffer_target target);
+// Deletes the gpu buffers of the stream rings. Called on shutdown, after
+// the lua state (and so every vbo) has been closed.
+void am_delete_stream_rings();
+
+// Incremented whenever a gpu array buffer is deleted. Vertex array objects
+// refer to buffers by id, so ones set up before a deletion may be stale.
+extern uint32_t am_array_buffer_deletions;
+
+// stats for the last frame
+extern int am_frame_upload_bytes;
+extern int am_frame_vbo_stalls; // updates to gpu buffers that may still be in use
+void am_reset_vbo_frame_stats();
+
 void am_open_vbo_module(lua_State *L);
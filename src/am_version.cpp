@@ -0,0 +1 @@
+const char *am_version = "DEV 2026-18-10 06:09";
@@ -1,6 +1,6 @@
 #include "amulet.h"
 
-static void decode_view_type_lua(am_buffer_view_type_lua ltype, am_buffer_view_type *type, int *components) {
+void am_decode_view_type_lua(am_buffer_view_type_lua ltype, am_buffer_view_type *type, int *components) {
     switch (ltype) {
         case AM_VIEW_TYPE_LUA_F32_1:
             *type = AM_VIEW_TYPE_F32;
@@ -390,7 +390,7 @@ int am_create_buffer_view(lua_State *L) {
     am_buffer_view_type_lua ltype = am_get_enum(L, am_buffer_view_type_lua, 2);
     am_buffer_view_type type = AM_NUM_VIEW_TYPES; // avoid gcc warning
     int components = 0;
-    decode_view_type_lua(ltype, &type, &components);
+    am_decode_view_type_lua(ltype, &type, &components);
 
     int type_size = am_view_type_infos[type].size * components;
 
@@ -121,6 +121,10 @@ am_buffer_view* am_new_buffer_view(lua_State *L, am_buffer_view_type type, int c
 // use this instead of am_get_userdata (does some extra checking)
 am_buffer_view* am_check_buffer_view(lua_State *L, int idx);
 
+// Gets the base type and number of components of a view type name
+// such as "vec3".
+void am_decode_view_type_lua(am_buffer_view_type_lua ltype, am_buffer_view_type *type, int *components);
+
 int am_create_buffer_view(lua_State *L);
 int am_view_op_add(lua_State *L);
 int am_view_op_sub(lua_State *L);
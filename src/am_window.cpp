@@ -455,10 +455,12 @@ static void draw_windows() {
             if (am_record_perf_timings) {
                 t0 = am_get_current_time();
             }
+            am_profile_begin(AM_PROFILE_MAIN_THREAD, "draw");
             rstate->do_render(&roots[0], num_roots, 0, true, win->clear_color, win->stencil_clear_value,
                 win->viewport_x, win->viewport_y, win->viewport_width, win->viewport_height,
                 win->pixel_width, win->pixel_height,
                 win->projection, win->has_depth_buffer);
+            am_profile_end(AM_PROFILE_MAIN_THREAD);
             if (am_record_perf_timings) {
                 am_last_frame_draw_time = am_get_current_time() - t0;
             }
@@ -472,6 +474,9 @@ bool am_update_windows(lua_State *L) {
     if (!close_windows(L)) return false;
     resize_windows();
     am_reset_gl_frame_stats();
+    am_reset_vbo_frame_stats();
+    am_reset_program_frame_stats();
+    am_allocator_end_frame(L);
     draw_windows();
     frame++;
     if (am_conf_log_gl_calls && am_conf_log_gl_frames > 0) {
@@ -488,6 +493,7 @@ bool am_execute_actions(lua_State *L, double dt) {
     if (am_record_perf_timings) {
         t0 = am_get_current_time();
     }
+    am_profile_begin(AM_PROFILE_MAIN_THREAD, "actions");
     am_pre_frame(L, dt);
     unsigned int n = windows.size();
     bool res = true;
@@ -510,6 +516,8 @@ bool am_execute_actions(lua_State *L, double dt) {
         }
     }
     am_post_frame(L);
+    am_profile_end(AM_PROFILE_MAIN_THREAD);
+    am_profile_lua_heap(L);
     if (am_record_perf_timings) {
         am_last_frame_lua_time = am_get_current_time() - t0;
     }
@@ -28,6 +28,10 @@
 #else
     #error unsupported target
 #endif
+
+#if defined(AM_USE_NULL_GL) && !defined(AM_BACKEND_SDL)
+    #error the null gl backend is only supported on windows, mac and linux
+#endif
 #if defined(AM_OSX) || defined(AM_LINUX) || defined(AM_WINDOWS)
     #define AM_GLPROFILE_DESKTOP 1
 #elif defined(AM_ANDROID) || defined(AM_IOS) || defined(AM_HTML)
@@ -42,7 +46,7 @@
     #define AM_SPRITEPACK
 #endif
 
-#if defined(AM_WINDOWS) || defined(AM_LINUX)
+#if (defined(AM_WINDOWS) || defined(AM_LINUX)) && !defined(AM_USE_NULL_GL)
 #define AM_NEED_GL_FUNC_PTRS
 #endif
 
@@ -93,6 +97,7 @@
 #include <new>
 #include <climits>
 #include <vector>
+#include <algorithm>
 
 #include "c99.h"
 
@@ -122,9 +127,11 @@ extern "C" {
 #include "am_alloc.h"
 #include "am_util.h"
 #include "am_utf8.h"
+#include "am_thread.h"
 #include "am_package.h"
 #include "am_gl.h"
 #include "am_time.h"
+#include "am_profiler.h"
 #include "am_input.h"
 #include "am_embedded.h"
 #include "am_userdata.h"
@@ -136,18 +143,23 @@ extern "C" {
 #include "am_lua_util.h"
 #include "am_math.h"
 #include "am_buffer.h"
+#include "am_mathv_simd.h"
+#include "am_mathv_threads.h"
 #include "am_mathv.h"
 #include "am_view.h"
 #include "am_image.h"
 #include "am_texture2d.h"
 #include "am_vbo.h"
 #include "am_audio.h"
+#include "am_audio_kernels.h"
 #include "am_action.h"
 #include "am_scene.h"
 #include "am_framebuffer.h"
 #include "am_window.h"
 #include "am_renderer.h"
 #include "am_program.h"
+#include "am_batch.h"
+#include "am_retained.h"
 #include "am_transforms.h"
 #include "am_depthbuffer.h"
 #include "am_stencilbuffer.h"
@@ -155,10 +167,12 @@ extern "C" {
 #include "am_blending.h"
 #include "am_model.h"
 #include "am_engine.h"
+#include "am_jobs.h"
 #include "am_json.h"
 #include "am_http.h"
 #include "am_browser.h"
 #include "am_spritepack.h"
+#include "am_text.h"
 #include "am_export.h"
 #include "am_rand.h"
 #include "am_sfxr.h"
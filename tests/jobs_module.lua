@@ -0,0 +1,29 @@
+local jobs_module = ...
+
+function jobs_module.scale(view, factor)
+    for i = 1, #view do
+        view[i] = view[i] * factor
+    end
+    return view, #view
+end
+
+function jobs_module.sum(from, to)
+    local total = 0
+    for i = from, to do
+        total = total + i
+    end
+    return total
+end
+
+function jobs_module.echo(...)
+    return ...
+end
+
+local
+function inner(x)
+    error("bad value: "..tostring(x))
+end
+
+function jobs_module.fail(x)
+    inner(x)
+end
@@ -0,0 +1,68 @@
+local stats = am.allocator_stats()
+if not stats then
+    print("allocator not available")
+    return
+end
+
+local
+function keys(t)
+    local ks = {}
+    for k in pairs(t) do table.insert(ks, k) end
+    table.sort(ks)
+    return table.concat(ks, ", ")
+end
+
+print("fields: "..keys(stats))
+print("pool fields: "..keys(stats.pools[1]))
+print("large fields: "..keys(stats.large))
+print("pools: "..#stats.pools)
+print("cell sizes: "..stats.pools[1].cell_size.." to "..stats.pools[#stats.pools].cell_size)
+
+-- The pool that tables are allocated from is found by allocating a
+-- batch of them and seeing which pool's live count grows by as much.
+local n = 1000
+collectgarbage("collect")
+collectgarbage("stop")
+local before = am.allocator_stats()
+local objs = {}
+for i = 1, n do objs[i] = {} end
+local after = am.allocator_stats()
+local pool
+for p = 1, #after.pools do
+    if after.pools[p].live - before.pools[p].live >= n then
+        pool = p
+        break
+    end
+end
+print("table pool found: "..tostring(pool ~= nil))
+local b, a = before.pools[pool], after.pools[pool]
+print("allocs grew by at least n: "..tostring(a.allocs - b.allocs >= n))
+print("bytes grew by cell size * n: "..tostring(a.bytes - b.bytes >= n * a.cell_size))
+print("peak_live at least live: "..tostring(a.peak_live >= a.live))
+print("reserved bytes cover live cells: "..tostring(a.reserved_bytes >= a.live * a.cell_size))
+print("utilization in (0, 1]: "..tostring(a.utilization > 0 and a.utilization <= 1))
+
+objs = nil
+collectgarbage("restart")
+collectgarbage("collect")
+local freed = am.allocator_stats().pools[pool]
+print("frees grew by at least n: "..tostring(freed.frees - a.frees >= n))
+-- (the stats tables themselves are allocated from the same pool)
+print("live dropped by about n: "..tostring(a.live - freed.live >= n - #after.pools - 10))
+print("peak_live kept: "..tostring(freed.peak_live >= a.live))
+
+-- objects bigger than the largest cell come from the heap
+local large_before = am.allocator_stats().large
+local big = string.rep("x", 100000)
+local large_after = am.allocator_stats().large
+print("large allocs grew: "..tostring(large_after.allocs > large_before.allocs))
+print("large bytes grew by the string size: "..tostring(large_after.bytes - large_before.bytes >= 100000))
+big = nil
+collectgarbage("collect")
+local large_freed = am.allocator_stats().large
+print("large bytes freed: "..tostring(large_after.bytes - large_freed.bytes >= 100000))
+print("large free_bytes grew: "..tostring(large_freed.free_bytes - large_after.free_bytes >= 100000))
+
+local frame = am.allocator_stats("frame")
+print("frame mode fields: "..keys(frame.large))
+print(pcall(am.allocator_stats, "bogus"))
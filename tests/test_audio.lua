@@ -0,0 +1,110 @@
+local channels = 2
+local samples = 44100 * 4
+local block = 4096
+
+local source_view = am.buffer(samples * channels * 4):view("float")
+local rng = am.rand(1)
+for i = 1, samples * channels do
+    source_view[i] = math.sin(i * 0.01) * 0.4 + (rng() - 0.5) * 0.2
+end
+local source = am.audio_buffer(source_view.buffer, channels, 44100)
+
+local
+function render(create)
+    local out = am.buffer((samples + block) * channels * 4):view("float")
+    am._render_audio_offline(create(), samples, out)
+    return out
+end
+
+-- largest difference relative to the peak of a
+local
+function max_diff(a, b)
+    local d = 0
+    local peak = 0
+    for i = 1, #a do
+        d = math.max(d, math.abs(a[i] - b[i]))
+        peak = math.max(peak, math.abs(a[i]))
+    end
+    return d / peak
+end
+
+-- The scalar kernel is the original loop, which rounds its output to
+-- float before feeding it back, so the block kernels (double throughout)
+-- can't match it exactly. With float coefficients and state they were
+-- out by up to 0.4% on the low cutoff and high resonance filters here.
+print("biquad kernels")
+local filters = {
+    {"lowpass", function() return am.track(source):lowpass_filter(1000, 1) end},
+    {"lowpass low cutoff", function() return am.track(source):lowpass_filter(20, 1) end},
+    {"lowpass high q", function() return am.track(source):lowpass_filter(200, 20) end},
+    {"highpass", function() return am.track(source):highpass_filter(1000, 1) end},
+    {"highpass low cutoff high q", function() return am.track(source):highpass_filter(30, 15) end},
+}
+local default_kernels = am._audio_kernels()[1]
+for _, filter in ipairs(filters) do
+    local name, create = filter[1], filter[2]
+    am._set_audio_kernels("scalar")
+    local expected = render(create)
+    for _, kernels in ipairs(am._audio_kernels()) do
+        am._set_audio_kernels(kernels)
+        local d = max_diff(expected, render(create))
+        if d > 1e-3 then
+            print(name, kernels, "differs from scalar by", d)
+        end
+    end
+    print(name, "ok")
+end
+am._set_audio_kernels(default_kernels)
+
+-- Children of a plain node are rendered in groups across the audio
+-- threads. Groups are summed separately, so the output may differ from
+-- the single threaded render by rounding only.
+print("audio threads")
+local
+function mix()
+    local shared = am.track(source, true):lowpass_filter(2000, 1)
+    local node = am.audio_node()
+    node:add(am.track(source, true):gain(0.5))
+    node:add(am.oscillator(440):gain(0.2))
+    node:add(shared:gain(0.3))
+    node:add(am.track(source, true):highpass_filter(500, 2))
+    -- shares a node with the third child, so both must be in one group
+    node:add(shared:gain(0.4))
+    node:add(am.oscillator(220):lowpass_filter(300, 1))
+    return node
+end
+am.set_audio_threads(1)
+local expected = render(mix)
+for _, threads in ipairs{2, 4} do
+    am.set_audio_threads(threads)
+    local d = max_diff(expected, render(mix))
+    print(threads, d < 1e-6 and "ok" or ("differs by "..d))
+end
+am.set_audio_threads(1)
+
+-- A stream decoded ahead on the decoder thread plays the same samples as
+-- one decoded on the audio thread. The prefetch covers the whole render,
+-- so the output doesn't depend on when the decoder thread runs.
+print("streams")
+local ogg = am.load_buffer("../examples/drums.ogg")
+for _, loop in ipairs{false, true} do
+    local direct = render(function() return am.stream(ogg, loop, 1, 0) end)
+    local stream
+    local ahead = render(function()
+        stream = am.stream(ogg, loop, 1, samples / 44100 + 1)
+        return stream
+    end)
+    local same = true
+    local nonzero = 0
+    for i = 1, #direct do
+        if direct[i] ~= ahead[i] then
+            same = false
+        end
+        if direct[i] ~= 0 then
+            nonzero = nonzero + 1
+        end
+    end
+    print("loop "..tostring(loop), same and "same" or "differs",
+        "underruns "..stream.underruns, "finished "..tostring(stream.finished),
+        nonzero > 0 and "not silent" or "silent")
+end
@@ -0,0 +1,57 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+if not am.null_gl_stats then
+    print("skipped (needs a NULL_GL build)")
+    win:close()
+    return
+end
+
+local img = [[
+.W.
+WWW
+.W.
+]]
+
+local
+function sprites(n)
+    local group = am.group()
+    for i = 1, n do
+        group:append(am.translate(i % 10 * 8 - 40, math.floor(i / 10) * 8 - 40) ^ am.sprite(img))
+    end
+    return group
+end
+
+local steps = {
+    {"plain", function() return sprites(100) end},
+    {"batch", function() return am.batch"vert" ^ sprites(100) end},
+    {"batch no position", function() return am.batch() ^ sprites(100) end},
+    {"batch two colors", function()
+        local group = sprites(100)
+        for i = 51, 100 do
+            group:child(i)"sprite".color = vec4(1, 0, 0, 1)
+        end
+        return am.batch"vert" ^ group
+    end},
+}
+
+local content = am.group()
+win.scene = content
+local step = 0
+local prev
+win.scene:action(function()
+    local stats = am.null_gl_stats()
+    if prev then
+        local name = steps[step][1]
+        local frames = stats.frames - prev.frames
+        print(name..": "..((stats.draw_calls - prev.draw_calls) / frames).." draws per frame, "
+            ..((stats.vertices - prev.vertices) / frames).." vertices per frame")
+    end
+    prev = stats
+    step = step + 1
+    if step > #steps then
+        win:close()
+        return
+    end
+    content:remove_all()
+    content:append(steps[step][2]())
+end)
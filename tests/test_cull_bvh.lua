@@ -0,0 +1,155 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+local prog = am.program([[
+    precision mediump float;
+    attribute vec3 vert;
+    uniform mat4 MV;
+    uniform mat4 P;
+    void main() {
+        gl_Position = P * MV * vec4(vert, 1.0);
+    }
+]], [[
+    precision mediump float;
+    void main() {
+        gl_FragColor = vec4(1.0);
+    }
+]])
+
+local verts = am.vec3_array{vec3(0), vec3(1, 0, 0), vec3(0, 1, 0)}
+local rand = am.rand(12345)
+
+local num_items = 600
+local items = {}
+for i = 1, num_items do
+    local center = vec3(rand(-200, 200), rand(-200, 200), rand(-200, 200))
+    local size = rand() * 10 + 0.5
+    items[i] = {sphere = i % 2 == 0, center = center, size = size}
+end
+
+-- Children that have been rendered have a matrix in their read_uniform
+-- node (it's 0 before that), so new ones are made each time the
+-- visible sets are compared.
+local
+function contents()
+    return am.read_uniform("MV") ^ am.bind{vert = verts} ^ am.draw("triangles")
+end
+
+local
+function cull_node(item)
+    local node
+    if item.sphere then
+        node = am.cull_sphere(item.size, item.center)
+    else
+        node = am.cull_box(item.center - item.size, item.center + item.size)
+    end
+    node:append(contents())
+    return node
+end
+
+local plain = am.group()
+local bvh = am.cull_bvh()
+for i = 1, num_items do
+    plain:append(cull_node(items[i]))
+    bvh:append(cull_node(items[i]))
+end
+
+local camera = am.lookat(vec3(0, 0, 300), vec3(0), vec3(0, 1, 0))
+win.scene = am.use_program(prog)
+    ^ am.bind{P = math.perspective(math.rad(60), 1, 1, 1000)}
+    ^ camera
+    ^ am.group{plain, bvh}
+
+local
+function refresh()
+    for i = 1, num_items do
+        for _, group in ipairs{plain, bvh} do
+            local node = group:child(i)
+            node:remove_all()
+            node:append(contents())
+        end
+    end
+end
+
+local
+function compare(name)
+    local visible = 0
+    local mismatches = 0
+    for i = 1, num_items do
+        local a = plain:child(i)"read_uniform".value ~= 0
+        local b = bvh:child(i)"read_uniform".value ~= 0
+        if a then
+            visible = visible + 1
+        end
+        if a ~= b then
+            mismatches = mismatches + 1
+        end
+    end
+    print(name..": "..visible.." visible, "..mismatches.." mismatches")
+end
+
+local
+function move_items(n)
+    for j = 1, n do
+        local i = rand(num_items)
+        local item = items[i]
+        item.center = vec3(rand(-200, 200), rand(-200, 200), rand(-200, 200))
+        for _, group in ipairs{plain, bvh} do
+            local node = group:child(i)
+            if item.sphere then
+                node.center = item.center
+            else
+                node.min = item.center - item.size
+                node.max = item.center + item.size
+            end
+        end
+    end
+end
+
+local steps = {
+    {"front", function() end},
+    {"inside", function()
+        camera.eye = vec3(10, 20, 30)
+        camera.center = vec3(100, 0, 0)
+    end},
+    {"above", function()
+        camera.eye = vec3(0, 400, 0)
+        camera.center = vec3(0)
+        camera.up = vec3(0, 0, 1)
+    end},
+    {"edge", function()
+        camera.eye = vec3(-250, -250, 0)
+        camera.center = vec3(-250, 0, 0)
+        camera.up = vec3(0, 0, 1)
+    end},
+    {"moved 50 items", function()
+        camera.eye = vec3(0, 0, 300)
+        camera.center = vec3(0)
+        camera.up = vec3(0, 1, 0)
+        move_items(50)
+    end},
+    {"moved 600 items", function()
+        move_items(600)
+    end},
+    {"removed items", function()
+        for i = num_items, 1, -3 do
+            plain:remove(plain:child(i))
+            bvh:remove(bvh:child(i))
+            table.remove(items, i)
+        end
+        num_items = #items
+    end},
+}
+
+local step = 0
+win.scene:action(function()
+    if step > 0 then
+        compare(steps[step][1])
+    end
+    step = step + 1
+    if step > #steps then
+        win:close()
+        return
+    end
+    steps[step][2]()
+    refresh()
+end)
@@ -0,0 +1,98 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+if not am.null_gl_stats then
+    print("skipped (needs a NULL_GL build)")
+    win:close()
+    return
+end
+
+local prog = am.program([[
+    precision mediump float;
+    attribute vec2 vert;
+    attribute vec2 offset;
+    attribute vec4 color;
+    uniform mat4 MV;
+    uniform mat4 P;
+    varying vec4 v_color;
+    void main() {
+        v_color = color;
+        gl_Position = P * MV * vec4(vert + offset, 0.0, 1.0);
+    }
+]], [[
+    precision mediump float;
+    varying vec4 v_color;
+    void main() {
+        gl_FragColor = v_color;
+    }
+]])
+
+local verts = am.vec2_array{vec2(-1, -1), vec2(1, -1), vec2(1, 1), vec2(-1, 1)}
+local elems = am.ushort_elem_array{1, 2, 3, 1, 3, 4}
+
+local offsets = {}
+local colors = {}
+for i = 1, 100 do
+    offsets[i] = vec2(i % 10, math.floor(i / 10)) * 4
+    colors[i] = vec4(i / 100, 0, 0, 1)
+end
+local offsets_view = am.vec2_array(offsets)
+local colors_view = am.vec4_array(colors)
+
+local
+function instanced(...)
+    return am.use_program(prog)
+        ^ am.bind{vert = verts}
+        ^ am.draw_instanced(...)
+end
+
+local steps = {
+    {"arrays", function()
+        return instanced("triangle_fan", 100, {offset = offsets_view, color = colors_view})
+    end},
+    {"elements", function()
+        return instanced("triangles", 100, {offset = offsets_view, color = colors_view}, elems)
+    end},
+    {"elements first/count", function()
+        return instanced("triangles", 100, {offset = offsets_view, color = colors_view}, elems, 4, 3)
+    end},
+    {"clamped to shortest view", function()
+        return instanced("triangles", 100, {offset = offsets_view, color = colors_view:slice(1, 40)}, elems)
+    end},
+    {"instances field", function()
+        local node = instanced("triangles", 100, {offset = offsets_view, color = colors_view}, elems)
+        node"draw".instances = 7
+        return node
+    end},
+    {"zero instances", function()
+        return instanced("triangles", 0, {offset = offsets_view, color = colors_view}, elems)
+    end},
+    {"three nodes", function()
+        local group = am.group()
+        for i = 1, 3 do
+            group:append(instanced("triangles", 10 * i, {offset = offsets_view, color = colors_view}, elems))
+        end
+        return group
+    end},
+}
+
+local content = am.group()
+win.scene = content
+local step = 0
+local prev
+win.scene:action(function()
+    local stats = am.null_gl_stats()
+    if prev then
+        local name = steps[step][1]
+        local frames = stats.frames - prev.frames
+        print(name..": "..((stats.draw_calls - prev.draw_calls) / frames).." draws per frame, "
+            ..((stats.vertices - prev.vertices) / frames).." vertices per frame")
+    end
+    prev = stats
+    step = step + 1
+    if step > #steps then
+        win:close()
+        return
+    end
+    content:remove_all()
+    content:append(steps[step][2]())
+end)
@@ -0,0 +1,77 @@
+-- buffers are moved to the worker and back
+local buf = am.buffer(4 * 10)
+local view = buf:view("float")
+for i = 1, 10 do
+    view[i] = i
+end
+local job = am.jobs.run("jobs_module.scale", view, 3)
+print(pcall(function() return view[1] end))
+local scaled, n = job:wait()
+print(job.status, n)
+local values = {}
+for i = 1, #scaled do
+    values[i] = scaled[i]
+end
+print(table.concat(values, " "))
+-- results can be read again
+local scaled2 = job:result()
+print(scaled2 == scaled)
+
+-- other values are copied
+local t = {1, "two", true, {x = vec3(1, 2, 3)}, q = quat(0), m = mat2(1, 2, 3, 4)}
+local r1, r2, r3 = am.jobs.run("jobs_module.echo", t, nil, 7):wait()
+print(r1[1], r1[2], r1[3], r1[4].x, r1.q, r1.m, r2, r3)
+print(r1 ~= t)
+
+-- errors include a traceback from the worker
+local job = am.jobs.run("jobs_module.fail", 42)
+print(pcall(job.wait, job))
+print(job.status)
+local err = job.error
+print(err:match("^[^\n]*"))
+print(err:find("stack traceback:", 1, true) ~= nil)
+print(err:find("in function 'inner'", 1, true) ~= nil)
+
+job = am.jobs.run("jobs_module.missing")
+print(pcall(job.wait, job))
+
+-- functions, userdata other than buffers and vectors, and cycles are rejected
+print(pcall(am.jobs.run, "jobs_module.echo", function() end))
+print(pcall(am.jobs.run, "jobs_module.echo", {f = print}))
+print(pcall(am.jobs.run, "jobs_module.echo", am.group()))
+local cycle = {}
+cycle.self = cycle
+print(pcall(am.jobs.run, "jobs_module.echo", cycle))
+
+-- many jobs at once
+local jobs = {}
+for i = 1, 200 do
+    jobs[i] = am.jobs.run("jobs_module.sum", i, i * 100)
+end
+local ok = true
+for i = 1, 200 do
+    local n = i * 100 - i + 1
+    if jobs[i]:wait() ~= n * (i + i * 100) / 2 then
+        ok = false
+    end
+end
+print("200 jobs", ok)
+
+-- many jobs each moving their own buffer
+jobs = {}
+local views = {}
+for i = 1, 50 do
+    local v = am.buffer(4 * 100):view("float")
+    v:set(i)
+    jobs[i] = am.jobs.run("jobs_module.scale", v, 2)
+end
+ok = true
+for i = 1, 50 do
+    local v = jobs[i]:wait()
+    for j = 1, 100 do
+        if v[j] ~= i * 2 then
+            ok = false
+        end
+    end
+end
+print("50 buffer jobs", ok)
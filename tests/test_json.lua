@@ -0,0 +1,84 @@
+local
+function dump(v)
+    if type(v) == "table" then
+        local keys = {}
+        for k in pairs(v) do table.insert(keys, k) end
+        table.sort(keys, function(a, b) return tostring(a) < tostring(b) end)
+        local s = "{"
+        for _, k in ipairs(keys) do s = s .. tostring(k) .. "=" .. dump(v[k]) .. "," end
+        return s .. "}"
+    end
+    return type(v) == "string" and string.format("%q", v) or tostring(v)
+end
+
+local
+function to_buffer(str)
+    local buf = am.buffer(#str)
+    local view = buf:view("ubyte")
+    for i = 1, #str do
+        view[i] = str:byte(i)
+    end
+    return buf
+end
+
+-- each document is parsed from a string and a buffer, lazily and
+-- with events, which should all agree.
+local
+function test(json)
+    local val, err = am.parse_json(json)
+    print(dump(val), err)
+    local val2, err2 = am.parse_json(to_buffer(json))
+    assert(dump(val2) == dump(val) and err2 == err)
+    local lazy, lazy_err = am.parse_json_lazy(json)
+    assert(dump(am.json_materialize(lazy)) == dump(val) and lazy_err == err)
+    local events = {}
+    local ok, events_err = am.parse_json_events(json, {
+        begin_object = function() table.insert(events, "{") end,
+        end_object = function() table.insert(events, "}") end,
+        begin_array = function() table.insert(events, "[") end,
+        end_array = function() table.insert(events, "]") end,
+        key = function(k) table.insert(events, k .. ":") end,
+        value = function(v) table.insert(events, tostring(v)) end,
+    })
+    assert(events_err == err)
+    if ok then
+        print(table.concat(events, " "))
+    end
+end
+
+test('{"a": [1, 2.5, -3e2, true, false, null, "x\\ty"], "b": {"c": "\\u00e9\\ud83d\\ude00"}, "d": {}, "e": []}')
+test('  [0, -0, 1e22, 1e-22, 0.1, 123456789012345678901234, 3.14159265358979] ')
+test('"\\"\\\\\\/\\n"')
+test('42')
+test('null')
+test('{"a": 1,}')
+test('[1, 2')
+test('{"a" 1}')
+test('[01]')
+test('"abc')
+test('"\\x"')
+test('["\\u12"]')
+test('[tru]')
+test('[1] x')
+test('')
+test(string.rep("[", 1000) .. string.rep("]", 1000))
+
+local lazy = am.parse_json_lazy('{"list": [{"id": 1}, {"id": 2, "tags": ["a", "b"]}, null, 4], "name": "level"}')
+print(lazy.name, #lazy.list, lazy.list[1].id, lazy.list[2].tags[2], lazy.list[3], lazy.list[4], lazy.list[5], lazy.missing)
+print(lazy.list == lazy.list, lazy.list[2] == lazy.list[2])
+for i, v in am.json_pairs(lazy.list) do
+    print(i, dump(am.json_materialize(v)))
+end
+print(pcall(function() lazy.name = "x" end))
+
+local count = 0
+print(am.parse_json_events('[1, 2, 3, 4]', {value = function(v)
+    count = count + 1
+    if v == 2 then return false end
+end}), count)
+
+local long = string.rep("ab\\n", 100)
+print(#am.parse_json('"' .. long .. '"'), #am.parse_json_lazy('["' .. long .. '"]')[1])
+
+local t = {a = {1, 2, 3}, b = "x\"y\\z\n", c = {d = true}}
+print(dump(am.parse_json(am.to_json(t))) == dump(t))
@@ -221,3 +221,30 @@ do
     print(mathv.greatest(mathv.array("float", 0)))
     print(mathv.least(mathv.array("float", 0)))
 end
+
+print("compile")
+do
+    local a = mathv.array("vec3", {vec3(1, 2, 3), vec3(4, 5, 6), vec3(-1, 0, 1)})
+    local b = mathv.array("vec3", {vec3(1, 0, 0), vec3(0, 1, 0), vec3(0, 0, 1)})
+    local s = mathv.array("float", {0.5, 2, 10})
+    local out = mathv.array("vec3", 3)
+    local blend = mathv.compile("vec3 a, float s, vec3 b, float t", "a * s + b * t")
+    print_view(blend(out, a, s, b, 1))
+    print_view(blend(out, a, 2, b, s))
+    local tree = mathv.compile("vec3 a, vec3 b", {"sub", {"cross", "a", "b"}, 1})
+    print_view(tree(out, a, b))
+    local lengths = mathv.array("float", 3)
+    print_view(mathv.compile("vec3 a", "dot(a * 2, a) ^ 2 / 4")(lengths, a))
+    print_view(mathv.compile("vec3 a, vec3 b", "-dot(a, b) > -3")(mathv.array("ubyte", 3), a, b))
+    local mat = mathv.array("mat4", {mat4(2), mat4(1), math.translate4(1, 2, 3)})
+    print_view(mathv.compile("mat4 m, vec3 a", "m * vec4(a, 1)")(mathv.array("vec4", 3), mat, a))
+    -- in place
+    local pos = mathv.array("vec2", {vec2(0, 0), vec2(1, 1)})
+    local step = mathv.compile("vec2 p, vec2 v, float dt", "p + v * dt")
+    step(pos, pos, mathv.array("vec2", {vec2(1, 0), vec2(0, 2)}), 0.5)
+    print_view(pos)
+    print(pcall(mathv.compile, "vec3 a, vec2 b", "a + b"))
+    print(pcall(mathv.compile, "vec3 a", "a + c"))
+    print(pcall(mathv.compile, "vec3 a", "a * (2"))
+    print(pcall(blend, lengths, a, s, b, 1))
+end
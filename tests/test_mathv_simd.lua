@@ -0,0 +1,116 @@
+-- Checks that each supported set of SIMD kernels gives the same results
+-- as the scalar loops. The lengths are odd so every case goes through
+-- the vector loop and the padded tail.
+
+local rand = am.rand(1234)
+local lengths = {67, 131}
+
+local
+function random_array(type, n, lo, hi)
+    local comps = ({float = 1, vec2 = 2, vec3 = 3, vec4 = 4})[type]
+    local t = {}
+    for i = 1, n * comps do
+        t[i] = lo + rand() * (hi - lo)
+    end
+    return mathv.array(type, t)
+end
+
+local
+function close(a, b, tol)
+    if type(a) == "number" then
+        return math.abs(a - b) <= tol * math.max(math.abs(a), 1)
+    elseif type(a) == "boolean" then
+        return a == b
+    end
+    for k = 1, #a do
+        if not close(a[k], b[k], tol) then return false end
+    end
+    return true
+end
+
+local
+function compare(expected, actual, tol)
+    if #expected ~= #actual then return false end
+    for i = 1, #expected do
+        if not close(expected[i], actual[i], tol) then
+            return false, i
+        end
+    end
+    return true
+end
+
+-- Each case is a function name, the argument types (a number is passed
+-- as a scalar) with their ranges and the allowed relative error.
+local exact = 0
+local ulps = 1e-6
+-- sums of products of the inputs, which may be added in a different
+-- order, so the error is relative to the products (up to 100)
+local sums = 1e-4
+local cases = {
+    {"add", {"vec3", -10, 10}, {"vec3", -10, 10}, ulps},
+    {"add", {"float", -10, 10}, 2.5, ulps},
+    {"sub", {"vec2", -10, 10}, {"vec2", -10, 10}, ulps},
+    {"vec_mul", {"vec4", -10, 10}, {"vec4", -10, 10}, ulps},
+    {"vec_mul", 3, {"vec3", -10, 10}, ulps},
+    {"div", {"float", -10, 10}, {"float", 1, 10}, ulps},
+    {"mod", {"float", -10, 10}, {"float", 1, 10}, ulps},
+    {"pow", {"float", 0.001, 100}, {"float", -8, 8}, 1e-5},
+    {"pow", {"float", 20, 30}, {"float", -25, 25}, 1e-5},
+    {"pow", {"vec2", 0.001, 100}, 2, ulps},
+    {"unm", {"vec3", -10, 10}, exact},
+    {"abs", {"float", -10, 10}, exact},
+    {"floor", {"vec2", -10, 10}, exact},
+    {"ceil", {"vec4", -10, 10}, exact},
+    {"fract", {"float", -10, 10}, ulps},
+    {"sign", {"float", -10, 10}, exact},
+    {"min", {"vec3", -10, 10}, {"vec3", -10, 10}, exact},
+    {"max", {"float", -10, 10}, 0, exact},
+    {"clamp", {"vec2", -10, 10}, -5, 5, exact},
+    {"mix", {"float", -10, 10}, {"float", -10, 10}, {"float", 0, 1}, ulps},
+    {"sin", {"float", -100, 100}, ulps},
+    {"cos", {"vec4", -100, 100}, ulps},
+    {"log", {"float", 0.001, 1000}, ulps},
+    {"lt", {"float", -10, 10}, {"float", -10, 10}, exact},
+    {"lte", {"vec2", -10, 10}, 0, exact},
+    {"gt", {"float", -10, 10}, {"float", -10, 10}, exact},
+    {"gte", {"vec3", -10, 10}, {"vec3", -10, 10}, exact},
+    {"dot", {"vec2", -10, 10}, {"vec2", -10, 10}, sums},
+    {"dot", {"vec4", -10, 10}, {"vec4", -10, 10}, sums},
+    {"length", {"vec3", -10, 10}, ulps},
+    {"normalize", {"vec2", -10, 10}, ulps},
+    {"normalize", {"vec4", -10, 10}, ulps},
+    {"cross", {"vec3", -10, 10}, {"vec3", -10, 10}, sums},
+}
+
+local kernels = mathv._supported_simd()
+for _, case in ipairs(cases) do
+    local name = case[1]
+    local tol = case[#case]
+    local desc = {}
+    local ok = true
+    for _, n in ipairs(lengths) do
+        local args = {}
+        for j = 2, #case - 1 do
+            local arg = case[j]
+            if type(arg) == "table" then
+                args[j - 1] = random_array(arg[1], n, arg[2], arg[3])
+                if n == lengths[1] then table.insert(desc, arg[1]) end
+            else
+                args[j - 1] = arg
+                if n == lengths[1] then table.insert(desc, "scalar") end
+            end
+        end
+        mathv._set_simd("scalar")
+        local expected = mathv[name](unpack(args))
+        for _, k in ipairs(kernels) do
+            mathv._set_simd(k)
+            local good, i = compare(expected, mathv[name](unpack(args)), tol)
+            if not good then
+                print(name.." differs with "..k.." kernels at "..tostring(i).." of "..n)
+                ok = false
+            end
+        end
+    end
+    print(name.."("..table.concat(desc, ", ").."): "..(ok and "ok" or "FAILED"))
+end
+mathv._set_simd(kernels[1])
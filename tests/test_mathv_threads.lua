@@ -0,0 +1,62 @@
+-- Checks that mathv calls big enough to be split between threads give
+-- exactly the same results as running on one thread.
+
+local rand = am.rand(4321)
+local n = 100003 -- above the default parallel threshold of 65536
+
+local
+function random_array(type, lo, hi)
+    local comps = ({float = 1, double = 1, vec3 = 3})[type]
+    local t = {}
+    for i = 1, n * comps do
+        t[i] = lo + rand() * (hi - lo)
+    end
+    return mathv.array(type, t)
+end
+
+local
+function same(a, b)
+    if #a ~= #b then return false end
+    for i = 1, #a do
+        if a[i] ~= b[i] then return false end
+    end
+    return true
+end
+
+local x = random_array("float", 0.5, 10)
+local y = random_array("float", -4, 4)
+local v = random_array("vec3", -10, 10)
+local w = random_array("vec3", -10, 10)
+local dx = random_array("double", 0.5, 10)
+
+local cases = {
+    {"add", function() return x + y end},
+    {"vec_mul", function() return v * w end},
+    {"pow", function() return mathv.pow(x, y) end},
+    {"sin", function() return mathv.sin(y) end},
+    {"normalize", function() return mathv.normalize(v) end},
+    {"dot", function() return mathv.dot(v, w) end},
+    {"cross", function() return mathv.cross(v, w) end},
+    {"lt", function() return mathv.lt(x, 5) end},
+    {"double log", function() return mathv.log(dx) end},
+}
+
+local kernels = mathv._supported_simd()
+local threads, threshold = mathv._threads()
+for _, case in ipairs(cases) do
+    local ok = true
+    for _, k in ipairs(kernels) do
+        mathv._set_simd(k)
+        mathv._set_threads(1)
+        local expected = case[2]()
+        mathv._set_threads(4)
+        local actual = case[2]()
+        if not same(expected, actual) then
+            print(case[1].." differs with "..k.." kernels")
+            ok = false
+        end
+    end
+    print(case[1]..": "..(ok and "ok" or "FAILED"))
+end
+mathv._set_simd(kernels[1])
+mathv._set_threads(threads, threshold)
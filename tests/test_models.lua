@@ -0,0 +1,116 @@
+local
+function vertex_reader(buf, stride, norm_offset, tex_offset)
+    local verts = buf:view("vec3", 0, stride)
+    local normals = norm_offset and buf:view("vec3", norm_offset, stride)
+    local uvs = tex_offset and buf:view("vec2", tex_offset, stride)
+    return function(i)
+        local s = tostring(verts[i])
+        if normals then
+            s = s.." "..tostring(normals[i])
+        end
+        if uvs then
+            s = s.." "..tostring(uvs[i])
+        end
+        return s
+    end, #verts
+end
+
+-- Returns a sorted list of the triangles in the model, each as a string
+-- of its corners in order.
+local
+function obj_triangles(filename, indexed)
+    local buf, stride, norm_offset, tex_offset, elems = am.load_obj(filename, indexed)
+    local vertex, num_verts = vertex_reader(buf, stride, norm_offset, tex_offset)
+    local tris = {}
+    local n = elems and #elems or num_verts
+    for i = 1, n, 3 do
+        local corners = {}
+        for k = 0, 2 do
+            corners[k + 1] = vertex(elems and elems[i + k] or i + k)
+        end
+        table.insert(tris, table.concat(corners, ", "))
+    end
+    table.sort(tris)
+    return tris, num_verts, n, elems
+end
+
+local
+function same(a, b)
+    if #a ~= #b then
+        return false
+    end
+    for i = 1, #a do
+        if a[i] ~= b[i] then
+            return false
+        end
+    end
+    return true
+end
+
+-- indexed output has the same triangles as non-indexed output
+for _, file in ipairs{"models/grid.obj", "models/quad.obj"} do
+    local tris, num_verts = obj_triangles(file)
+    local itris, num_iverts, num_elems, elems = obj_triangles(file, true)
+    print(file..": "..num_verts.." vertices, "..num_iverts.." indexed vertices, "
+        ..num_elems.." "..am.type(elems).." elements, same triangles: "..tostring(same(tris, itris)))
+end
+
+-- relative indices
+print("negative indices same as positive: "..tostring(
+    same(obj_triangles("models/quad.obj"), obj_triangles("models/quad_negative.obj")) and
+    same(obj_triangles("models/quad.obj", true), obj_triangles("models/quad_negative.obj", true))))
+
+-- a missing value is read as 0 and doesn't consume the next line
+local buf, stride, norm_offset, tex_offset = am.load_obj("models/missing_value.obj")
+local vertex, num_verts = vertex_reader(buf, stride, norm_offset, tex_offset)
+for i = 1, num_verts do
+    print(vertex(i))
+end
+
+-- a small GLB file
+local
+function view_values(view)
+    local vals = {}
+    for i = 1, #view do
+        vals[i] = tostring(view[i])
+    end
+    return am.type(view).."{"..table.concat(vals, ", ").."}"
+end
+
+local model = am.load_glb("models/triangle.glb")
+print("buffer size: "..#model.buffer)
+for m, mesh in ipairs(model.meshes) do
+    print("mesh "..m..": "..mesh.name)
+    for p, prim in ipairs(mesh.primitives) do
+        print("  primitive "..p..": "..prim.mode..", material "..tostring(prim.material))
+        local names = {}
+        for name in pairs(prim.attributes) do
+            table.insert(names, name)
+        end
+        table.sort(names)
+        for _, name in ipairs(names) do
+            print("    "..name..": "..view_values(prim.attributes[name]))
+        end
+        print("    elements: "..(prim.elements and view_values(prim.elements) or "nil"))
+    end
+end
+-- views refer to the file's buffer, except for widened byte indices
+local prim = model.meshes[1].primitives[1]
+print(prim.attributes.POSITION.buffer == model.buffer, prim.elements.buffer == model.buffer,
+    model.meshes[1].primitives[2].elements.buffer == model.buffer)
+-- views of the same accessor are shared
+print(prim.attributes.POSITION == model.meshes[1].primitives[3].attributes.POSITION)
+for i, node in ipairs(model.nodes) do
+    print("node "..i..": "..node.name..", mesh "..tostring(node.mesh)
+        ..", children {"..table.concat(node.children, ", ").."}")
+    print(node.transform)
+end
+print("roots: {"..table.concat(model.roots, ", ").."}")
+print("material: "..model.gltf.materials[1].name)
+
+-- bad files
+for _, file in ipairs{"models/truncated.glb", "models/accessor_out_of_range.glb",
+    "models/view_out_of_range.glb", "models/quad.obj"}
+do
+    print(pcall(am.load_glb, file))
+end
@@ -0,0 +1,82 @@
+-- cacheable entries are at most a quarter of the cache, so this fits
+-- four of the 2000 byte entries
+local pkg = am._open_package("tests/packages/test.zip", 8000)
+
+local
+function show_cache()
+    local names, bytes = pkg:cache()
+    print("cache: {"..table.concat(names, ", ").."} "..bytes.." bytes")
+end
+
+local
+function check(name)
+    local data, err = pkg:read(name)
+    if data == nil then
+        print(name, err)
+    elseif #data > 20 then
+        print(name, #data.." bytes", data:sub(1, 6))
+    else
+        print(name, (data:gsub("\n", "\\n")))
+    end
+end
+
+print("lookup")
+check("stored.txt")
+check("dir/nested.txt")
+check("empty.txt")
+-- the first of two entries with the same name wins
+check("a.txt")
+check("missing.txt")
+check("dir")
+check("nested.txt")
+print(pkg:exists("dir/nested.txt"), pkg:exists("dir/nested"), pkg:exists(""))
+-- enough entries that some share hash slots
+local all_ok = true
+for i = 1, 40 do
+    local name = string.format("files/%02d.txt", i)
+    if pkg:read(name) ~= "file "..i.."\n" then
+        print("wrong data for "..name)
+        all_ok = false
+    end
+end
+print("40 files ok: "..tostring(all_ok))
+
+print("lru")
+pkg:close()
+pkg = am._open_package("tests/packages/test.zip", 8000)
+show_cache()
+-- stored entries are read from the mapping, so aren't cached
+check("stored.txt")
+show_cache()
+for _, c in ipairs{"a", "b", "c", "d"} do
+    check(c..".txt")
+end
+show_cache()
+-- a hit moves the entry to the front
+check("a.txt")
+show_cache()
+-- evicts the least recently used
+check("e.txt")
+show_cache()
+-- too big to cache
+check("big.txt")
+show_cache()
+-- pinned entries aren't evicted, even when least recently used
+print(#pkg:pin("d.txt"))
+check("e.txt")
+check("a.txt")
+check("c.txt")
+show_cache()
+check("f.txt")
+show_cache()
+pkg:unpin("d.txt")
+check("g.txt")
+show_cache()
+-- pinning an uncached entry caches it
+print(#pkg:pin("b.txt"))
+show_cache()
+pkg:unpin("b.txt")
+print(pcall(pkg.unpin, pkg, "b.txt"))
+pkg:close()
+print(pcall(pkg.read, pkg, "a.txt"))
+print(pcall(am._open_package, "tests/packages/missing.zip"))
@@ -0,0 +1,78 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+-- Returns the complete scopes recorded on the main thread, in the
+-- order they ended.
+local
+function main_thread_scopes(json)
+    local scopes = {}
+    for name, ts, dur in json:gmatch('{"name":"([^"]*)","cat":"[^"]*","ph":"X","ts":([%d%.]+),"dur":([%d%.]+),"pid":1,"tid":1}') do
+        ts, dur = tonumber(ts), tonumber(dur)
+        table.insert(scopes, {name = name, start = ts, stop = ts + dur})
+    end
+    return scopes
+end
+
+local
+function named(scopes, name)
+    local list = {}
+    for _, s in ipairs(scopes) do
+        if s.name == name then table.insert(list, s) end
+    end
+    return list
+end
+
+local
+function inside(inner, outers)
+    for _, outer in ipairs(outers) do
+        if inner.start >= outer.start and inner.stop <= outer.stop then
+            return true
+        end
+    end
+    return false
+end
+
+local
+function disjoint(list)
+    table.sort(list, function(a, b) return a.start < b.start end)
+    for i = 2, #list do
+        if list[i].start < list[i - 1].stop then return false end
+    end
+    return true
+end
+
+local scene = am.group()
+win.scene = scene
+
+local failing_line = debug.getinfo(1, "l").currentline + 1
+local failing = am.group():action("failing", function() error("boom") end)
+local after = am.group():action("after", function() end)
+
+local frame = 0
+scene:action("driver", function()
+    frame = frame + 1
+    if frame == 1 then
+        am.profiler.start()
+    elseif frame == 3 then
+        local ok, msg = pcall(failing.update, failing)
+        print("error re-raised: "..tostring(not ok and msg:match("boom") ~= nil))
+        print("traceback starts in the failing action: "..tostring(msg:match("traceback:%s*test_profiler.lua:"..failing_line..":") ~= nil))
+        -- the error screen replaced the scene
+        win.scene = scene
+        after:update()
+    elseif frame == 6 then
+        local json = am.profiler.dump()
+        print("thread names: "..tostring(json:match('"args":{"name":"main"}') ~= nil))
+        local scopes = main_thread_scopes(json)
+        local actions = named(scopes, "actions")
+        local drivers = named(scopes, "driver")
+        local failed = named(scopes, "failing")
+        local afters = named(scopes, "after")
+        print("actions scopes don't overlap: "..tostring(#actions >= 4 and disjoint(actions)))
+        print("driver scopes: "..#drivers)
+        print("driver scopes inside actions: "..tostring(inside(drivers[1], actions)))
+        print("failing and after scopes: "..#failed..", "..#afters)
+        print("failing scope inside driver: "..tostring(inside(failed[1], drivers)))
+        print("failing scope closed before after: "..tostring(failed[1].stop <= afters[1].start))
+        win:close()
+    end
+end)
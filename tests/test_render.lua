@@ -21,6 +21,13 @@ assert(v1[4] == 16)
 
 fb1.clear_color = vec4(0, 0, 0, 1)
 
+if am.null_gl_stats then
+    -- the null GL backend doesn't rasterize, so only clears can be checked
+    win:close()
+    print"ok"
+    return
+end
+
 fb1:clear()
 fb1:render(am.rect(-2, -2, 2, 2, vec4(0, 1, 0, 1)))
 fb1:read_back()
@@ -0,0 +1,93 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+if not am.null_gl_stats then
+    print("skipped (needs a NULL_GL build)")
+    win:close()
+    return
+end
+
+local prog = am.program([[
+    precision mediump float;
+    attribute vec2 vert;
+    uniform mat4 MV;
+    uniform mat4 P;
+    void main() {
+        gl_Position = P * MV * vec4(vert, 0.0, 1.0);
+    }
+]], [[
+    precision mediump float;
+    uniform vec4 color;
+    void main() {
+        gl_FragColor = color;
+    }
+]])
+
+local verts = am.vec2_array{vec2(-1, -1), vec2(1, -1), vec2(0, 1)}
+
+-- read_uniform nodes below a retained node are only updated when
+-- the retained node records them, so they show when that happens.
+local
+function item(x)
+    return am.translate(x, 0)
+        ^ am.read_uniform("MV")
+        ^ am.bind{vert = verts, color = vec4(1)}
+        ^ am.draw("triangles")
+end
+
+local retained = am.retained()
+for i = 1, 5 do
+    retained:append(item(i))
+end
+local parent = am.translate(100, 0)
+win.scene = parent ^ am.use_program(prog) ^ retained
+
+local
+function positions()
+    local xs = {}
+    for i, child in retained:child_pairs() do
+        local mv = child"read_uniform".value
+        table.insert(xs, mv and tostring(mv[4].x) or "nil")
+    end
+    return table.concat(xs, " ")
+end
+
+local steps = {
+    {"initial", function() end},
+    {"unchanged", function() end},
+    {"append child", function()
+        retained:append(item(6))
+    end},
+    {"remove child", function()
+        retained:remove(retained:child(2))
+    end},
+    {"parent transform", function()
+        parent.position2d = vec2(200, 0)
+    end},
+    {"child transform", function()
+        retained:child(1).position2d = vec2(50, 0)
+    end},
+    {"add descendant", function()
+        retained:child(3)"bind":append(am.draw("triangles"))
+    end},
+    {"remove all", function()
+        retained:remove_all()
+    end},
+}
+
+local step = 0
+local prev
+win.scene:action(function()
+    local stats = am.null_gl_stats()
+    if prev then
+        local name = steps[step][1]
+        local frames = stats.frames - prev.frames
+        print(name..": "..((stats.draw_calls - prev.draw_calls) / frames).." draws per frame, MV x: "..positions())
+    end
+    prev = stats
+    step = step + 1
+    if step > #steps then
+        win:close()
+        return
+    end
+    steps[step][2]()
+end)
@@ -0,0 +1,77 @@
+local win = am.window({title = "test", width = 100, height = 100, depth_buffer = true})
+
+if not am.null_gl_stats then
+    print("skipped (needs a NULL_GL build)")
+    win:close()
+    return
+end
+
+local vshader = [[
+    precision mediump float;
+    attribute vec2 vert;
+    uniform mat4 MV;
+    uniform mat4 P;
+    void main() {
+        gl_Position = P * MV * vec4(vert, 0.0, 1.0);
+    }
+]]
+local prog1 = am.program(vshader, [[
+    precision mediump float;
+    void main() {
+        gl_FragColor = vec4(1.0);
+    }
+]])
+local prog2 = am.program(vshader, [[
+    precision mediump float;
+    void main() {
+        gl_FragColor = vec4(0.5);
+    }
+]])
+
+local verts = am.vec2_array{vec2(-1, -1), vec2(1, -1), vec2(0, 1)}
+
+-- Draws alternate between two programs, so sorting them by program
+-- halves the number of program binds.
+local
+function scene(wrap)
+    local retained = am.retained()
+    for i = 1, 6 do
+        local prog = i % 2 == 0 and prog1 or prog2
+        retained:append(am.translate(i, 0)
+            ^ am.use_program(prog)
+            ^ am.bind{vert = verts}
+            ^ am.draw("triangles"))
+    end
+    return wrap(retained)
+end
+
+local cases = {
+    {"less", function(n) return am.depth_test("less") ^ n end},
+    {"greater", function(n) return am.depth_test("greater") ^ n end},
+    {"lequal", function(n) return am.depth_test("lequal") ^ n end},
+    {"equal", function(n) return am.depth_test("equal") ^ n end},
+    {"always", function(n) return am.depth_test("always") ^ n end},
+    {"less without depth writes", function(n) return am.depth_test("less", false) ^ n end},
+    {"less with color mask", function(n) return am.depth_test("less") ^ am.color_mask(true, true, true, false) ^ n end},
+    {"less with blending", function(n) return am.depth_test("less") ^ am.blend("alpha") ^ n end},
+}
+
+local c = 0
+local prev
+local driver = am.group()
+win.scene = driver
+driver:action(function()
+    local stats = am.null_gl_stats()
+    if prev then
+        local frames = stats.frames - prev.frames
+        print(cases[c][1]..": "..((stats.program_binds - prev.program_binds) / frames).." program binds per frame")
+    end
+    prev = stats
+    c = c + 1
+    if c > #cases then
+        win:close()
+        return
+    end
+    driver:remove_all()
+    driver:append(scene(cases[c][2]))
+end)
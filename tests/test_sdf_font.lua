@@ -0,0 +1,109 @@
+-- Packs tests/sdf_test.ttf with the -sdf option and checks the font
+-- fields, the stored distances and the text node that draws the font.
+-- The font's units are 1/1000 em. I is the rectangle (100, 0)-(500, 700)
+-- and O is the rectangle (100, 0)-(800, 700) with a (300, 200)-(600, 500)
+-- hole, so at 32px I's left edge is 3.2 pixels into its glyph.
+
+local win = am.window({title = "test", width = 100, height = 100})
+
+local exe = am.app_base_dir.."amulet"..(am.platform == "windows" and ".exe" or "")
+local tmp = os.tmpname()
+local png, lua = tmp..".png", tmp..".lua"
+
+local
+function pack(opts)
+    local cmd = string.format('"%s" pack %s -png "%s" -lua "%s" tests/sdf_test.ttf@32:I-I,O-O',
+        exe, opts, png, lua)
+    local res = os.execute(cmd)
+    assert(res == 0 or res == true, "pack failed: "..cmd)
+    local f = io.open(lua, "r")
+    local src = f:read("*a")
+    f:close()
+    return src
+end
+
+local
+function glyph_pixels(img, chr)
+    local w, h = img.width, img.height
+    local x1, y1 = chr.s1 * w, chr.t1 * h
+    return math.floor(x1 + 0.5), math.floor(y1 + 0.5),
+        math.floor((chr.s2 - chr.s1) * w + 0.5), math.floor((chr.t2 - chr.t1) * h + 0.5)
+end
+
+-- The distance field is stored in the alpha channel.
+local
+function alpha_at(img, x, y)
+    return img.buffer:view("ubyte", 3, 4)[y * img.width + x + 1]
+end
+
+local
+function row(img, chr, y)
+    local x0, y0, gw, gh = glyph_pixels(img, chr)
+    local vals = {}
+    for x = 0, gw - 1 do
+        table.insert(vals, alpha_at(img, x0 + x, y0 + (y or math.floor(gh / 2))))
+    end
+    return vals
+end
+
+local
+function check_distances(name, opts, range)
+    local src = pack(opts)
+    print(name..":")
+    print("  sdf = "..tostring(src:match("sdf = (%a+)")))
+    print("  distance_range = "..tostring(src:match("distance_range = (%d+)")))
+    local font_data = loadstring(src:gsub("return am._init_fonts.*$", "return font_data"))()
+    local chars = font_data[1].chars
+    local img = am.load_image("@"..png)
+
+    local I = row(img, chars[73])
+    print("  I middle row: "..table.concat(I, " "))
+    -- away from the edges the distance is clamped, and across the
+    -- edges it changes by 255 / range per pixel
+    local step = I[4] - I[3]
+    print("  step per pixel near the edge is 255 / range: "..tostring(math.abs(step - 255 / range) <= 2))
+    local x0, y0, gw, gh = glyph_pixels(img, chars[73])
+    print("  I border is outside: "..tostring(alpha_at(img, x0, y0) == 0 and alpha_at(img, x0 + gw - 1, y0 + gh - 1) == 0))
+    print("  I center is inside: "..tostring(alpha_at(img, x0 + math.floor(gw / 2), y0 + math.floor(gh / 2)) == 255))
+
+    -- O's middle row crosses the ring twice, with the hole between
+    -- (the ring is thinner than range 8, so is only inside past the
+    -- 128 edge value, not clamped to 255)
+    local O = row(img, chars[79])
+    local runs, inside = 0, false
+    for _, a in ipairs(O) do
+        if a >= 128 and not inside then runs = runs + 1 end
+        inside = a >= 128
+    end
+    print("  O middle row inside runs: "..runs)
+    print("  O hole is outside: "..tostring(O[math.floor(#O / 2) + 1] == 0))
+end
+
+check_distances("default range", "-sdf", 4)
+check_distances("range 8", "-sdf -sdf-range 8", 8)
+
+local src = pack("")
+print("without -sdf: sdf field "..(src:match("sdf =") and "present" or "absent"))
+
+-- am.text draws distance field fonts with the sdf shader ("@" makes
+-- the texture load from the absolute path rather than the data dir)
+src = pack("-sdf")
+local font = loadstring(src:gsub('am._init_fonts%(font_data, "[^"]*"%)',
+    function() return string.format("am._init_fonts(font_data, %q)", "@"..png) end))().sdf_test32
+print("font.sdf = "..tostring(font.sdf)..", font.distance_range = "..font.distance_range)
+local node = am.text(font, "IO")
+print("program is sdf_texturecolor2d: "..tostring(node"use_program".program == am.shaders.sdf_texturecolor2d))
+print("blend mode: "..node"blend".mode)
+local tex = font.texture
+print("sdf_unit_range: "..tostring(node"bind".sdf_unit_range == vec2(4 / tex.width, 4 / tex.height)))
+node.text = "OIO"
+print("set_text keeps the program: "..tostring(node"use_program".program == am.shaders.sdf_texturecolor2d))
+local fb = am.framebuffer(am.texture2d(64))
+local draws = am.perf_stats().frame_draw_calls
+fb:render(am.bind{P = math.ortho(-32, 32, -32, 32)} ^ node)
+print("draw calls: "..(am.perf_stats().frame_draw_calls - draws))
+
+os.remove(png)
+os.remove(lua)
+os.remove(tmp)
+win:close()
@@ -0,0 +1,115 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+if not am.null_gl_stats then
+    print("skipped (needs a NULL_GL build)")
+    win:close()
+    return
+end
+
+local rand = am.rand(4321)
+
+local img = [[
+.W.
+WWW
+.W.
+]]
+
+local
+function object()
+    local x = rand(-50, 50)
+    local y = rand(-50, 50)
+    local rect = am.rect(-4, -4, 4, 4, vec4(rand(), rand(), rand(), 1))
+    local sprite = am.sprite(img)
+    return am.translate(x, y) ^ am.rotate(rand() * math.pi) ^ am.group{
+        am.pass(1) ^ rect,
+        am.pass(rand(2, 3)) ^ am.blend("add") ^ sprite,
+        am.pass(4) ^ am.group{rect, sprite},
+    }
+end
+
+local
+function objects(n)
+    local group = am.group()
+    for i = 1, n do
+        group:append(object())
+    end
+    return group
+end
+
+local scenes = {
+    {"per object passes", function()
+        return objects(50)
+    end},
+    {"nested passes", function()
+        return am.pass(1, 2, 3) ^ am.group{
+            objects(10),
+            am.pass(2) ^ am.translate(5, 5) ^ objects(10),
+            am.pass(3, 4) ^ objects(10),
+        }
+    end},
+    {"retained", function()
+        return am.group{am.retained() ^ objects(30), objects(10)}
+    end},
+    {"batch", function()
+        return am.batch"vert" ^ objects(30)
+    end},
+    {"batch above retained", function()
+        return am.batch"vert" ^ am.retained() ^ objects(30)
+    end},
+    {"passes above batch", function()
+        return am.group{
+            am.pass(1) ^ am.batch"vert" ^ objects(10),
+            am.pass(2) ^ am.batch"vert" ^ objects(10),
+        }
+    end},
+}
+
+local
+function counts(stats, prev)
+    local frames = stats.frames - prev.frames
+    return string.format("%g draws, %g program binds, %g state changes",
+        (stats.draw_calls - prev.draw_calls) / frames,
+        (stats.program_binds - prev.program_binds) / frames,
+        (stats.state_changes - prev.state_changes) / frames)
+end
+
+-- Each scene is rendered with one traversal per pass and then with a
+-- single traversal. Each mode gets a frame to settle before the frames
+-- that are counted.
+local steps = {}
+for _, scene in ipairs(scenes) do
+    local name, create = scene[1], scene[2]
+    local node
+    table.insert(steps, function()
+        node = create()
+        win.scene:remove_all()
+        win.scene:append(node)
+        am.set_single_traversal(false)
+    end)
+    local multi
+    table.insert(steps, function(stats) multi = stats end)
+    table.insert(steps, function(stats, prev)
+        multi = counts(stats, multi)
+        am.set_single_traversal(true)
+    end)
+    local single
+    table.insert(steps, function(stats) single = stats end)
+    table.insert(steps, function(stats)
+        single = counts(stats, single)
+        print(name..":")
+        print("  multi-pass:       "..multi)
+        print("  single traversal: "..single)
+        print("  "..(multi == single and "same" or "DIFFERENT"))
+    end)
+end
+
+win.scene = am.group()
+local step = 0
+win.scene:action(function()
+    step = step + 1
+    if step > #steps then
+        win:close()
+        return
+    end
+    steps[step](am.null_gl_stats())
+end)
@@ -0,0 +1,142 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+local newline = string.byte("\n")
+local space = string.byte(" ")
+
+-- Reference layout (the original Lua implementation).
+local
+function lua_layout(font, str, halign, valign)
+    local chars = font.chars
+    local lh = font.line_height
+    local row_widths = {0}
+    local max_width = 0
+    local h = lh
+    local row = 1
+    for p, c in utf8.codes(str) do
+        if c == newline then
+            h = h + lh
+            row = row + 1
+            row_widths[row] = 0
+        else
+            local char_data = chars[c] or chars[0] or chars[space]
+            local w = row_widths[row] + char_data.advance
+            row_widths[row] = w
+            if w > max_width then
+                max_width = w
+            end
+        end
+    end
+    local function row_x(row)
+        if halign == "center" then
+            return -math.floor(row_widths[row] / 2)
+        elseif halign == "right" then
+            return -row_widths[row]
+        else
+            return 0
+        end
+    end
+    row = 1
+    local x = row_x(row)
+    local y
+    if valign == "center" then
+        y = math.floor(h / 2) - lh
+    elseif valign == "bottom" then
+        y = h - lh
+    else
+        y = -lh
+    end
+    local verts = {}
+    local uvs = {}
+    for p, c in utf8.codes(str) do
+        local char_data, x1, y1, x2, y2, advance
+        if c == newline then
+            y = y - lh
+            x1, y1, x2, y2 = 0, 0, 0, 0
+            char_data = chars[space]
+            advance = 0
+            row = row + 1
+            x = row_x(row)
+        else
+            char_data = chars[c] or chars[0] or chars[space]
+            x1, y1, x2, y2 = char_data.x1, char_data.y1, char_data.x2, char_data.y2
+            advance = char_data.advance
+        end
+        local s1, t1, s2, t2 = char_data.s1, char_data.t1, char_data.s2, char_data.t2
+        for _, v in ipairs{x + x1, y + y2, x + x1, y + y1, x + x2, y + y1, x + x2, y + y2} do
+            table.insert(verts, v)
+        end
+        for _, v in ipairs{s1, t2, s1, t1, s2, t1, s2, t2} do
+            table.insert(uvs, v)
+        end
+        x = x + advance
+    end
+    return verts, uvs, max_width, h
+end
+
+local
+function compare_view(view, expected, n)
+    for i = 1, n do
+        local v = view[i]
+        local ex, ey = expected[i * 2 - 1], expected[i * 2]
+        if math.abs(v.x - ex) > 1e-5 or math.abs(v.y - ey) > 1e-5 then
+            return false
+        end
+    end
+    return true
+end
+
+local
+function check(name, font, str, halign, valign, node)
+    node = node or am.text(font, str, halign, valign)
+    local verts, uvs, w, h = lua_layout(font, str, halign, valign)
+    local n = #verts / 2
+    local ok = w == node.width and h == node.height
+        and compare_view(node"bind".vert, verts, n)
+        and compare_view(node"bind".uv, uvs, n)
+    print(name..": "..(ok and "ok" or "MISMATCH").." "..node.width.."x"..node.height)
+end
+
+-- default font, which has no glyph 0, so missing glyphs fall back to space
+for _, a in ipairs{{"left", "top"}, {"center", "center"}, {"right", "bottom"}} do
+    local halign, valign = a[1], a[2]
+    am.text("init") -- make sure the default font is loaded
+    local font = am.default_font
+    check("default "..halign.."/"..valign, font, "Hello, world!", halign, valign)
+    check("default multiline "..halign.."/"..valign, font, "one\ntwo lines\n\nfour", halign, valign)
+    check("default missing "..halign.."/"..valign, font, "a中b", halign, valign)
+end
+
+-- custom font with a glyph 0 and varying glyph sizes
+local
+function glyph(w, h, s)
+    return {x1 = 0, y1 = -1, x2 = w, y2 = h - 1, s1 = s, t1 = 0, s2 = s + 0.1, t2 = 0.5, advance = w + 1,
+        width = w, height = h}
+end
+local chars = {
+    [0] = glyph(5, 9, 0.0),
+    [space] = glyph(3, 1, 0.1),
+    [string.byte("a")] = glyph(6, 8, 0.2),
+    [string.byte("b")] = glyph(7, 11, 0.3),
+    [string.byte("c")] = glyph(4, 6, 0.4),
+}
+local font = {is_font = true, is_premult = false, line_height = 12, chars = chars,
+    texture = am.default_font.texture}
+check("custom", font, "abc cab", "center", "center")
+check("custom multiline", font, "ab\nc\nabcabc", "right", "top")
+check("custom missing", font, "a?b\nzz", "left", "bottom")
+
+-- replacing the font's chars is picked up by existing and new nodes
+local node = am.text(font, "abc", "left", "bottom")
+local chars2 = {}
+for c, g in pairs(chars) do
+    chars2[c] = glyph(g.width * 2, g.height, g.s1)
+end
+font.chars = chars2
+check("new chars", font, "abc", "left", "bottom")
+node.text = "cab"
+check("new chars set_text", font, "cab", "left", "bottom", node)
+font.line_height = 20
+node.text = "ab\nc"
+check("new line height set_text", font, "ab\nc", "left", "bottom", node)
+
+win:close()
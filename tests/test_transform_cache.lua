@@ -0,0 +1,51 @@
+-- Transform nodes reuse their matrices between frames. This checks that
+-- changing a parent still moves its descendants, by culling a child that
+-- is moved out of view (the window shows -50 to 50 in x and y).
+
+local win = am.window({title = "test", width = 100, height = 100})
+
+local child = am.translate(40, 40)
+local sphere = am.cull_sphere(1) ^ am.rect(-1, -1, 1, 1)
+local bind = am.bind{MV = mat4(1)}
+local parent_translate = am.translate(0, 0)
+local parent_scale = am.scale(1)
+local parent_rotate = am.rotate(0)
+local parent_transform = am.transform(mat4(1))
+
+win.scene = bind ^ parent_translate ^ parent_scale ^ parent_rotate
+    ^ parent_transform ^ am.group{am.translate(0, 0) ^ child ^ sphere}
+
+local steps = {
+    {"initial", function() end},
+    {"translate parent out", function() parent_translate.position2d = vec2(20, 0) end},
+    {"translate parent back", function() parent_translate.position2d = vec2(0, 0) end},
+    {"scale parent out", function() parent_scale.scale2d = vec2(2) end},
+    {"scale parent back", function() parent_scale.scale2d = vec2(1) end},
+    {"rotate parent out", function() parent_rotate.angle = math.pi / 4 end},
+    {"rotate parent back", function() parent_rotate.angle = 0 end},
+    {"transform parent out", function() parent_transform.mat = math.translate4(20, 0, 0) end},
+    {"transform parent back", function() parent_transform.mat = mat4(1) end},
+    {"bind MV out", function() bind.MV = math.translate4(-100, 0, 0) end},
+    {"bind MV back", function() bind.MV = mat4(1) end},
+    {"move child out", function() child.position2d = vec2(60, 0) end},
+    {"move child back", function() child.position2d = vec2(40, 40) end},
+}
+
+-- Each change is rendered for a couple of frames, so later frames use
+-- the cached matrices, before the draw calls are checked.
+local step = 0
+local frame = 0
+win.scene:action(function()
+    frame = frame + 1
+    if frame % 3 == 1 then
+        step = step + 1
+        if step > #steps then
+            win:close()
+            return
+        end
+        steps[step][2]()
+    elseif frame % 3 == 0 then
+        local draws = am.perf_stats().frame_draw_calls
+        print(steps[step][1]..": "..(draws > 0 and "visible" or "culled"))
+    end
+end)
@@ -0,0 +1,94 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+if not am.null_gl_stats then
+    print("skipped (needs a NULL_GL build)")
+    win:close()
+    return
+end
+
+local vshader = [[
+    attribute vec2 vert;
+    uniform mat4 MV;
+    uniform mat4 P;
+    void main() {
+        gl_Position = P * MV * vec4(vert, 0.0, 1.0);
+    }
+]]
+local fshader = [[
+    precision mediump float;
+    uniform vec4 color;
+    void main() {
+        gl_FragColor = color;
+    }
+]]
+local prog = am.program(vshader, fshader)
+local verts = am.vec2_array{vec2(-1, -1), vec2(1, -1), vec2(0, 1)}
+
+local
+function objects(n, spread)
+    local group = am.group()
+    for i = 1, n do
+        group:append(am.translate(spread and i or 0, 0)
+            ^ am.draw("triangles"))
+    end
+    return am.use_program(prog)
+        ^ am.bind{P = mat4(1), color = vec4(1, 0, 0, 1), vert = verts}
+        ^ group
+end
+
+local scenes = {
+    {"same transform", false, function()
+        return objects(10, false)
+    end},
+    {"different transforms", false, function()
+        return objects(10, true)
+    end},
+    {"color changed each update", true, function()
+        local node = objects(10, false)
+        local bind = node"bind"
+        local red = 0
+        node:action(function()
+            red = (red + 0.01) % 1
+            bind.color = vec4(red, 0, 0, 1)
+        end)
+        return node
+    end},
+}
+
+-- The null GL backend renders many frames per update, so a uniform
+-- changed from an action is counted per update rather than per frame.
+local
+function counts(stats, prev, per_update)
+    local uploads = stats.uniform_uploads - prev.uniform_uploads
+    local per = per_update and "update" or "frame"
+    local n = per_update and 2 or stats.frames - prev.frames
+    return string.format("%g uploads per %s, %g skipped in the last frame",
+        uploads / n, per, am.perf_stats().frame_uniform_skips)
+end
+
+-- Each scene gets an update to settle before the two that are counted.
+local steps = {}
+for _, scene in ipairs(scenes) do
+    local name, per_update, create = scene[1], scene[2], scene[3]
+    local start
+    table.insert(steps, function()
+        win.scene:remove_all()
+        win.scene:append(create())
+    end)
+    table.insert(steps, function(stats) start = stats end)
+    table.insert(steps, function() end)
+    table.insert(steps, function(stats)
+        print(name..": "..counts(stats, start, per_update))
+    end)
+end
+
+win.scene = am.group()
+local step = 0
+win.scene:action(function()
+    step = step + 1
+    if step > #steps then
+        win:close()
+        return
+    end
+    steps[step](am.null_gl_stats())
+end)
@@ -0,0 +1,93 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+local vshader = [[
+    attribute vec2 vert;
+    void main() {
+        gl_Position = vec4(vert, 0.0, 1.0);
+    }
+]]
+local fshader = [[
+    precision mediump float;
+    void main() {
+        gl_FragColor = vec4(1.0);
+    }
+]]
+local prog = am.program(vshader, fshader)
+local fb = am.framebuffer(am.texture2d(16))
+
+local
+function draw(...)
+    local group = am.group()
+    for _, verts in ipairs{...} do
+        group:append(am.bind{vert = verts} ^ am.draw("triangles"))
+    end
+    return am.use_program(prog) ^ group
+end
+
+-- Renders node and returns the bytes uploaded and the stalls it caused.
+local
+function render(node)
+    local stats = am.perf_stats()
+    local bytes, stalls = stats.frame_upload_bytes, stats.frame_vbo_stalls
+    fb:render(node)
+    stats = am.perf_stats()
+    return stats.frame_upload_bytes - bytes, stats.frame_vbo_stalls - stalls
+end
+
+local
+function print_renders(name, n, node, update)
+    print(name..":")
+    for i = 1, n do
+        if update then update(i) end
+        print("  "..table.concat({render(node)}, " bytes, ").." stalls")
+    end
+end
+
+local
+function vec2s(n, usage)
+    local buf = am.buffer(n * 8)
+    if usage then buf.usage = usage end
+    return buf:view("vec2")
+end
+
+-- only the first render uploads a static buffer
+local static = vec2s(1000)
+print_renders("static", 2, draw(static))
+
+-- updating a buffer every frame cycles through its vbo slots, so
+-- the updates never stall
+local dynamic = vec2s(1000)
+print_renders("dynamic", 6, draw(dynamic), function(i)
+    dynamic[10] = vec2(i)
+end)
+
+-- stream buffers are copied to the stream ring when updated
+local stream = vec2s(1000, "stream")
+print_renders("stream", 3, draw(stream), function(i)
+    if i < 3 then stream[10] = vec2(i) end
+end)
+
+-- three 1MB stream buffers fit in the ring, so they aren't uploaded
+-- again unless they change
+local fits = {}
+for i = 1, 3 do fits[i] = vec2s(128 * 1024, "stream") end
+print_renders("3MB of stream buffers", 2, draw(unpack(fits)))
+
+-- five don't, so the ring wraps around every frame and buffers
+-- uploaded before the wrap are uploaded again
+local wraps = {}
+for i = 1, 5 do wraps[i] = vec2s(128 * 1024, "stream") end
+print_renders("5MB of stream buffers", 2, draw(unpack(wraps)))
+
+-- a buffer that is both vertex data and a framebuffer's image buffer
+-- can be updated twice in one frame, which stalls
+local ib = am.image_buffer(4)
+local verts = ib.buffer:view("vec2")
+local fb2 = am.framebuffer(am.texture2d(ib))
+print_renders("updated twice in a frame", 3, draw(verts), function(i)
+    verts[1] = vec2(i)
+    fb2:read_back()
+    verts[1] = vec2(-i)
+end)
+
+win:close()
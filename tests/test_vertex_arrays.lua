@@ -0,0 +1,134 @@
+local win = am.window({title = "test", width = 100, height = 100})
+
+if not am.null_gl_stats then
+    print("skipped (needs a NULL_GL build)")
+    win:close()
+    return
+end
+
+local prog = am.program([[
+    precision mediump float;
+    attribute vec2 vert;
+    attribute vec4 color;
+    uniform mat4 MV;
+    uniform mat4 P;
+    varying vec4 v_color;
+    void main() {
+        v_color = color;
+        gl_Position = P * MV * vec4(vert, 0.0, 1.0);
+    }
+]], [[
+    precision mediump float;
+    varying vec4 v_color;
+    void main() {
+        gl_FragColor = v_color;
+    }
+]])
+
+local inst_prog = am.program([[
+    precision mediump float;
+    attribute vec2 vert;
+    attribute vec2 offset;
+    attribute vec4 color;
+    uniform mat4 MV;
+    uniform mat4 P;
+    varying vec4 v_color;
+    void main() {
+        v_color = color;
+        gl_Position = P * MV * vec4(vert + offset, 0.0, 1.0);
+    }
+]], [[
+    precision mediump float;
+    varying vec4 v_color;
+    void main() {
+        gl_FragColor = v_color;
+    }
+]])
+
+local
+function triangle(usage)
+    local buf = am.buffer(3 * 24)
+    buf.usage = usage or "static"
+    local verts = buf:view("vec2", 0, 24)
+    local colors = buf:view("vec4", 8, 24)
+    verts:set{vec2(-1, -1), vec2(1, -1), vec2(0, 1)}
+    colors:set(vec4(1))
+    return verts, colors
+end
+
+local
+function meshes(n, usage)
+    local group = am.group()
+    for i = 1, n do
+        local verts, colors = triangle(usage)
+        group:append(am.translate(i, 0) ^ am.bind{vert = verts, color = colors} ^ am.draw"triangles")
+    end
+    return am.use_program(prog) ^ group
+end
+
+local shared_verts, shared_colors = triangle()
+
+local steps = {
+    {"static", function()
+        return meshes(20)
+    end},
+    {"shared arrays", function()
+        local group = am.group()
+        for i = 1, 20 do
+            group:append(am.translate(i, 0) ^ am.draw"triangles")
+        end
+        return am.use_program(prog) ^ am.bind{vert = shared_verts, color = shared_colors} ^ group
+    end},
+    {"stream", function()
+        return meshes(20, "stream")
+    end},
+    {"instanced", function()
+        local offsets = am.vec2_array{vec2(0), vec2(1), vec2(2)}
+        local group = am.group()
+        for i = 1, 20 do
+            group:append(am.draw_instanced("triangles", 3, {offset = offsets}))
+        end
+        return am.use_program(inst_prog) ^ am.bind{vert = shared_verts, color = shared_colors} ^ group
+    end},
+    {"batch", function()
+        return am.batch"vert" ^ meshes(20)
+    end},
+    {"mixed", function()
+        local offsets = am.vec2_array{vec2(0), vec2(1), vec2(2)}
+        return am.group{
+            meshes(10),
+            am.use_program(inst_prog) ^ am.bind{vert = shared_verts, color = shared_colors}
+                ^ am.draw_instanced("triangles", 3, {offset = offsets}),
+            meshes(5, "stream"),
+            meshes(10),
+        }
+    end},
+}
+
+local content = am.group()
+win.scene = content
+local step = 0
+local settled = false
+win.scene:action(function()
+    -- The frame counters in am.perf_stats are for the last frame drawn,
+    -- so a scene is checked the second time the action runs after it's
+    -- set up, by which time it's been drawn at least twice.
+    if step > 0 and not settled then
+        settled = true
+        return
+    end
+    if step > 0 then
+        local stats = am.perf_stats()
+        print(steps[step][1]..": "..stats.frame_draw_calls.." draws, "
+            ..stats.frame_vertex_array_hits.." vao hits, "
+            ..stats.frame_vertex_array_misses.." vao misses")
+    end
+    step = step + 1
+    settled = false
+    if step > #steps then
+        win:close()
+        return
+    end
+    content:remove_all()
+    content:append(steps[step][2]())
+end)
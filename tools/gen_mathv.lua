@@ -51,6 +51,11 @@ local view_type_info = {
     },
 }
 
+-- A variant's simd field is the expression computed by its kernel in
+-- src/am_mathv_simd_impl.inc, used for dense f32 views. For component-wise
+-- functions a, b and c are vectors of the arguments. For element-wise
+-- functions a[k] and b[k] are vectors of component k of the arguments and
+-- the expression sets the output components o[k].
 local func_defs = {
     -- basic functions
     { 
@@ -60,6 +65,7 @@ local func_defs = {
         variants = {
             {
                 cname = "ADD_OP",
+                simd = "vf_add(a, b)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"},
@@ -131,6 +137,7 @@ local func_defs = {
         variants = {
             {
                 cname = "SUB_OP",
+                simd = "vf_sub(a, b)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"},
@@ -201,6 +208,7 @@ local func_defs = {
         variants = {
             {
                 cname = "MUL_OP",
+                simd = "vf_mul(a, b)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"},
@@ -272,6 +280,7 @@ local func_defs = {
         variants = {
             {
                 cname = "DIV_OP",
+                simd = "vf_div(a, b)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"},
@@ -343,6 +352,7 @@ local func_defs = {
         variants = {
             {
                 cname = "F32MOD_OP",
+                simd = "vf_mod(a, b)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"},
@@ -414,6 +424,7 @@ local func_defs = {
         variants = {
             {
                 cname = "powf",
+                simd = "vf_pow(a, b)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"},
@@ -439,6 +450,7 @@ local func_defs = {
         variants = {
             {
                 cname = "UNM_OP",
+                simd = "vf_neg(a)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"},
@@ -503,6 +515,7 @@ local func_defs = {
         variants = {
             {
                 cname = "fabsf",
+                simd = "vf_abs(a)",
                 ret_type = "f32",
                 args = {
                     {name = "val", type = "f32"}
@@ -605,6 +618,7 @@ local func_defs = {
         variants = {
             {
                 cname = "ceilf",
+                simd = "vf_ceil(a)",
                 ret_type = "f32",
                 args = {
                     {name = "val", type = "f32"}
@@ -625,6 +639,7 @@ local func_defs = {
         variants = {
             {
                 cname = "am_clamp",
+                simd = "vf_clamp(a, b, c)",
                 ret_type = "f32",
                 args = {
                     {name = "val", type = "f32"},
@@ -649,6 +664,7 @@ local func_defs = {
         variants = {
             {
                 cname = "cosf",
+                simd = "vf_cos(a)",
                 ret_type = "f32",
                 args = {
                     {name = "angle", type = "f32"}
@@ -669,6 +685,7 @@ local func_defs = {
         variants = {
             {
                 cname = "floorf",
+                simd = "vf_floor(a)",
                 ret_type = "f32",
                 args = {
                     {name = "val", type = "f32"}
@@ -689,6 +706,7 @@ local func_defs = {
         variants = {
             {
                 cname = "glm::fract",
+                simd = "vf_fract(a)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"}
@@ -709,6 +727,7 @@ local func_defs = {
         variants = {
             {
                 cname = "logf",
+                simd = "vf_log(a)",
                 ret_type = "f32",
                 args = {
                     {name = "val", type = "f32"}
@@ -729,6 +748,7 @@ local func_defs = {
         variants = {
             {
                 cname = "am_max",
+                simd = "vf_max(a, b)",
                 ret_type = "f32",
                 args = {
                     {name = "a", type = "f32"},
@@ -751,6 +771,7 @@ local func_defs = {
         variants = {
             {
                 cname = "am_min",
+                simd = "vf_min(a, b)",
                 ret_type = "f32",
                 args = {
                     {name = "a", type = "f32"},
@@ -773,6 +794,7 @@ local func_defs = {
         variants = {
             {
                 cname = "glm::mix",
+                simd = "vf_mix(a, b, c)",
                 ret_type = "f32",
                 args = {
                     {name = "a", type = "f32"},
@@ -797,6 +819,7 @@ local func_defs = {
         variants = {
             {
                 cname = "am_sign",
+                simd = "vf_sign(a)",
                 ret_type = "f32",
                 args = {
                     {name = "x", type = "f32"}
@@ -817,6 +840,7 @@ local func_defs = {
         variants = {
             {
                 cname = "sinf",
+                simd = "vf_sin(a)",
                 ret_type = "f32",
                 args = {
                     {name = "angle", type = "f32"}
@@ -857,6 +881,7 @@ local func_defs = {
         variants = {
             {
                 cname = "LT_OP",
+                simd = "vf_lt(a, b)",
                 ret_type = "u8",
                 args = {
                     {name = "a", type = "f32"},
@@ -927,6 +952,7 @@ local func_defs = {
         variants = {
             {
                 cname = "LTE_OP",
+                simd = "vf_le(a, b)",
                 ret_type = "u8",
                 args = {
                     {name = "a", type = "f32"},
@@ -997,6 +1023,7 @@ local func_defs = {
         variants = {
             {
                 cname = "GT_OP",
+                simd = "vf_gt(a, b)",
                 ret_type = "u8",
                 args = {
                     {name = "a", type = "f32"},
@@ -1067,6 +1094,7 @@ local func_defs = {
         variants = {
             {
                 cname = "GTE_OP",
+                simd = "vf_ge(a, b)",
                 ret_type = "u8",
                 args = {
                     {name = "a", type = "f32"},
@@ -1774,6 +1802,7 @@ local func_defs = {
         variants = {
             {
                 cname = "glm::cross",
+                simd = "vf_cross(a, b, o)",
                 ret_type = "f32",
                 ret_comps = 3,
                 args = {
@@ -1858,6 +1887,7 @@ local func_defs = {
         variants = {
             {
                 cname = "glm::dot",
+                simd = "o[0] = vf_dot2(a, b)",
                 ret_type = "f32",
                 ret_comps = 1,
                 args = {
@@ -1867,6 +1897,7 @@ local func_defs = {
             },
             {
                 cname = "glm::dot",
+                simd = "o[0] = vf_dot3(a, b)",
                 ret_type = "f32",
                 ret_comps = 1,
                 args = {
@@ -1876,6 +1907,7 @@ local func_defs = {
             },
             {
                 cname = "glm::dot",
+                simd = "o[0] = vf_dot4(a, b)",
                 ret_type = "f32",
                 ret_comps = 1,
                 args = {
@@ -1956,6 +1988,7 @@ local func_defs = {
         variants = {
             {
                 cname = "glm::length",
+                simd = "o[0] = vf_sqrt(vf_dot2(a, a))",
                 ret_type = "f32",
                 ret_comps = 1,
                 args = {
@@ -1964,6 +1997,7 @@ local func_defs = {
             },
             {
                 cname = "glm::length",
+                simd = "o[0] = vf_sqrt(vf_dot3(a, a))",
                 ret_type = "f32",
                 ret_comps = 1,
                 args = {
@@ -1972,6 +2006,7 @@ local func_defs = {
             },
             {
                 cname = "glm::length",
+                simd = "o[0] = vf_sqrt(vf_dot4(a, a))",
                 ret_type = "f32",
                 ret_comps = 1,
                 args = {
@@ -2010,6 +2045,7 @@ local func_defs = {
         variants = {
             {
                 cname = "glm::normalize",
+                simd = "vf_normalize(a, 2, vf_dot2(a, a), o)",
                 ret_type = "f32",
                 ret_comps = 2,
                 args = {
@@ -2018,6 +2054,7 @@ local func_defs = {
             },
             {
                 cname = "glm::normalize",
+                simd = "vf_normalize(a, 3, vf_dot3(a, a), o)",
                 ret_type = "f32",
                 ret_comps = 3,
                 args = {
@@ -2026,6 +2063,7 @@ local func_defs = {
             },
             {
                 cname = "glm::normalize",
+                simd = "vf_normalize(a, 4, vf_dot4(a, a), o)",
                 ret_type = "f32",
                 ret_comps = 4,
                 args = {
@@ -2339,6 +2377,78 @@ function get_arg_types(func, except)
     return keys(types)
 end
 
+local simd_kernels = {}
+
+-- Adds the kernel for a variant with a simd expression to the list
+-- written to src/am_mathv_simd_kernels.inc.
+local
+function add_simd_kernel(func, variant)
+    local nargs = #variant.args
+    local kernel = {
+        nargs = nargs,
+        expr = variant.simd,
+    }
+    if func.kind == "element_wise" then
+        kernel.comps = variant.args[1].comps
+        kernel.ret_comps = variant.ret_comps
+        kernel.name = func.name..kernel.comps.."_f32"
+        kernel.kind = "elem"..nargs
+    else
+        kernel.comps = 1
+        kernel.ret_comps = 1
+        kernel.name = func.name.."_f32"
+        if nargs == 1 then
+            kernel.kind = "unary"
+        elseif nargs == 2 then
+            kernel.kind = variant.ret_type == "u8" and "compare" or "binary"
+        elseif nargs == 3 then
+            kernel.kind = "ternary"
+        else
+            error("no simd kernel kind for "..func.name)
+        end
+    end
+    table.insert(simd_kernels, kernel)
+    return kernel
+end
+
+local
+function simd_call_args(kernel, count)
+    local out_ctype = kernel.kind == "compare" and "uint8_t" or "float"
+    local args = "("..out_ctype.."*)output_data"
+    for a = 1, kernel.nargs do
+        args = args..", (const float*)arg_data["..(a-1).."]"
+    end
+    args = args..", "..count
+    if kernel.nargs > 1 then
+        args = args..", loop->simd_bcast"
+    end
+    return args
+end
+
+local
+function has_simd_variant(func)
+    for _, variant in ipairs(func.variants) do
+        if variant.simd then
+            return true
+        end
+    end
+    return false
+end
+
+-- Collects generated code, so the loop functions for a function's
+-- variants can be written before the function itself.
+local
+function new_buffer()
+    local buf = {}
+    function buf:write(str)
+        table.insert(self, str)
+    end
+    function buf:contents()
+        return table.concat(self)
+    end
+    return buf
+end
+
 local gen_funcs
 local gen_func
 local gen_component_wise_func_impl
@@ -2417,20 +2527,25 @@ function gen_component_wise_func_impl(f, func)
         uint8_t *output_data;
         bool args_are_dense;
         bool output_is_dense;
+]]..(has_simd_variant(func) and "        unsigned int simd_bcast = 0;\n" or "")..[[
         component_wise_setup(L, "mathv.]]..func.name..[[", nargs, 
             arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
             &output_count, &output_components, &args_are_dense);
     ]]
+    local loops = new_buffer()
+    local body = new_buffer()
+    for i, variant in ipairs(func.variants) do
+        gen_component_wise_func_variant(body, loops, func, variant, func.name.."_loop"..i)
+    end
+    f:write(loops:contents())
     ind(f, 0, func_decl)
     ind(f, 1, prelude)
-    for _, variant in ipairs(func.variants) do
-        gen_component_wise_func_variant(f, func, variant)
-    end
+    f:write(body:contents())
     ind(f, 1, return_sig_error)
     ind(f, 0, "}\n\n")
 end
 
-function gen_component_wise_func_variant(f, func, variant)
+function gen_component_wise_func_variant(f, loops, func, variant, loop_name)
     local args = variant.args
     local nargs = #args
     local ret_view_type = view_type_info[variant.ret_type].enumval
@@ -2441,13 +2556,14 @@ function gen_component_wise_func_variant(f, func, variant)
             "arg_type["..(i-1).."] != MT_am_buffer_view)"
     end
 
+    variant.loop_name = loop_name
     ind(f, 1, "if ("..sig_test..") {\n")
-    gen_component_wise_inner_loop(f, func, variant)
+    gen_component_wise_inner_loop(f, loops, func, variant, loop_name)
     ind(f, 2, "return 1;\n")
     ind(f, 1, "}\n")
 end
 
-function gen_component_wise_inner_loop(f, func, variant)
+function gen_component_wise_inner_loop(f, loops, func, variant, loop_name)
     local ret_ctype = view_type_info[variant.ret_type].ctype
     local component_size = "sizeof("..ret_ctype..")"
     local setup_dense_arg_arrays = ""
@@ -2473,7 +2589,7 @@ function gen_component_wise_inner_loop(f, func, variant)
         end
     end
     local loop = [[
-    if (output_is_dense && args_are_dense) {
+    if (loop->is_dense) {
         ]]..ret_ctype..[[ *out_arr = (]]..ret_ctype..[[*)output_data;
         ]]..setup_dense_arg_arrays..[[
 
@@ -2495,13 +2611,44 @@ function gen_component_wise_inner_loop(f, func, variant)
     }
     ]]
 
+    local use_simd = "false"
+    local simd_bcast = "0"
+    if variant.simd then
+        local kernel = add_simd_kernel(func, variant)
+        loop = [[
+    if (loop->use_simd) {
+        am_mathv_simd->]]..kernel.name..[[(]]..simd_call_args(kernel, "output_count * output_components")..[[);
+    } else ]]..(loop:gsub("^%s+", ""))
+        use_simd = "use_simd"
+        simd_bcast = "simd_bcast"
+    end
+
+    local nargs = #variant.args
+    ind(loops, 0, [[
+static void ]]..loop_name..[[(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[]]..nargs..[[];
+    uint8_t *output_data = mathv_loop_range(loop, ]]..nargs..[[, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_components = loop->output_components;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+    unsigned int *arg_components = loop->arg_components;
+]])
+    ind(loops, 1, loop)
+    ind(loops, 0, "}\n\n")
+
     for i, arg in ipairs(variant.args) do
         ind(f, 2, "arg_view_type["..(i-1).."] = "..view_type_info[arg.type].enumval..";")
     end
     ind(f, 2, "setup_non_view_args(L, \"mathv."..func.name.."\", nargs, arg_type, arg_view_type, arg_components, arg_singleton_bufs, arg_data);")
     ind(f, 2, "output_view_type = "..view_type_info[variant.ret_type].enumval..";")
     ind(f, 2, "create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);")
-    ind(f, 2, loop)
+    if variant.simd then
+        ind(f, 2, "bool use_simd = output_is_dense && simd_component_wise_args_ok(nargs, arg_type, arg_stride, arg_components, output_components, &simd_bcast);")
+    end
+    ind(f, 2, "run_mathv_loop("..loop_name..", arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,")
+    ind(f, 3, "output_is_dense && args_are_dense, "..use_simd..", "..simd_bcast..");")
 end
 
 function gen_element_wise_func_impl(f, func)
@@ -2532,20 +2679,25 @@ function gen_element_wise_func_impl(f, func)
         unsigned int output_stride;
         uint8_t *output_data;
         bool output_is_dense;
+]]..(has_simd_variant(func) and "        unsigned int simd_bcast = 0;\n" or "")..[[
         element_wise_setup(L, "mathv.]]..func.name..[[", nargs, 
             arg_type, arg_view_type, arg_count, arg_data, arg_stride, arg_components, arg_singleton_bufs, 
             &output_count);
     ]]
+    local loops = new_buffer()
+    local body = new_buffer()
+    for i, variant in ipairs(func.variants) do
+        gen_element_wise_func_variant(body, loops, func, variant, func.name.."_loop"..i)
+    end
+    f:write(loops:contents())
     ind(f, 0, func_decl)
     ind(f, 1, prelude)
-    for _, variant in ipairs(func.variants) do
-        gen_element_wise_func_variant(f, func, variant)
-    end
+    f:write(body:contents())
     ind(f, 1, return_sig_error)
     ind(f, 0, "}\n\n")
 end
 
-function gen_element_wise_func_variant(f, func, variant)
+function gen_element_wise_func_variant(f, loops, func, variant, loop_name)
     local args = variant.args
     local nargs = #args
     local sig_test = "nargs == "..nargs.." "
@@ -2597,16 +2749,83 @@ for (unsigned int i = 0; i < output_count; ++i) {
     ind(f, 2, "output_view_type = "..view_type_info[variant.ret_type].enumval..";")
     ind(f, 2, "output_components = "..ret_components..";\n")
     ind(f, 2, "create_output_view(L, target, output_view_type, &output_count, output_components, &output_stride, &output_data, &output_is_dense);")
-    ind(f, 2, setup_pointers)
-    ind(f, 2, iterate)
+
+    local nargs = #variant.args
+    variant.loop_name = loop_name
+    ind(loops, 0, [[
+static void ]]..loop_name..[[(void *data, unsigned int start, unsigned int end) {
+    mathv_loop *loop = (mathv_loop*)data;
+    uint8_t *arg_data[]]..nargs..[[];
+    uint8_t *output_data = mathv_loop_range(loop, ]]..nargs..[[, start, arg_data);
+    unsigned int output_count = end - start;
+    unsigned int output_stride = loop->output_stride;
+    unsigned int *arg_stride = loop->arg_stride;
+]])
+    local use_simd = "false"
+    local simd_bcast = "0"
+    if variant.simd then
+        local kernel = add_simd_kernel(func, variant)
+        ind(loops, 1, [[
+            if (loop->use_simd) {
+                am_mathv_simd->]]..kernel.name..[[(]]..simd_call_args(kernel, "output_count")..[[);
+                return;
+            }
+        ]])
+        ind(f, 2, "bool use_simd = output_is_dense && simd_element_wise_args_ok(nargs, arg_type, arg_stride, arg_components, &simd_bcast);")
+        use_simd = "use_simd"
+        simd_bcast = "simd_bcast"
+    end
+    ind(loops, 1, setup_pointers)
+    ind(loops, 1, iterate)
+    ind(loops, 0, "}\n\n")
+
+    ind(f, 2, "run_mathv_loop("..loop_name..", arg_data, arg_stride, arg_components, output_count, output_components, output_stride, output_data,")
+    ind(f, 3, "false, "..use_simd..", "..simd_bcast..");")
     ind(f, 2, "return 1;\n")
     ind(f, 1, "}\n")
 end
 
+-- The variants of each function, used to type check and run the
+-- expressions given to mathv.compile.
+local
+function gen_op_table(f)
+    for _, func in ipairs(func_defs) do
+        if func.variants then
+            f:write("static const mathv_op_variant "..func.name.."_variants[] = {\n")
+            for _, variant in ipairs(func.variants) do
+                local args = ""
+                for a, arg in ipairs(variant.args) do
+                    args = args.."{"..view_type_info[arg.type].enumval..", "..(arg.comps or 0).."}"
+                    if a < #variant.args then
+                        args = args..", "
+                    end
+                end
+                f:write("    {"..variant.loop_name..", "..view_type_info[variant.ret_type].enumval..", "..
+                    (variant.ret_comps or 0)..", "..(variant.simd and "true" or "false")..", "..
+                    #variant.args..", {"..args.."}},\n")
+            end
+            f:write("};\n\n")
+        end
+    end
+    f:write("static const mathv_op mathv_ops[] = {\n")
+    for _, func in ipairs(func_defs) do
+        if func.variants then
+            f:write("    {\""..func.name.."\", "..(func.kind == "element_wise" and "true" or "false")..", "..
+                #func.variants..", "..func.name.."_variants},\n")
+        end
+    end
+    f:write([[
+    {NULL, false, 0, NULL}
+};
+
+]])
+end
+
 local
 function gen_open_module_func(f)
     f:write([[
 void am_open_mathv_module(lua_State *L) {
+    am_init_mathv_simd();
     luaL_Reg vfuncs[] = {
         {"range",    am_mathv_range},
         {"random",   am_mathv_random},
@@ -2615,6 +2834,11 @@ void am_open_mathv_module(lua_State *L) {
         {"sum",      am_mathv_sum},
         {"greatest", am_mathv_greatest},
         {"least",    am_mathv_least},
+        {"compile",  am_mathv_compile},
+        {"_supported_simd", am_mathv_supported_simd},
+        {"_set_simd", am_mathv_set_simd},
+        {"_threads", am_mathv_threads},
+        {"_set_threads", am_mathv_set_threads},
 ]])
     for _, func in ipairs(func_defs) do
         f:write("        {\""..func.name.."\", am_mathv_"..func.name.."},\n")
@@ -2623,6 +2847,7 @@ void am_open_mathv_module(lua_State *L) {
         {NULL, NULL}
     };
     am_open_module(L, "mathv", vfuncs);
+    register_mathv_kernel_mt(L);
 }
 ]])
 end
@@ -2675,9 +2900,30 @@ function gen_cpp_file()
 
 ]])
     gen_funcs(f)
+    gen_op_table(f)
+    ind(f, 0, [[
+#include "am_mathv_compile.inc"
+
+]])
     gen_register_view_methods_func(f)
     gen_open_module_func(f)
     f:close()
 end
 
+local
+function gen_simd_kernels_file()
+    local f = io.open("src/am_mathv_simd_kernels.inc", "w")
+    ind(f, 0, [[
+// This file is generated by tools/gen_mathv.lua
+// AM_SIMD_KERNEL(kind, name, components, return components, expression)
+
+]])
+    for _, kernel in ipairs(simd_kernels) do
+        f:write("AM_SIMD_KERNEL("..kernel.kind..", "..kernel.name..", "..kernel.comps..", "..
+            kernel.ret_comps..", "..kernel.expr..")\n")
+    end
+    f:close()
+end
+
 gen_cpp_file()
+gen_simd_kernels_file()